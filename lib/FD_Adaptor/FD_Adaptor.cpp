@@ -0,0 +1,97 @@
+#include "FD_Adaptor.h"
+#include "rtos_trace.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+
+
+FD_Adaptor::~FD_Adaptor() {
+  deinit();
+  if (fd_ >= 0) {
+    close(fd_);
+  }
+}
+
+void FD_Adaptor::init() {
+  if (receiving_ || not open() || pipe(stop_) != 0) {
+    return;
+  }
+  // a closed PC end fails the write, it doesn't end the process
+  signal(SIGPIPE, SIG_IGN);
+  // the thread inherits the mask
+  sigset_t all, old;
+  sigfillset(&all);
+  pthread_sigmask(SIG_SETMASK, &all, &old);
+  receiving_ = pthread_create(&rx_thread_, nullptr, receive_thread, this) == 0;
+  pthread_sigmask(SIG_SETMASK, &old, nullptr);
+}
+
+void FD_Adaptor::deinit() {
+  if (not receiving_) {
+    return;
+  }
+  const uint8_t stop = 1;
+  while (write(stop_[1], &stop, 1) < 0 && errno == EINTR) {
+  }
+  pthread_join(rx_thread_, nullptr);
+  close(stop_[0]);
+  close(stop_[1]);
+  receiving_ = false;
+}
+
+void* FD_Adaptor::receive_thread(void* self) {
+  auto& link = *static_cast<FD_Adaptor*>(self);
+  uint8_t buff[MAX_CHUNK];
+  while (true) {
+    pollfd p[2] = { { link.fd_, POLLIN, 0 }, { link.stop_[0], POLLIN, 0 } };
+    if (poll(p, 2, -1) <= 0) {
+      continue;
+    }
+    if (p[1].revents) {
+      return nullptr;
+    }
+    const size_t max = link.chunk_ ? std::min(link.chunk_, sizeof(buff)) : sizeof(buff);
+    const ssize_t n = read(link.fd_, buff, max);
+    if (n > 0) {
+      // in the trace like the USB interrupt of the board
+      static const uint16_t marker = rtos_trace_marker("USB ISR");
+      rtos_trace_isr_enter(marker);
+      link.receive(buff, n);
+      rtos_trace_isr_exit(marker);
+    } else if (n == 0 || (errno != EAGAIN && errno != EINTR)) {
+      // the PC end is gone, until it's opened again
+      poll(p + 1, 1, WAIT_MS);
+      if (p[1].revents) {
+        return nullptr;
+      }
+    }
+  }
+}
+
+size_t FD_Adaptor::transmit(const void* buff, size_t sz) {
+  const auto* data = static_cast<const uint8_t*>(buff);
+  size_t sent = 0;
+  for (unsigned waits = 0; sent < sz && waits < MAX_WAITS;) {
+    const size_t len = chunk_ ? std::min(chunk_, sz - sent) : sz - sent;
+    const ssize_t n = write(fd_, data + sent, len);
+    if (n > 0) {
+      sent += n;
+      continue;
+    }
+    if (n < 0 && errno != EAGAIN && errno != EINTR) {
+      return 0;
+    }
+    if (sent == 0 && n < 0 && errno == EAGAIN) {
+      // busy, the caller tries again
+      return 0;
+    }
+    // part of it is out, the rest can't be taken back. If the PC stops reading, the rest is lost like on a pulled cable
+    pollfd p = { fd_, POLLOUT, 0 };
+    poll(&p, 1, WAIT_MS);
+    ++waits;
+  }
+  return sz;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "IHWMessage.h"
+#include <pthread.h>
+
+#ifdef TESTING
+void fd_adaptor_tests();
+#endif
+
+/// @brief Base of the links of host builds, an IHWMessage over a file descriptor
+/// @details A thread reads the descriptor and calls receive() from outside of FreeRTOS, like the USB interrupt does,
+/// with at most chunk() bytes at a time. It has every signal blocked, so the FreeRTOS POSIX port never runs a tick on
+/// it. transmit() writes chunk() bytes at a time, so the PC end sees the pieces the USB packets would make.
+class FD_Adaptor : public IHWMessage {
+public:
+  static inline constexpr size_t USB_PACKET_SZ = 64;  ///< CDC_DATA_FS_MAX_PACKET_SIZE
+  static inline constexpr size_t MAX_CHUNK = 4096;    ///< most bytes of a receive(), with a chunk of 0
+
+  ~FD_Adaptor() override;
+
+  /// @brief Open the descriptor if needed, and start receiving
+  void init() override;
+
+  /// @brief Write all of @p buff, or nothing if the PC end doesn't take any more bytes, like CDC_Transmit_FS()
+  size_t transmit(const void* buff, size_t sz) override;
+
+  bool status() const override {
+    return fd_ >= 0;
+  }
+
+  /// @brief Stop receiving, receive() isn't called after it returns
+  void deinit() override;
+
+  /// @brief Bytes of a receive() and of a write, 0 for as many as there are
+  void set_chunk(size_t sz) {
+    chunk_ = sz;
+  }
+
+  size_t chunk() const {
+    return chunk_;
+  }
+
+protected:
+  FD_Adaptor() = default;
+  FD_Adaptor(const FD_Adaptor&) = delete;
+  FD_Adaptor& operator=(const FD_Adaptor&) = delete;
+
+  /// @brief Open the device end into fd_, non-blocking
+  /// @return false on failure
+  virtual bool open() = 0;
+
+  int fd_ = -1;
+
+private:
+  static inline constexpr int WAIT_MS = 10;          ///< for the PC to read, in the middle of a transmit
+  static inline constexpr unsigned MAX_WAITS = 100;  ///< then the rest is dropped
+
+  static void* receive_thread(void* self);
+
+  size_t chunk_ = USB_PACKET_SZ;
+  int stop_[2] = { -1, -1 };  ///< pipe, wakes the receive thread to end it
+  pthread_t rx_thread_{};
+  bool receiving_ = false;
+};
@@ -0,0 +1,157 @@
+#ifdef TESTING
+  #include "FD_Adaptor.h"
+  #include "PTY_Adaptor.h"
+  #include "Socket_Adaptor.h"
+  #include "FreeRTOS.h"
+  #include "task.h"
+  #include "unity.h"
+  #include <algorithm>
+  #include <atomic>
+  #include <cerrno>
+  #include <cstring>
+  #include <fcntl.h>
+  #include <unistd.h>
+
+static constexpr size_t DATA_SZ = 1000;
+
+/// @brief What the receive thread passed to receive()
+static uint8_t received[DATA_SZ];
+static std::atomic<size_t> received_sz{ 0 };
+static std::atomic<size_t> largest_chunk{ 0 };
+static std::atomic<unsigned> calls{ 0 };
+
+static void on_receive(const void* buff, size_t sz) {
+  const size_t at = received_sz.load();
+  memcpy(received + at, buff, std::min(sz, DATA_SZ - at));
+  largest_chunk = std::max(largest_chunk.load(), sz);
+  ++calls;
+  received_sz = at + sz;
+}
+
+static void reset() {
+  received_sz = 0;
+  largest_chunk = 0;
+  calls = 0;
+}
+
+/// @brief Every byte value, line endings and control characters included
+static const uint8_t* data() {
+  static uint8_t d[DATA_SZ];
+  for (size_t i = 0; i < DATA_SZ; ++i) {
+    d[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+  }
+  return d;
+}
+
+/// @brief Wait up to a second for @p n bytes
+static bool wait_received(size_t n) {
+  for (int i = 0; i < 100 && received_sz < n; ++i) {
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  return received_sz == n;
+}
+
+/// @brief Read @p n bytes from the PC end
+static bool read_all(int fd, uint8_t* buff, size_t n) {
+  for (size_t done = 0; done < n;) {
+    const ssize_t r = read(fd, buff + done, n - done);
+    if (r < 0 && errno == EINTR) {
+      continue;
+    }
+    if (r <= 0) {
+      return false;
+    }
+    done += r;
+  }
+  return true;
+}
+
+/// @brief The PC sends, the device receives USB packets, then the other way
+static void round_trip(FD_Adaptor& link, int pc) {
+  reset();
+  link.set_receive_cb(on_receive);
+  link.init();
+  TEST_ASSERT_TRUE(link.status());
+
+  TEST_ASSERT_EQUAL(DATA_SZ, write(pc, data(), DATA_SZ));
+  TEST_ASSERT_TRUE(wait_received(DATA_SZ));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(data(), received, DATA_SZ);
+  TEST_ASSERT_LESS_OR_EQUAL(FD_Adaptor::USB_PACKET_SZ, largest_chunk.load());
+  TEST_ASSERT_GREATER_OR_EQUAL(DATA_SZ / FD_Adaptor::USB_PACKET_SZ, calls.load());
+
+  uint8_t out[DATA_SZ];
+  TEST_ASSERT_EQUAL(DATA_SZ, link.transmit(data(), DATA_SZ));
+  TEST_ASSERT_TRUE(read_all(pc, out, DATA_SZ));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(data(), out, DATA_SZ);
+  link.deinit();
+}
+
+void test_socket_round_trip() {
+  Socket_Adaptor link;
+  round_trip(link, link.peer());
+}
+
+void test_pty_round_trip() {
+  PTY_Adaptor link;
+  TEST_ASSERT_TRUE(link.open());
+  const int pc = open(link.path(), O_RDWR | O_NOCTTY);
+  TEST_ASSERT_GREATER_OR_EQUAL(0, pc);
+  round_trip(link, pc);
+  close(pc);
+}
+
+void test_whole_chunks() {
+  Socket_Adaptor link;
+  link.set_chunk(0);
+  reset();
+  link.set_receive_cb(on_receive);
+  link.init();
+
+  // one write, most likely one receive()
+  TEST_ASSERT_EQUAL(DATA_SZ, write(link.peer(), data(), DATA_SZ));
+  TEST_ASSERT_TRUE(wait_received(DATA_SZ));
+  TEST_ASSERT_GREATER_THAN(FD_Adaptor::USB_PACKET_SZ, largest_chunk.load());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(data(), received, DATA_SZ);
+}
+
+void test_pc_not_reading() {
+  Socket_Adaptor link;
+  link.init();
+
+  // the socket buffer fills up, then the link is busy
+  size_t sent = 0;
+  while (link.transmit(data(), DATA_SZ) == DATA_SZ) {
+    sent += DATA_SZ;
+    TEST_ASSERT_LESS_THAN(16 * 1024 * 1024, sent);
+  }
+  TEST_ASSERT_EQUAL(0, link.transmit(data(), 1));
+}
+
+void test_pc_gone() {
+  Socket_Adaptor link;
+  link.init();
+  close(link.peer());
+  TEST_ASSERT_EQUAL(0, link.transmit(data(), DATA_SZ));
+}
+
+void test_deinit() {
+  Socket_Adaptor link;
+  reset();
+  link.set_receive_cb(on_receive);
+  link.init();
+  link.deinit();
+  TEST_ASSERT_EQUAL(DATA_SZ, write(link.peer(), data(), DATA_SZ));
+  vTaskDelay(pdMS_TO_TICKS(50));
+  TEST_ASSERT_EQUAL(0, calls.load());
+}
+
+void fd_adaptor_tests() {
+  RUN_TEST(test_socket_round_trip);
+  RUN_TEST(test_pty_round_trip);
+  RUN_TEST(test_whole_chunks);
+  RUN_TEST(test_pc_not_reading);
+  RUN_TEST(test_pc_gone);
+  RUN_TEST(test_deinit);
+}
+
+#endif
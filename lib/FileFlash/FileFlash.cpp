@@ -0,0 +1,95 @@
+#include "FileFlash.h"
+#include <algorithm>
+#include <cstring>
+
+FileFlash::FileFlash(const char* path, size_t sectors, size_t sector_size)
+    : sectors_(sectors), sector_size_(sector_size), mem_(sectors * sector_size, 0xFF) {
+  if (not path) {
+    return;
+  }
+  // keep what a previous instance wrote, if the geometry is the same
+  if ((file_ = fopen(path, "r+b"))) {
+    if (mem_.size() != fread(mem_.data(), 1, mem_.size(), file_)) {
+      std::fill(mem_.begin(), mem_.end(), 0xFF);
+      sync(0, mem_.size());
+    }
+  } else if ((file_ = fopen(path, "w+b"))) {
+    sync(0, mem_.size());
+  }
+}
+
+FileFlash::~FileFlash() {
+  if (file_) {
+    fclose(file_);
+  }
+}
+
+size_t FileFlash::spend(size_t n) {
+  if (not powered_) {
+    return 0;
+  }
+  if (not cut_) {
+    return n;
+  }
+  const size_t done = std::min(n, budget_);
+  budget_ -= done;
+  if (done < n) {
+    powered_ = false;
+  }
+  return done;
+}
+
+void FileFlash::sync(size_t from, size_t n) {
+  if (not file_) {
+    return;
+  }
+  fseek(file_, from, SEEK_SET);
+  fwrite(mem_.data() + from, 1, n, file_);
+  fflush(file_);
+}
+
+bool FileFlash::erase(size_t sector) {
+  if (sector >= sectors_ || not powered_) {
+    return false;
+  }
+  const size_t base = sector * sector_size_;
+  const size_t done = spend(sector_size_);
+  std::fill_n(mem_.begin() + base, done, 0xFF);
+  sync(base, sector_size_);
+  ++erases_;
+  return done == sector_size_;
+}
+
+bool FileFlash::program(size_t sector, size_t offset, const void* data, size_t sz) {
+  if (sector >= sectors_ || offset % ALIGN || offset + sz > sector_size_ || not powered_) {
+    return false;
+  }
+  const size_t base = sector * sector_size_ + offset;
+  const auto* src = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < sz; ++i) {
+    if ((mem_[base + i] & src[i]) != src[i]) {
+      // would set a bit, the byte wasn't erased
+      return false;
+    }
+  }
+
+  const size_t done = spend(sz);
+  for (size_t i = 0; i < done; ++i) {
+    mem_[base + i] = src[i];
+  }
+  if (done < sz) {
+    // the byte at the cut is half programmed
+    mem_[base + done] &= src[done] | 0xF0;
+  }
+  sync(base, sz);
+  programmed_ += done;
+  return done == sz;
+}
+
+bool FileFlash::read(size_t sector, size_t offset, void* buff, size_t sz) const {
+  if (sector >= sectors_ || offset + sz > sector_size_) {
+    return false;
+  }
+  memcpy(buff, mem_.data() + sector * sector_size_ + offset, sz);
+  return true;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "IFlash.h"
+#include <cstdio>
+#include <vector>
+
+/// @brief Flash in RAM, written through to a file, stands in for the internal flash in host builds and tests
+/// @details Like NOR flash, programming fails if it would set a bit, which isn't erased. A new instance on the same file
+/// sees what the previous one wrote, like the board after a reboot. The power can be cut in the middle of a write.
+class FileFlash : public IFlash {
+public:
+  /// @param path backing file, created if it doesn't exist. If nullptr, the flash is only in RAM
+  FileFlash(const char* path, size_t sectors, size_t sector_size);
+  ~FileFlash() override;
+  FileFlash(const FileFlash&) = delete;
+  FileFlash& operator=(const FileFlash&) = delete;
+
+  size_t sector_count() const override {
+    return sectors_;
+  }
+
+  size_t sector_size() const override {
+    return sector_size_;
+  }
+
+  bool erase(size_t sector) override;
+
+  bool program(size_t sector, size_t offset, const void* data, size_t sz) override;
+
+  bool read(size_t sector, size_t offset, void* buff, size_t sz) const override;
+
+  /// @brief Lose power after @p bytes more bytes are erased or programmed
+  /// @details The write in progress stops there, the byte at the cut only gets some of its bits. Every erase and
+  /// program fails after that, until restore_power()
+  void cut_power_after(size_t bytes) {
+    budget_ = bytes;
+    cut_ = true;
+  }
+
+  /// @brief Power is back, like after a reboot
+  void restore_power() {
+    cut_ = false;
+    powered_ = true;
+  }
+
+  /// @brief false after the power was cut
+  bool powered() const {
+    return powered_;
+  }
+
+  /// @brief Number of sectors erased
+  uint32_t erases() const {
+    return erases_;
+  }
+
+  /// @brief Number of bytes programmed
+  uint32_t programmed() const {
+    return programmed_;
+  }
+
+private:
+  /// @brief Take @p n bytes from the power budget
+  /// @return how many of them are written before the power is lost
+  size_t spend(size_t n);
+
+  /// @brief Write bytes of memory to the file
+  void sync(size_t from, size_t n);
+
+  const size_t sectors_;
+  const size_t sector_size_;
+  std::vector<uint8_t> mem_;
+  FILE* file_ = nullptr;
+  size_t budget_ = 0;
+  bool cut_ = false;
+  bool powered_ = true;
+  uint32_t erases_ = 0;
+  uint32_t programmed_ = 0;
+};
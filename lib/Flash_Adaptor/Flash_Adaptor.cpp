@@ -0,0 +1,51 @@
+#include "Flash_Adaptor.h"
+#include "STHAL.h"
+#include <cstring>
+
+bool Flash_Adaptor::erase(size_t sector) {
+  if (sector >= SECTORS) {
+    return false;
+  }
+  FLASH_EraseInitTypeDef erase{};
+  erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase.Sector = FLASH_SECTOR_6 + sector;
+  erase.NbSectors = 1;
+  erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+  uint32_t bad_sector = 0;
+
+  HAL_FLASH_Unlock();
+  const bool ok = HAL_OK == HAL_FLASHEx_Erase(&erase, &bad_sector);
+  HAL_FLASH_Lock();
+  return ok;
+}
+
+bool Flash_Adaptor::program(size_t sector, size_t offset, const void* data, size_t sz) {
+  if (sector >= SECTORS || offset % ALIGN || offset + sz > SECTOR_SZ) {
+    return false;
+  }
+  uint32_t addr = BASE + sector * SECTOR_SZ + offset;
+  const auto* src = static_cast<const uint8_t*>(data);
+
+  HAL_FLASH_Unlock();
+  bool ok = true;
+  // words while they fit, 2.7 V and up allows 32 bit programming
+  for (; ok && sz >= sizeof(uint32_t); addr += sizeof(uint32_t), src += sizeof(uint32_t), sz -= sizeof(uint32_t)) {
+    uint32_t word;
+    memcpy(&word, src, sizeof(word));
+    ok = HAL_OK == HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, addr, word);
+  }
+  for (; ok && sz; ++addr, ++src, --sz) {
+    ok = HAL_OK == HAL_FLASH_Program(FLASH_TYPEPROGRAM_BYTE, addr, *src);
+  }
+  HAL_FLASH_Lock();
+  return ok;
+}
+
+bool Flash_Adaptor::read(size_t sector, size_t offset, void* buff, size_t sz) const {
+  if (sector >= SECTORS || offset + sz > SECTOR_SZ) {
+    return false;
+  }
+  // the flash is memory mapped
+  memcpy(buff, reinterpret_cast<const void*>(BASE + sector * SECTOR_SZ + offset), sz);
+  return true;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "IFlash.h"
+
+/// @brief The last two 128 KB sectors of the internal flash, 6 and 7 at 0x08040000
+/// @details The firmware is limited to the sectors below them in platformio.ini. The flash has one bank, so the CPU
+/// stalls while it's erased or programmed. Erasing a sector takes 1-2 s.
+class Flash_Adaptor : public IFlash {
+public:
+  size_t sector_count() const override {
+    return SECTORS;
+  }
+
+  size_t sector_size() const override {
+    return SECTOR_SZ;
+  }
+
+  bool erase(size_t sector) override;
+
+  bool program(size_t sector, size_t offset, const void* data, size_t sz) override;
+
+  bool read(size_t sector, size_t offset, void* buff, size_t sz) const override;
+
+  static Flash_Adaptor& get_instance() {
+    static Flash_Adaptor f;
+    return f;
+  }
+
+private:
+  Flash_Adaptor() = default;
+  Flash_Adaptor(const Flash_Adaptor&) = delete;
+  Flash_Adaptor& operator=(const Flash_Adaptor&) = delete;
+
+  static inline constexpr size_t SECTORS = 2;
+  static inline constexpr size_t SECTOR_SZ = 128 * 1024;
+  static inline constexpr uint32_t BASE = 0x08040000;  ///< address of sector 6
+};
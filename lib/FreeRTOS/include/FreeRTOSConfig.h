@@ -35,7 +35,7 @@ extern uint32_t SystemCoreClock;
 /* Memory allocation related definitions. */
 #define configSUPPORT_STATIC_ALLOCATION           0
 #define configSUPPORT_DYNAMIC_ALLOCATION          1
-#define configTOTAL_HEAP_SIZE                     ((size_t)50000)
+#define configTOTAL_HEAP_SIZE                     ((size_t)80000) /* GUI strip pixmap needs 25 KB */
 #define configAPPLICATION_ALLOCATED_HEAP          0
 #define configSTACK_ALLOCATION_FROM_SEPARATE_HEAP 0
 
@@ -47,10 +47,33 @@ extern uint32_t SystemCoreClock;
 #define configUSE_DAEMON_TASK_STARTUP_HOOK 0
 
 /* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS        0
+#define configGENERATE_RUN_TIME_STATS        1
+#define configRUN_TIME_COUNTER_TYPE          uint64_t /* cycles, 32 bits wrap in 25 s */
 #define configUSE_TRACE_FACILITY             1
 #define configUSE_STATS_FORMATTING_FUNCTIONS 0
 
+/* The DWT cycle counter on the board, the monotonic clock in ns on the host, see port/run_time_clock.c */
+#ifdef __cplusplus
+extern "C" {
+#endif
+void vRunTimeClockInit(void);
+uint64_t ullRunTimeClock(void);
+uint32_t ulRunTimeClockHz(void);
+#ifdef __cplusplus
+}
+#endif
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() vRunTimeClockInit()
+#define portGET_RUN_TIME_COUNTER_VALUE()         ullRunTimeClock()
+#ifndef NATIVE
+  /* a task may run longer than the cycle counter takes to wrap */
+  #define traceTASK_INCREMENT_TICK(xTickCount) ((void)ullRunTimeClock())
+#endif
+
+/* Task switches, queues, semaphores and notifications are recorded by lib/rtos_trace */
+#ifdef RTOS_TRACE
+  #include "rtos_trace_hooks.h"
+#endif
+
 /* Co-routine related definitions. */
 #define configUSE_CO_ROUTINES           0
 #define configMAX_CO_ROUTINE_PRIORITIES 1
@@ -101,7 +124,7 @@ void assert_failed(uint8_t*, uint32_t);
 #define INCLUDE_xTaskGetSchedulerState      1
 #define INCLUDE_xTaskGetCurrentTaskHandle   1
 #define INCLUDE_uxTaskGetStackHighWaterMark 1
-#define INCLUDE_xTaskGetIdleTaskHandle      0
+#define INCLUDE_xTaskGetIdleTaskHandle      1
 #define INCLUDE_eTaskGetState               1
 #define INCLUDE_xEventGroupSetBitFromISR    1
 #define INCLUDE_xTimerPendFunctionCall      0
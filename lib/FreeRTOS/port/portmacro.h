@@ -0,0 +1,15 @@
+/* Selects the port: ARM_CM4F on the board, the POSIX port in host builds (env:native) */
+#ifdef NATIVE
+  /* the POSIX port counts the user time of the process in ticks, FreeRTOSConfig.h sets a finer run time clock */
+  #pragma push_macro("portCONFIGURE_TIMER_FOR_RUN_TIME_STATS")
+  #pragma push_macro("portGET_RUN_TIME_COUNTER_VALUE")
+  #undef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+  #undef portGET_RUN_TIME_COUNTER_VALUE
+  #include "../Source/portable/ThirdParty/GCC/Posix/portmacro.h"
+  #undef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+  #undef portGET_RUN_TIME_COUNTER_VALUE
+  #pragma pop_macro("portCONFIGURE_TIMER_FOR_RUN_TIME_STATS")
+  #pragma pop_macro("portGET_RUN_TIME_COUNTER_VALUE")
+#else
+  #include "../Source/portable/GCC/ARM_CM4F/portmacro.h"
+#endif
@@ -0,0 +1,61 @@
+/* The clock of the run time stats: the DWT cycle counter on the board, the monotonic clock on the host (env:native).
+ * See configGENERATE_RUN_TIME_STATS in FreeRTOSConfig.h */
+#include "FreeRTOS.h"
+
+#ifdef NATIVE
+  #include <time.h>
+
+static uint64_t ullStartNs = 0;
+
+static uint64_t prvMonotonicNs(void) {
+  struct timespec xNow;
+  clock_gettime(CLOCK_MONOTONIC, &xNow);
+  return (uint64_t)xNow.tv_sec * 1000000000ULL + (uint64_t)xNow.tv_nsec;
+}
+
+void vRunTimeClockInit(void) {
+  ullStartNs = prvMonotonicNs();
+}
+
+uint64_t ullRunTimeClock(void) {
+  return prvMonotonicNs() - ullStartNs;
+}
+
+uint32_t ulRunTimeClockHz(void) {
+  return 1000000000UL;
+}
+
+#else
+  #define DEMCR           (*(volatile uint32_t*)0xE000EDFCUL)
+  #define DEMCR_TRCENA    (1UL << 24)
+  #define DWT_CTRL        (*(volatile uint32_t*)0xE0001000UL)
+  #define DWT_CTRL_CYCENA (1UL << 0)
+  #define DWT_CYCCNT      (*(volatile uint32_t*)0xE0001004UL)
+
+static uint32_t ulLastCycles = 0;
+static uint32_t ulWraps = 0;
+
+void vRunTimeClockInit(void) {
+  DEMCR |= DEMCR_TRCENA;
+  DWT_CTRL |= DWT_CTRL_CYCENA;
+  ulLastCycles = DWT_CYCCNT;
+}
+
+/* Called at each context switch, each tick and by uxTaskGetSystemState(), so the 32 bit counter is read more often
+ * than it wraps, every 25 s at 168 MHz. The tick may interrupt a task reading it, hence the mask */
+uint64_t ullRunTimeClock(void) {
+  const UBaseType_t uxMask = portSET_INTERRUPT_MASK_FROM_ISR();
+  const uint32_t ulCycles = DWT_CYCCNT;
+  if (ulCycles < ulLastCycles) {
+    ++ulWraps;
+  }
+  ulLastCycles = ulCycles;
+  const uint64_t ullNow = ((uint64_t)ulWraps << 32) | ulCycles;
+  portCLEAR_INTERRUPT_MASK_FROM_ISR(uxMask);
+  return ullNow;
+}
+
+uint32_t ulRunTimeClockHz(void) {
+  return SystemCoreClock;
+}
+#endif
@@ -0,0 +1,13 @@
+# Builds the port matching the platform: ARM_CM4F on the board, the POSIX port in host builds (env:native).
+# The headers are selected by port/portmacro.h
+Import("env")
+
+if env["PIOPLATFORM"] == "native":
+    port = "Source/portable/ThirdParty/GCC/Posix"
+    env.Replace(SRC_FILTER=[
+        "+<Source/*.c>",
+        "+<%s/*.c>" % port,
+        "+<%s/utils/*.c>" % port,
+        "+<Source/portable/MemMang/heap_3.c>",  # malloc, the host has no fixed heap
+        "+<port/*.c>",
+    ])
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+/// @brief Interface for flash memory, which keeps data across reboots (internal flash, SPI flash ...)
+/// @details The memory is split into sectors of equal size. An erased sector reads 0xFF, programming only clears bits,
+/// and each byte is programmed at most once between erases.
+class IFlash {
+public:
+  static inline constexpr size_t ALIGN = 4;  ///< offset of program() is a multiple of this
+
+  /// @brief Number of sectors
+  virtual size_t sector_count() const = 0;
+
+  /// @brief Size of each sector in bytes
+  virtual size_t sector_size() const = 0;
+
+  /// @brief Set the whole sector to 0xFF
+  /// @return true on success
+  virtual bool erase(size_t sector) = 0;
+
+  /// @brief Write into erased bytes of a sector
+  /// @param offset from the start of @p sector, aligned to ALIGN
+  /// @return true on success
+  virtual bool program(size_t sector, size_t offset, const void* data, size_t sz) = 0;
+
+  /// @brief Read from a sector
+  /// @return true on success
+  virtual bool read(size_t sector, size_t offset, void* buff, size_t sz) const = 0;
+
+  virtual ~IFlash() = default;
+};
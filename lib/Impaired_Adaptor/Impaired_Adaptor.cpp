@@ -0,0 +1,168 @@
+#include "Impaired_Adaptor.h"
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <unistd.h>
+
+
+Impaired_Adaptor::~Impaired_Adaptor() {
+  deinit();
+}
+
+uint64_t Impaired_Adaptor::now_us() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+void Impaired_Adaptor::init() {
+  if (running_ || active_) {
+    return;
+  }
+  active_ = this;
+  for (int dir = 0; dir < DIRECTIONS; ++dir) {
+    // mixed, close seeds start far apart. xorshift never leaves 0
+    uint32_t state = (imp_.seed + dir) * 0x9E3779B9;
+    state = (state ^ (state >> 16)) * 0x85EBCA6B;
+    state ^= state >> 13;
+    random_[dir].state = state ? state : 1;
+    link_free_us_[dir] = last_due_us_[dir] = 0;
+    queue_[dir].clear();
+  }
+  stats_ = {};
+  stop_ = false;
+  inner_.set_receive_cb(from_inner);
+  inner_.init();
+
+  // the thread inherits the mask, the ticks of FreeRTOS stay on the tasks
+  sigset_t all, old;
+  sigfillset(&all);
+  pthread_sigmask(SIG_SETMASK, &all, &old);
+  running_ = pthread_create(&thread_, nullptr, delivery_thread, this) == 0;
+  pthread_sigmask(SIG_SETMASK, &old, nullptr);
+  if (not running_) {
+    active_ = nullptr;
+  }
+}
+
+void Impaired_Adaptor::deinit() {
+  if (not running_) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    stop_ = true;
+  }
+  changed_.notify_one();
+  pthread_join(thread_, nullptr);
+  running_ = false;
+  inner_.deinit();
+  active_ = nullptr;
+}
+
+Impaired_Adaptor::Stats Impaired_Adaptor::stats() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return stats_;
+}
+
+void Impaired_Adaptor::schedule(Direction dir, const uint8_t* data, size_t sz, uint64_t now) {
+  Random& random = random_[dir];
+  stats_.bytes += sz;
+  const size_t fragment = imp_.fragment ? imp_.fragment : sz;
+  for (size_t pos = 0; pos < sz; pos += fragment) {
+    const size_t len = std::min(fragment, sz - pos);
+    Piece piece{ 0, {} };
+    piece.data.reserve(len);
+    for (size_t i = pos; i < pos + len; ++i) {
+      if (random.chance_ppm(imp_.drop_ppm)) {
+        ++stats_.dropped;
+        continue;
+      }
+      uint8_t b = data[i];
+      if (random.chance_ppm(imp_.flip_ppm)) {
+        b ^= 1 << (random() % 8);
+        ++stats_.flipped;
+      }
+      piece.data.push_back(b);
+    }
+
+    // on the wire after the previous bytes, then delayed. A later piece never overtakes an earlier one
+    const uint64_t start = std::max(now, link_free_us_[dir]);
+    link_free_us_[dir] = start + (imp_.bytes_per_s ? uint64_t(len) * 1000000 / imp_.bytes_per_s : 0);
+    const uint32_t jitter = imp_.jitter_us ? random() % (imp_.jitter_us + 1) : 0;
+    piece.due_us = std::max(link_free_us_[dir] + imp_.latency_us + jitter, last_due_us_[dir]);
+    last_due_us_[dir] = piece.due_us;
+    if (not piece.data.empty()) {
+      queue_[dir].push_back(std::move(piece));
+    }
+  }
+}
+
+size_t Impaired_Adaptor::transmit(const void* buff, size_t sz) {
+  if (not running_) {
+    return 0;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    const uint64_t now = now_us();
+    if (link_free_us_[TO_PC] > now) {
+      ++stats_.busy;
+      return 0;
+    }
+    schedule(TO_PC, static_cast<const uint8_t*>(buff), sz, now);
+  }
+  changed_.notify_one();
+  return sz;
+}
+
+void Impaired_Adaptor::from_inner(const void* buff, size_t sz) {
+  Impaired_Adaptor* self = active_;
+  if (not self) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(self->mtx_);
+    self->schedule(TO_DEVICE, static_cast<const uint8_t*>(buff), sz, now_us());
+  }
+  self->changed_.notify_one();
+}
+
+void* Impaired_Adaptor::delivery_thread(void* self) {
+  static_cast<Impaired_Adaptor*>(self)->deliver();
+  return nullptr;
+}
+
+void Impaired_Adaptor::deliver() {
+  std::unique_lock<std::mutex> lock(mtx_);
+  while (not stop_) {
+    // the next piece due, of either direction
+    int next = -1;
+    for (int dir = 0; dir < DIRECTIONS; ++dir) {
+      if (not queue_[dir].empty() && (next < 0 || queue_[dir].front().due_us < queue_[next].front().due_us)) {
+        next = dir;
+      }
+    }
+    if (next < 0) {
+      changed_.wait(lock);
+      continue;
+    }
+    const uint64_t due = queue_[next].front().due_us;
+    const uint64_t now = now_us();
+    if (due > now) {
+      changed_.wait_for(lock, std::chrono::microseconds(due - now));
+      continue;
+    }
+    Piece piece = std::move(queue_[next].front());
+    queue_[next].pop_front();
+
+    lock.unlock();
+    if (next == TO_DEVICE) {
+      receive(piece.data.data(), piece.data.size());
+    } else {
+      // the PC isn't reading, like a full USB buffer
+      while (inner_.transmit(piece.data.data(), piece.data.size()) == 0 && not stop_) {
+        usleep(1000);
+      }
+    }
+    lock.lock();
+  }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "IHWMessage.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <pthread.h>
+#include <vector>
+
+#ifdef TESTING
+void impaired_adaptor_tests();
+#endif
+
+/// @brief Makes an inner link as bad as a cheap USB hub or a busy PC, in host builds
+/// @details Both directions are delayed by a thread, which hands the bytes on when they are due: receive() from outside
+/// of FreeRTOS like the CDC interrupt, and the inner transmit() towards the PC. The bytes stay in order, jitter only
+/// spreads them out. With a bandwidth cap, transmit() is busy until the previous write is on the wire, like
+/// CDC_Transmit_FS().
+///
+/// Each direction has its own random generator, seeded from Impairments::seed, so the same bytes are dropped and
+/// flipped in every run. Only one instance can be initialized at a time, the inner link calls back without a context.
+class Impaired_Adaptor : public IHWMessage {
+public:
+  struct Impairments {
+    uint32_t latency_us = 0;   ///< one way
+    uint32_t jitter_us = 0;    ///< up to this much more, at random
+    uint32_t bytes_per_s = 0;  ///< each way, 0 for no cap
+    size_t fragment = 0;       ///< most bytes handed on at once, 0 for as they come
+    uint32_t drop_ppm = 0;     ///< bytes lost, per million
+    uint32_t flip_ppm = 0;     ///< bytes with one bit flipped, per million
+    uint32_t seed = 1;
+  };
+
+  /// @brief What happened to the bytes, in both directions
+  struct Stats {
+    uint32_t bytes = 0;    ///< handed to the link
+    uint32_t dropped = 0;
+    uint32_t flipped = 0;
+    uint32_t busy = 0;     ///< transmits refused, because of the bandwidth cap
+  };
+
+  Impaired_Adaptor(IHWMessage& inner, const Impairments& impairments) : inner_(inner), imp_(impairments) {
+  }
+  ~Impaired_Adaptor() override;
+  Impaired_Adaptor(const Impaired_Adaptor&) = delete;
+  Impaired_Adaptor& operator=(const Impaired_Adaptor&) = delete;
+
+  /// @brief Initialize the inner link, and start handing on
+  void init() override;
+
+  /// @brief Queue @p buff towards the PC
+  /// @return @p sz, 0 while the bandwidth cap doesn't allow it
+  size_t transmit(const void* buff, size_t sz) override;
+
+  bool status() const override {
+    return inner_.status();
+  }
+
+  /// @brief Stop handing on, the queued bytes are lost. Deinitializes the inner link
+  void deinit() override;
+
+  Stats stats() const;
+
+private:
+  enum Direction { TO_PC, TO_DEVICE, DIRECTIONS };
+
+  /// @brief Bytes, which are handed on at due_us
+  struct Piece {
+    uint64_t due_us;
+    std::vector<uint8_t> data;
+  };
+
+  /// @brief xorshift32, the same sequence on every host
+  struct Random {
+    uint32_t state;
+    uint32_t operator()() {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      return state;
+    }
+    bool chance_ppm(uint32_t ppm) {
+      return ppm && (*this)() % 1000000 < ppm;
+    }
+  };
+
+  static uint64_t now_us();
+
+  /// @brief Impair @p sz bytes and queue them, called with mtx_ held
+  void schedule(Direction dir, const uint8_t* data, size_t sz, uint64_t now);
+
+  static void from_inner(const void* buff, size_t sz);
+  static void* delivery_thread(void* self);
+  void deliver();
+
+  static inline Impaired_Adaptor* active_ = nullptr;  ///< receives from the inner link
+
+  IHWMessage& inner_;
+  const Impairments imp_;
+  mutable std::mutex mtx_;
+  std::condition_variable changed_;
+  std::deque<Piece> queue_[DIRECTIONS];
+  Random random_[DIRECTIONS]{};
+  uint64_t link_free_us_[DIRECTIONS] = { 0, 0 };  ///< the previous bytes are on the wire until then
+  uint64_t last_due_us_[DIRECTIONS] = { 0, 0 };
+  Stats stats_;
+  pthread_t thread_{};
+  bool running_ = false;
+  std::atomic<bool> stop_{ false };
+};
@@ -0,0 +1,144 @@
+#ifdef TESTING
+  #include "Impaired_Adaptor.h"
+  #include "Socket_Adaptor.h"
+  #include "bench.h"
+  #include "FreeRTOS.h"
+  #include "task.h"
+  #include "unity.h"
+  #include <algorithm>
+  #include <atomic>
+  #include <cerrno>
+  #include <cstring>
+  #include <poll.h>
+  #include <unistd.h>
+
+static constexpr size_t DATA_SZ = 1000;
+
+/// @brief What reached the device
+static uint8_t received[DATA_SZ];
+static std::atomic<size_t> received_sz{ 0 };
+static std::atomic<size_t> largest_piece{ 0 };
+
+static void on_receive(const void* buff, size_t sz) {
+  const size_t at = received_sz.load();
+  memcpy(received + at, buff, std::min(sz, DATA_SZ - at));
+  largest_piece = std::max(largest_piece.load(), sz);
+  received_sz = at + sz;
+}
+
+static const uint8_t* data() {
+  static uint8_t d[DATA_SZ];
+  for (size_t i = 0; i < DATA_SZ; ++i) {
+    d[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+  }
+  return d;
+}
+
+/// @brief Wait up to a second for the PC end to be readable, the ticks of FreeRTOS interrupt poll()
+static bool pc_readable(int fd) {
+  pollfd p = { fd, POLLIN, 0 };
+  for (bench::Stopwatch sw; sw.us() < 1000000;) {
+    if (poll(&p, 1, 10) > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// @brief Send the data from the PC, return the bytes the device got after @p settle_ms
+static size_t pc_to_device(const Impaired_Adaptor::Impairments& impairments, unsigned settle_ms = 100) {
+  received_sz = 0;
+  largest_piece = 0;
+  Socket_Adaptor socket;
+  Impaired_Adaptor link(socket, impairments);
+  link.set_receive_cb(on_receive);
+  link.init();
+  // small writes, so the pieces don't depend on how the receive thread reads
+  for (size_t pos = 0; pos < DATA_SZ; pos += 10) {
+    TEST_ASSERT_EQUAL(10, write(socket.peer(), data() + pos, 10));
+  }
+  vTaskDelay(pdMS_TO_TICKS(settle_ms));
+  link.deinit();
+  return received_sz;
+}
+
+void test_impaired_in_order() {
+  Impaired_Adaptor::Impairments imp;
+  imp.latency_us = 1000;
+  imp.jitter_us = 5000;
+  imp.fragment = 3;
+  TEST_ASSERT_EQUAL(DATA_SZ, pc_to_device(imp));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(data(), received, DATA_SZ);
+  TEST_ASSERT_LESS_OR_EQUAL(3, largest_piece.load());
+}
+
+void test_impaired_seeded() {
+  Impaired_Adaptor::Impairments imp;
+  imp.drop_ppm = 20000;
+  imp.flip_ppm = 20000;
+  imp.seed = 5;
+
+  const size_t first_sz = pc_to_device(imp);
+  static uint8_t first[DATA_SZ];
+  memcpy(first, received, first_sz);
+  TEST_ASSERT_LESS_THAN(DATA_SZ, first_sz);
+  TEST_ASSERT_GREATER_THAN(DATA_SZ * 9 / 10, first_sz);
+
+  // the same bytes are lost and flipped again
+  TEST_ASSERT_EQUAL(first_sz, pc_to_device(imp));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(first, received, first_sz);
+
+  imp.seed = 6;
+  const size_t other_sz = pc_to_device(imp);
+  TEST_ASSERT_TRUE(other_sz != first_sz || 0 != memcmp(first, received, first_sz));
+}
+
+void test_impaired_latency() {
+  Impaired_Adaptor::Impairments imp;
+  imp.latency_us = 30000;
+  Socket_Adaptor socket;
+  Impaired_Adaptor link(socket, imp);
+  link.init();
+
+  bench::Stopwatch sw;
+  TEST_ASSERT_EQUAL(DATA_SZ, link.transmit(data(), DATA_SZ));
+  TEST_ASSERT_TRUE(pc_readable(socket.peer()));
+  TEST_ASSERT_GREATER_OR_EQUAL(30000, sw.us());
+  link.deinit();
+}
+
+void test_impaired_bandwidth() {
+  Impaired_Adaptor::Impairments imp;
+  imp.bytes_per_s = 10000;
+  Socket_Adaptor socket;
+  Impaired_Adaptor link(socket, imp);
+  link.init();
+
+  // 100 ms on the wire, busy until then like the CDC
+  bench::Stopwatch sw;
+  TEST_ASSERT_EQUAL(DATA_SZ, link.transmit(data(), DATA_SZ));
+  TEST_ASSERT_EQUAL(0, link.transmit(data(), DATA_SZ));
+  TEST_ASSERT_EQUAL(1, link.stats().busy);
+
+  static uint8_t pc[DATA_SZ];
+  size_t got = 0;
+  while (got < DATA_SZ) {
+    TEST_ASSERT_TRUE(pc_readable(socket.peer()));
+    const ssize_t r = read(socket.peer(), pc + got, DATA_SZ - got);
+    TEST_ASSERT_TRUE(r > 0 || errno == EINTR);
+    got += r > 0 ? r : 0;
+  }
+  TEST_ASSERT_GREATER_OR_EQUAL(100000, sw.us());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(data(), pc, DATA_SZ);
+  TEST_ASSERT_EQUAL(DATA_SZ, link.transmit(data(), DATA_SZ));
+  link.deinit();
+}
+
+void impaired_adaptor_tests() {
+  RUN_TEST(test_impaired_in_order);
+  RUN_TEST(test_impaired_seeded);
+  RUN_TEST(test_impaired_latency);
+  RUN_TEST(test_impaired_bandwidth);
+}
+
+#endif
@@ -0,0 +1,39 @@
+#include "PTY_Adaptor.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+
+PTY_Adaptor::~PTY_Adaptor() {
+  deinit();
+  if (slave_ >= 0) {
+    close(slave_);
+  }
+}
+
+bool PTY_Adaptor::open() {
+  if (fd_ >= 0) {
+    return true;
+  }
+  const int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0 || ptsname_r(master, path_, sizeof(path_)) != 0) {
+    if (master >= 0) {
+      close(master);
+    }
+    path_[0] = '\0';
+    return false;
+  }
+  slave_ = ::open(path_, O_RDWR | O_NOCTTY);
+
+  // bytes, no echo and no line editing, like the virtual COM port
+  termios tio;
+  if (slave_ >= 0 && tcgetattr(slave_, &tio) == 0) {
+    cfmakeraw(&tio);
+    tcsetattr(slave_, TCSANOW, &tio);
+  }
+  // a PC, which doesn't read, mustn't block the uart task
+  fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+  fd_ = master;
+  return true;
+}
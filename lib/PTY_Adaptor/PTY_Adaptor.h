@@ -0,0 +1,30 @@
+#pragma once
+
+#include "FD_Adaptor.h"
+
+/// @brief Pseudo-terminal wrapper to be used in the communicator class, in place of the USB CDC in host builds
+/// @details The device end is the master side. The PC stand-in opens path(), like the virtual COM port of the board.
+class PTY_Adaptor : public FD_Adaptor {
+public:
+  PTY_Adaptor() = default;
+  ~PTY_Adaptor() override;
+
+  /// @brief Create the pseudo-terminal, init() does it too
+  /// @return false if it can't be created
+  bool open() override;
+
+  /// @brief Path of the PC end, like /dev/pts/3, empty if it isn't open
+  const char* path() const {
+    return path_;
+  }
+
+  /// @brief The link of the simulator
+  static PTY_Adaptor& get_instance() {
+    static PTY_Adaptor p;
+    return p;
+  }
+
+private:
+  int slave_ = -1;  ///< kept open, so reading the master doesn't fail while the PC end is closed
+  char path_[64] = { 0 };
+};
@@ -1,5 +1,6 @@
 #include "STHAL.h"
 #include "stm32f4xx_it.h"
+#include "rtos_trace.h"
 
 
 /******************************************************************************/
@@ -69,7 +70,19 @@ void TIM7_IRQHandler(void) {
 
 void OTG_FS_IRQHandler(void) {
   extern PCD_HandleTypeDef hpcd_USB_OTG_FS;
+  static uint16_t marker = 0;
+  if (!marker) {
+    marker = rtos_trace_marker("USB ISR");
+  }
+  rtos_trace_isr_enter(marker);
   HAL_PCD_IRQHandler(&hpcd_USB_OTG_FS);
+  rtos_trace_isr_exit(marker);
+}
+
+
+/// touch panel pen down, T_PEN is PC5
+void EXTI9_5_IRQHandler(void) {
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_5);
 }
 
 
@@ -111,7 +124,6 @@ void CAN1_TX_IRQHandler(void) { while(1) {} }
 void CAN1_RX0_IRQHandler(void) { while(1) {} }
 void CAN1_RX1_IRQHandler(void) { while(1) {} }
 void CAN1_SCE_IRQHandler(void) { while(1) {} }
-void EXTI9_5_IRQHandler(void) { while(1) {} }
 void TIM1_BRK_TIM9_IRQHandler(void) { while(1) {} }
 void TIM1_UP_TIM10_IRQHandler(void) { while(1) {} }
 void TIM1_TRG_COM_TIM11_IRQHandler(void) { while(1) {} }
@@ -0,0 +1,41 @@
+#include "STHAL.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+uint32_t SystemCoreClock = 168000000;
+
+static struct timespec start;
+
+void HAL_Init(void) {
+  clock_gettime(CLOCK_MONOTONIC, &start);
+}
+
+void SystemClock_Config(void) {
+}
+
+void Error_Handler(void) {
+  fprintf(stderr, "Error_Handler\n");
+  abort();
+}
+
+uint32_t HAL_GetTick(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((now.tv_sec - start.tv_sec) * 1000 + (now.tv_nsec - start.tv_nsec) / 1000000);
+}
+
+void HAL_Delay(uint32_t ms) {
+  struct timespec t = { ms / 1000, (long)(ms % 1000) * 1000000 };
+  // the tick signal of the FreeRTOS port interrupts the sleep
+  while (nanosleep(&t, &t) == -1 && errno == EINTR) {
+  }
+}
+
+#ifdef USE_FULL_ASSERT
+void assert_failed(uint8_t* file, uint32_t line) {
+  fprintf(stderr, "assert failed: %s:%lu\n", (const char*)file, (unsigned long)line);
+  abort();
+}
+#endif
@@ -0,0 +1,37 @@
+/**
+ * @file STHAL.h
+ * @brief Stand-in for the STHAL library in host builds (env:native)
+ * @details Only what the shared test code and the benchmarks need. There are no peripherals on the host.
+ */
+
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef __weak
+  #define __weak __attribute__((weak))
+#endif
+
+extern uint32_t SystemCoreClock;
+
+void HAL_Init(void);
+void SystemClock_Config(void);
+void Error_Handler(void);
+
+/// @brief Milliseconds since start
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t ms);
+
+#ifdef USE_FULL_ASSERT
+void assert_failed(uint8_t* file, uint32_t line);
+  #define assert_param(expr) ((expr) ? (void)0U : assert_failed((uint8_t*)__FILE__, __LINE__))
+#else
+  #define assert_param(expr) ((void)0U)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,22 @@
+#include "Socket_Adaptor.h"
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+Socket_Adaptor::Socket_Adaptor() {
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+    return;
+  }
+  fd_ = fds[0];
+  peer_ = fds[1];
+  fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) | O_NONBLOCK);
+}
+
+Socket_Adaptor::~Socket_Adaptor() {
+  deinit();
+  if (peer_ >= 0) {
+    close(peer_);
+  }
+}
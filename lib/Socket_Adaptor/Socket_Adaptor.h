@@ -0,0 +1,26 @@
+#pragma once
+
+#include "FD_Adaptor.h"
+
+/// @brief One end of a socket pair as the link, for tests and benchmarks in host builds
+/// @details The PC end is peer(), a blocking stream socket. Unlike a pseudo-terminal, it has no line discipline, and
+/// the PC sees when the device end is closed.
+class Socket_Adaptor : public FD_Adaptor {
+public:
+  /// @brief Create the pair, status() is false if it can't be created
+  Socket_Adaptor();
+  ~Socket_Adaptor() override;
+
+  /// @brief The end of the PC, closed with the adaptor
+  int peer() const {
+    return peer_;
+  }
+
+protected:
+  bool open() override {
+    return fd_ >= 0;
+  }
+
+private:
+  int peer_ = -1;
+};
@@ -0,0 +1,99 @@
+/**
+ * @file bench.h
+ * @brief Helpers for benchmarks, which run as unit tests and print their results to the test output
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include "unity.h"
+#include "STHAL.h"
+#ifdef NATIVE
+  #include <ctime>
+#endif
+
+namespace bench {
+
+#ifdef NATIVE
+  /// @brief Measures elapsed time with the monotonic clock of the host
+  class Stopwatch {
+  public:
+    Stopwatch() {
+      restart();
+    }
+
+    void restart() {
+      start_ = now_ns();
+    }
+
+    /// @brief Nanoseconds since construction or restart(), the host has no cycle counter
+    [[nodiscard]] uint32_t cycles() const {
+      return static_cast<uint32_t>(now_ns() - start_);
+    }
+
+    /// @brief Microseconds since construction or restart()
+    [[nodiscard]] uint32_t us() const {
+      return static_cast<uint32_t>((now_ns() - start_) / 1000);
+    }
+
+  private:
+    static uint64_t now_ns() {
+      timespec t;
+      clock_gettime(CLOCK_MONOTONIC, &t);
+      return static_cast<uint64_t>(t.tv_sec) * 1000000000u + t.tv_nsec;
+    }
+    uint64_t start_ = 0;
+  };
+#else
+  /// @brief Measures elapsed time with the DWT cycle counter
+  class Stopwatch {
+  public:
+    Stopwatch() {
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+      restart();
+    }
+
+    void restart() {
+      start_ = DWT->CYCCNT;
+    }
+
+    /// @brief CPU cycles since construction or restart()
+    [[nodiscard]] uint32_t cycles() const {
+      return DWT->CYCCNT - start_;
+    }
+
+    /// @brief Microseconds since construction or restart()
+    [[nodiscard]] uint32_t us() const {
+      return cycles() / (SystemCoreClock / 1000000);
+    }
+
+  private:
+    uint32_t start_ = 0;
+  };
+#endif
+
+  /// @brief Print a named measurement to the test output
+  /// @param name what was measured
+  /// @param value the result
+  /// @param unit unit of @p value
+  inline void report(const char* name, uint32_t value, const char* unit) {
+    char buff[96];
+    snprintf(buff, sizeof(buff), "%s: %lu %s", name, static_cast<unsigned long>(value), unit);
+    TEST_MESSAGE(buff);
+  }
+
+  /// @brief The @p pct-th percentile of @p values, nearest rank
+  /// @details Sorts @p values in place
+  /// @param values measurements
+  /// @param n number of @p values, not 0
+  /// @param pct 0-100
+  inline uint32_t percentile(uint32_t* values, size_t n, unsigned pct) {
+    std::sort(values, values + n);
+    const size_t rank = (pct * n + 99) / 100;
+    return values[rank ? rank - 1 : 0];
+  }
+
+}  // namespace bench
@@ -0,0 +1,83 @@
+/**
+ * @file bench_icon.h
+ * @brief A 32x32 RGB PNG, like the icons the PC sends, for the benchmarks which draw sessions
+ */
+#pragma once
+#include <cstdint>
+
+namespace bench {
+
+  inline constexpr uint8_t icon_png[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x02, 0x00, 0x00, 0x00, 0xFC, 0x18, 0xED,
+    0xA3, 0x00, 0x00, 0x04, 0x36, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xE5, 0x96, 0xA1, 0xB6, 0x25,
+    0x27, 0x10, 0x45, 0xF3, 0x4D, 0x31, 0xD7, 0xB4, 0x69, 0x83, 0xC1, 0x60, 0x30, 0x18, 0x0C, 0x06,
+    0x83, 0xC1, 0x6C, 0x83, 0xC1, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x83, 0xC1, 0xB4, 0x69, 0xD3, 0xE6,
+    0x7D, 0x5B, 0xEE, 0xB5, 0x2F, 0x93, 0xC9, 0x24, 0x2B, 0x2E, 0x7C, 0xC0, 0xD9, 0xAB, 0xA8, 0x3A,
+    0xA7, 0xEA, 0xB7, 0xDF, 0xFE, 0x17, 0xCF, 0xF1, 0xE5, 0xF9, 0x0A, 0x7C, 0x45, 0xBE, 0xE0, 0x2B,
+    0xF1, 0x95, 0xF9, 0x2A, 0x7C, 0xFD, 0x07, 0xD2, 0x86, 0xC7, 0xF2, 0x38, 0x1E, 0xCF, 0x13, 0x78,
+    0x22, 0x0F, 0x3C, 0x89, 0x27, 0xF3, 0x14, 0x9E, 0xCA, 0xD3, 0x78, 0xFE, 0xA5, 0xB4, 0xE2, 0xD6,
+    0xDC, 0x86, 0xDB, 0x72, 0x3B, 0x6E, 0xCF, 0x1D, 0xB8, 0x23, 0x37, 0xDC, 0x89, 0x3B, 0x73, 0x17,
+    0xEE, 0xCA, 0xDD, 0xB8, 0x3B, 0xF7, 0xE0, 0xFE, 0x67, 0xEA, 0x92, 0x4B, 0x71, 0x69, 0x2E, 0xC3,
+    0x65, 0xB9, 0x1C, 0x97, 0xE7, 0x0A, 0x5C, 0x91, 0x0B, 0xAE, 0xC4, 0x95, 0xB9, 0x0A, 0x57, 0xE5,
+    0x6A, 0x5C, 0x9D, 0x6B, 0x70, 0x4D, 0xAE, 0x5F, 0x55, 0x17, 0x6C, 0xC9, 0x56, 0x6C, 0xCD, 0x36,
+    0x6C, 0xCB, 0x76, 0x6C, 0xCF, 0x0E, 0xEC, 0xC8, 0x86, 0x9D, 0xD8, 0x99, 0x5D, 0xD8, 0x95, 0xDD,
+    0xD8, 0x9D, 0x3D, 0xD8, 0x93, 0xBD, 0xD8, 0x7F, 0xAF, 0x7E, 0xB2, 0x04, 0x4B, 0xB2, 0x14, 0x4B,
+    0xB3, 0x0C, 0xCB, 0xB2, 0x1C, 0xCB, 0xB3, 0x02, 0x2B, 0xB2, 0x60, 0x25, 0x56, 0x66, 0x15, 0x56,
+    0x65, 0x35, 0x56, 0x67, 0x0D, 0xD6, 0x64, 0x2D, 0xD6, 0x66, 0xFD, 0x4C, 0xFD, 0x60, 0x9E, 0x4C,
+    0xC1, 0x94, 0x4C, 0xC5, 0xD4, 0x4C, 0xC3, 0xB4, 0x4C, 0xC7, 0xF4, 0xCC, 0xC0, 0x8C, 0x4C, 0x98,
+    0x89, 0x99, 0x99, 0x85, 0x59, 0x99, 0x8D, 0xD9, 0x99, 0x83, 0x39, 0x99, 0x8B, 0xB9, 0x99, 0x17,
+    0xF3, 0x27, 0x80, 0x71, 0x32, 0x04, 0x43, 0x32, 0x14, 0x43, 0x33, 0x0C, 0xC3, 0x32, 0x1C, 0xC3,
+    0x33, 0x02, 0x23, 0x32, 0x60, 0x24, 0x46, 0x66, 0x14, 0x46, 0x65, 0x34, 0x46, 0x67, 0x0C, 0xC6,
+    0x64, 0x2C, 0xC6, 0x66, 0x5C, 0x8C, 0x1F, 0xAB, 0xBF, 0xE8, 0x07, 0xFD, 0xA4, 0x0B, 0xBA, 0xA4,
+    0x2B, 0xBA, 0xA6, 0x1B, 0xBA, 0xA5, 0x3B, 0xBA, 0xA7, 0x07, 0x7A, 0xA4, 0x43, 0x4F, 0xF4, 0x4C,
+    0x2F, 0xF4, 0x4A, 0x6F, 0xF4, 0x4E, 0x1F, 0xF4, 0x49, 0x5F, 0xF4, 0x4D, 0xBF, 0xE8, 0x37, 0xFD,
+    0x87, 0x80, 0x76, 0xD0, 0x4E, 0x9A, 0xA0, 0x49, 0x9A, 0xA2, 0x69, 0x9A, 0xA1, 0x59, 0x9A, 0xA3,
+    0x79, 0x5A, 0xA0, 0x45, 0x1A, 0xB4, 0x44, 0xCB, 0xB4, 0x42, 0xAB, 0xB4, 0x46, 0xEB, 0xB4, 0x41,
+    0x9B, 0xB4, 0x45, 0xDB, 0xB4, 0x8B, 0x76, 0xD3, 0xBE, 0xAB, 0xFF, 0x4E, 0x7D, 0x51, 0x0F, 0xEA,
+    0x49, 0x15, 0x54, 0x49, 0x55, 0x54, 0x4D, 0x35, 0x54, 0x4B, 0x75, 0x54, 0x4F, 0x0D, 0xD4, 0x48,
+    0x85, 0x9A, 0xA8, 0x99, 0x5A, 0xA8, 0x95, 0xDA, 0xA8, 0x9D, 0x3A, 0xA8, 0x93, 0xBA, 0xA8, 0x9B,
+    0x7A, 0x51, 0x6F, 0xEA, 0x43, 0xFD, 0x06, 0x28, 0x2F, 0xCA, 0x41, 0x39, 0x29, 0x82, 0x22, 0x29,
+    0x8A, 0xA2, 0x29, 0x86, 0x62, 0x29, 0x8E, 0xE2, 0x29, 0x81, 0x12, 0x29, 0x50, 0x12, 0x25, 0x53,
+    0x0A, 0xA5, 0x52, 0x1A, 0xA5, 0x53, 0x06, 0x65, 0x52, 0x16, 0x65, 0x53, 0x2E, 0xCA, 0x4D, 0x79,
+    0x28, 0xDF, 0x00, 0xF9, 0x45, 0x3E, 0xC8, 0x27, 0x59, 0x90, 0x25, 0x59, 0x91, 0x35, 0xD9, 0x90,
+    0x2D, 0xD9, 0x91, 0x3D, 0x39, 0x90, 0x23, 0x19, 0x72, 0x22, 0x67, 0x72, 0x21, 0x57, 0x72, 0x23,
+    0x77, 0xF2, 0x20, 0x4F, 0xF2, 0x22, 0x6F, 0xF2, 0x45, 0xBE, 0xC9, 0x0F, 0xF9, 0x1B, 0x20, 0xBD,
+    0x48, 0x07, 0xE9, 0x24, 0x09, 0x92, 0x24, 0x29, 0x92, 0x26, 0x19, 0x92, 0x25, 0x39, 0x92, 0x27,
+    0x05, 0x52, 0x24, 0x41, 0x4A, 0xA4, 0x4C, 0x2A, 0xA4, 0x4A, 0x6A, 0xA4, 0x4E, 0x1A, 0xA4, 0x49,
+    0x5A, 0xA4, 0x4D, 0xBA, 0x48, 0x37, 0xE9, 0x21, 0x7D, 0x03, 0xF0, 0x82, 0x03, 0x4E, 0x10, 0x20,
+    0x41, 0x81, 0x06, 0x03, 0x16, 0x1C, 0x78, 0x08, 0x10, 0xF9, 0xBC, 0x37, 0xE4, 0x5D, 0xC8, 0xFB,
+    0xB3, 0xDE, 0x0D, 0x79, 0x37, 0xFD, 0x3D, 0x58, 0xEF, 0xE1, 0x7D, 0x1B, 0xE4, 0x6D, 0xC2, 0xB7,
+    0xD1, 0xDF, 0x61, 0xF2, 0x0E, 0xAC, 0x77, 0x28, 0x7E, 0x03, 0xC4, 0x17, 0xF1, 0x20, 0x9E, 0x44,
+    0x41, 0x94, 0x44, 0x45, 0xD4, 0x44, 0x43, 0xB4, 0x44, 0x47, 0xF4, 0xC4, 0x40, 0x8C, 0x1F, 0x44,
+    0x4C, 0xC4, 0x4C, 0x2C, 0xC4, 0x4A, 0x6C, 0xC4, 0x4E, 0x1C, 0xC4, 0x49, 0x5C, 0xC4, 0x4D, 0xBC,
+    0x88, 0x37, 0xF1, 0x21, 0x7E, 0x03, 0x84, 0x17, 0xE1, 0x20, 0x9C, 0x04, 0x41, 0x90, 0x04, 0x45,
+    0xD0, 0x04, 0x43, 0xB0, 0x04, 0x47, 0xF0, 0x84, 0x40, 0x88, 0x9F, 0x32, 0x42, 0x22, 0x64, 0x42,
+    0x21, 0x54, 0x42, 0x23, 0x74, 0xC2, 0x20, 0x4C, 0xC2, 0x22, 0x6C, 0xC2, 0x45, 0xB8, 0x09, 0x0F,
+    0xE1, 0x1B, 0xC0, 0xBF, 0xF0, 0x07, 0xFE, 0xC4, 0x0B, 0xBC, 0xC4, 0x2B, 0xBC, 0xC6, 0x1B, 0xBC,
+    0xC5, 0x3B, 0xBC, 0xC7, 0x07, 0x7C, 0xFC, 0x7C, 0x95, 0x4F, 0xF8, 0x8C, 0x2F, 0xF8, 0x8A, 0x6F,
+    0xF8, 0x8E, 0x1F, 0xF8, 0x89, 0x5F, 0xF8, 0x8D, 0xBF, 0xF0, 0x37, 0xFE, 0xC1, 0xFF, 0xD9, 0x68,
+    0xEE, 0xC0, 0x9D, 0x38, 0x81, 0x93, 0x38, 0x85, 0xD3, 0x38, 0x83, 0xB3, 0x38, 0x87, 0xF3, 0xB8,
+    0x80, 0x8B, 0x9F, 0x76, 0xB8, 0x84, 0xCB, 0xB8, 0x82, 0xAB, 0xB8, 0x86, 0xEB, 0xB8, 0x81, 0x9B,
+    0xB8, 0x85, 0xDB, 0xB8, 0x0B, 0x77, 0xE3, 0x7E, 0xE8, 0x64, 0x7B, 0x60, 0x4F, 0xAC, 0xC0, 0x4A,
+    0xAC, 0xC2, 0x6A, 0xAC, 0xC1, 0x5A, 0xAC, 0xC3, 0x7A, 0x6C, 0xC0, 0xC6, 0x4F, 0xCB, 0x6D, 0xC2,
+    0x66, 0x6C, 0xC1, 0x56, 0x6C, 0xC3, 0x76, 0xEC, 0xC0, 0x4E, 0xEC, 0xC2, 0x6E, 0xEC, 0x85, 0xBD,
+    0xB1, 0x7F, 0x15, 0x76, 0xE6, 0xC4, 0x08, 0x8C, 0xC4, 0x28, 0x8C, 0xC6, 0x18, 0x8C, 0xC5, 0x38,
+    0x8C, 0xC7, 0x04, 0x4C, 0xFC, 0x8C, 0x95, 0x49, 0x98, 0x8C, 0x29, 0x98, 0x8A, 0x69, 0x98, 0x8E,
+    0x19, 0x98, 0x89, 0x59, 0x98, 0x8D, 0xB9, 0x30, 0x3F, 0x49, 0x53, 0x7D, 0xA2, 0x05, 0x5A, 0xA2,
+    0x15, 0x5A, 0xA3, 0x0D, 0xDA, 0xA2, 0x1D, 0xDA, 0xA3, 0x03, 0x3A, 0x7E, 0x46, 0x57, 0x27, 0x74,
+    0x46, 0x17, 0x74, 0x45, 0x37, 0x74, 0x47, 0x0F, 0xF4, 0x44, 0x2F, 0xF4, 0x46, 0x5F, 0xE8, 0x9F,
+    0x2F, 0x1C, 0x25, 0x50, 0x12, 0xA5, 0x50, 0x1A, 0x65, 0x50, 0x16, 0xE5, 0x50, 0x1E, 0x15, 0x50,
+    0xF1, 0x63, 0x0F, 0x95, 0x50, 0x19, 0x55, 0x50, 0x15, 0xD5, 0x50, 0x1D, 0x35, 0x50, 0x13, 0xB5,
+    0x50, 0x1B, 0xF5, 0x2B, 0x2B, 0x53, 0x4A, 0xA4, 0x42, 0x6A, 0xA4, 0x41, 0x5A, 0xA4, 0x43, 0x7A,
+    0x64, 0x40, 0xC6, 0x8F, 0x05, 0x65, 0x42, 0x66, 0x64, 0x41, 0x56, 0x64, 0x43, 0x76, 0xE4, 0x40,
+    0x4E, 0xE4, 0x42, 0xFE, 0xFA, 0xD2, 0x17, 0x0A, 0xA1, 0x11, 0x06, 0x61, 0x11, 0x0E, 0xE1, 0x11,
+    0x01, 0x11, 0x3F, 0x36, 0x17, 0x09, 0x91, 0x11, 0x05, 0x51, 0x11, 0x0D, 0xD1, 0x11, 0x03, 0x31,
+    0x11, 0xFF, 0xF4, 0x6C, 0x39, 0x35, 0xA7, 0xE1, 0xB4, 0x9C, 0x8E, 0xD3, 0x73, 0x06, 0xCE, 0xF8,
+    0x89, 0x92, 0x33, 0x71, 0x66, 0xCE, 0xC2, 0x59, 0x39, 0x1B, 0x67, 0xE7, 0x1C, 0x9C, 0xFF, 0xFA,
+    0xF0, 0x3A, 0x2C, 0x87, 0xE3, 0xF0, 0x1C, 0x81, 0x23, 0x7E, 0xE2, 0xEA, 0x48, 0x1C, 0x99, 0xA3,
+    0x70, 0x54, 0x8E, 0xC6, 0xF1, 0x9F, 0x9C, 0x8E, 0x2F, 0xCF, 0x2B, 0xF0, 0x8A, 0x9F, 0x48, 0x7C,
+    0x25, 0x5E, 0x99, 0x57, 0xE1, 0xF5, 0xFF, 0x38, 0x9C, 0xFF, 0x00, 0x60, 0x27, 0x62, 0x6E, 0x0B,
+    0x2B, 0x4A, 0x58, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,  };
+
+}  // namespace bench
@@ -0,0 +1,474 @@
+/**
+ * @file bench_icon_corpus.h
+ * @brief Icons of different kinds, as PNG and as palette RLE, for the image format benchmark
+ * @details The PNGs are 32x32 RGBA, the RLE files were made from them by scripts/icon2rle.py with 256 colors.
+ * The gradient is bench::icon_png.
+ */
+#pragma once
+#include "bench_icon.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace bench {
+
+  /// @brief Flat colors with antialiased edges, like most application icons
+  inline constexpr uint8_t flat_png[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7A, 0x7A,
+    0xF4, 0x00, 0x00, 0x01, 0x2E, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0x63, 0x94, 0xEB, 0x78, 0xCA,
+    0x30, 0x90, 0x80, 0x09, 0x89, 0xAD, 0x0F, 0xC4, 0xEB, 0x81, 0xF8, 0x3F, 0x8D, 0xF1, 0x7A, 0xA8,
+    0x5D, 0x28, 0x0E, 0x00, 0x09, 0x1C, 0x00, 0xE2, 0x00, 0x3A, 0x78, 0x3A, 0x00, 0x6A, 0x97, 0x3E,
+    0xB2, 0x03, 0x1A, 0x80, 0x58, 0x80, 0x8E, 0x21, 0x2F, 0x00, 0xB5, 0x13, 0xEE, 0x80, 0x80, 0x01,
+    0x88, 0xFE, 0x00, 0xF4, 0x34, 0x30, 0xE0, 0x89, 0x70, 0xD4, 0x01, 0xA3, 0x0E, 0x20, 0x0A, 0xAC,
+    0x88, 0x14, 0x66, 0xB0, 0x90, 0x65, 0x1B, 0x38, 0x07, 0x58, 0xCA, 0xB1, 0x33, 0xAC, 0x8C, 0x12,
+    0x61, 0x98, 0x15, 0x28, 0xC8, 0x20, 0xC3, 0xC7, 0x3C, 0x70, 0x51, 0xE0, 0xAE, 0xC6, 0xC9, 0x70,
+    0x34, 0x53, 0x9C, 0xA1, 0xCE, 0x89, 0x8F, 0x81, 0x8F, 0x9D, 0x71, 0xE0, 0xD2, 0x40, 0xB2, 0x29,
+    0x0F, 0xC3, 0x91, 0x0C, 0x71, 0x86, 0x02, 0x6B, 0x5E, 0xB2, 0x1C, 0x42, 0x95, 0x44, 0xC8, 0xCF,
+    0xC1, 0xC4, 0x50, 0x68, 0xC3, 0xCB, 0xB0, 0x2D, 0x51, 0x94, 0x21, 0x44, 0x87, 0x73, 0xE0, 0x72,
+    0x81, 0x2C, 0x3F, 0x0B, 0x43, 0xAF, 0xB7, 0x20, 0xC3, 0xB6, 0x04, 0x51, 0xA2, 0x13, 0xEA, 0x80,
+    0x67, 0x43, 0x16, 0x6A, 0x1A, 0xF6, 0xF8, 0xE3, 0x1F, 0x86, 0x09, 0x47, 0x3E, 0x33, 0xAC, 0xB9,
+    0xF2, 0x9D, 0xBE, 0x0E, 0xF8, 0xF8, 0xE3, 0x1F, 0xC3, 0xBC, 0x33, 0x5F, 0x81, 0xF8, 0x0B, 0xC3,
+    0xA7, 0x9F, 0xFF, 0xE9, 0x1B, 0x02, 0x73, 0x4F, 0x7F, 0x61, 0x98, 0x70, 0xF4, 0x33, 0xC9, 0x16,
+    0x53, 0xEC, 0x80, 0x9D, 0xB7, 0xBE, 0x33, 0x34, 0xED, 0xFD, 0xC4, 0xF0, 0xE4, 0xD3, 0x5F, 0xFA,
+    0xA6, 0x81, 0xE3, 0x8F, 0x7E, 0x82, 0xE3, 0xF9, 0xC4, 0xE3, 0x5F, 0x54, 0x49, 0x37, 0x8C, 0xD0,
+    0x56, 0xF1, 0xFF, 0x01, 0xCA, 0x04, 0x8C, 0xA3, 0xD5, 0xF1, 0xA8, 0x03, 0x06, 0x8D, 0x03, 0x36,
+    0x0C, 0x80, 0xDD, 0x1B, 0xD0, 0x7B, 0x46, 0x1F, 0xE8, 0x68, 0xF9, 0x07, 0xF4, 0x9E, 0xD1, 0x45,
+    0x20, 0x76, 0xA0, 0x53, 0x48, 0x6C, 0x80, 0xDA, 0x75, 0x11, 0xBD, 0x24, 0x04, 0x09, 0x04, 0xD2,
+    0x3B, 0x1E, 0x00, 0x1F, 0x73, 0x62, 0x75, 0x9E, 0x93, 0x6D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x49,
+    0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+  };
+
+  /// @brief One color line art on transparent background
+  inline constexpr uint8_t outline_png[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7A, 0x7A,
+    0xF4, 0x00, 0x00, 0x01, 0x39, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xED, 0x97, 0xDD, 0x0D, 0x82,
+    0x30, 0x10, 0xC7, 0xAD, 0xF1, 0x5D, 0x36, 0xF0, 0xD5, 0x37, 0xBB, 0x81, 0xDD, 0x40, 0x36, 0x10,
+    0x37, 0xC0, 0x49, 0x64, 0x03, 0x61, 0x03, 0xDD, 0xA0, 0x6C, 0x00, 0x23, 0xB8, 0x01, 0x4C, 0xA0,
+    0x6D, 0xF2, 0x27, 0x69, 0x48, 0x29, 0x95, 0x16, 0x48, 0x08, 0x97, 0x5C, 0x1A, 0x92, 0x6B, 0xEF,
+    0x77, 0x1F, 0xBD, 0x06, 0x72, 0x3C, 0xD2, 0xCD, 0x9C, 0xB2, 0xDD, 0xCC, 0x2C, 0x2B, 0xC0, 0x22,
+    0x00, 0x9E, 0x73, 0x02, 0x5C, 0x85, 0x46, 0x73, 0x01, 0x9C, 0x85, 0xA6, 0x3D, 0x36, 0x17, 0xA1,
+    0xA7, 0x31, 0x00, 0xE4, 0xA1, 0x2F, 0x0B, 0x40, 0x69, 0xC3, 0x4D, 0x10, 0x43, 0x00, 0xF6, 0x88,
+    0x3C, 0xE8, 0xB1, 0x2B, 0xA0, 0x01, 0xEC, 0xF7, 0xBE, 0x00, 0x64, 0x54, 0xD4, 0x22, 0xFA, 0x5A,
+    0x28, 0x03, 0x84, 0xB4, 0x8F, 0x7D, 0x00, 0x3C, 0x71, 0xA8, 0x49, 0x1E, 0x48, 0xFB, 0x15, 0x10,
+    0x8D, 0xE3, 0x58, 0x97, 0x05, 0x13, 0xC0, 0x57, 0xA3, 0x36, 0x1D, 0x5F, 0x60, 0x4D, 0x84, 0x1E,
+    0x84, 0xE6, 0x00, 0x0A, 0x74, 0xFB, 0xC7, 0x18, 0x44, 0x19, 0xCA, 0x14, 0x28, 0xD1, 0x37, 0xB7,
+    0x85, 0x4D, 0x35, 0x09, 0x93, 0x96, 0x43, 0xDE, 0x05, 0x40, 0x0C, 0xCF, 0xF1, 0xF7, 0x0F, 0x87,
+    0xC4, 0xB0, 0x9F, 0x74, 0x7C, 0x2F, 0xFB, 0x31, 0x3A, 0xB7, 0x1A, 0xF2, 0x80, 0xB5, 0x9A, 0x0A,
+    0x20, 0xEE, 0xA8, 0x3D, 0x9F, 0x02, 0x40, 0xDE, 0xFF, 0x10, 0xD1, 0x36, 0xCD, 0x18, 0x0D, 0x01,
+    0x20, 0x1A, 0x4D, 0x2D, 0x00, 0xA8, 0x92, 0x85, 0x0F, 0xCA, 0xC1, 0x00, 0x94, 0xBA, 0x66, 0xE0,
+    0xA6, 0x8B, 0xA2, 0x25, 0x77, 0x38, 0xCC, 0x30, 0xF9, 0x12, 0xE5, 0x6A, 0xD6, 0x3E, 0x4A, 0x10,
+    0x2A, 0xCD, 0xD5, 0x25, 0x39, 0x9C, 0x73, 0x64, 0xA4, 0x50, 0x40, 0x9C, 0x01, 0x6A, 0xD4, 0xB4,
+    0xB2, 0x28, 0x05, 0x85, 0x5D, 0xA4, 0x8B, 0xDE, 0xA5, 0x09, 0x4B, 0x64, 0xA2, 0x2F, 0x0B, 0x21,
+    0xCA, 0x51, 0x8E, 0x31, 0x07, 0x72, 0x8B, 0xC7, 0xE9, 0x6D, 0x72, 0x2E, 0x65, 0xE7, 0xE1, 0xE1,
+    0x61, 0x2E, 0x07, 0xF8, 0x98, 0x03, 0xB7, 0xF5, 0xC7, 0x64, 0x05, 0x70, 0x91, 0x1F, 0x2B, 0x61,
+    0x42, 0xFF, 0x0E, 0x6E, 0x72, 0x56, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42,
+    0x60, 0x82,
+  };
+
+  /// @brief Textured, more colors than the palette holds
+  inline constexpr uint8_t photo_png[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7A, 0x7A,
+    0xF4, 0x00, 0x00, 0x0B, 0x32, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0x25, 0x57, 0x39, 0x93, 0x1C,
+    0x49, 0x19, 0x7D, 0x55, 0x95, 0x95, 0x75, 0x1F, 0x7D, 0xCD, 0x8C, 0x34, 0x5A, 0xA4, 0xC5, 0xC0,
+    0x96, 0x43, 0x10, 0x04, 0x04, 0x31, 0x06, 0x01, 0x78, 0x72, 0xF1, 0x98, 0xF1, 0x30, 0xE5, 0x63,
+    0xE1, 0xED, 0x5A, 0x2B, 0x13, 0x6F, 0xE7, 0x27, 0x68, 0x4C, 0xAC, 0xD5, 0xFE, 0x83, 0xC5, 0x63,
+    0x09, 0x20, 0xF6, 0x90, 0x34, 0x47, 0x1F, 0x75, 0xDF, 0x47, 0xF2, 0x7A, 0x98, 0x88, 0x8A, 0xE9,
+    0xAE, 0xCE, 0xCA, 0xCA, 0xFC, 0xBE, 0x77, 0xA5, 0xF6, 0x97, 0xBF, 0xFF, 0x09, 0xCF, 0xBC, 0x15,
+    0x16, 0xCA, 0x82, 0x5E, 0x0C, 0xD8, 0x58, 0x11, 0x56, 0x76, 0x04, 0x31, 0xEA, 0x70, 0x4D, 0x17,
+    0x6A, 0xD6, 0x71, 0x48, 0x0B, 0x78, 0x8B, 0x15, 0xDE, 0xEF, 0xF7, 0x30, 0xA2, 0x08, 0xDB, 0xAE,
+    0x41, 0xE7, 0x48, 0xBC, 0xAF, 0x73, 0xEC, 0x55, 0x0F, 0x15, 0xBB, 0xB8, 0xEB, 0x72, 0xE4, 0x7A,
+    0x8F, 0x02, 0x2D, 0xCA, 0xB9, 0x46, 0x3D, 0x95, 0x10, 0x36, 0x90, 0xA6, 0x77, 0x90, 0x46, 0x8F,
+    0x75, 0x20, 0xD1, 0xA7, 0xF7, 0x78, 0xE2, 0x4B, 0x78, 0x63, 0x83, 0x73, 0xCF, 0xC2, 0x70, 0xFF,
+    0x11, 0x7A, 0xE8, 0x9D, 0x70, 0x40, 0x88, 0xEC, 0xD0, 0x41, 0x9B, 0x1D, 0x04, 0xEE, 0x1A, 0x6A,
+    0x34, 0x91, 0x27, 0x0D, 0xAA, 0xBC, 0xE3, 0x6F, 0x0E, 0xE6, 0x01, 0xFC, 0x5C, 0x21, 0xF2, 0xA3,
+    0x57, 0x42, 0xD3, 0xBF, 0x88, 0x7C, 0xFF, 0xAB, 0xA1, 0x6D, 0x54, 0xE4, 0xBB, 0xCA, 0x12, 0x9A,
+    0xAA, 0x8B, 0x44, 0xD9, 0x26, 0xBE, 0xD2, 0xE6, 0xEE, 0x8B, 0xA9, 0xAF, 0x5E, 0x55, 0xF9, 0x8E,
+    0x73, 0x34, 0x48, 0x76, 0xB7, 0x98, 0xFA, 0x92, 0x57, 0x8D, 0xA1, 0x2D, 0xA1, 0xAB, 0x11, 0x6D,
+    0x55, 0xC0, 0x91, 0x26, 0xEA, 0xA2, 0xC0, 0xD9, 0xE6, 0x04, 0x42, 0xB5, 0x16, 0xB2, 0xAA, 0xC3,
+    0x89, 0x58, 0xC1, 0x33, 0x5C, 0x94, 0xFB, 0x1E, 0x0B, 0xE9, 0xC1, 0xE5, 0xA2, 0x6C, 0xCD, 0x41,
+    0x5F, 0x8C, 0x51, 0x20, 0x83, 0xD7, 0xCA, 0x30, 0x5F, 0xEF, 0xB2, 0x22, 0x6E, 0x0C, 0x60, 0xE6,
+    0xEA, 0xCB, 0x7D, 0x82, 0xBA, 0xD2, 0x21, 0x3D, 0x01, 0x47, 0xD7, 0xD0, 0xB5, 0xCD, 0x45, 0x91,
+    0x6C, 0x2F, 0xEC, 0x85, 0xFD, 0x5A, 0xAA, 0x39, 0x85, 0x52, 0x6F, 0x22, 0x5B, 0xBE, 0x01, 0x54,
+    0x56, 0x66, 0x0F, 0xB0, 0xBC, 0x00, 0xB6, 0xC5, 0xCD, 0xE4, 0x07, 0x28, 0xD3, 0x84, 0x39, 0x1B,
+    0x48, 0xEF, 0x53, 0x18, 0xBF, 0xFC, 0xFD, 0xAF, 0x60, 0x94, 0x3A, 0x2F, 0x0D, 0x21, 0x7C, 0x84,
+    0x9A, 0x0F, 0xBD, 0x06, 0xBA, 0xA4, 0x65, 0x1B, 0xC4, 0xAB, 0xF2, 0x50, 0xBE, 0x33, 0x21, 0xFF,
+    0x90, 0x27, 0x85, 0x5D, 0x57, 0x2D, 0xE6, 0x19, 0x68, 0xDA, 0x0E, 0xAE, 0xEF, 0xA3, 0x6C, 0x6A,
+    0x3C, 0xEC, 0xB7, 0xD8, 0x27, 0x7B, 0x28, 0x9D, 0xAF, 0xD2, 0x66, 0x4C, 0xF3, 0x88, 0xED, 0xC3,
+    0x9D, 0xCD, 0x6D, 0x5F, 0x98, 0x1A, 0xFE, 0x3C, 0xB7, 0xCD, 0x3F, 0xB5, 0xBE, 0xFF, 0xD6, 0x1C,
+    0x46, 0x0C, 0x69, 0x8E, 0xD8, 0x90, 0x98, 0x92, 0x82, 0x57, 0x85, 0x50, 0x99, 0x10, 0xCD, 0x9D,
+    0x82, 0xAB, 0x4B, 0x68, 0x9A, 0x05, 0xA1, 0x3B, 0x9C, 0x40, 0x43, 0x9E, 0x96, 0x08, 0x4C, 0xEB,
+    0x4B, 0x7D, 0xD4, 0x2F, 0xAD, 0xD1, 0x82, 0xD4, 0x05, 0x44, 0xA5, 0x71, 0x41, 0x80, 0x6B, 0xD9,
+    0x78, 0xF8, 0xF0, 0x81, 0x18, 0xD0, 0x31, 0xB1, 0xDF, 0xB6, 0x06, 0x18, 0xDD, 0x80, 0x66, 0x4C,
+    0xD1, 0xF1, 0x7B, 0x4D, 0x1C, 0x44, 0x9C, 0xAF, 0xCA, 0x2A, 0xCC, 0x9D, 0x16, 0x6B, 0x6A, 0x78,
+    0xEB, 0xE9, 0xF2, 0x1A, 0x6D, 0x7B, 0x35, 0xE4, 0x2D, 0x8C, 0x58, 0xC2, 0x99, 0x1C, 0x58, 0x2D,
+    0xE7, 0x9B, 0x24, 0xC4, 0x5A, 0x3F, 0xC7, 0x9A, 0x7D, 0x5E, 0x28, 0x81, 0xF2, 0x87, 0x8A, 0x8B,
+    0x30, 0x11, 0x89, 0xF0, 0x4B, 0xBD, 0x1A, 0x2E, 0x0D, 0xDB, 0xC0, 0xD4, 0xF5, 0x98, 0xEB, 0x01,
+    0x7A, 0x37, 0x63, 0xAC, 0x1B, 0x4C, 0xCD, 0x8C, 0x05, 0xC1, 0x79, 0x77, 0x48, 0x51, 0xD7, 0x07,
+    0x68, 0xBE, 0x40, 0x64, 0x71, 0x57, 0x65, 0x03, 0x9B, 0x55, 0xD8, 0xA6, 0x7B, 0x14, 0x53, 0x0D,
+    0x7F, 0xE5, 0x73, 0x7C, 0x8F, 0x86, 0x40, 0x9D, 0x05, 0x2E, 0xC5, 0x44, 0x20, 0xBA, 0xF1, 0x55,
+    0xFB, 0xB1, 0x46, 0x64, 0xDB, 0x08, 0x8D, 0x18, 0xC3, 0x81, 0xEF, 0x33, 0x12, 0x87, 0x8B, 0x9B,
+    0xF0, 0x90, 0xE5, 0xF8, 0x74, 0xB9, 0x41, 0x9B, 0x64, 0x5F, 0x9E, 0xAE, 0xC3, 0xCB, 0x62, 0x5B,
+    0xC0, 0xF6, 0x34, 0xA8, 0x69, 0x84, 0xC1, 0x97, 0x88, 0x5E, 0xC1, 0x19, 0xB8, 0x20, 0xF6, 0xA0,
+    0xD5, 0xBA, 0x63, 0x1F, 0x60, 0x0E, 0x13, 0xBA, 0xA6, 0x47, 0xDE, 0xE7, 0x68, 0xCD, 0x09, 0x22,
+    0x34, 0x61, 0x15, 0x80, 0x69, 0x7B, 0x38, 0x7C, 0x77, 0xC0, 0xA4, 0xF1, 0x59, 0x43, 0xA1, 0x6A,
+    0x4A, 0x3C, 0xDB, 0xAC, 0x2E, 0xB7, 0xDF, 0xDF, 0xE1, 0xF9, 0x72, 0x79, 0xA5, 0xD7, 0x02, 0x1A,
+    0xAB, 0x3A, 0xEE, 0x01, 0x91, 0xFF, 0xB7, 0x61, 0x59, 0x3D, 0x58, 0x8D, 0x0B, 0x1D, 0xE2, 0x95,
+    0x28, 0xAD, 0xCB, 0x3C, 0xCF, 0x09, 0x48, 0x1B, 0x7D, 0xD6, 0x60, 0x11, 0xFB, 0xA8, 0xB3, 0x02,
+    0xD2, 0xD2, 0x10, 0xB0, 0xB4, 0xDF, 0x7F, 0xFC, 0x00, 0xBE, 0x0E, 0x4E, 0x6C, 0xC3, 0x6C, 0x46,
+    0x28, 0x7E, 0x8E, 0x3D, 0x9B, 0x2C, 0xBA, 0x47, 0x93, 0x02, 0x7D, 0x53, 0xB0, 0x02, 0x0D, 0x74,
+    0x56, 0xCF, 0x0B, 0x5C, 0x4C, 0xDC, 0xF9, 0x94, 0x6B, 0xE8, 0x87, 0x1E, 0xE1, 0x18, 0x5E, 0xD6,
+    0x3F, 0xB4, 0x6F, 0x85, 0xEA, 0x6F, 0x08, 0x15, 0xC4, 0x04, 0xA2, 0xB0, 0x4A, 0x0F, 0xF5, 0x43,
+    0x07, 0x5F, 0xC8, 0x68, 0x6E, 0xE7, 0x6B, 0x55, 0x4C, 0xD0, 0x0C, 0x36, 0x56, 0x9F, 0x11, 0xB9,
+    0x1E, 0xF6, 0xFF, 0xBA, 0x43, 0xB4, 0xF0, 0x90, 0x6F, 0x53, 0xCC, 0x96, 0x82, 0x46, 0x6A, 0xBA,
+    0xEC, 0xFF, 0xAE, 0xD8, 0x73, 0x51, 0x0A, 0x73, 0x5B, 0xA3, 0xCB, 0xB8, 0xFB, 0x69, 0x82, 0xE4,
+    0x7D, 0xBB, 0xD3, 0xD1, 0x53, 0x43, 0xA6, 0x56, 0x61, 0x20, 0x68, 0x87, 0xA1, 0xC3, 0x50, 0x0E,
+    0x18, 0xFC, 0x01, 0x63, 0xD3, 0xC1, 0xD4, 0xCD, 0xEB, 0xAE, 0x9F, 0x5E, 0x9C, 0x45, 0xEB, 0x6C,
+    0x29, 0x5C, 0x08, 0x24, 0x06, 0xAC, 0x23, 0x28, 0x84, 0x78, 0x2D, 0x06, 0x11, 0xAB, 0x8C, 0x0C,
+    0x20, 0x6F, 0x4F, 0x4F, 0x96, 0xE8, 0xEF, 0x73, 0x9C, 0xB8, 0xEC, 0x55, 0xC6, 0x9E, 0xB2, 0x64,
+    0x69, 0x99, 0xC1, 0xEC, 0x26, 0x72, 0x9C, 0x0B, 0xE9, 0x3A, 0x34, 0x53, 0xC5, 0x9D, 0xE5, 0x10,
+    0x31, 0xE9, 0xD5, 0x90, 0xF7, 0xE4, 0x7C, 0x2F, 0x58, 0x13, 0x3E, 0xDF, 0x11, 0xA2, 0x8B, 0xCD,
+    0x0A, 0x73, 0x6F, 0xC0, 0xAC, 0x4D, 0x60, 0xD0, 0x11, 0x9A, 0x0B, 0x0C, 0xBB, 0x22, 0x76, 0x94,
+    0xF9, 0x1A, 0xB3, 0xFC, 0xAB, 0x60, 0xAB, 0x8C, 0x9F, 0x9B, 0xBF, 0x83, 0xAC, 0x27, 0x84, 0xB3,
+    0xF9, 0x76, 0x4E, 0x4A, 0x5B, 0xB6, 0x23, 0x4E, 0xDD, 0x00, 0x87, 0x1F, 0x3F, 0xF0, 0xA5, 0x06,
+    0x01, 0xC8, 0xC9, 0x8A, 0x1C, 0xBB, 0xBB, 0x5B, 0x48, 0x61, 0x20, 0x39, 0xEC, 0xD0, 0x75, 0x2D,
+    0x72, 0xDE, 0xEB, 0xC7, 0x1E, 0x06, 0x39, 0x5D, 0xF1, 0xE5, 0xFB, 0x43, 0xF2, 0xD8, 0xD7, 0x96,
+    0x98, 0x98, 0x06, 0x85, 0x91, 0xA0, 0x35, 0x66, 0x13, 0xC5, 0xAE, 0x80, 0xCE, 0x45, 0xE8, 0x8D,
+    0x06, 0xAD, 0x02, 0x64, 0x47, 0x52, 0x37, 0xE2, 0x65, 0xAC, 0x45, 0x9F, 0xBB, 0xBD, 0x03, 0x3D,
+    0x92, 0x11, 0xAC, 0xD9, 0x7A, 0x95, 0xDD, 0x25, 0x71, 0x24, 0x7D, 0x68, 0x04, 0x64, 0x7E, 0xBF,
+    0x87, 0x4D, 0x62, 0x1B, 0x3D, 0x7B, 0x4C, 0xE4, 0x1B, 0xFD, 0x00, 0xDF, 0x10, 0x38, 0x90, 0x7E,
+    0xC7, 0xFF, 0x47, 0x00, 0xAE, 0x3D, 0xEF, 0x08, 0x58, 0xA4, 0xB7, 0xF7, 0x70, 0x60, 0x70, 0xCC,
+    0x8C, 0x7A, 0x9F, 0x63, 0x2C, 0x58, 0x72, 0xB6, 0x49, 0xD5, 0x6C, 0x4F, 0x35, 0xF3, 0x02, 0x16,
+    0xF6, 0x9A, 0xF7, 0x14, 0xE7, 0x0C, 0xF8, 0xFC, 0x12, 0x91, 0x3C, 0x89, 0x87, 0xDC, 0xE0, 0x3B,
+    0x3B, 0xE8, 0x2D, 0xB9, 0x59, 0xA7, 0xE5, 0x85, 0x2B, 0xA8, 0x6E, 0xA4, 0x96, 0x2F, 0x2D, 0x98,
+    0x8A, 0xDA, 0xC0, 0xDD, 0xD6, 0xE9, 0x81, 0x7D, 0xA4, 0xBA, 0xE7, 0xE4, 0x78, 0x91, 0xC2, 0x21,
+    0x36, 0x1E, 0x7B, 0xCE, 0xCF, 0x3B, 0x82, 0x71, 0xE1, 0xD1, 0x2B, 0xD8, 0x8A, 0x99, 0xC2, 0xB4,
+    0x0A, 0x22, 0x78, 0xA6, 0xCD, 0xEF, 0x2C, 0xBD, 0xB7, 0x80, 0x31, 0x19, 0xC8, 0x77, 0x25, 0xE7,
+    0x09, 0xF8, 0xFC, 0xC8, 0x7B, 0x94, 0xDD, 0xD9, 0x85, 0x36, 0x50, 0xA3, 0x1A, 0x93, 0xF7, 0x97,
+    0x17, 0x23, 0xD9, 0xA0, 0x3B, 0x8E, 0x05, 0xCF, 0xB3, 0x5F, 0xD6, 0xE4, 0xAB, 0xA2, 0xB1, 0x10,
+    0xC7, 0xA4, 0xCE, 0x08, 0x29, 0x67, 0x04, 0x81, 0xC9, 0x7B, 0x0D, 0x4C, 0x73, 0x44, 0x4C, 0xD4,
+    0x1B, 0xC6, 0x40, 0xC1, 0x6A, 0x89, 0xEC, 0xFA, 0x71, 0x4C, 0x55, 0x25, 0x58, 0x2C, 0x7C, 0xE4,
+    0x47, 0x79, 0x55, 0xC7, 0x67, 0x58, 0x1D, 0xFE, 0x0D, 0x03, 0x75, 0x83, 0xED, 0xF0, 0xFD, 0x88,
+    0xED, 0x62, 0x45, 0xF3, 0x06, 0x4D, 0x33, 0xF1, 0xA2, 0x8C, 0xC2, 0xC6, 0x38, 0x12, 0x7A, 0x49,
+    0xF3, 0x32, 0x08, 0x4E, 0xA0, 0x93, 0x6D, 0xA8, 0x87, 0xFC, 0xE2, 0xE4, 0x7C, 0x01, 0x37, 0x22,
+    0x37, 0xD9, 0xA8, 0x49, 0xFF, 0xFF, 0xB5, 0xCF, 0x3F, 0x20, 0x58, 0x8A, 0xC7, 0xCF, 0xA3, 0x46,
+    0x77, 0x73, 0x06, 0x54, 0xFD, 0x01, 0xCB, 0x53, 0x0F, 0xD1, 0x9A, 0x3E, 0xA1, 0xA8, 0x76, 0x74,
+    0xBA, 0x91, 0xBA, 0x90, 0xD5, 0x09, 0x7D, 0x41, 0x72, 0x0E, 0xFA, 0x49, 0x57, 0xC3, 0x09, 0x7D,
+    0x8E, 0xED, 0x10, 0xAE, 0x56, 0x30, 0x6C, 0x07, 0x5E, 0xBC, 0x84, 0x26, 0x1D, 0xFE, 0x46, 0x43,
+    0x9A, 0x00, 0xCB, 0x8F, 0x2F, 0xAA, 0x9E, 0xEC, 0x79, 0x28, 0x3E, 0x62, 0xED, 0xB0, 0x57, 0x56,
+    0x8B, 0xBE, 0x2F, 0x48, 0x3D, 0x85, 0xA9, 0xE0, 0x02, 0xA4, 0x06, 0x19, 0x4D, 0xD8, 0x96, 0x3F,
+    0x12, 0xCF, 0xD4, 0x83, 0x28, 0x44, 0xD3, 0xF7, 0x08, 0x6C, 0xF9, 0xA8, 0x03, 0xE0, 0xEF, 0x56,
+    0x6C, 0xE0, 0x61, 0xCC, 0x10, 0x9C, 0xD0, 0x3F, 0xA4, 0xC4, 0xBF, 0x77, 0x5B, 0x98, 0x61, 0x4C,
+    0xB7, 0xEA, 0xA1, 0xB9, 0x26, 0x6C, 0x23, 0xE0, 0x86, 0x25, 0x74, 0x72, 0x7E, 0x5F, 0xD3, 0x4D,
+    0xCD, 0x80, 0xB2, 0x2E, 0xB1, 0x3E, 0x3B, 0xE3, 0x3B, 0x06, 0xEA, 0x44, 0x0C, 0xB1, 0x7A, 0x11,
+    0x62, 0x65, 0x4C, 0x30, 0xF4, 0x81, 0x72, 0x5A, 0x21, 0x1F, 0x4B, 0x84, 0x11, 0x4B, 0x6D, 0x2B,
+    0x18, 0xD6, 0x00, 0x47, 0x51, 0xB3, 0x89, 0x8B, 0x6A, 0x3C, 0x20, 0x9D, 0x0E, 0x98, 0x5D, 0x96,
+    0x99, 0x54, 0xCB, 0x28, 0x38, 0x72, 0x65, 0x50, 0x5E, 0x97, 0xF8, 0xCF, 0xE1, 0x80, 0x86, 0xA5,
+    0x5C, 0xBD, 0xD8, 0x20, 0x21, 0x45, 0x4F, 0xD7, 0xE7, 0x28, 0xA8, 0x9C, 0x1E, 0x25, 0x7E, 0x20,
+    0xFD, 0xE2, 0xE3, 0xEE, 0x7B, 0x6A, 0x43, 0x35, 0x21, 0x8A, 0xCF, 0xA8, 0xBC, 0x5C, 0x97, 0x2B,
+    0xD1, 0x68, 0x0A, 0x22, 0xD5, 0x1E, 0x98, 0x01, 0xD8, 0x6B, 0xB6, 0xC2, 0xB0, 0x07, 0x84, 0xD4,
+    0x75, 0xB3, 0x6F, 0x30, 0x30, 0x54, 0x38, 0xF1, 0x0C, 0x69, 0x1A, 0xD8, 0x1D, 0x1E, 0xD0, 0x89,
+    0x16, 0x24, 0x09, 0x39, 0x6F, 0x3D, 0x7E, 0x9F, 0xCC, 0x81, 0xBB, 0xF5, 0x91, 0xCD, 0x14, 0x17,
+    0x61, 0x22, 0xA3, 0x64, 0x23, 0x32, 0xA0, 0x48, 0x41, 0x58, 0x26, 0x1A, 0xAA, 0xA8, 0xED, 0xD3,
+    0xC8, 0x68, 0xE9, 0x8C, 0x0E, 0x08, 0x22, 0x1F, 0xCE, 0xDA, 0x06, 0x67, 0xC4, 0x68, 0x2A, 0xE8,
+    0x6C, 0x97, 0xA0, 0xFD, 0x8B, 0x29, 0x26, 0xAA, 0x6D, 0xBC, 0x6B, 0x2D, 0x75, 0x21, 0xEC, 0x0A,
+    0x69, 0x9F, 0xC1, 0xB5, 0x29, 0xCF, 0x04, 0x60, 0xD7, 0xD1, 0x70, 0xC6, 0x0A, 0xE6, 0xD9, 0x0C,
+    0x41, 0xBE, 0xC3, 0x11, 0xF8, 0x6E, 0x77, 0x07, 0xEB, 0xA9, 0xC4, 0xD2, 0xF1, 0x70, 0x4B, 0x06,
+    0x48, 0xCB, 0xA2, 0xBB, 0x71, 0x03, 0x45, 0x8D, 0xD6, 0x1E, 0xA1, 0x09, 0x07, 0xA3, 0x4E, 0x45,
+    0x24, 0x00, 0xB7, 0xB4, 0xDD, 0x88, 0x98, 0xF0, 0xD6, 0x0B, 0x24, 0xDB, 0x12, 0x86, 0xEB, 0xC2,
+    0xF4, 0x42, 0x74, 0x0F, 0x39, 0xEC, 0x20, 0x7A, 0xC7, 0xB5, 0x53, 0x8A, 0xCF, 0x15, 0xFC, 0xC0,
+    0xFC, 0xC6, 0xD2, 0xFB, 0x8B, 0xA3, 0xF0, 0x78, 0x93, 0x85, 0x76, 0xBF, 0x43, 0x29, 0x06, 0x58,
+    0x2E, 0xA3, 0x90, 0xEA, 0x30, 0xF2, 0xF2, 0x97, 0x01, 0x6E, 0xD3, 0x1D, 0xB0, 0xA6, 0x09, 0x6B,
+    0x35, 0xE6, 0x50, 0xC0, 0x32, 0x48, 0x5D, 0xB6, 0xE8, 0xB0, 0x4B, 0xA1, 0x9F, 0x78, 0x54, 0xC6,
+    0x91, 0x2D, 0xA8, 0xA0, 0x1C, 0x13, 0x54, 0x5F, 0x04, 0x9F, 0x6E, 0x50, 0x54, 0xEC, 0x35, 0x01,
+    0x4B, 0xF9, 0x64, 0xC9, 0xE9, 0x96, 0xAA, 0xC0, 0xE6, 0x3C, 0xC4, 0xA0, 0xE9, 0xDF, 0xF4, 0x2D,
+    0x37, 0x26, 0x4E, 0x47, 0xF4, 0x46, 0xF3, 0x6E, 0x14, 0xC3, 0x6B, 0x45, 0x47, 0x23, 0xA9, 0x61,
+    0xB3, 0xFF, 0x7D, 0x5D, 0xD0, 0x68, 0x3A, 0x78, 0xEC, 0x39, 0x3D, 0x11, 0x95, 0x91, 0x41, 0x9C,
+    0x6A, 0x8F, 0x7D, 0x4D, 0x19, 0xA7, 0x4A, 0x51, 0x70, 0x11, 0x31, 0xDD, 0x11, 0x38, 0xD9, 0x3C,
+    0xC5, 0x2D, 0xA1, 0x6D, 0x91, 0xFB, 0x06, 0x3D, 0xC0, 0x08, 0x8E, 0xF4, 0xD3, 0x50, 0x51, 0x0D,
+    0x65, 0xC8, 0x4A, 0x10, 0xDC, 0x4F, 0x7F, 0xF6, 0x8C, 0xA2, 0x03, 0x68, 0x54, 0x5D, 0xC9, 0x74,
+    0x64, 0xE9, 0xF6, 0x3B, 0x8B, 0xCF, 0x88, 0xD6, 0xE5, 0xEA, 0x03, 0x71, 0x23, 0xE4, 0x9C, 0x96,
+    0xD5, 0x3E, 0xF6, 0x5D, 0x26, 0xA3, 0x0D, 0x03, 0x63, 0x21, 0xB0, 0x0C, 0xB8, 0xAB, 0x3A, 0x43,
+    0x47, 0x5E, 0xDB, 0xBE, 0xC3, 0x65, 0xD0, 0x8E, 0xC9, 0xE4, 0xE5, 0xE9, 0x12, 0x75, 0x59, 0x23,
+    0xA1, 0x0F, 0xC8, 0xB3, 0x27, 0x28, 0xC8, 0x73, 0x19, 0x2F, 0x20, 0x27, 0x81, 0x80, 0xE1, 0xB6,
+    0xE2, 0xD5, 0x11, 0xE5, 0xCB, 0x4F, 0xCE, 0xC9, 0x2C, 0x7A, 0xAC, 0xE6, 0x92, 0xEA, 0x5C, 0xE9,
+    0x3C, 0xE1, 0xA7, 0xE7, 0xCF, 0x38, 0x77, 0x97, 0x9A, 0xBE, 0x7B, 0x73, 0x0C, 0x2E, 0x7A, 0xF4,
+    0x5C, 0xC2, 0x3A, 0x55, 0x48, 0xD4, 0xED, 0x1B, 0xE7, 0x09, 0x2B, 0x15, 0xB5, 0x8F, 0x97, 0xF3,
+    0x84, 0xE0, 0x1B, 0x6F, 0xD1, 0xD0, 0xE0, 0xF5, 0xA5, 0xE2, 0x3D, 0x7A, 0xBF, 0xD3, 0xE1, 0x30,
+    0x1F, 0x38, 0x36, 0xE3, 0xEF, 0x94, 0xED, 0x05, 0xC3, 0xAB, 0x4E, 0xBC, 0x3C, 0x8D, 0x39, 0x86,
+    0xBA, 0xBE, 0x74, 0x1F, 0xAF, 0x89, 0xF8, 0x09, 0x7F, 0x72, 0xCA, 0x2A, 0x8D, 0x30, 0x37, 0x21,
+    0x2A, 0x56, 0xD6, 0x58, 0xB9, 0xBC, 0xC7, 0x96, 0x18, 0x6C, 0xA9, 0xAF, 0xBD, 0x39, 0x3E, 0xBB,
+    0x1D, 0x0E, 0xD0, 0xB3, 0xE9, 0x1E, 0xCA, 0x6B, 0x00, 0xBF, 0x79, 0x23, 0xE2, 0x29, 0x9D, 0x9C,
+    0x1A, 0xBD, 0x2C, 0x49, 0x37, 0xCA, 0xEB, 0x73, 0xFA, 0xC4, 0x8A, 0xB4, 0xF3, 0x67, 0xEE, 0x36,
+    0xE1, 0xFD, 0x1E, 0xE6, 0x82, 0xA0, 0xDB, 0xF8, 0x48, 0x49, 0x57, 0xF8, 0x44, 0x3B, 0x29, 0x3C,
+    0x58, 0x3A, 0x3A, 0x06, 0xC0, 0x12, 0xE3, 0xE3, 0xE5, 0x6C, 0x96, 0x7C, 0xEE, 0xF8, 0x6C, 0xCC,
+    0xDF, 0x15, 0x9F, 0xF1, 0x39, 0x1F, 0x81, 0xEA, 0x51, 0x1B, 0xD6, 0x41, 0xBA, 0x7A, 0x7E, 0xFA,
+    0x66, 0xD7, 0x26, 0x1C, 0xE7, 0x41, 0xF7, 0xD7, 0x02, 0xFB, 0xEA, 0x3D, 0x94, 0xD5, 0x66, 0x69,
+    0x7B, 0x7F, 0xA9, 0x51, 0xED, 0xF2, 0x9E, 0xF9, 0xDF, 0x53, 0xD8, 0x95, 0xF7, 0xEC, 0x21, 0xCB,
+    0xBA, 0x09, 0xB0, 0x7E, 0x46, 0x43, 0xE1, 0xCB, 0x08, 0x78, 0xB8, 0xCB, 0x10, 0x26, 0xC3, 0x46,
+    0x78, 0xB2, 0x86, 0xBF, 0x5E, 0x71, 0x4C, 0x08, 0x8B, 0xE7, 0x05, 0xC1, 0xA0, 0x1A, 0xB3, 0x25,
+    0x07, 0x3A, 0x68, 0x4F, 0x40, 0x1B, 0x34, 0xAC, 0xEE, 0x18, 0x2D, 0x5C, 0xAA, 0x26, 0xE3, 0x9A,
+    0xC1, 0xE0, 0xA2, 0x2C, 0xE3, 0x72, 0x5F, 0xA5, 0x59, 0x7C, 0x46, 0xBB, 0x67, 0x7E, 0xD4, 0x1B,
+    0x4A, 0xAB, 0x69, 0xCF, 0x44, 0x3C, 0x01, 0x22, 0x86, 0x9B, 0x43, 0x76, 0x7F, 0xED, 0x85, 0x64,
+    0xC2, 0x50, 0xC1, 0xF1, 0x8F, 0xFF, 0x5B, 0x74, 0x23, 0x1D, 0x6E, 0x3E, 0x06, 0x0E, 0x07, 0xD1,
+    0x72, 0xC5, 0xEF, 0x33, 0x69, 0x1A, 0xC3, 0x90, 0x2E, 0xC7, 0x2C, 0x98, 0x8E, 0x47, 0xCC, 0x9A,
+    0xE4, 0x77, 0x1F, 0xF7, 0xBB, 0x8C, 0x63, 0xCE, 0x1E, 0xEF, 0x09, 0x26, 0xAD, 0x78, 0xC5, 0x56,
+    0x1C, 0x2D, 0x9A, 0x79, 0xCB, 0x72, 0xBD, 0x6B, 0xDB, 0xF3, 0x6E, 0xE2, 0xD5, 0x12, 0x55, 0x5B,
+    0x71, 0x0E, 0xB6, 0x4C, 0x1D, 0x51, 0xCF, 0xB8, 0xE5, 0x30, 0x42, 0x99, 0xAC, 0xB6, 0x34, 0xF5,
+    0xAB, 0xB6, 0xA9, 0xAE, 0x0D, 0x66, 0xFD, 0xBE, 0x3B, 0x86, 0xCA, 0x86, 0xA7, 0x23, 0x0D, 0xBA,
+    0xC6, 0x2C, 0x4F, 0x8E, 0x27, 0x07, 0xF2, 0x99, 0xE9, 0x99, 0x91, 0x00, 0x47, 0xF5, 0x3A, 0xEC,
+    0x79, 0xE8, 0xA0, 0xDF, 0x77, 0xAD, 0x4E, 0x30, 0x0E, 0x58, 0x2D, 0x9F, 0x3D, 0xDE, 0xEB, 0xB9,
+    0xF5, 0x92, 0x40, 0x54, 0xCC, 0x04, 0x16, 0x17, 0x16, 0xF8, 0x8B, 0xEB, 0x87, 0xFB, 0xFD, 0x55,
+    0x53, 0x13, 0x03, 0x8C, 0xE8, 0x1D, 0x1D, 0x74, 0xA0, 0x57, 0xE8, 0x26, 0x43, 0x66, 0x5F, 0x94,
+    0xCC, 0x73, 0x14, 0x07, 0x4D, 0x20, 0x76, 0x02, 0xA6, 0x9B, 0xF1, 0x2A, 0xDF, 0xE6, 0xD7, 0x3C,
+    0x90, 0xE0, 0x34, 0x7E, 0x82, 0xEC, 0x81, 0xA7, 0x9A, 0x41, 0xF2, 0x30, 0xD2, 0xF1, 0x88, 0xF5,
+    0x14, 0x6D, 0x46, 0xBF, 0x60, 0xCA, 0xD9, 0x7F, 0xAC, 0x78, 0x9F, 0x55, 0xD0, 0x97, 0x7C, 0x36,
+    0xC6, 0x49, 0xF4, 0x9C, 0x63, 0x46, 0xAA, 0xE9, 0x86, 0x07, 0x9B, 0x05, 0xC7, 0xCD, 0x38, 0xDC,
+    0x52, 0xB2, 0x95, 0x7B, 0x9D, 0x6F, 0xAB, 0xAB, 0x63, 0x0C, 0xB7, 0x70, 0x3C, 0xD4, 0x94, 0x84,
+    0x0F, 0x45, 0x89, 0xC7, 0x3E, 0x61, 0x52, 0xB3, 0x7D, 0xAA, 0x59, 0xB3, 0x4B, 0xA8, 0xDB, 0x8A,
+    0xF9, 0xBE, 0x87, 0x60, 0xAE, 0x5B, 0x86, 0xF1, 0xD5, 0x98, 0x4D, 0x6F, 0x9B, 0xBE, 0xBC, 0x56,
+    0x8D, 0x11, 0xB7, 0xFA, 0x04, 0x5F, 0x5B, 0x32, 0x21, 0xD9, 0xFC, 0x1F, 0x22, 0x27, 0xAD, 0x7C,
+    0xDD, 0x45, 0x46, 0x2C, 0x6A, 0x8C, 0x74, 0xDB, 0xFB, 0x12, 0x92, 0x31, 0x4E, 0xAB, 0x8F, 0x69,
+    0xC8, 0xA0, 0x76, 0xC8, 0x63, 0xB0, 0x4D, 0x75, 0x21, 0x2F, 0xE7, 0x62, 0xBE, 0x59, 0xD8, 0x74,
+    0x45, 0x2A, 0x67, 0xF6, 0x31, 0x63, 0x6E, 0xEC, 0x08, 0x68, 0x56, 0x81, 0xB9, 0xD3, 0xF8, 0xCD,
+    0x6F, 0xD7, 0x18, 0xA9, 0x64, 0x6B, 0x9E, 0x24, 0x1D, 0xC6, 0x81, 0x39, 0xA5, 0xFF, 0x53, 0x4C,
+    0x66, 0x86, 0x88, 0xF6, 0xD0, 0x7D, 0xAB, 0x75, 0xE6, 0xDF, 0x22, 0x7B, 0xD3, 0x76, 0x95, 0xFE,
+    0x52, 0x8D, 0xAE, 0xBD, 0x65, 0x80, 0x25, 0x27, 0x71, 0x77, 0xCF, 0x43, 0x68, 0x2D, 0x51, 0x37,
+    0x3C, 0xD4, 0x1A, 0x6B, 0x14, 0xA5, 0x81, 0xB6, 0xB3, 0x48, 0x75, 0x0F, 0x45, 0x36, 0xA7, 0x75,
+    0x3E, 0x7F, 0xD6, 0x64, 0xD3, 0x1F, 0xC5, 0x64, 0xFD, 0x43, 0x0C, 0x26, 0x93, 0x71, 0x0F, 0x8B,
+    0xC6, 0x34, 0xA7, 0x15, 0x3E, 0x09, 0x57, 0x88, 0x59, 0xED, 0x61, 0x4B, 0xB0, 0xFF, 0xFA, 0x17,
+    0x31, 0x22, 0x9E, 0x1C, 0xA6, 0x2D, 0xA3, 0x38, 0x7B, 0x19, 0xB0, 0x4C, 0xE3, 0x9E, 0xB8, 0x18,
+    0x68, 0x24, 0x4C, 0x2F, 0x73, 0xA9, 0x77, 0x5A, 0x67, 0x7F, 0x8D, 0xDE, 0xFD, 0x3C, 0x3F, 0xA8,
+    0x6F, 0xFA, 0xC6, 0xBE, 0x6B, 0x2A, 0xD9, 0x4A, 0xF3, 0xF4, 0x45, 0x92, 0x70, 0x2D, 0x6A, 0x81,
+    0xDD, 0x76, 0x64, 0x9F, 0x4F, 0xDE, 0xDD, 0xDF, 0xB5, 0x6F, 0x1D, 0xB9, 0xF9, 0x8C, 0xD9, 0xE6,
+    0x0A, 0xBD, 0xF5, 0xB5, 0xAD, 0x05, 0xDD, 0x58, 0xCC, 0x3C, 0x3F, 0x08, 0x6E, 0x88, 0xB1, 0x8E,
+    0x78, 0x90, 0x35, 0x77, 0x7E, 0xB7, 0x87, 0xC5, 0x43, 0xCB, 0x19, 0xF3, 0x81, 0x10, 0x19, 0x63,
+    0x16, 0x75, 0x5A, 0xE3, 0x51, 0xA9, 0xDA, 0x57, 0xB4, 0xD2, 0x13, 0x56, 0xC2, 0xC0, 0x90, 0x74,
+    0xB4, 0x51, 0x0A, 0x0C, 0x8F, 0x6C, 0xDB, 0xEF, 0x79, 0xC2, 0x65, 0x02, 0xEA, 0x27, 0xF3, 0x26,
+    0xDE, 0x9C, 0xDD, 0x24, 0x0F, 0x35, 0x05, 0x89, 0xFD, 0x37, 0x49, 0x47, 0xCA, 0xEA, 0x9C, 0x31,
+    0x25, 0xB1, 0xEC, 0xC8, 0x25, 0x92, 0xBC, 0x84, 0x17, 0x2E, 0x41, 0x03, 0x41, 0x9D, 0x8C, 0x98,
+    0xC6, 0x09, 0xCE, 0xF2, 0x98, 0x9A, 0x67, 0x74, 0x69, 0xCD, 0xD8, 0x46, 0xBF, 0x19, 0xD9, 0x1E,
+    0x26, 0xA6, 0xFD, 0xFB, 0x0F, 0xF8, 0x1F, 0xF6, 0xDC, 0x3C, 0xFD, 0x50, 0x7E, 0x6F, 0xB5, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+  };
+
+  inline constexpr uint8_t gradient_rle[] = {
+    0x52, 0x4C, 0x00, 0x20, 0x00, 0x20, 0x00, 0xFF, 0x00, 0x00, 0x33, 0xCD, 0x33, 0xCF, 0x33, 0xD0,
+    0x43, 0xCA, 0x43, 0xCB, 0x43, 0xCD, 0x43, 0xCF, 0x43, 0xD0, 0x43, 0xD2, 0x43, 0xD4, 0x53, 0xC8,
+    0x53, 0xCA, 0x53, 0xCB, 0x53, 0xCD, 0x53, 0xCF, 0x53, 0xD0, 0x53, 0xD2, 0x53, 0xD4, 0x53, 0xD5,
+    0x5B, 0xC8, 0x5B, 0xCA, 0x5B, 0xCB, 0x5B, 0xCD, 0x5B, 0xCF, 0x5B, 0xD0, 0x5B, 0xD2, 0x5B, 0xD4,
+    0x5B, 0xD5, 0x6B, 0xC8, 0x6B, 0xCA, 0x6B, 0xCB, 0x6B, 0xCD, 0x6B, 0xCF, 0x6B, 0xD0, 0x6B, 0xD2,
+    0x6B, 0xD4, 0x6B, 0xD5, 0x6B, 0xD7, 0x7B, 0xC8, 0x7B, 0xCA, 0x7B, 0xCB, 0x7B, 0xCD, 0x7B, 0xCF,
+    0x7B, 0xD0, 0x7B, 0xD2, 0x7B, 0xD4, 0x7B, 0xD5, 0x7B, 0xD7, 0x83, 0xC8, 0x83, 0xCA, 0x83, 0xCB,
+    0x83, 0xCD, 0x83, 0xCF, 0x83, 0xD0, 0x83, 0xD2, 0x83, 0xD4, 0x83, 0xD5, 0x83, 0xD7, 0x93, 0xC8,
+    0x93, 0xCA, 0x93, 0xCB, 0x93, 0xCD, 0x93, 0xCF, 0x93, 0xD0, 0x93, 0xD2, 0x93, 0xD4, 0x93, 0xD5,
+    0xA3, 0xCA, 0xA3, 0xCB, 0xA3, 0xCD, 0xA3, 0xCF, 0xA3, 0xD0, 0xA3, 0xD2, 0xA3, 0xD4, 0xAB, 0xCB,
+    0xAB, 0xCD, 0xAB, 0xCF, 0xAB, 0xD0, 0xAB, 0xD2, 0xA3, 0xD5, 0xAB, 0xCA, 0xAB, 0xD4, 0x33, 0xCE,
+    0x33, 0xD1, 0x33, 0xD2, 0x3B, 0xCB, 0x3B, 0xCD, 0x3B, 0xCF, 0x3B, 0xD0, 0x3B, 0xD2, 0x43, 0xCC,
+    0x43, 0xCE, 0x43, 0xD1, 0x43, 0xD3, 0x4B, 0xCA, 0x4B, 0xCB, 0x4B, 0xCD, 0x4B, 0xCF, 0x4B, 0xD0,
+    0x4B, 0xD2, 0x4B, 0xD4, 0x4B, 0xD5, 0x53, 0xC9, 0x53, 0xCC, 0x53, 0xCE, 0x53, 0xD1, 0x53, 0xD3,
+    0x53, 0xD6, 0x5B, 0xC7, 0x5B, 0xC9, 0x5B, 0xCC, 0x5B, 0xCE, 0x5B, 0xD1, 0x5B, 0xD3, 0x5B, 0xD6,
+    0x5B, 0xD7, 0x63, 0xC8, 0x63, 0xCA, 0x63, 0xCB, 0x63, 0xCD, 0x63, 0xCF, 0x63, 0xD0, 0x63, 0xD2,
+    0x63, 0xD4, 0x63, 0xD5, 0x63, 0xD7, 0x6B, 0xC6, 0x6B, 0xC7, 0x6B, 0xC9, 0x6B, 0xCC, 0x6B, 0xCE,
+    0x6B, 0xD1, 0x6B, 0xD3, 0x6B, 0xD6, 0x73, 0xC8, 0x73, 0xCA, 0x73, 0xCB, 0x73, 0xCD, 0x73, 0xCF,
+    0x73, 0xD0, 0x73, 0xD2, 0x73, 0xD4, 0x73, 0xD5, 0x73, 0xD7, 0x7B, 0xC6, 0x7B, 0xC7, 0x7B, 0xC9,
+    0x7B, 0xCC, 0x7B, 0xCE, 0x7B, 0xD1, 0x7B, 0xD3, 0x7B, 0xD6, 0x83, 0xC6, 0x83, 0xC7, 0x83, 0xC9,
+    0x83, 0xCC, 0x83, 0xCE, 0x83, 0xD1, 0x83, 0xD3, 0x83, 0xD6, 0x8B, 0xC8, 0x8B, 0xCA, 0x8B, 0xCB,
+    0x8B, 0xCD, 0x8B, 0xCF, 0x8B, 0xD0, 0x8B, 0xD2, 0x8B, 0xD4, 0x8B, 0xD5, 0x93, 0xC9, 0x93, 0xCC,
+    0x93, 0xCE, 0x93, 0xD1, 0x93, 0xD3, 0x93, 0xD6, 0x9B, 0xC8, 0x9B, 0xCA, 0x9B, 0xCB, 0x9B, 0xCD,
+    0x9B, 0xCF, 0x9B, 0xD0, 0x9B, 0xD2, 0x9B, 0xD4, 0x9B, 0xD5, 0xA3, 0xC9, 0xA3, 0xCC, 0xA3, 0xCE,
+    0xA3, 0xD1, 0xA3, 0xD3, 0xAB, 0xCC, 0xAB, 0xCE, 0xAB, 0xD1, 0xAB, 0xD3, 0xB3, 0xCD, 0xB3, 0xCF,
+    0xB3, 0xD0, 0xB3, 0xD2, 0xBB, 0xCD, 0xBB, 0xCF, 0xBB, 0xD0, 0x33, 0xCB, 0x33, 0xCC, 0x3B, 0xCA,
+    0x3B, 0xCC, 0x3B, 0xCE, 0x3B, 0xD1, 0x3B, 0xD3, 0x3B, 0xD4, 0x43, 0xC9, 0x43, 0xD5, 0x4B, 0xC8,
+    0x4B, 0xC9, 0x4B, 0xCC, 0x4B, 0xCE, 0x4B, 0xD1, 0x4B, 0xD3, 0x63, 0xC6, 0x63, 0xC7, 0x63, 0xC9,
+    0x63, 0xCC, 0x63, 0xCE, 0x63, 0xD1, 0x63, 0xD3, 0x63, 0xD6, 0x73, 0xC6, 0x73, 0xC7, 0x73, 0xC9,
+    0x73, 0xCC, 0x73, 0xCE, 0x73, 0xD1, 0x73, 0xD3, 0x73, 0xD6, 0x8B, 0xC7, 0x8B, 0xC9, 0x8B, 0xCC,
+    0x8B, 0xCE, 0x8B, 0xD1, 0x8B, 0xD3, 0x8B, 0xD6, 0x8B, 0xD7, 0x93, 0xC7, 0x93, 0xD7, 0x9B, 0xC9,
+    0x9B, 0xCC, 0x9B, 0xCE, 0x9B, 0xD1, 0x9B, 0xD3, 0x9B, 0xD6, 0xA3, 0xC8, 0xB3, 0xCB, 0xB3, 0xCC,
+    0xB3, 0xCE, 0xB3, 0xD1, 0xBB, 0xCE, 0xBB, 0xD1, 0x4B, 0x00, 0x87, 0x7E, 0x26, 0x26, 0x90, 0x30,
+    0x30, 0x3A, 0x3A, 0x15, 0x00, 0x8B, 0x74, 0x74, 0x7E, 0x26, 0x26, 0x90, 0x30, 0x30, 0x3A, 0x3A,
+    0xF0, 0xF2, 0x11, 0x00, 0x8F, 0x6C, 0x6C, 0x73, 0x73, 0xE0, 0x86, 0x86, 0xE8, 0x98, 0x98, 0xA0,
+    0xA0, 0xEF, 0xAF, 0xAF, 0xF8, 0x0E, 0x00, 0x91, 0x66, 0x13, 0x13, 0x1C, 0x1C, 0x7D, 0x25, 0x25,
+    0x8F, 0x2F, 0x2F, 0x39, 0x39, 0xA9, 0x43, 0x43, 0xB8, 0x50, 0x0C, 0x00, 0x93, 0xD2, 0x66, 0x13,
+    0x13, 0x1C, 0x1C, 0x7D, 0x25, 0x25, 0x8F, 0x2F, 0x2F, 0x39, 0x39, 0xA9, 0x43, 0x43, 0xB8, 0x50,
+    0x50, 0x0A, 0x00, 0x95, 0x0A, 0x0A, 0x65, 0x12, 0x12, 0x1B, 0x1B, 0x7C, 0x24, 0x24, 0x8E, 0x2E,
+    0x2E, 0x38, 0x38, 0xA8, 0x42, 0x42, 0xB7, 0x4A, 0x4A, 0x52, 0x08, 0x00, 0x97, 0xD0, 0x0A, 0x0A,
+    0x65, 0x12, 0x12, 0x1B, 0x1B, 0x7C, 0x24, 0x24, 0x8E, 0x2E, 0x2E, 0x38, 0x38, 0xA8, 0x42, 0x42,
+    0xB7, 0x4A, 0x4A, 0x52, 0x52, 0x07, 0x00, 0x97, 0xCF, 0x5E, 0x5E, 0xD8, 0x6B, 0x6B, 0x72, 0x72,
+    0xDF, 0x85, 0x85, 0xE7, 0x97, 0x97, 0x9F, 0x9F, 0xEE, 0xAE, 0xAE, 0xF7, 0xBD, 0xBD, 0xC1, 0xC1,
+    0x06, 0x00, 0x99, 0x55, 0x5A, 0x09, 0x09, 0x64, 0x11, 0x11, 0x1A, 0x1A, 0x7B, 0x23, 0x23, 0x8D,
+    0x2D, 0x2D, 0x37, 0x37, 0xA7, 0x41, 0x41, 0xB6, 0x49, 0x49, 0x4F, 0x4F, 0xC5, 0x05, 0x00, 0x99,
+    0x55, 0x5A, 0x09, 0x09, 0x64, 0x11, 0x11, 0x1A, 0x1A, 0x7B, 0x23, 0x23, 0x8D, 0x2D, 0x2D, 0x37,
+    0x37, 0xA7, 0x41, 0x41, 0xB6, 0x49, 0x49, 0x4F, 0x4F, 0xC5, 0x04, 0x00, 0x9B, 0x54, 0x54, 0xCE,
+    0x5D, 0x5D, 0xD7, 0x6A, 0x6A, 0x71, 0x71, 0xDE, 0x84, 0x84, 0xE6, 0x96, 0x96, 0x9E, 0x9E, 0xED,
+    0xAD, 0xAD, 0xF6, 0xBC, 0xBC, 0xC0, 0xC0, 0xFD, 0xFF, 0x03, 0x00, 0x9B, 0x03, 0x03, 0x59, 0x08,
+    0x08, 0x63, 0x10, 0x10, 0x19, 0x19, 0x7A, 0x22, 0x22, 0x8C, 0x2C, 0x2C, 0x36, 0x36, 0xA6, 0x40,
+    0x40, 0xB5, 0x48, 0x48, 0x4E, 0x4E, 0xC4, 0xC8, 0x03, 0x00, 0x9B, 0x03, 0x03, 0x59, 0x08, 0x08,
+    0x63, 0x10, 0x10, 0x19, 0x19, 0x7A, 0x22, 0x22, 0x8C, 0x2C, 0x2C, 0x36, 0x36, 0xA6, 0x40, 0x40,
+    0xB5, 0x48, 0x48, 0x4E, 0x4E, 0xC4, 0xC8, 0x03, 0x00, 0x9B, 0x02, 0x02, 0x58, 0x07, 0x07, 0x62,
+    0x0F, 0x0F, 0x18, 0x18, 0x79, 0x21, 0x21, 0x8B, 0x2B, 0x2B, 0x35, 0x35, 0xA5, 0x3F, 0x3F, 0xB4,
+    0x47, 0x47, 0x4D, 0x4D, 0xC3, 0xC7, 0x03, 0x00, 0x9B, 0x02, 0x02, 0x58, 0x07, 0x07, 0x62, 0x0F,
+    0x0F, 0x18, 0x18, 0x79, 0x21, 0x21, 0x8B, 0x2B, 0x2B, 0x35, 0x35, 0xA5, 0x3F, 0x3F, 0xB4, 0x47,
+    0x47, 0x4D, 0x4D, 0xC3, 0xC7, 0x03, 0x00, 0x9B, 0x53, 0x53, 0xCD, 0x5C, 0x5C, 0xD6, 0x69, 0x69,
+    0x70, 0x70, 0xDD, 0x83, 0x83, 0xE5, 0x95, 0x95, 0x9D, 0x9D, 0xEC, 0xAC, 0xAC, 0xF5, 0xBB, 0xBB,
+    0xBF, 0xBF, 0xFC, 0xFE, 0x03, 0x00, 0x9B, 0x01, 0x01, 0x57, 0x06, 0x06, 0x61, 0x0E, 0x0E, 0x17,
+    0x17, 0x78, 0x20, 0x20, 0x8A, 0x2A, 0x2A, 0x34, 0x34, 0xA4, 0x3E, 0x3E, 0xB3, 0x46, 0x46, 0x4C,
+    0x4C, 0xC2, 0xC6, 0x03, 0x00, 0x9B, 0x01, 0x01, 0x57, 0x06, 0x06, 0x61, 0x0E, 0x0E, 0x17, 0x17,
+    0x78, 0x20, 0x20, 0x8A, 0x2A, 0x2A, 0x34, 0x34, 0xA4, 0x3E, 0x3E, 0xB3, 0x46, 0x46, 0x4C, 0x4C,
+    0xC2, 0xC6, 0x04, 0x00, 0x99, 0xCA, 0xCC, 0x5B, 0x5B, 0xD5, 0x68, 0x68, 0x6F, 0x6F, 0xDC, 0x82,
+    0x82, 0xE4, 0x94, 0x94, 0x9C, 0x9C, 0xEB, 0xAB, 0xAB, 0xF4, 0xBA, 0xBA, 0xBE, 0xBE, 0xFB, 0x05,
+    0x00, 0x99, 0xC9, 0x56, 0x05, 0x05, 0x60, 0x0D, 0x0D, 0x16, 0x16, 0x77, 0x1F, 0x1F, 0x89, 0x29,
+    0x29, 0x33, 0x33, 0xA3, 0x3D, 0x3D, 0xB2, 0x45, 0x45, 0x4B, 0x4B, 0xFA, 0x06, 0x00, 0x97, 0x56,
+    0x05, 0x05, 0x60, 0x0D, 0x0D, 0x16, 0x16, 0x77, 0x1F, 0x1F, 0x89, 0x29, 0x29, 0x33, 0x33, 0xA3,
+    0x3D, 0x3D, 0xB2, 0x45, 0x45, 0x4B, 0x4B, 0x07, 0x00, 0x97, 0xCB, 0x04, 0x04, 0x5F, 0x0C, 0x0C,
+    0x15, 0x15, 0x76, 0x1E, 0x1E, 0x88, 0x28, 0x28, 0x32, 0x32, 0xA2, 0x3C, 0x3C, 0xB1, 0x44, 0x44,
+    0x51, 0x51, 0x08, 0x00, 0x95, 0x04, 0x04, 0x5F, 0x0C, 0x0C, 0x15, 0x15, 0x76, 0x1E, 0x1E, 0x88,
+    0x28, 0x28, 0x32, 0x32, 0xA2, 0x3C, 0x3C, 0xB1, 0x44, 0x44, 0x51, 0x0A, 0x00, 0x93, 0xD1, 0xD4,
+    0x67, 0x67, 0x6E, 0x6E, 0xDB, 0x81, 0x81, 0xE3, 0x93, 0x93, 0x9B, 0x9B, 0xEA, 0xAA, 0xAA, 0xF3,
+    0xB9, 0xB9, 0x0C, 0x00, 0x91, 0xD3, 0x0B, 0x0B, 0x14, 0x14, 0x75, 0x1D, 0x1D, 0x87, 0x27, 0x27,
+    0x31, 0x31, 0xA1, 0x3B, 0x3B, 0xB0, 0xF9, 0x0E, 0x00, 0x8F, 0x0B, 0x0B, 0x14, 0x14, 0x75, 0x1D,
+    0x1D, 0x87, 0x27, 0x27, 0x31, 0x31, 0xA1, 0x3B, 0x3B, 0xB0, 0x11, 0x00, 0x8B, 0x6D, 0x6D, 0xDA,
+    0x80, 0x80, 0xE2, 0x92, 0x92, 0x9A, 0x9A, 0xE9, 0xF1, 0x15, 0x00, 0x87, 0xD9, 0x7F, 0x7F, 0xE1,
+    0x91, 0x91, 0x99, 0x99, 0x4B, 0x00,
+  };
+
+  inline constexpr uint8_t flat_rle[] = {
+    0x52, 0x4C, 0x00, 0x20, 0x00, 0x20, 0x03, 0x0D, 0x00, 0x00, 0x1C, 0x5C, 0xFF, 0xFF, 0x2C, 0x7C,
+    0x55, 0x3D, 0x3C, 0xBD, 0x75, 0xBD, 0x8E, 0x1E, 0x9E, 0x5E, 0xBE, 0xDE, 0xC7, 0x1F, 0xD7, 0x5F,
+    0xE7, 0x9F, 0xF7, 0xBF, 0x21, 0x00, 0x1B, 0x01, 0x82, 0x00, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D,
+    0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D,
+    0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x81, 0xA4, 0x10,
+    0x01, 0x81, 0x00, 0x0A, 0x01, 0x83, 0x22, 0x95, 0x0E, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x85, 0x22,
+    0x22, 0x83, 0x0C, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x04, 0x02, 0x82, 0xD7, 0x30, 0x0A, 0x01, 0x81,
+    0x00, 0x0A, 0x01, 0x06, 0x02, 0x81, 0xC6, 0x09, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x08, 0x02, 0x81,
+    0xB4, 0x07, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x08, 0x02, 0x81, 0xB4, 0x07, 0x01, 0x81, 0x00, 0x0A,
+    0x01, 0x06, 0x02, 0x81, 0xC6, 0x09, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x04, 0x02, 0x82, 0xD7, 0x30,
+    0x0A, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x85, 0x22, 0x22, 0x83, 0x0C, 0x01, 0x81, 0x00, 0x0A, 0x01,
+    0x83, 0x22, 0x95, 0x0E, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x81, 0xA4, 0x10, 0x01, 0x81, 0x00, 0x1D,
+    0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D,
+    0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x82, 0x00, 0x00,
+    0x1B, 0x01, 0x21, 0x00,
+  };
+
+  inline constexpr uint8_t outline_rle[] = {
+    0x52, 0x4C, 0x00, 0x20, 0x00, 0x20, 0x03, 0x01, 0x00, 0x00, 0x29, 0x46, 0x7F, 0x00, 0x2F, 0x00,
+    0x80, 0x10, 0x1D, 0x00, 0x81, 0x11, 0x1C, 0x00, 0x82, 0x11, 0x10, 0x05, 0x00, 0x81, 0x11, 0x13,
+    0x00, 0x83, 0x11, 0x11, 0x04, 0x00, 0x83, 0x11, 0x11, 0x12, 0x00, 0x83, 0x11, 0x11, 0x05, 0x00,
+    0x82, 0x11, 0x10, 0x11, 0x00, 0x04, 0x01, 0x89, 0x00, 0x00, 0x10, 0x01, 0x11, 0x0F, 0x00, 0x05,
+    0x01, 0x89, 0x00, 0x01, 0x11, 0x01, 0x11, 0x0A, 0x00, 0x0A, 0x01, 0x8A, 0x00, 0x01, 0x11, 0x00,
+    0x11, 0x10, 0x09, 0x00, 0x0A, 0x01, 0x8A, 0x00, 0x00, 0x11, 0x10, 0x11, 0x10, 0x09, 0x00, 0x0A,
+    0x01, 0x8A, 0x00, 0x00, 0x11, 0x10, 0x01, 0x10, 0x09, 0x00, 0x0A, 0x01, 0x04, 0x00, 0x85, 0x11,
+    0x00, 0x11, 0x09, 0x00, 0x0A, 0x01, 0x04, 0x00, 0x85, 0x11, 0x00, 0x11, 0x09, 0x00, 0x0A, 0x01,
+    0x8A, 0x00, 0x00, 0x11, 0x10, 0x01, 0x10, 0x09, 0x00, 0x0A, 0x01, 0x8A, 0x00, 0x00, 0x11, 0x10,
+    0x11, 0x10, 0x09, 0x00, 0x0A, 0x01, 0x8A, 0x00, 0x01, 0x11, 0x00, 0x11, 0x10, 0x0E, 0x00, 0x05,
+    0x01, 0x89, 0x00, 0x01, 0x11, 0x01, 0x11, 0x10, 0x00, 0x04, 0x01, 0x89, 0x00, 0x00, 0x10, 0x01,
+    0x11, 0x11, 0x00, 0x83, 0x11, 0x11, 0x05, 0x00, 0x82, 0x11, 0x10, 0x12, 0x00, 0x83, 0x11, 0x11,
+    0x04, 0x00, 0x83, 0x11, 0x11, 0x13, 0x00, 0x82, 0x11, 0x10, 0x05, 0x00, 0x81, 0x11, 0x15, 0x00,
+    0x81, 0x11, 0x1E, 0x00, 0x80, 0x10, 0x7F, 0x00, 0x2E, 0x00,
+  };
+
+  inline constexpr uint8_t photo_rle[] = {
+    0x52, 0x4C, 0x00, 0x20, 0x00, 0x20, 0x02, 0xFE, 0x00, 0x00, 0xDE, 0x05, 0x1D, 0x8F, 0xD9, 0x51,
+    0x21, 0x27, 0x25, 0x0D, 0x25, 0xB1, 0x29, 0x45, 0x2C, 0xB1, 0x2D, 0x6F, 0x2D, 0x8B, 0x35, 0x51,
+    0x42, 0x8D, 0x44, 0xB3, 0x49, 0x05, 0x4C, 0x27, 0x52, 0x24, 0x52, 0xC8, 0x53, 0x65, 0x53, 0x70,
+    0x54, 0x6B, 0x55, 0x12, 0x58, 0xAA, 0x59, 0xAD, 0x5B, 0x24, 0x5C, 0x31, 0x5C, 0xED, 0x60, 0xC5,
+    0x62, 0x2E, 0x63, 0x6A, 0x6A, 0xF0, 0x73, 0x26, 0x73, 0x4B, 0x74, 0x8C, 0x74, 0xEE, 0x7B, 0x8C,
+    0x7C, 0x4E, 0x80, 0xB2, 0x81, 0xA9, 0x82, 0x26, 0x83, 0x26, 0x8A, 0xEC, 0x8D, 0x50, 0x92, 0x8B,
+    0x96, 0x33, 0x99, 0xA5, 0x9B, 0x8E, 0x9B, 0xCF, 0x9C, 0x2F, 0x9C, 0xE9, 0x9D, 0x68, 0xA0, 0x86,
+    0xA3, 0x2E, 0xA3, 0x44, 0xA3, 0xC5, 0xA4, 0xE4, 0xA9, 0xA7, 0xAA, 0x24, 0xAA, 0xB0, 0xAB, 0x26,
+    0xAC, 0x2B, 0xAD, 0x0C, 0xB2, 0xA4, 0xB3, 0x52, 0xB3, 0xD0, 0xB4, 0xE3, 0xB4, 0xE6, 0xB9, 0x52,
+    0xBA, 0xAB, 0xBC, 0x51, 0xBC, 0xF1, 0xC1, 0x10, 0xC3, 0x65, 0xC3, 0xD1, 0xC4, 0x08, 0xC5, 0xC5,
+    0xC8, 0xCC, 0xC8, 0xEA, 0xC9, 0x89, 0xCA, 0x06, 0xCA, 0xA7, 0xCC, 0x6B, 0xCC, 0xEA, 0xD3, 0xB2,
+    0xD4, 0x25, 0xD5, 0x33, 0xDA, 0x30, 0xDA, 0x92, 0x18, 0xA3, 0x1C, 0x0B, 0x20, 0xE4, 0x21, 0x44,
+    0x22, 0x04, 0x22, 0xC7, 0x22, 0xE4, 0x22, 0xEA, 0x23, 0x65, 0x23, 0xCA, 0x24, 0x06, 0x24, 0x6F,
+    0x25, 0x10, 0x25, 0x52, 0x29, 0xE9, 0x2A, 0x06, 0x2A, 0x44, 0x2A, 0xAA, 0x2A, 0xC7, 0x2B, 0x2C,
+    0x2C, 0xA7, 0x2C, 0xC9, 0x2D, 0x28, 0x2D, 0xAE, 0x2D, 0xCF, 0x2E, 0x12, 0x33, 0x05, 0x33, 0x27,
+    0x33, 0x86, 0x33, 0xA8, 0x34, 0x0B, 0x34, 0xEB, 0x35, 0x48, 0x38, 0xE4, 0x39, 0x28, 0x39, 0x45,
+    0x39, 0xA5, 0x3A, 0x25, 0x3A, 0xA7, 0x3B, 0x0D, 0x3B, 0xEF, 0x3D, 0x11, 0x40, 0xE8, 0x41, 0x0A,
+    0x43, 0x90, 0x44, 0x70, 0x45, 0x8B, 0x45, 0xCD, 0x45, 0xD3, 0x46, 0x0E, 0x49, 0xED, 0x4A, 0xA4,
+    0x4A, 0xC7, 0x4C, 0xAC, 0x4C, 0xCF, 0x50, 0xE8, 0x51, 0x85, 0x52, 0x67, 0x53, 0xAA, 0x54, 0x88,
+    0x58, 0xC4, 0x59, 0x2C, 0x59, 0xE7, 0x5C, 0xAC, 0x5D, 0x89, 0x5D, 0xAF, 0x5D, 0xEB, 0x5E, 0x0F,
+    0x61, 0x85, 0x63, 0xAF, 0x64, 0x71, 0x64, 0xA7, 0x69, 0x47, 0x6A, 0x44, 0x6D, 0x46, 0x6D, 0x4B,
+    0x6D, 0xAF, 0x6E, 0x0B, 0x71, 0x4A, 0x72, 0x89, 0x74, 0x4D, 0x75, 0x88, 0x78, 0xE5, 0x7D, 0xD1,
+    0x84, 0x25, 0x85, 0x25, 0x88, 0xA5, 0x88, 0xE5, 0x88, 0xF2, 0x89, 0x28, 0x89, 0xE4, 0x8A, 0xC5,
+    0x8C, 0x0C, 0x8C, 0x6A, 0x8C, 0x85, 0x8D, 0x89, 0x8E, 0x29, 0x92, 0xEE, 0x94, 0x8E, 0x98, 0xB2,
+    0x9A, 0x0B, 0x9A, 0x6E, 0x9B, 0xC4, 0x9D, 0xE8, 0xA0, 0xE9, 0xA1, 0x93, 0xA2, 0x12, 0xA4, 0x90,
+    0xA5, 0x85, 0xA5, 0x92, 0xA9, 0x12, 0xAB, 0x04, 0xAC, 0x0D, 0xAC, 0x10, 0xB0, 0xEA, 0xB1, 0x08,
+    0xB1, 0x4A, 0xB1, 0x67, 0xB1, 0x8F, 0xB1, 0xC6, 0xB1, 0xED, 0xB2, 0x0E, 0xB2, 0xCD, 0xB4, 0x66,
+    0xB4, 0xCA, 0xB5, 0x64, 0xB5, 0x72, 0xB5, 0xE6, 0xB6, 0x13, 0xBA, 0x54, 0xBA, 0x73, 0xBA, 0xF3,
+    0xBC, 0x09, 0xBC, 0x0C, 0xBD, 0xC8, 0xC2, 0xE9, 0xC3, 0xE5, 0xC4, 0x52, 0xC4, 0xE5, 0xC4, 0xF2,
+    0xC5, 0x63, 0xC5, 0xD3, 0xC8, 0xEF, 0xC9, 0x51, 0xC9, 0x6C, 0xCA, 0x2F, 0xCA, 0xEF, 0xCA, 0xF2,
+    0xCB, 0x46, 0xCC, 0xC7, 0xCD, 0x49, 0xD1, 0x0C, 0xD1, 0x6E, 0xD2, 0x0A, 0xD2, 0x12, 0xD2, 0x4C,
+    0xD3, 0xE6, 0xD4, 0x14, 0xD4, 0x93, 0xD4, 0xC5, 0xD5, 0x26, 0xD5, 0xB4, 0xD5, 0xC5, 0xDA, 0xCA,
+    0xDA, 0xF2, 0xDB, 0x52, 0xDD, 0x48, 0x2A, 0x00, 0x89, 0xE5, 0xE5, 0xD8, 0xC5, 0x2C, 0xAB, 0xA4,
+    0x9B, 0x89, 0x6F, 0x13, 0x00, 0x8D, 0xF9, 0xF9, 0xE5, 0xD6, 0xD8, 0x2A, 0x2A, 0xAB, 0xA4, 0x9B,
+    0x86, 0x87, 0x0A, 0x0A, 0x0F, 0x00, 0x91, 0x55, 0xE3, 0x55, 0xE3, 0x46, 0xD6, 0xC5, 0xD6, 0x2A,
+    0x22, 0x1A, 0x99, 0x87, 0x86, 0x6D, 0x6E, 0x78, 0x6E, 0x0C, 0x00, 0x02, 0xF6, 0x90, 0x55, 0xF6,
+    0xE1, 0xE3, 0xC9, 0xC3, 0xBA, 0x22, 0x97, 0x97, 0x8D, 0x77, 0x6D, 0x6C, 0x6E, 0x6C, 0x78, 0x0A,
+    0x00, 0x91, 0xE1, 0x49, 0xF5, 0xF5, 0xF6, 0xE1, 0xC9, 0x45, 0xC3, 0x30, 0x23, 0xA8, 0xA8, 0x8D,
+    0x14, 0x75, 0x62, 0x6C, 0x03, 0x62, 0x08, 0x00, 0x91, 0x3F, 0xF5, 0xEB, 0x53, 0xFD, 0x53, 0x53,
+    0x49, 0x49, 0x40, 0x2E, 0x23, 0x23, 0x1D, 0x92, 0x92, 0x75, 0x75, 0x02, 0x60, 0x82, 0x5E, 0x74,
+    0x5E, 0x06, 0x00, 0x99, 0xDB, 0xDA, 0xDB, 0xFC, 0xEB, 0xFD, 0xEB, 0xFC, 0xEA, 0xD2, 0xBD, 0x34,
+    0x29, 0xA7, 0x20, 0x11, 0x8C, 0x6A, 0x5E, 0x5E, 0x73, 0x6A, 0x5E, 0x72, 0x72, 0x8B, 0x05, 0x00,
+    0x99, 0xD9, 0xDA, 0xD9, 0xF2, 0xFC, 0xE9, 0x57, 0x56, 0xE9, 0xD1, 0xBD, 0xBC, 0x2B, 0xA7, 0xA7,
+    0x91, 0x8C, 0x67, 0x68, 0x68, 0x5D, 0x5C, 0x5C, 0x7D, 0x68, 0x7D, 0x04, 0x00, 0x83, 0xC2, 0xD9,
+    0x43, 0xE7, 0x02, 0xF2, 0x94, 0x56, 0x56, 0xE9, 0xD0, 0xD0, 0xBC, 0x26, 0xA0, 0x96, 0x96, 0x7C,
+    0x7C, 0x5B, 0x5B, 0x67, 0x5C, 0x5B, 0x7C, 0x7D, 0x7C, 0x0E, 0x03, 0x00, 0x9B, 0xC1, 0xC6, 0x43,
+    0xF2, 0x47, 0x03, 0x03, 0xF0, 0x4C, 0xF0, 0xCA, 0xC0, 0xB1, 0xB1, 0xA6, 0xA0, 0x0E, 0x7B, 0x07,
+    0x5A, 0x5A, 0x07, 0x58, 0x5A, 0x07, 0x07, 0x7B, 0x0E, 0x02, 0x00, 0xC6, 0xB0, 0xBB, 0x43, 0x43,
+    0x47, 0xE6, 0x03, 0xE7, 0xF0, 0xEF, 0xCA, 0xCC, 0xC0, 0xCC, 0xAA, 0x1B, 0xA0, 0x94, 0x79, 0x5A,
+    0x58, 0x58, 0x5B, 0x58, 0x7B, 0x58, 0x7A, 0x82, 0x8F, 0xA0, 0x00, 0x00, 0x25, 0xBB, 0xC6, 0xE7,
+    0xE7, 0x03, 0xE6, 0xE6, 0x4C, 0x4D, 0x4D, 0xCA, 0xC0, 0xAE, 0xB1, 0x1B, 0xA0, 0xA0, 0x0E, 0x5A,
+    0x07, 0x58, 0x58, 0x5A, 0x5A, 0x04, 0x7A, 0x82, 0x8F, 0xA6, 0x00, 0x00, 0xB0, 0xBB, 0xC6, 0xE7,
+    0xE6, 0x03, 0xF0, 0x02, 0xEF, 0xBE, 0x4D, 0xCB, 0x33, 0xAF, 0xAA, 0xAA, 0x94, 0x1B, 0x0E, 0x5A,
+    0x5A, 0x58, 0x5A, 0x58, 0x58, 0x04, 0x7A, 0x83, 0x8F, 0x16, 0x00, 0x00, 0xB0, 0xC1, 0x43, 0x47,
+    0xE6, 0xF0, 0x4C, 0xEF, 0x4D, 0xE8, 0x4E, 0xCB, 0xCB, 0xCD, 0xAE, 0xAA, 0x94, 0x0E, 0x90, 0x79,
+    0x58, 0x5B, 0x58, 0x04, 0x5A, 0x7A, 0x7A, 0x82, 0x82, 0x95, 0x00, 0x00, 0xB0, 0xC1, 0xCE, 0xE7,
+    0xE6, 0xF0, 0xE8, 0x4D, 0x4D, 0x02, 0x4E, 0x8A, 0xCD, 0x38, 0xAF, 0xAA, 0x9C, 0x9C, 0x79, 0x7C,
+    0x5A, 0x07, 0x5B, 0x02, 0x04, 0x9D, 0x7A, 0x83, 0x17, 0x95, 0x00, 0x00, 0xC2, 0xC2, 0xD1, 0xCE,
+    0xE8, 0xF3, 0xF1, 0x4E, 0xF1, 0x4E, 0xCD, 0xCF, 0xCF, 0x2D, 0xB2, 0x27, 0x9C, 0x90, 0x96, 0x7C,
+    0x67, 0x67, 0x66, 0x67, 0x02, 0x66, 0x8C, 0x8A, 0x8A, 0x95, 0x00, 0x00, 0xBD, 0x3A, 0xD1, 0xEA,
+    0xF3, 0xF1, 0xF3, 0xFB, 0x02, 0x4F, 0xB9, 0x50, 0x39, 0xB2, 0xB3, 0xA1, 0xA1, 0x10, 0x91, 0x7E,
+    0x7E, 0x67, 0x6A, 0x69, 0x66, 0x69, 0x0C, 0x0C, 0x8A, 0x1C, 0x00, 0x00, 0xB9, 0xB9, 0xD2, 0x44,
+    0xDF, 0xFB, 0xDF, 0x50, 0x50, 0xEC, 0xEC, 0x3E, 0xC7, 0x3B, 0xB3, 0x28, 0x1F, 0x8B, 0x8C, 0x7E,
+    0x73, 0x5F, 0x5D, 0x69, 0x6B, 0x5F, 0x7F, 0x84, 0x0C, 0x1E, 0x00, 0x00, 0x2F, 0xC8, 0xDD, 0xDD,
+    0xDF, 0x03, 0xEC, 0xB4, 0xF4, 0x48, 0xC7, 0x35, 0x36, 0xBE, 0xAC, 0x18, 0x12, 0x74, 0x73, 0x74,
+    0x5D, 0x61, 0x5F, 0x76, 0x6B, 0x6B, 0x7F, 0x13, 0x9D, 0x00, 0x00, 0xB4, 0xC8, 0xDD, 0x51, 0xDC,
+    0xE0, 0xF4, 0x54, 0xF4, 0x54, 0xE0, 0xD3, 0xBE, 0xBE, 0xB6, 0xAC, 0x9F, 0x93, 0x0F, 0x62, 0x76,
+    0x61, 0x61, 0x59, 0x59, 0x85, 0x80, 0x80, 0x19, 0x9E, 0x02, 0x00, 0x9B, 0x3D, 0xD4, 0x52, 0xEE,
+    0xED, 0xFE, 0xF7, 0x54, 0xF8, 0xF8, 0xE2, 0x42, 0xB6, 0xAC, 0xAD, 0x9F, 0x9F, 0x93, 0x77, 0x6D,
+    0x59, 0x77, 0x77, 0x64, 0x63, 0x63, 0x15, 0x85, 0x03, 0x00, 0x86, 0x31, 0xDE, 0xEE, 0xFE, 0xF8,
+    0xF7, 0xF7, 0x02, 0xF8, 0x91, 0x41, 0x37, 0xC4, 0xB6, 0xA2, 0xA9, 0x98, 0x86, 0x86, 0x77, 0x05,
+    0x05, 0x09, 0x05, 0x09, 0x81, 0x81, 0x8E, 0x04, 0x00, 0x99, 0xDE, 0xDE, 0xFA, 0xFA, 0x01, 0xFA,
+    0xFA, 0xE4, 0xE4, 0xD5, 0xC4, 0xAD, 0xAD, 0xA2, 0xA2, 0x98, 0x78, 0x77, 0x6F, 0x70, 0x6F, 0x6F,
+    0x70, 0x06, 0x88, 0x88, 0x05, 0x00, 0x84, 0xC4, 0x4B, 0x4B, 0x01, 0x4B, 0x02, 0x01, 0x91, 0xD7,
+    0xC4, 0xD7, 0xC4, 0xB7, 0xA9, 0xA5, 0x9A, 0x86, 0x89, 0x0A, 0x70, 0x70, 0x02, 0x71, 0x06, 0x88,
+    0x88, 0x06, 0x00, 0x80, 0xC4, 0x03, 0xFA, 0x92, 0x01, 0xFA, 0x4B, 0x4B, 0xD7, 0xBF, 0xB8, 0xB8,
+    0x9A, 0xA5, 0x86, 0x0A, 0x89, 0x6F, 0x71, 0x71, 0x02, 0x06, 0x88, 0x08, 0x00, 0x95, 0xE4, 0xFA,
+    0xFA, 0xE4, 0x01, 0x01, 0xFA, 0xD5, 0xDE, 0xBF, 0xB8, 0xA9, 0x98, 0x9A, 0x0A, 0x87, 0x09, 0x02,
+    0x06, 0x71, 0x06, 0x71, 0x0A, 0x00, 0x93, 0xE4, 0xFA, 0x01, 0xE4, 0x01, 0xD5, 0xDE, 0x32, 0x32,
+    0xB7, 0xA3, 0xA3, 0x99, 0x9B, 0x6F, 0x70, 0x70, 0x65, 0x64, 0x06, 0x0C, 0x00, 0x8E, 0xF8, 0xF8,
+    0xE2, 0xF8, 0xF8, 0xEE, 0xDE, 0x32, 0xB7, 0xA3, 0xA4, 0x8D, 0x99, 0x64, 0x0B, 0x02, 0x65, 0x0F,
+    0x00, 0x8D, 0xF8, 0xED, 0xED, 0xD3, 0xD4, 0xB5, 0xB5, 0x21, 0x22, 0x8E, 0x8E, 0x81, 0x08, 0x63,
+    0x13, 0x00, 0x89, 0x4A, 0xDC, 0x3C, 0xBA, 0xB4, 0x24, 0x9D, 0x9E, 0x84, 0x0D, 0x2A, 0x00,
+  };
+
+  /// @brief One icon in both formats
+  struct CorpusIcon {
+    const char* name;
+    const uint8_t* png;
+    size_t png_sz;
+    const uint8_t* rle;
+    size_t rle_sz;
+    bool lossless;  ///< the RLE file has every color of the PNG
+  };
+
+  inline constexpr CorpusIcon icon_corpus[] = {
+    { "gradient", icon_png, sizeof(icon_png), gradient_rle, sizeof(gradient_rle), true },
+    { "flat", flat_png, sizeof(flat_png), flat_rle, sizeof(flat_rle), true },
+    { "outline", outline_png, sizeof(outline_png), outline_rle, sizeof(outline_rle), true },
+    { "photo", photo_png, sizeof(photo_png), photo_rle, sizeof(photo_rle), false },
+  };
+
+}  // namespace bench
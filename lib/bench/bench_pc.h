@@ -0,0 +1,201 @@
+/**
+ * @file bench_pc.h
+ * @brief Stands in for the PC on the other end of a host link, for the benchmarks, which run CommAPI (env:native)
+ * @details A thread answers the device at once. The PC has SESSIONS sessions, each with the same icon of the given
+ * size. A read, which gets nothing for READ_TIMEOUT_MS, drops the command, so a frame cut by an impaired link doesn't
+ * stall the PC. Frames with a wrong CRC are ignored.
+ */
+
+#pragma once
+#ifdef NATIVE
+  #include "utils.h"
+  #include <algorithm>
+  #include <atomic>
+  #include <cerrno>
+  #include <csignal>
+  #include <cstring>
+  #include <poll.h>
+  #include <pthread.h>
+  #include <unistd.h>
+  #include <vector>
+
+namespace bench {
+
+  class PCThread {
+  public:
+    static inline constexpr uint8_t SESSIONS = 5;
+    static inline constexpr int READ_TIMEOUT_MS = 100;
+
+    /// @brief Called from the thread with each valid SET_VOLUME
+    using volume_cb_t = void (*)(int16_t pid, uint8_t volume);
+
+    /// @param fd the PC end of the link, not closed
+    /// @param icon_sz bytes of the icon
+    PCThread(int fd, uint32_t icon_sz, volume_cb_t on_volume = nullptr)
+        : fd_(fd), icon_(icon_sz), on_volume_(on_volume) {
+      for (size_t i = 0; i < icon_.size(); ++i) {
+        icon_[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+      }
+      // a thread of the host, the ticks of FreeRTOS stay on the tasks
+      sigset_t all, old;
+      sigfillset(&all);
+      pthread_sigmask(SIG_SETMASK, &all, &old);
+      pthread_create(&thread_, nullptr, run, this);
+      pthread_sigmask(SIG_SETMASK, &old, nullptr);
+    }
+
+    ~PCThread() {
+      stop_ = true;
+      pthread_join(thread_, nullptr);
+    }
+
+    PCThread(const PCThread&) = delete;
+    PCThread& operator=(const PCThread&) = delete;
+
+  private:
+    static void* run(void* self) {
+      auto& pc = *static_cast<PCThread*>(self);
+      while (not pc.stop_) {
+        uint8_t cmd;
+        if (pc.read(&cmd, 1)) {
+          pc.serve(cmd);
+        }
+      }
+      return nullptr;
+    }
+
+    /// @return false if nothing came for READ_TIMEOUT_MS, or the thread is stopped
+    bool read(uint8_t* buff, size_t n) {
+      for (size_t done = 0; done < n;) {
+        pollfd p = { fd_, POLLIN, 0 };
+        if (stop_ || poll(&p, 1, READ_TIMEOUT_MS) <= 0) {
+          return false;
+        }
+        const ssize_t r = ::read(fd_, buff + done, n - done);
+        if (r <= 0 && not(r < 0 && (errno == EINTR || errno == EAGAIN))) {
+          return false;
+        }
+        done += r > 0 ? r : 0;
+      }
+      return true;
+    }
+
+    /// @brief Read @p n bytes and their CRC
+    bool read_checked(uint8_t* buff, size_t n) {
+      uint8_t crc[4];
+      return read(buff, n) && read(crc, sizeof(crc)) && utils::mem2T<uint32_t>(crc) == utils::crc32mpeg2(buff, n);
+    }
+
+    void write_all(const uint8_t* data, size_t n) {
+      for (size_t done = 0; done < n;) {
+        const ssize_t w = ::write(fd_, data + done, n - done);
+        if (w <= 0 && not(w < 0 && (errno == EINTR || errno == EAGAIN))) {
+          return;
+        }
+        done += w > 0 ? w : 0;
+      }
+    }
+
+    /// @brief Send @p data with its CRC
+    void send(const uint8_t* data, size_t n) {
+      uint8_t buff[300];
+      memcpy(buff, data, n);
+      const uint32_t crc = utils::crc32mpeg2(data, n);
+      memcpy(buff + n, &crc, sizeof(crc));
+      write_all(buff, n + sizeof(crc));
+    }
+
+    void send_sessions(uint16_t offset, uint8_t n) {
+      for (uint16_t i = offset; i < offset + n; ++i) {
+        const char name[] = "program.exe";
+        const uint8_t head[5] = { static_cast<uint8_t>(i + 1), 0, static_cast<uint8_t>(i * 20), 0, sizeof(name) - 1 };
+        send(head, sizeof(head));
+        send(reinterpret_cast<const uint8_t*>(name), sizeof(name) - 1);
+      }
+    }
+
+    void send_icon() {
+      const uint32_t size = icon_.size();
+      send(reinterpret_cast<const uint8_t*>(&size), sizeof(size));
+      uint8_t chunk_sz[4];
+      if (not read_checked(chunk_sz, sizeof(chunk_sz))) {
+        return;
+      }
+      const uint32_t chunk = std::min<uint32_t>(utils::mem2T<uint32_t>(chunk_sz), 256);
+      for (uint32_t sent = 0; sent < size;) {
+        const uint32_t len = std::min(chunk, size - sent);
+        send(icon_.data() + sent, len);
+        sent += len;
+        // the ack of each chunk, the last one is the success
+        uint8_t ack;
+        if (not read_checked(&ack, 1) || ack != 0xA0) {
+          return;
+        }
+      }
+    }
+
+    void serve(uint8_t cmd) {
+      uint8_t msg[8];
+      switch (cmd) {
+        case 0x01: {  // LOAD_ALL
+          const uint8_t n = SESSIONS;
+          send(&n, 1);
+          send_sessions(0, n);
+          break;
+        }
+        case 0x02:  // READ_IMG
+          if (read_checked(msg, 2)) {
+            send_icon();
+          }
+          break;
+        case 0x03:  // SET_VOLUME
+          if (read_checked(msg, 3) && on_volume_) {
+            on_volume_(utils::mem2T<int16_t>(msg), msg[2]);
+          }
+          break;
+        case 0x04:  // ECHO
+          while (read(msg, 1) && msg[0]) {
+          }
+          break;
+        case 0x05:  // SET_MUTE
+          read_checked(msg, 3);
+          break;
+        case 0x06: {  // QUERY_CHANGES, none
+          const uint8_t changed = 0;
+          send(&changed, 1);
+          break;
+        }
+        case 0x07:  // IMAGE_INFO
+          if (read_checked(msg, 2)) {
+            const uint32_t info[2] = { utils::crc32mpeg2(icon_.data(), icon_.size()), uint32_t(icon_.size()) };
+            send(reinterpret_cast<const uint8_t*>(info), sizeof(info));
+          }
+          break;
+        case 0x08:  // LOAD_PAGE
+          if (read_checked(msg, 3)) {
+            const uint16_t offset = std::min<uint16_t>(utils::mem2T<uint16_t>(msg), SESSIONS);
+            const uint8_t n = std::min<uint8_t>(msg[2], SESSIONS - offset);
+            const uint8_t head[3] = { SESSIONS, 0, n };
+            send(head, sizeof(head));
+            send_sessions(offset, n);
+          }
+          break;
+        case 0xA0:  // the device's success or failure
+        case 0xB0:
+          read(msg, 4);
+          break;
+        default:
+          // garbage, the next byte may be a command
+          break;
+      }
+    }
+
+    int fd_;
+    std::vector<uint8_t> icon_;
+    volume_cb_t on_volume_;
+    std::atomic<bool> stop_{ false };
+    pthread_t thread_{};
+  };
+
+}  // namespace bench
+#endif
@@ -1,9 +1,13 @@
 #include "comm_api.h"
 #include <cstring>
 #include "utils.h"
+#include <algorithm>
+#include <iterator>
 #include <type_traits>
 #include "sem_lock.h"
 #include "passert.h"
+#include "latency_trace.h"
+#include "metrics.h"
 
 namespace mixer {
   enum commands : uint8_t {
@@ -13,11 +17,21 @@ namespace mixer {
     ECHO = 0x04,
     SET_MUTE = 0x05,
     QUERY_CHANGES = 0x06,
+    IMAGE_INFO = 0x07,
+    LOAD_PAGE = 0x08,
+    TASK_STATS = 0x09,
+    TRACE = 0x0A,
+    LOG = 0x0B,
+    METRICS = 0x0C,
     RESPONSE_OK = 0xA0,
     RESPONSE_FAIL = 0xB0,
   };
 }
 
+METRICS_COUNTER(crc_errors, "comm.crc_errors");
+METRICS_COUNTER(timeouts, "comm.timeouts");
+METRICS_HISTOGRAM(rtt_us, "comm.rtt_us");  ///< from the end of a frame to the response, as the device sees it
+
 namespace CRC_Cache {
   constexpr std::array<uint8_t, 5> calc_crc(uint8_t val) {
     uint32_t crc = utils::crc32mpeg2(&val, 1);
@@ -35,9 +49,13 @@ namespace CRC_Cache {
 };  // namespace CRC_Cache
 
 bool CommAPI::verify_read(size_t n) {
+  const uint32_t start = metrics::now();
   if (0 == uart_->wait_for(n + 4)) {
+    timeouts.add();
+    no_answer_ = 0 == uart_->available();
     return false;
   }
+  no_answer_ = false;
   unsigned i = 0;
 
   // read data
@@ -47,7 +65,13 @@ bool CommAPI::verify_read(size_t n) {
   auto crc = utils::crc32mpeg2(buffer_, n);
   uint32_t crc_in = uart_->read<uint32_t>();
 
-  return crc == crc_in;
+  if (crc != crc_in) {
+    crc_errors.add();
+    return false;
+  }
+  rtt_us.record(metrics::elapsed_us(start));
+  latency_trace_mark(LATENCY_RESPONSE_RECEIVED);
+  return true;
 }
 
 CommAPI::ret_t CommAPI::load_volumes() {
@@ -57,25 +81,63 @@ CommAPI::ret_t CommAPI::load_volumes() {
 
   uart_->write(mixer::commands::LOAD_ALL);
   uart_->flush();
+  latency_trace_mark(LATENCY_FRAME_WRITTEN);
 
   if (not verify_read(sizeof(uint8_t))) {
     return comm_failure();
   }
 
   uint8_t n_data = buffer_[0];
+  total_ = n_data;
+
+  if (not load_sessions(n_data)) {
+    return comm_failure();
+  }
+  return comm_success();
+}
+
+CommAPI::ret_t CommAPI::load_page(uint16_t offset, uint8_t count) {
+  utils::Lock lck(mtx_);
+
+  uart_->empty_rx();
+  uart_->write(mixer::commands::LOAD_PAGE);
+
+  uint8_t msg_buff[7] = { 0 };
+  *reinterpret_cast<uint16_t*>(msg_buff) = offset;
+  msg_buff[2] = std::min<uint8_t>(count, MAX_SUPPORTED_PROGRAMS);
+  *reinterpret_cast<uint32_t*>(msg_buff + 3) = utils::crc32mpeg2(msg_buff, 3);
+  uart_->write(msg_buff, 7);
+  uart_->flush();
+  latency_trace_mark(LATENCY_FRAME_WRITTEN);
 
+  // total, sessions in the page
+  if (not verify_read(sizeof(uint16_t) + sizeof(uint8_t))) {
+    const bool silent = no_answer_;
+    comm_failure();
+    return silent ? ret_t::NO_ANSWER : ret_t::CRC_ERR;
+  }
+  const uint16_t total = utils::mem2T<uint16_t>(buffer_);
+  const uint8_t n_data = buffer_[sizeof(uint16_t)];
+
+  if (not load_sessions(n_data)) {
+    return comm_failure();
+  }
+  total_ = total;
+  return comm_success();
+}
+
+bool CommAPI::load_sessions(size_t n) {
   for (unsigned i = 0; i < MAX_SUPPORTED_PROGRAMS; ++i) {
     volumes_[i] = std::nullopt;
   }
 
-  for (unsigned i = 0; i < n_data && i < MAX_SUPPORTED_PROGRAMS; ++i) {
+  for (unsigned i = 0; i < n && i < MAX_SUPPORTED_PROGRAMS; ++i) {
     volumes_[i] = load_one();
     if (not volumes_[i]) {
-      return comm_failure();
+      return false;
     }
   }
-
-  return comm_success();
+  return true;
 }
 
 
@@ -109,6 +171,7 @@ CommAPI::volume_t CommAPI::load_one() {
 void CommAPI::init(CommClass* u) {
   uart_ = u;
   mtx_ = xSemaphoreCreateMutex();
+  rtos_trace_name_object(mtx_, "CommAPI");
   passert(mtx_);
   passert(uart_);
 }
@@ -120,50 +183,111 @@ void CommAPI::init(CommClass* u) {
 ///   Next, we read the chunks and verify the CRC for each one. If OK, we send a byte, indicating we are ready for next
 ///     chunk
 ///   After all chunks are correctly received, we are done
-CommAPI::ret_t CommAPI::load_image(int16_t pid, uint8_t* buff, size_t max_sz) {
-  utils::Lock lck(mtx_);
-  uart_->empty_rx();
-  uart_->write(mixer::commands::READ_IMG);
+CommAPI::ImageStream::ImageStream(CommAPI& api, int16_t pid) : api_(api), lck_(api.mtx_) {
+  CommClass* uart = api_.uart_;
+  uart->empty_rx();
+  uart->write(mixer::commands::READ_IMG);
 
-  uint8_t msg_buff[8] = { 0 };
+  uint8_t msg_buff[6] = { 0 };
   static_assert(std::is_same<decltype(pid), int16_t>::value);
 
   *reinterpret_cast<int16_t*>(msg_buff) = pid;
   *reinterpret_cast<uint32_t*>(msg_buff + 2) = utils::crc32mpeg2(msg_buff, 2);
-  uart_->write(msg_buff, 6);
-  uart_->flush();
-
-  if (not verify_read(sizeof(uint32_t))) {
-    return comm_failure();
+  uart->write(msg_buff, 6);
+  uart->flush();
+  latency_trace_mark(LATENCY_FRAME_WRITTEN);
+
+  if (not api_.verify_read(sizeof(uint32_t))) {
+    failed_ = true;
+    api_.comm_failure();
+    return;
   }
+  size_ = utils::mem2T<uint32_t>(api_.buffer_);
+}
 
-  const uint32_t msg_len = utils::mem2T<uint32_t>(buffer_);
+CommAPI::ImageStream::~ImageStream() {
+  if (not failed_ && received_ < size_) {
+    // abandoned, the PC stops sending
+    api_.comm_failure();
+  }
+}
 
-  if (max_sz < msg_len) {
-    comm_failure();
-    return ret_t::BUFF_SZ_ERR;
+size_t CommAPI::ImageStream::next(const uint8_t*& data) {
+  if (failed_ || received_ == size_) {
+    return 0;
   }
 
   constexpr uint32_t chunk_size = BUFF_SZ - sizeof(uint32_t);
-  *reinterpret_cast<uint32_t*>(msg_buff) = chunk_size;
-  *reinterpret_cast<uint32_t*>(msg_buff + 4) = utils::crc32mpeg2(msg_buff, 4);
+  if (0 == received_) {
+    // the chunk size is only sent, once the image is wanted
+    uint8_t msg_buff[8] = { 0 };
+    *reinterpret_cast<uint32_t*>(msg_buff) = chunk_size;
+    *reinterpret_cast<uint32_t*>(msg_buff + 4) = utils::crc32mpeg2(msg_buff, 4);
+
+    api_.uart_->write(msg_buff, 8);
+    api_.uart_->flush();
+  }
 
-  uart_->write(msg_buff, 8);
-  uart_->flush();
+  const uint32_t bytes_to_read = std::min(chunk_size, size_ - received_);
+  if (not api_.verify_read(bytes_to_read)) {
+    failed_ = true;
+    api_.comm_failure();
+    return 0;
+  }
+  received_ += bytes_to_read;
+
+  // buffer_ isn't touched until the next verify_read(), so the PC may already send the next chunk
+  if (received_ == size_) {
+    api_.comm_success();
+  } else {
+    api_.ack_chunk();
+  }
+  data = api_.buffer_;
+  return bytes_to_read;
+}
 
+CommAPI::ImageStream CommAPI::open_image(int16_t pid) {
+  return ImageStream(*this, pid);
+}
 
-  for (uint32_t read_bytes = 0; read_bytes < msg_len;) {
-    uint32_t bytes_to_read = std::min(chunk_size, msg_len - read_bytes);
-    if (not verify_read(bytes_to_read)) {
-      return comm_failure();
-    }
+CommAPI::ret_t CommAPI::image_info(int16_t pid, ImageInfo& info) {
+  utils::Lock lck(mtx_);
+  uart_->empty_rx();
+  uart_->write(mixer::commands::IMAGE_INFO);
+
+  uint8_t msg_buff[6] = { 0 };
+  *reinterpret_cast<int16_t*>(msg_buff) = pid;
+  *reinterpret_cast<uint32_t*>(msg_buff + 2) = utils::crc32mpeg2(msg_buff, 2);
+  uart_->write(msg_buff, 6);
+  uart_->flush();
+  latency_trace_mark(LATENCY_FRAME_WRITTEN);
+
+  // hash, size
+  if (not verify_read(2 * sizeof(uint32_t))) {
+    const bool silent = no_answer_;
+    comm_failure();
+    return silent ? ret_t::NO_ANSWER : ret_t::CRC_ERR;
+  }
+  info = { utils::mem2T<uint32_t>(buffer_), utils::mem2T<uint32_t>(buffer_ + sizeof(uint32_t)) };
+  return comm_success();
+}
 
-    memcpy(buff + read_bytes, buffer_, bytes_to_read);
-    read_bytes += bytes_to_read;
-    comm_success();
+CommAPI::ret_t CommAPI::load_image(int16_t pid, uint8_t* buff, size_t max_sz) {
+  ImageStream img = open_image(pid);
+  if (img.failed()) {
+    return ret_t::CRC_ERR;
+  }
+  if (max_sz < img.size()) {
+    // the destructor reports the failure
+    return ret_t::BUFF_SZ_ERR;
   }
 
-  return ret_t::OK;
+  const uint8_t* chunk = nullptr;
+  while (const size_t len = img.next(chunk)) {
+    memcpy(buff, chunk, len);
+    buff += len;
+  }
+  return img.complete() ? ret_t::OK : ret_t::CRC_ERR;
 }
 
 void CommAPI::set_volume(int16_t pid, uint8_t vol) {
@@ -184,6 +308,7 @@ void CommAPI::set_volume(int16_t pid, uint8_t vol) {
 
   uart_->write(msg_buff, buff_sz);
   uart_->flush();
+  latency_trace_mark(LATENCY_FRAME_WRITTEN);
 }
 
 void CommAPI::echo(const char* c) {
@@ -192,6 +317,178 @@ void CommAPI::echo(const char* c) {
   uart_->write(c);
 }
 
+void CommAPI::report_tasks(const task_stats::Report& report) {
+  utils::Lock lck(mtx_);
+  uint8_t frame[1 + 4 + 2 + 1 + 4];  // cmd, interval, idle, n, crc
+  frame[0] = mixer::commands::TASK_STATS;
+  memcpy(frame + 1, &report.interval_us, 4);
+  memcpy(frame + 5, &report.idle_permille, 2);
+  frame[7] = report.n;
+  const uint32_t head_crc = utils::crc32mpeg2(frame + 1, 7);
+  memcpy(frame + 8, &head_crc, 4);
+  if (not uart_->write(frame, sizeof(frame))) {
+    return;
+  }
+
+  for (size_t i = 0; i < report.n; ++i) {
+    const auto& t = report.tasks[i];
+    const uint8_t name_len = strnlen(t.name, sizeof(t.name));
+    uint8_t task[12 + sizeof(t.name) + 4];  // number, priority, state, permille, run_us, stack, name_len, name, crc
+    task[0] = t.number;
+    task[1] = t.priority;
+    task[2] = t.state;
+    memcpy(task + 3, &t.permille, 2);
+    memcpy(task + 5, &t.run_us, 4);
+    memcpy(task + 9, &t.stack_free, 2);
+    task[11] = name_len;
+    memcpy(task + 12, t.name, name_len);
+    const uint32_t crc = utils::crc32mpeg2(task, 12 + name_len);
+    memcpy(task + 12 + name_len, &crc, 4);
+    if (not uart_->write(task, 12 + name_len + 4)) {
+      return;
+    }
+  }
+}
+
+bool CommAPI::write_checked(uint8_t* frame, size_t n) {
+  const uint32_t crc = utils::crc32mpeg2(frame, n);
+  memcpy(frame + n, &crc, sizeof(crc));
+  if (uart_->write(frame, n + sizeof(crc))) {
+    return true;
+  }
+  uart_->flush();
+  return uart_->write(frame, n + sizeof(crc));
+}
+
+void CommAPI::send_log(const uint8_t* records, uint16_t n, uint32_t dropped) {
+  utils::Lock lck(mtx_);
+  uint8_t frame[LOG_CHUNK + 4];
+  frame[0] = mixer::commands::LOG;
+  if (not uart_->write(frame, 1)) {
+    return;
+  }
+  memcpy(frame, &dropped, 4);
+  memcpy(frame + 4, &n, 2);
+  if (not write_checked(frame, 6)) {
+    return;
+  }
+  for (uint16_t done = 0; done < n;) {
+    const uint16_t chunk = std::min<uint16_t>(n - done, LOG_CHUNK);
+    memcpy(frame, records + done, chunk);
+    if (not write_checked(frame, chunk)) {
+      return;
+    }
+    done += chunk;
+  }
+}
+
+void CommAPI::send_metrics(uint32_t ms, bool names) {
+  utils::Lock lck(mtx_);
+  // too large for the stacks, the mutex guards them
+  static uint8_t frame[METRICS_FRAME + 4];
+  static uint8_t value[metrics::MAX_ENCODED];
+  static_assert(metrics::MAX_ENCODED <= METRICS_FRAME - 2);
+
+  const uint16_t n = metrics::count();
+  frame[0] = mixer::commands::METRICS;
+  if (not uart_->write(frame, 1)) {
+    return;
+  }
+  memcpy(frame, &ms, 4);
+  memcpy(frame + 4, &n, 2);
+  frame[6] = names;
+  if (not write_checked(frame, 7)) {
+    return;
+  }
+
+  if (names) {
+    for (uint16_t i = 0; i < n; ++i) {
+      const auto& e = metrics::entry(i);
+      const uint8_t len = strnlen(e.name, 64);
+      frame[0] = e.type;
+      frame[1] = len;
+      memcpy(frame + 2, e.name, len);
+      if (not write_checked(frame, 2 + len)) {
+        return;
+      }
+    }
+  }
+
+  uint16_t len = 0;
+  for (uint16_t i = 0; i < n; ++i) {
+    const size_t sz = metrics::encode(i, value);
+    if (2 + len + sz > METRICS_FRAME) {
+      memcpy(frame, &len, 2);
+      if (not write_checked(frame, 2 + len)) {
+        return;
+      }
+      len = 0;
+    }
+    memcpy(frame + 2 + len, value, sz);
+    len += sz;
+  }
+  if (len) {
+    memcpy(frame, &len, 2);
+    write_checked(frame, 2 + len);
+  }
+}
+
+#ifdef RTOS_TRACE
+void CommAPI::send_trace(const rtos_trace_record_t* records, uint16_t n, uint32_t lost, bool names) {
+  constexpr rtos_trace_name_t tables[] = { RTOS_TRACE_NAME_TASK, RTOS_TRACE_NAME_OBJECT, RTOS_TRACE_NAME_MARKER };
+  constexpr uint16_t table_sz[] = { RTOS_TRACE_TASKS, RTOS_TRACE_OBJECTS, RTOS_TRACE_MARKERS };
+  uint8_t info = 0;
+  uint8_t n_names = 0;
+  for (size_t t = 0; names && t < std::size(tables); ++t) {
+    for (uint16_t id = 0; id < table_sz[t]; ++id) {
+      n_names += nullptr != rtos_trace_name(tables[t], id, &info);
+    }
+  }
+
+  utils::Lock lck(mtx_);
+  uint8_t frame[TRACE_CHUNK * sizeof(rtos_trace_record_t) + 4];
+  frame[0] = mixer::commands::TRACE;
+  if (not uart_->write(frame, 1)) {
+    return;
+  }
+  const uint32_t hz = ulRunTimeClockHz();
+  memcpy(frame, &hz, 4);
+  memcpy(frame + 4, &lost, 4);
+  frame[8] = n_names;
+  memcpy(frame + 9, &n, 2);
+  if (not write_checked(frame, 11)) {
+    return;
+  }
+
+  for (size_t t = 0; names && t < std::size(tables); ++t) {
+    for (uint16_t id = 0; id < table_sz[t]; ++id) {
+      const char* name = rtos_trace_name(tables[t], id, &info);
+      if (not name) {
+        continue;
+      }
+      const uint8_t len = strnlen(name, 64);
+      frame[0] = tables[t];
+      memcpy(frame + 1, &id, 2);
+      frame[3] = info;
+      frame[4] = len;
+      memcpy(frame + 5, name, len);
+      if (not write_checked(frame, 5 + len)) {
+        return;
+      }
+    }
+  }
+
+  for (uint16_t done = 0; done < n;) {
+    const uint16_t chunk = std::min<uint16_t>(n - done, TRACE_CHUNK);
+    memcpy(frame, records + done, chunk * sizeof(rtos_trace_record_t));
+    if (not write_checked(frame, chunk * sizeof(rtos_trace_record_t))) {
+      return;
+    }
+    done += chunk;
+  }
+}
+#endif
+
 void CommAPI::set_mute(int16_t pid, bool mute) {
   utils::Lock lck(mtx_);
   constexpr size_t buff_sz = 1 + 2 + 1 + 4;  // cmd, pid, muted, crc
@@ -203,6 +500,7 @@ void CommAPI::set_mute(int16_t pid, bool mute) {
   *reinterpret_cast<uint32_t*>(buff + 4) = utils::crc32mpeg2(buff + 1, buff_sz - 5);
 
   uart_->write(buff, buff_sz);
+  latency_trace_mark(LATENCY_FRAME_WRITTEN);
 }
 
 
@@ -214,6 +512,7 @@ uint8_t CommAPI::changes() {
   uart_->write(mixer::commands::QUERY_CHANGES);
 
   uart_->flush();
+  latency_trace_mark(LATENCY_FRAME_WRITTEN);
 
   if (not verify_read(sizeof(uint8_t))) {
     return 2;
@@ -241,6 +540,12 @@ CommAPI::ret_t CommAPI::comm_success() {
   return ret_t::OK;
 }
 
+void CommAPI::ack_chunk() {
+  uart_->write(CRC_Cache::response_ok.data(), CRC_Cache::response_ok.size());
+  uart_->flush();
+  last_successful_comm_ = xTaskGetTickCount();
+}
+
 TickType_t CommAPI::since_last_success() const {
   return xTaskGetTickCount() - last_successful_comm_;
 }
\ No newline at end of file
@@ -2,6 +2,9 @@
 #include <optional>
 #include "comm_class.h"
 #include "utils.h"
+#include "sem_lock.h"
+#include "task_stats.h"
+#include "rtos_trace.h"
 #include <array>
 #include "FreeRTOS.h"
 #include "semphr.h"
@@ -32,6 +35,7 @@ namespace mixer {
     OK = 0,
     CRC_ERR,
     BUFF_SZ_ERR,
+    NO_ANSWER,  ///< the PC sent nothing until the timeout, that's what it does with a command it doesn't know
   };
 }  // namespace mixer
 
@@ -46,11 +50,83 @@ public:
   /// @return 0 on success
   ret_t load_volumes();
 
+  /// @brief Load a window of the session list into the internal buffer
+  /// @details The PC may have more sessions than the buffer holds, only the ones in the window are sent, names
+  /// included. Sessions after the end of the list are left empty.
+  /// @param offset index of the first session
+  /// @param count number of sessions, at most MAX_SUPPORTED_PROGRAMS
+  /// @return 0 on success, NO_ANSWER if the PC doesn't support it
+  ret_t load_page(uint16_t offset, uint8_t count);
+
+  /// @brief Number of sessions the PC has, from the last load_page() or load_volumes()
+  uint16_t total_sessions() const {
+    return total_;
+  }
+
   /// @brief set volume for session
   /// @param pid PID of the session
   /// @param vol volume 0-100%
   void set_volume(int16_t pid, uint8_t vol);
 
+  /// @brief Image of a session, received chunk by chunk
+  /// @details The API is locked while the stream is alive. Each chunk is acknowledged as soon as its CRC is checked,
+  /// so the PC sends the next chunk while the previous one is decoded. A stream destroyed before the last chunk
+  /// reports failure to the PC.
+  class ImageStream {
+  public:
+    ~ImageStream();
+    ImageStream(const ImageStream&) = delete;
+    ImageStream& operator=(const ImageStream&) = delete;
+
+    /// @brief Receive the next chunk
+    /// @param data set to the chunk, valid until the next call
+    /// @return length of the chunk, 0 after the last chunk or on failure
+    size_t next(const uint8_t*& data);
+
+    /// @brief Size of the whole image in bytes, as reported by the PC
+    uint32_t size() const {
+      return size_;
+    }
+
+    /// @brief true, if the PC didn't answer, or a chunk was corrupted
+    bool failed() const {
+      return failed_;
+    }
+
+    /// @brief true, if all chunks were received
+    bool complete() const {
+      return not failed_ && received_ == size_;
+    }
+
+  private:
+    friend class CommAPI;
+    ImageStream(CommAPI& api, int16_t pid);
+
+    CommAPI& api_;
+    utils::Lock lck_;
+    uint32_t size_ = 0;      ///< total bytes
+    uint32_t received_ = 0;  ///< bytes received so far
+    bool failed_ = false;
+  };
+
+  /// @brief Request the image of a session
+  /// @details Nothing but the size is read, the image is received by ImageStream::next()
+  /// @param pid PID of session
+  ImageStream open_image(int16_t pid);
+
+  /// @brief Hash and size of a session image, see IconCache::hash()
+  struct ImageInfo {
+    uint32_t hash;
+    uint32_t size;
+  };
+
+  /// @brief Ask the PC which image a session has, without receiving it
+  /// @details A cached image is found by its hash, so only unknown images are downloaded
+  /// @param pid PID of session
+  /// @param[out] info set on success
+  /// @return 0 on success, NO_ANSWER if the PC doesn't support it
+  ret_t image_info(int16_t pid, ImageInfo& info);
+
   /// @brief Load image for session
   /// @param pid PID of session
   /// @param buff destination
@@ -67,6 +143,42 @@ public:
   /// @param str null terminated array
   void echo(const char* str);
 
+  /// @brief Send the CPU load of each task to the PC, it doesn't answer
+  /// @details A head frame: interval in us (u32), idle permille (u16), number of tasks (u8). Then a frame for each
+  /// task: number (u8), priority (u8), state (u8), permille (u16), run time in us (u32), least free stack in words
+  /// (u16), name length (u8), name without NUL. Each frame ends with its CRC. Nothing more is sent, once the output
+  /// buffer is full
+  void report_tasks(const task_stats::Report& report);
+
+  static inline constexpr size_t LOG_CHUNK = 128;  ///< bytes of log records in a frame
+
+  /// @brief Send records of the deferred log to the PC, see dlog.h. It doesn't answer
+  /// @details A head frame: records dropped before these (u32), bytes of records (u16). Then the records, LOG_CHUNK
+  /// bytes in a frame, the PC joins them. Each frame ends with its CRC. Waits for the output buffer, when it's full
+  void send_log(const uint8_t* records, uint16_t n, uint32_t dropped);
+
+  static inline constexpr size_t METRICS_FRAME = 384;  ///< bytes of values in a frame, at least one histogram
+
+  /// @brief Send every metric of the registry to the PC, see metrics.h. It doesn't answer
+  /// @details A head frame: time in ms (u32), number of metrics (u16), with names (u8). With names, a frame for each
+  /// metric: type (u8), name length (u8), name without NUL. Then the values, as many in a frame as fit into
+  /// METRICS_FRAME: bytes of values (u16), each metric::encode()d. Each frame ends with its CRC. Waits for the output
+  /// buffer, when it's full
+  /// @param names with the names, the PC keeps them for the next snapshots
+  void send_metrics(uint32_t ms, bool names);
+
+#ifdef RTOS_TRACE
+  static inline constexpr size_t TRACE_CHUNK = 32;  ///< records in a frame
+
+  /// @brief Send records of the RTOS tracer to the PC, it doesn't answer
+  /// @details A head frame: run time clock in Hz (u32), records lost before these (u32), number of names (u8), number
+  /// of records (u16). Then a frame for each name of a task, an object or a marker: table (u8), id (u16), info (u8),
+  /// name length (u8), name without NUL. Then the records, TRACE_CHUNK in a frame. Each frame ends with its CRC. Waits
+  /// for the output buffer, when it's full
+  /// @param names with the names, the PC keeps them for the next traces
+  void send_trace(const rtos_trace_record_t* records, uint16_t n, uint32_t lost, bool names);
+#endif
+
   /// @brief check if sessions have changed since last check
   /// @return 0 if changes, 1 if no changes, 2 on comm failure
   uint8_t changes();
@@ -103,6 +215,14 @@ private:
   /// @return always ret_t::OK
   ret_t comm_success();
 
+  /// @brief Acknowledge a chunk, without dropping what the PC sent since
+  void ack_chunk();
+
+  /// @brief Write @p n bytes of @p frame and their CRC, after them in @p frame
+  /// @details Sends what's in the output buffer first, if the frame doesn't fit
+  /// @return false if it still doesn't fit
+  bool write_checked(uint8_t* frame, size_t n);
+
   /// @brief reads n+4 bytes and checks CRC at the end of buffer
   /// @details uses timeout from UART. Reads into internal buffer
   /// @param n number of bytes to read, without CRC
@@ -112,8 +232,14 @@ private:
   /// @brief Load a session from the UART
   /// @return session info or std::nullopt
   volume_t load_one();
+  /// @brief Load @p n sessions into the internal buffer, clear the rest
+  /// @return false on comm failure
+  bool load_sessions(size_t n);
+
   TickType_t last_successful_comm_ = 0;
+  bool no_answer_ = false;  ///< the last read timed out without a byte, a broken answer was still answered
   std::array<volume_t, MAX_SUPPORTED_PROGRAMS> volumes_;
+  uint16_t total_ = 0;  ///< sessions on the PC
   CommClass* uart_;
   static inline constexpr size_t BUFF_SZ = 256;
   uint8_t buffer_[BUFF_SZ];  ///< used for CRC and serial communication
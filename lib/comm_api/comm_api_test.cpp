@@ -109,8 +109,247 @@ void test_load_volumes() {
   TEST_ASSERT_EQUAL_STRING(volume.name_, opt->name_);
 }
 
+/// @brief Stands in for the PC, when an image is requested
+struct FakeImagePC {
+  static constexpr size_t CHUNK = 252;
+  static inline uint8_t image[600];
+  static inline size_t sent = 0;              ///< bytes of the image sent so far
+  static inline size_t corrupt_chunk = 1000;  ///< this chunk is sent with a bad CRC
+  static inline uint32_t failures = 0;        ///< RESPONSE_FAIL received
+  static inline uint32_t successes = 0;       ///< RESPONSE_OK received after the image info
+  static inline bool has_info = true;         ///< false for a PC, which doesn't know IMAGE_INFO
+  static inline bool corrupt_info = false;    ///< the image info is sent with a bad CRC
+
+  static void reset() {
+    for (size_t i = 0; i < sizeof(image); ++i) {
+      image[i] = i * 7;
+    }
+    sent = 0;
+    corrupt_chunk = 1000;
+    failures = 0;
+    successes = 0;
+    has_info = true;
+    corrupt_info = false;
+  }
+
+  static void send(const void* data, size_t sz) {
+    uint8_t msg[CHUNK + 4];
+    memcpy(msg, data, sz);
+    *reinterpret_cast<uint32_t*>(msg + sz) = utils::crc32mpeg2(msg, sz);
+    call_receive(msg, sz + 4);
+  }
+
+  static void send_chunk() {
+    const size_t len = std::min(CHUNK, sizeof(image) - sent);
+    uint8_t msg[CHUNK + 4];
+    memcpy(msg, image + sent, len);
+    *reinterpret_cast<uint32_t*>(msg + len) = utils::crc32mpeg2(msg, len);
+    if (sent / CHUNK == corrupt_chunk) {
+      msg[0] ^= 0xFF;
+    }
+    sent += len;
+    call_receive(msg, len + 4);
+  }
+
+  static size_t transmit(const void* data, size_t sz) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    if (p[0] == 0x02) {
+      const uint32_t len = sizeof(image);
+      send(&len, sizeof(len));
+    } else if (p[0] == 0x07) {
+      if (has_info) {
+        uint32_t info[2] = { utils::crc32mpeg2(image, sizeof(image)), sizeof(image) };
+        if (corrupt_info) {
+          // the CRC is of the right hash
+          uint8_t msg[sizeof(info) + 4];
+          memcpy(msg, info, sizeof(info));
+          *reinterpret_cast<uint32_t*>(msg + sizeof(info)) = utils::crc32mpeg2(msg, sizeof(info));
+          msg[0] ^= 0xFF;
+          call_receive(msg, sizeof(msg));
+        } else {
+          send(info, sizeof(info));
+        }
+      }
+    } else if (sz == 5 && p[0] == 0xA0 && sent == 0) {
+      ++successes;
+    } else if (sz == 8 && utils::mem2T<uint32_t>(p) == CHUNK) {
+      send_chunk();
+    } else if (p[0] == 0xA0 && sent < sizeof(image)) {
+      send_chunk();
+    } else if (p[0] == 0xB0) {
+      ++failures;
+    }
+    return sz;
+  }
+};
+
+static void init_image_pc() {
+  comm.init();
+  CommAPI::get_instance().init(&comm);
+  FakeImagePC::reset();
+  When(Method(mock, transmit)).AlwaysDo(FakeImagePC::transmit);
+}
+
+void test_image_stream() {
+  init_image_pc();
+  CommAPI::ImageStream img = CommAPI::get_instance().open_image(100);
+  TEST_ASSERT_FALSE(img.failed());
+  TEST_ASSERT_EQUAL_UINT32(sizeof(FakeImagePC::image), img.size());
+
+  // the chunks arrive in order, and each one is acknowledged before the next() returns
+  uint8_t received[sizeof(FakeImagePC::image)] = { 0 };
+  size_t total = 0;
+  const uint8_t* chunk = nullptr;
+  while (const size_t len = img.next(chunk)) {
+    TEST_ASSERT_LESS_OR_EQUAL(FakeImagePC::CHUNK, len);
+    memcpy(received + total, chunk, len);
+    total += len;
+  }
+  TEST_ASSERT_TRUE(img.complete());
+  TEST_ASSERT_EQUAL_UINT32(sizeof(received), total);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(FakeImagePC::image, received, sizeof(received));
+  TEST_ASSERT_EQUAL_UINT32(0, FakeImagePC::failures);
+}
+
+void test_image_stream_bad_crc() {
+  init_image_pc();
+  FakeImagePC::corrupt_chunk = 1;
+  CommAPI::ImageStream img = CommAPI::get_instance().open_image(100);
+
+  const uint8_t* chunk = nullptr;
+  TEST_ASSERT_EQUAL_UINT32(FakeImagePC::CHUNK, img.next(chunk));
+  TEST_ASSERT_EQUAL_UINT32(0, img.next(chunk));
+  TEST_ASSERT_TRUE(img.failed());
+  TEST_ASSERT_FALSE(img.complete());
+  TEST_ASSERT_EQUAL_UINT32(1, FakeImagePC::failures);
+}
+
+void test_load_image() {
+  init_image_pc();
+  uint8_t received[sizeof(FakeImagePC::image)] = { 0 };
+  TEST_ASSERT_EQUAL(mixer::OK, CommAPI::get_instance().load_image(100, received, sizeof(received)));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(FakeImagePC::image, received, sizeof(received));
+
+  // doesn't fit, the PC is told to stop before anything is sent
+  FakeImagePC::reset();
+  TEST_ASSERT_EQUAL(mixer::BUFF_SZ_ERR, CommAPI::get_instance().load_image(100, received, sizeof(received) - 1));
+  TEST_ASSERT_EQUAL_UINT32(0, FakeImagePC::sent);
+  TEST_ASSERT_EQUAL_UINT32(1, FakeImagePC::failures);
+}
+
+void test_image_info() {
+  init_image_pc();
+  CommAPI::ImageInfo info{};
+  TEST_ASSERT_EQUAL(mixer::OK, CommAPI::get_instance().image_info(100, info));
+  TEST_ASSERT_EQUAL_UINT32(utils::crc32mpeg2(FakeImagePC::image, sizeof(FakeImagePC::image)), info.hash);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(FakeImagePC::image), info.size);
+  TEST_ASSERT_EQUAL_UINT32(1, FakeImagePC::successes);
+  TEST_ASSERT_EQUAL_UINT32(0, FakeImagePC::sent);
+
+  // an older PC doesn't answer
+  FakeImagePC::reset();
+  FakeImagePC::has_info = false;
+  TEST_ASSERT_EQUAL(mixer::NO_ANSWER, CommAPI::get_instance().image_info(100, info));
+  TEST_ASSERT_EQUAL_UINT32(1, FakeImagePC::failures);
+
+  // a broken answer is still an answer
+  FakeImagePC::reset();
+  FakeImagePC::corrupt_info = true;
+  TEST_ASSERT_EQUAL(mixer::CRC_ERR, CommAPI::get_instance().image_info(100, info));
+  TEST_ASSERT_EQUAL_UINT32(1, FakeImagePC::failures);
+}
+
+/// @brief Stands in for a PC with many sessions, answers the page requests
+struct FakeSessionPC {
+  static inline uint16_t sessions = 100;
+  static inline uint32_t pages = 0;      ///< requests answered
+  static inline bool cut_short = false;  ///< only the head of the page is sent
+
+  static mixer::ProgramVolume session(uint16_t i) {
+    char name[mixer::ProgramVolume::NAME_SZ];
+    snprintf(name, sizeof(name), "program%u.exe", i);
+    return mixer::ProgramVolume(1000 + i, i % 101, name);
+  }
+
+  static size_t transmit(const void* data, size_t sz) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    if (p[0] != 0x08 || sz < 8) {
+      return sz;
+    }
+    ++pages;
+    const uint16_t offset = utils::mem2T<uint16_t>(p + 1);
+    const uint8_t count = p[3];
+    const uint8_t n = offset < sessions ? std::min<uint16_t>(count, sessions - offset) : 0;
+
+    uint8_t head[3];
+    memcpy(head, &sessions, sizeof(sessions));
+    head[2] = n;
+    FakeImagePC::send(head, sizeof(head));
+    for (uint16_t i = offset; i < offset + n && not cut_short; ++i) {
+      const auto vol = session(i);
+      const uint8_t name_len = strlen(vol.name_) + 1;
+      uint8_t info[5];
+      memcpy(info, &vol.pid_, sizeof(vol.pid_));
+      info[2] = vol.volume_;
+      info[3] = vol.muted_;
+      info[4] = name_len;
+      FakeImagePC::send(info, sizeof(info));
+      FakeImagePC::send(vol.name_, name_len);
+    }
+    return sz;
+  }
+};
+
+void test_load_page() {
+  comm.init();
+  CommAPI& api = CommAPI::get_instance();
+  api.init(&comm);
+  FakeSessionPC::sessions = 100;
+  FakeSessionPC::pages = 0;
+  FakeSessionPC::cut_short = false;
+  When(Method(mock, transmit)).AlwaysDo(FakeSessionPC::transmit);
+
+  // every session is seen once, a window at a time
+  for (uint16_t offset = 0; offset < 100; offset += CommAPI::MAX_SUPPORTED_PROGRAMS) {
+    TEST_ASSERT_EQUAL(mixer::OK, api.load_page(offset, CommAPI::MAX_SUPPORTED_PROGRAMS));
+    TEST_ASSERT_EQUAL_UINT16(100, api.total_sessions());
+    for (size_t i = 0; i < CommAPI::MAX_SUPPORTED_PROGRAMS; ++i) {
+      const auto expected = FakeSessionPC::session(offset + i);
+      const auto& vol = api.get_volumes()[i];
+      TEST_ASSERT_TRUE(vol.has_value());
+      TEST_ASSERT_EQUAL_INT16(expected.pid_, vol->pid_);
+      TEST_ASSERT_EQUAL_UINT8(expected.volume_, vol->volume_);
+      TEST_ASSERT_EQUAL_STRING(expected.name_, vol->name_);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(100 / CommAPI::MAX_SUPPORTED_PROGRAMS, FakeSessionPC::pages);
+
+  // the last page isn't full
+  TEST_ASSERT_EQUAL(mixer::OK, api.load_page(98, CommAPI::MAX_SUPPORTED_PROGRAMS));
+  TEST_ASSERT_EQUAL_INT16(1099, api.get_volumes()[1]->pid_);
+  TEST_ASSERT_FALSE(api.get_volumes()[2].has_value());
+
+  // past the end, only the total is sent
+  TEST_ASSERT_EQUAL(mixer::OK, api.load_page(200, CommAPI::MAX_SUPPORTED_PROGRAMS));
+  TEST_ASSERT_EQUAL_UINT16(100, api.total_sessions());
+  TEST_ASSERT_FALSE(api.get_volumes()[0].has_value());
+
+  // a page cut short was answered
+  FakeSessionPC::cut_short = true;
+  TEST_ASSERT_EQUAL(mixer::CRC_ERR, api.load_page(0, CommAPI::MAX_SUPPORTED_PROGRAMS));
+
+  // an older PC doesn't know the command
+  When(Method(mock, transmit)).AlwaysDo([](const void*, size_t sz) { return sz; });
+  TEST_ASSERT_EQUAL(mixer::NO_ANSWER, api.load_page(0, CommAPI::MAX_SUPPORTED_PROGRAMS));
+}
+
 void mixer_api_test() {
   M_RUN_TEST(test_load_volumes);
+  M_RUN_TEST(test_image_stream);
+  M_RUN_TEST(test_image_stream_bad_crc);
+  M_RUN_TEST(test_load_image);
+  M_RUN_TEST(test_image_info);
+  M_RUN_TEST(test_load_page);
 }
 
 #endif
\ No newline at end of file
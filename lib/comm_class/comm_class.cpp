@@ -1,6 +1,12 @@
 #include "comm_class.h"
 #include "sem_lock.h"
+#include "rtos_trace.h"
+#include "metrics.h"
 
+METRICS_COUNTER(rx_bytes, "comm.rx_bytes");
+METRICS_COUNTER(rx_dropped, "comm.rx_dropped");  ///< the receive buffer was full
+METRICS_COUNTER(tx_bytes, "comm.tx_bytes");
+METRICS_COUNTER(tx_rejected, "comm.tx_rejected");  ///< writes which didn't fit into the send buffer
 
 
 void CommClass::init() {
@@ -8,10 +14,12 @@ void CommClass::init() {
   hw_msg_->init();
   flush_mtx_ = xSemaphoreCreateMutex();
   passert(flush_mtx_);
+  rtos_trace_name_object(flush_mtx_, "CommClass flush");
 }
 
 size_t CommClass::write(const uint8_t* data, size_t len) {
   if (tx_buffer_.free() < len) {
+    tx_rejected.add();
     return 0;
   }
   if (auto ptr = tx_buffer_.reserve(len)) {
@@ -32,6 +40,7 @@ size_t CommClass::write(const char* str) {
 
 size_t CommClass::write(uint8_t c) {
   if (tx_buffer_.is_full()) {
+    tx_rejected.add();
     return 0;
   }
   tx_buffer_.push(c);
@@ -86,6 +95,7 @@ void CommClass::flush() {
   while (auto n = tx_buffer_.size_cont()) {
     if (n == hw_msg_->transmit(&(tx_buffer_.peek()), n)) {
       tx_buffer_.pop(n);
+      tx_bytes.add(n);
     } else {
       if (--cnt == 0) {
         return;
@@ -114,5 +124,9 @@ void CommClass::notify_tx_task() {
 }
 
 void CommClass::receive(const void* buff, size_t len) {
-  rx_buffer_.push(static_cast<const uint8_t*>(buff), len);
+  const size_t n = rx_buffer_.push(static_cast<const uint8_t*>(buff), len);
+  rx_bytes.add(n);
+  if (n < len) {
+    rx_dropped.add(len - n);
+  }
 }
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "dlog.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+// the linker puts the format strings together, and marks where they are
+extern "C" const char __start_dlog_fmt[];
+
+// the section is there even if nothing logs
+__attribute__((section("dlog_fmt"), used)) static const char empty[] = "";
+
+namespace dlog {
+  namespace {
+    uint8_t queue[QUEUE_SZ];
+    uint32_t head = 0;  ///< bytes written
+    uint32_t tail = 0;  ///< bytes read
+    uint32_t dropped_ = 0;
+
+    uint8_t at(uint32_t i) {
+      return queue[i % QUEUE_SZ];
+    }
+  }  // namespace
+
+  uint16_t id(const char* fmt) {
+    return reinterpret_cast<uintptr_t>(fmt) - reinterpret_cast<uintptr_t>(__start_dlog_fmt);
+  }
+
+  void write(const uint8_t* record, size_t n) {
+    taskENTER_CRITICAL();
+    if (QUEUE_SZ - (head - tail) < n) {
+      ++dropped_;
+    } else {
+      const size_t first = head % QUEUE_SZ;
+      const size_t until_end = QUEUE_SZ - first;
+      if (n <= until_end) {
+        memcpy(queue + first, record, n);
+      } else {
+        memcpy(queue + first, record, until_end);
+        memcpy(queue, record + until_end, n - until_end);
+      }
+      head += n;
+    }
+    taskEXIT_CRITICAL();
+  }
+
+  size_t read(uint8_t* out, size_t max, uint32_t* dropped) {
+    taskENTER_CRITICAL();
+    size_t n = 0;
+    while (tail != head) {
+      const size_t len = HEAD_SZ + at(tail + 2);
+      if (n + len > max) {
+        break;
+      }
+      for (size_t i = 0; i < len; ++i) {
+        out[n++] = at(tail++);
+      }
+    }
+    *dropped = dropped_;
+    dropped_ = 0;
+    taskEXIT_CRITICAL();
+    return n;
+  }
+
+  size_t pending() {
+    return head - tail;
+  }
+}  // namespace dlog
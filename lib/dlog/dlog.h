@@ -0,0 +1,123 @@
+/**
+ * @file dlog.h
+ * @brief Deferred binary log, in place of formatting text on the board and sending it with CommAPI::echo()
+ * @details `DLOG("HEAP:%u\t%u", free, min)` queues the id of its format string and the raw arguments. The link task
+ * sends the queue to the PC with the LOG command, between its other commands. The format strings stay in the
+ * `dlog_fmt` section of the ELF, the id is the offset of a string there, and the PC server expands the records with
+ * the ELF, see `pc_server -L`.
+ *
+ * The arguments are stored by their type: integers up to 32 bits in 4 bytes, 64 bit integers in 8, floating point as a
+ * double, pointers as their address, and strings as a length byte and up to MAX_STRING characters. The format is
+ * checked like the one of printf, and a record that could be longer than MAX_RECORD doesn't compile.
+ *
+ * Logging never waits for the link, a record which doesn't fit into the queue is dropped and counted. Not for ISRs,
+ * and not in inline functions of headers, whose format strings would be in a COMDAT group.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#ifdef TESTING
+void dlog_tests();
+#endif
+
+namespace dlog {
+  static inline constexpr size_t QUEUE_SZ = 512;   ///< bytes of the records waiting for the link
+  static inline constexpr size_t HEAD_SZ = 3;      ///< id (u16) and length of the arguments (u8)
+  static inline constexpr size_t MAX_RECORD = 80;  ///< head and arguments
+  static inline constexpr size_t MAX_STRING = 32;  ///< longer strings are cut
+
+  /// @brief Id of a format string, its offset in the dlog_fmt section
+  uint16_t id(const char* fmt);
+
+  /// @brief Queue a record, drop it if the queue is full
+  void write(const uint8_t* record, size_t n);
+
+  /// @brief Move whole records from the queue, the oldest first
+  /// @param dropped set to the records dropped since the previous read
+  /// @return bytes moved, not more than @p max
+  size_t read(uint8_t* out, size_t max, uint32_t* dropped);
+
+  /// @brief Bytes in the queue
+  size_t pending();
+
+  namespace detail {
+    /// @brief Bytes of an argument in the record, the most for strings
+    template <typename T>
+    constexpr size_t max_size() {
+      using U = std::decay_t<T>;
+      if constexpr (std::is_floating_point_v<U>) {
+        return sizeof(double);
+      } else if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>) {
+        return 1 + MAX_STRING;
+      } else if constexpr (std::is_pointer_v<U>) {
+        return sizeof(uintptr_t);
+      } else {
+        static_assert(std::is_integral_v<U> || std::is_enum_v<U>, "DLOG takes numbers, pointers and strings");
+        return sizeof(U) > 4 ? 8 : 4;
+      }
+    }
+
+    inline void put(uint8_t*& out, const char* s) {
+      const uint8_t len = s ? strnlen(s, MAX_STRING) : 0;
+      *out++ = len;
+      memcpy(out, s, len);
+      out += len;
+    }
+
+    inline void put(uint8_t*& out, char* s) {
+      put(out, static_cast<const char*>(s));
+    }
+
+    template <typename T>
+    void put(uint8_t*& out, T value) {
+      if constexpr (std::is_enum_v<T>) {
+        put(out, static_cast<std::underlying_type_t<T>>(value));
+        return;
+      } else if constexpr (std::is_floating_point_v<T>) {
+        const double d = value;
+        memcpy(out, &d, sizeof(d));
+      } else if constexpr (std::is_pointer_v<T>) {
+        const uintptr_t p = reinterpret_cast<uintptr_t>(value);
+        memcpy(out, &p, sizeof(p));
+      } else if constexpr (max_size<T>() == 8) {
+        const uint64_t v = static_cast<uint64_t>(value);
+        memcpy(out, &v, sizeof(v));
+      } else {
+        // sign extended, like printf gets it
+        const std::conditional_t<std::is_signed_v<T>, int32_t, uint32_t> v = value;
+        memcpy(out, &v, sizeof(v));
+      }
+      out += max_size<T>();
+    }
+  }  // namespace detail
+
+  /// @brief Queue a record of @p id with @p args
+  template <typename... Args>
+  void log(uint16_t id, const Args&... args) {
+    static_assert(HEAD_SZ + (0 + ... + detail::max_size<Args>()) <= MAX_RECORD, "too many arguments for a record");
+    uint8_t record[MAX_RECORD];
+    uint8_t* out = record + HEAD_SZ;
+    (detail::put(out, args), ...);
+    memcpy(record, &id, sizeof(id));
+    record[2] = out - record - HEAD_SZ;
+    write(record, out - record);
+  }
+
+  /// @brief Never called, lets the compiler check the arguments against the format
+  __attribute__((format(printf, 1, 2))) inline void check_format(const char*, ...) {
+  }
+}  // namespace dlog
+
+/// @brief Log a line for the PC, formatted there
+#define DLOG(fmt, ...)                                                                   \
+  do {                                                                                   \
+    __attribute__((section("dlog_fmt"), used)) static const char dlog_fmt_[] = fmt;      \
+    if (false) {                                                                         \
+      ::dlog::check_format(fmt, ##__VA_ARGS__);                                          \
+    }                                                                                    \
+    ::dlog::log(::dlog::id(dlog_fmt_), ##__VA_ARGS__);                                   \
+  } while (0)
@@ -0,0 +1,106 @@
+#ifdef TESTING
+  #include "dlog.h"
+  #include "unity.h"
+
+extern "C" const char __start_dlog_fmt[];
+
+static uint8_t records[dlog::QUEUE_SZ];
+
+/// @brief Empty the queue, other tasks may have logged
+static void drain() {
+  uint32_t dropped;
+  while (dlog::read(records, sizeof(records), &dropped)) {
+  }
+}
+
+/// @brief The next argument of a record
+template <typename T>
+static T next(const uint8_t*& p) {
+  T value;
+  memcpy(&value, p, sizeof(value));
+  p += sizeof(value);
+  return value;
+}
+
+void test_dlog_encoding() {
+  drain();
+  enum Stage : uint8_t { FIRST, SECOND };
+  int x = 0;
+  DLOG("dlog test %d %d %s %llu %.1f %p", -2, SECOND, "abc", 1ULL << 40, 0.5f, &x);
+
+  uint32_t dropped = 1;
+  const size_t n = dlog::read(records, sizeof(records), &dropped);
+  TEST_ASSERT_EQUAL(0, dropped);
+  const size_t args = 4 + 4 + 1 + 3 + 8 + 8 + sizeof(uintptr_t);
+  TEST_ASSERT_EQUAL(dlog::HEAD_SZ + args, n);
+  TEST_ASSERT_EQUAL(args, records[2]);
+
+  // the id is the offset of the format in its section
+  const uint8_t* p = records;
+  const uint16_t id = next<uint16_t>(p);
+  TEST_ASSERT_EQUAL_STRING("dlog test %d %d %s %llu %.1f %p", __start_dlog_fmt + id);
+  TEST_ASSERT_EQUAL(id, dlog::id(__start_dlog_fmt + id));
+
+  p = records + dlog::HEAD_SZ;
+  TEST_ASSERT_EQUAL(-2, next<int32_t>(p));
+  TEST_ASSERT_EQUAL(1, next<uint32_t>(p));
+  TEST_ASSERT_EQUAL(3, *p++);
+  TEST_ASSERT_EQUAL_MEMORY("abc", p, 3);
+  p += 3;
+  TEST_ASSERT_TRUE(next<uint64_t>(p) == 1ULL << 40);
+  TEST_ASSERT_TRUE(next<double>(p) == 0.5);
+  TEST_ASSERT_TRUE(next<uintptr_t>(p) == reinterpret_cast<uintptr_t>(&x));
+}
+
+void test_dlog_strings() {
+  drain();
+  const char* none = nullptr;
+  DLOG("dlog test %s|%s", "a string longer than thirty two characters", none);
+
+  uint32_t dropped;
+  const size_t n = dlog::read(records, sizeof(records), &dropped);
+  TEST_ASSERT_EQUAL(dlog::HEAD_SZ + 1 + dlog::MAX_STRING + 1, n);
+  TEST_ASSERT_EQUAL(dlog::MAX_STRING, records[dlog::HEAD_SZ]);
+  TEST_ASSERT_EQUAL_MEMORY("a string longer than thirty two ", records + dlog::HEAD_SZ + 1, dlog::MAX_STRING);
+  TEST_ASSERT_EQUAL(0, records[n - 1]);
+}
+
+void test_dlog_drops() {
+  drain();
+  // 3 + 4 bytes a record
+  size_t logged = 0;
+  while (dlog::pending() + 7 <= dlog::QUEUE_SZ) {
+    DLOG("dlog test %u", static_cast<unsigned>(logged++));
+  }
+  DLOG("dlog test %u", 1000u);
+  DLOG("dlog test %u", 1001u);
+  TEST_ASSERT_EQUAL(logged * 7, dlog::pending());
+
+  // only whole records, and the drops once
+  uint32_t dropped;
+  TEST_ASSERT_EQUAL(2 * 7, dlog::read(records, 2 * 7 + 6, &dropped));
+  TEST_ASSERT_EQUAL(2, dropped);
+  const uint8_t* p = records + 7 + dlog::HEAD_SZ;
+  TEST_ASSERT_EQUAL(1, next<uint32_t>(p));
+
+  // the queue wraps
+  DLOG("dlog test %u", 1002u);
+  size_t n = 0;
+  uint32_t more = 0;
+  for (size_t got; (got = dlog::read(records + n, 7, &dropped)); n += got) {
+    more += dropped;
+  }
+  TEST_ASSERT_EQUAL(0, more);
+  TEST_ASSERT_EQUAL((logged - 1) * 7, n);
+  p = records + n - 4;
+  TEST_ASSERT_EQUAL(1002, next<uint32_t>(p));
+  TEST_ASSERT_EQUAL(0, dlog::pending());
+}
+
+void dlog_tests() {
+  RUN_TEST(test_dlog_encoding);
+  RUN_TEST(test_dlog_strings);
+  RUN_TEST(test_dlog_drops);
+}
+
+#endif
@@ -0,0 +1,305 @@
+#include "icon_cache.h"
+#include "utils.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+  constexpr uint32_t MAGIC = 0x31434349;      ///< "ICC1"
+  constexpr uint32_t COMMITTED = 0x00C0FFEE;  ///< state of a complete record
+  constexpr uint32_t ERASED = 0xFFFFFFFF;
+
+  struct SectorHeader {
+    uint32_t seq;
+    uint32_t magic;  ///< programmed after seq
+  };
+
+  struct RecordHeader {
+    uint32_t key;
+    uint32_t size;
+    uint32_t check;  ///< of key and size, a torn header ends the log
+    uint32_t state;  ///< programmed after the icon
+  };
+  constexpr size_t CHECKED = offsetof(RecordHeader, check);
+  constexpr size_t STATE = offsetof(RecordHeader, state);
+
+  constexpr size_t align(size_t n) {
+    return (n + IFlash::ALIGN - 1) / IFlash::ALIGN * IFlash::ALIGN;
+  }
+
+  uint32_t check(const RecordHeader& h) {
+    return utils::crc32mpeg2(reinterpret_cast<const uint8_t*>(&h), CHECKED);
+  }
+
+  /// @brief Call @p f(offset, header) for each record of the sector, which has a valid header
+  /// @return end of the log. After a torn header, the sector counts as full
+  template <typename F>
+  size_t scan(const IFlash& flash, size_t sector, F&& f) {
+    const size_t sz = flash.sector_size();
+    size_t offset = sizeof(SectorHeader);
+    RecordHeader h;
+    while (offset + sizeof(h) <= sz) {
+      if (not flash.read(sector, offset, &h, sizeof(h))) {
+        return sz;
+      }
+      if (h.key == ERASED && h.size == ERASED && h.check == ERASED && h.state == ERASED) {
+        return offset;
+      }
+      if (h.check != check(h) || h.size > sz - offset - sizeof(h)) {
+        return sz;
+      }
+      f(offset, h);
+      offset += sizeof(h) + align(h.size);
+    }
+    return sz;
+  }
+}  // namespace
+
+uint32_t IconCache::hash(const uint8_t* data, size_t len, uint32_t crc) {
+  return utils::crc32mpeg2(data, len, crc);
+}
+
+size_t IconCache::sectors() const {
+  return std::min(flash_.sector_count(), MAX_SECTORS);
+}
+
+void IconCache::mount() {
+  head_ = MAX_SECTORS;
+  spare_ = MAX_SECTORS;
+  for (size_t s = 0; s < sectors(); ++s) {
+    SectorHeader h;
+    sectors_[s].valid = flash_.read(s, 0, &h, sizeof(h)) && h.magic == MAGIC;
+    sectors_[s].seq = h.seq;
+    if (sectors_[s].valid && (head_ == MAX_SECTORS || h.seq > sectors_[head_].seq)) {
+      head_ = s;
+    }
+  }
+  end_ = head_ == MAX_SECTORS ? 0 : scan(flash_, head_, [](size_t, const RecordHeader&) {});
+}
+
+size_t IconCache::newest_first(std::array<size_t, MAX_SECTORS>& order) const {
+  size_t n = 0;
+  for (size_t s = 0; s < sectors(); ++s) {
+    if (sectors_[s].valid) {
+      order[n++] = s;
+    }
+  }
+  std::sort(order.begin(), order.begin() + n, [this](size_t a, size_t b) { return sectors_[a].seq > sectors_[b].seq; });
+  return n;
+}
+
+std::optional<IconCache::Location> IconCache::find(uint32_t key) const {
+  std::array<size_t, MAX_SECTORS> order;
+  const size_t n = newest_first(order);
+  for (size_t i = 0; i < n; ++i) {
+    // the last copy in a sector is the newest
+    std::optional<Location> found;
+    scan(flash_, order[i], [&](size_t offset, const RecordHeader& h) {
+      if (h.key == key && h.state == COMMITTED) {
+        found = Location{ order[i], offset, h.size };
+      }
+    });
+    if (found) {
+      return found;
+    }
+  }
+  return std::nullopt;
+}
+
+size_t IconCache::count() const {
+  std::array<size_t, MAX_SECTORS> order;
+  const size_t n = newest_first(order);
+  size_t icons = 0;
+  for (size_t i = 0; i < n; ++i) {
+    scan(flash_, order[i], [&](size_t offset, const RecordHeader& h) {
+      if (h.state != COMMITTED) {
+        return;
+      }
+      // older copies don't count
+      const auto newest = find(h.key);
+      icons += newest && newest->sector == order[i] && newest->offset == offset;
+    });
+  }
+  return icons;
+}
+
+bool IconCache::blank(size_t sector) const {
+  uint8_t buff[CHUNK];
+  for (size_t offset = 0; offset < flash_.sector_size(); offset += CHUNK) {
+    const size_t len = std::min(CHUNK, flash_.sector_size() - offset);
+    if (not flash_.read(sector, offset, buff, len)
+        || not std::all_of(buff, buff + len, [](uint8_t b) { return b == 0xFF; })) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IconCache::prepare() {
+  if (spare_ != MAX_SECTORS) {
+    return true;
+  }
+  // an unused sector, or the least recently used one, but never the head
+  size_t next = MAX_SECTORS;
+  for (size_t s = 0; s < sectors(); ++s) {
+    if (s == head_) {
+      continue;
+    }
+    if (next == MAX_SECTORS || (sectors_[next].valid && (not sectors_[s].valid || sectors_[s].seq < sectors_[next].seq))) {
+      next = s;
+    }
+  }
+  if (next == MAX_SECTORS) {
+    return false;
+  }
+  const bool erase = sectors_[next].valid || not blank(next);
+  sectors_[next].valid = false;
+  if (erase && not flash_.erase(next)) {
+    return false;
+  }
+  spare_ = next;
+  return true;
+}
+
+std::optional<size_t> IconCache::reserve(uint32_t size) {
+  const size_t sz = flash_.sector_size();
+  if (size > sz - sizeof(SectorHeader) - sizeof(RecordHeader)) {
+    return std::nullopt;
+  }
+  const size_t need = sizeof(RecordHeader) + align(size);
+
+  if (head_ == MAX_SECTORS || end_ + need > sz) {
+    if (spare_ == MAX_SECTORS) {
+      return std::nullopt;
+    }
+    uint32_t newest = 0;
+    for (size_t s = 0; s < sectors(); ++s) {
+      if (sectors_[s].valid) {
+        newest = std::max(newest, sectors_[s].seq);
+      }
+    }
+
+    // the sector counts as unused until its header is complete
+    const size_t next = spare_;
+    spare_ = MAX_SECTORS;
+    head_ = MAX_SECTORS;
+    const SectorHeader h{ newest + 1, MAGIC };
+    if (not flash_.program(next, 0, &h.seq, sizeof(h.seq))
+        || not flash_.program(next, offsetof(SectorHeader, magic), &h.magic, sizeof(h.magic))) {
+      return std::nullopt;
+    }
+    sectors_[next] = { h.seq, true };
+    head_ = next;
+    end_ = sizeof(SectorHeader);
+  }
+
+  const size_t offset = end_;
+  end_ += need;
+  return offset;
+}
+
+IconCache::Writer IconCache::begin(uint32_t key, uint32_t size) {
+  const auto offset = reserve(size);
+  if (not offset) {
+    return Writer();
+  }
+  RecordHeader h{ key, size, 0, ERASED };
+  h.check = check(h);
+  if (not flash_.program(head_, *offset, &h, STATE)) {
+    return Writer();
+  }
+  return Writer(&flash_, key, size, head_, *offset);
+}
+
+IconCache::Writer IconCache::add(uint32_t key, uint32_t size) {
+  return begin(key, size);
+}
+
+std::optional<IconCache::Location> IconCache::copy(uint32_t key, const Location& from) {
+  Writer w = begin(key, from.size);
+  Reader r(&flash_, key, from.sector, from.offset + sizeof(RecordHeader), from.size);
+  const uint8_t* data = nullptr;
+  while (const size_t len = r.next(data)) {
+    w.write(data, len);
+  }
+  if (not w.commit()) {
+    return std::nullopt;
+  }
+  return Location{ w.sector_, w.offset_, w.size_ };
+}
+
+IconCache::Reader IconCache::open(uint32_t key) {
+  auto loc = find(key);
+  if (not loc) {
+    return Reader();
+  }
+  if (loc->sector != head_) {
+    // used again, so it must outlive its sector. Without space in the head or a spare, it's read from there
+    if (const auto moved = copy(key, *loc)) {
+      loc = moved;
+    }
+  }
+  return Reader(&flash_, key, loc->sector, loc->offset + sizeof(RecordHeader), loc->size);
+}
+
+size_t IconCache::Reader::next(const uint8_t*& data) {
+  if (not found_ || read_ >= size_) {
+    return 0;
+  }
+  const size_t len = std::min<size_t>(CHUNK, size_ - read_);
+  if (not flash_->read(sector_, offset_ + read_, buff_, len)) {
+    found_ = false;
+    return 0;
+  }
+  crc_ = hash(buff_, len, crc_);
+  read_ += len;
+  data = buff_;
+  return len;
+}
+
+bool IconCache::Writer::program(const uint8_t* data, size_t len) {
+  failed_ = failed_ || not flash_->program(sector_, offset_ + sizeof(RecordHeader) + programmed_, data, len);
+  programmed_ += len;
+  return not failed_;
+}
+
+bool IconCache::Writer::write(const uint8_t* data, size_t len) {
+  if (failed_ || len > size_ - written_) {
+    failed_ = true;
+    return false;
+  }
+  crc_ = hash(data, len, crc_);
+  written_ += len;
+
+  // complete the tail first, the flash is programmed in aligned words
+  if (tail_len_) {
+    const size_t take = std::min(IFlash::ALIGN - tail_len_, len);
+    memcpy(tail_ + tail_len_, data, take);
+    tail_len_ += take;
+    data += take;
+    len -= take;
+    if (tail_len_ == IFlash::ALIGN) {
+      tail_len_ = 0;
+      program(tail_, IFlash::ALIGN);
+    }
+  }
+  const size_t aligned = len / IFlash::ALIGN * IFlash::ALIGN;
+  if (aligned) {
+    program(data, aligned);
+  }
+  memcpy(tail_ + tail_len_, data + aligned, len - aligned);
+  tail_len_ += len - aligned;
+  return not failed_;
+}
+
+bool IconCache::Writer::commit() {
+  if (failed_ || written_ != size_ || crc_ != key_) {
+    return false;
+  }
+  if (tail_len_) {
+    memset(tail_ + tail_len_, 0xFF, IFlash::ALIGN - tail_len_);
+    tail_len_ = 0;
+    program(tail_, IFlash::ALIGN);
+  }
+  failed_ = failed_ || not flash_->program(sector_, offset_ + STATE, &COMMITTED, sizeof(COMMITTED));
+  return not failed_;
+}
@@ -0,0 +1,175 @@
+#pragma once
+#include "IFlash.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#ifdef TESTING
+void icon_cache_tests();
+#endif
+
+/// @brief Icons received from the PC, kept in flash across reboots
+/// @details The icons are a log in the sectors of an IFlash, keyed by the hash of their content. New icons are appended
+/// to the newest sector. When it's full, the spare sector becomes the newest one. An icon read from an older sector is
+/// copied to the newest one first, so the icons in use aren't evicted.
+///
+/// Erasing stalls the CPU for 1-2 s, so adding and opening icons never erase. prepare() erases the spare ahead of time,
+/// the least recently used sector, if no sector is unused. Without a spare, icons aren't added until it's called.
+///
+/// Sector: { sequence, MAGIC }, then records
+/// Record: { key, size, check, state }, then the icon, padded to IFlash::ALIGN
+///
+/// The magic and the state are written last, so anything cut by a power loss is skipped after the reboot. Only one
+/// Reader or Writer may be used at a time.
+class IconCache {
+public:
+  static inline constexpr size_t MAX_SECTORS = 8;  ///< more sectors of the flash aren't used
+  static inline constexpr size_t CHUNK = 64;       ///< most bytes returned by Reader::next(), flash reads are cheap
+
+  /// @brief Hash of an icon, its key in the cache
+  /// @details utils::crc32mpeg2() of the whole file, the PC reports the same with the image info
+  static uint32_t hash(const uint8_t* data, size_t len, uint32_t crc = 0xFFFFFFFF);
+
+  explicit IconCache(IFlash& flash) : flash_(flash) {
+  }
+
+  /// @brief Find the newest sector and the end of its log, call before anything else
+  void mount();
+
+  /// @brief Erase the spare sector, if there is none, call while nothing waits for the CPU
+  /// @details A sector, which is unused and still erased, becomes the spare without an erase
+  /// @return true if there is a spare
+  bool prepare();
+
+  /// @brief Reads a cached icon chunk by chunk
+  class Reader {
+  public:
+    /// @brief true if the icon is in the cache
+    bool found() const {
+      return found_;
+    }
+
+    /// @brief Size of the icon in bytes
+    uint32_t size() const {
+      return size_;
+    }
+
+    /// @brief Read the next chunk
+    /// @param data set to the chunk, valid until the next call
+    /// @return length of the chunk, 0 at the end or on failure
+    size_t next(const uint8_t*& data);
+
+    /// @brief true if the whole icon was read, and it still matches its hash
+    bool intact() const {
+      return found_ && read_ == size_ && crc_ == key_;
+    }
+
+  private:
+    friend class IconCache;
+    Reader() = default;
+    Reader(const IFlash* flash, uint32_t key, size_t sector, size_t offset, uint32_t size)
+        : flash_(flash), key_(key), sector_(sector), offset_(offset), size_(size), found_(true) {
+    }
+
+    const IFlash* flash_ = nullptr;
+    uint32_t key_ = 0;
+    size_t sector_ = 0;
+    size_t offset_ = 0;  ///< of the icon in the sector
+    uint32_t size_ = 0;
+    uint32_t read_ = 0;
+    uint32_t crc_ = 0xFFFFFFFF;
+    bool found_ = false;
+    uint8_t buff_[CHUNK];
+  };
+
+  /// @brief Appends an icon while it's received
+  /// @details The icon is only found after commit(). If the Writer is dropped before, its space is lost until the
+  /// sector is evicted.
+  class Writer {
+  public:
+    /// @brief false if there was no space, or writing failed
+    bool ok() const {
+      return not failed_;
+    }
+
+    /// @brief Append the next part of the icon
+    /// @return false on failure, or if it's more than the size given to add()
+    bool write(const uint8_t* data, size_t len);
+
+    /// @brief Finish the icon
+    /// @return true if all of it was written, and it matches its key
+    bool commit();
+
+  private:
+    friend class IconCache;
+    Writer() = default;
+    Writer(IFlash* flash, uint32_t key, uint32_t size, size_t sector, size_t offset)
+        : flash_(flash), key_(key), size_(size), sector_(sector), offset_(offset), failed_(false) {
+    }
+
+    /// @brief Program @p len bytes after the programmed ones
+    bool program(const uint8_t* data, size_t len);
+
+    IFlash* flash_ = nullptr;
+    uint32_t key_ = 0;
+    uint32_t size_ = 0;
+    size_t sector_ = 0;
+    size_t offset_ = 0;        ///< of the record in the sector
+    uint32_t written_ = 0;     ///< bytes of the icon taken by write()
+    uint32_t programmed_ = 0;  ///< bytes of the icon in flash, the rest is in the tail
+    uint32_t crc_ = 0xFFFFFFFF;
+    uint8_t tail_[IFlash::ALIGN] = { 0 };  ///< not aligned end of the written bytes, not programmed yet
+    size_t tail_len_ = 0;
+    bool failed_ = true;
+  };
+
+  /// @brief Open the icon with hash @p key, move it to the newest sector if needed
+  Reader open(uint32_t key);
+
+  /// @brief Start to append an icon, which has the hash @p key
+  /// @details Takes the spare, if the newest sector is full. Without one, the Writer fails
+  Writer add(uint32_t key, uint32_t size);
+
+  /// @brief Number of icons, which can be found
+  size_t count() const;
+
+private:
+  struct Location {
+    size_t sector;
+    size_t offset;  ///< of the record
+    uint32_t size;
+  };
+
+  struct Sector {
+    uint32_t seq = 0;    ///< higher is newer
+    bool valid = false;  ///< has a complete header
+  };
+
+  /// @brief Newest location of the icon
+  std::optional<Location> find(uint32_t key) const;
+
+  /// @brief Make space for a record of @p size bytes of data in the newest sector
+  /// @return offset of the record, or nothing if there is no space
+  std::optional<size_t> reserve(uint32_t size);
+
+  /// @brief Reserve a record and write its header
+  Writer begin(uint32_t key, uint32_t size);
+
+  /// @brief Copy the icon to the newest sector
+  std::optional<Location> copy(uint32_t key, const Location& from);
+
+  /// @brief Sectors with a header, newest first
+  size_t newest_first(std::array<size_t, MAX_SECTORS>& order) const;
+
+  size_t sectors() const;
+
+  /// @brief true if the whole sector reads as erased
+  bool blank(size_t sector) const;
+
+  IFlash& flash_;
+  std::array<Sector, MAX_SECTORS> sectors_{};
+  size_t head_ = MAX_SECTORS;   ///< newest sector, appended to
+  size_t end_ = 0;              ///< end of the log in the head
+  size_t spare_ = MAX_SECTORS;  ///< erased, the next head
+};
@@ -0,0 +1,308 @@
+#ifdef TESTING
+  #include "icon_cache.h"
+  #include "FileFlash.h"
+  #include "unity.h"
+  #include <algorithm>
+  #include <cstdio>
+  #include <cstring>
+
+static constexpr size_t SECTORS = 3;
+static constexpr size_t SECTOR_SZ = 1024;
+static constexpr size_t ICON_SZ = 301;  ///< not aligned, three fit into a sector
+
+/// @brief Content of icon @p n, every icon is different
+static const uint8_t* icon(uint8_t n, size_t sz = ICON_SZ) {
+  static uint8_t data[SECTOR_SZ];
+  for (size_t i = 0; i < sz; ++i) {
+    data[i] = static_cast<uint8_t>(i * 31 + n * 17 + (i >> 3));
+  }
+  return data;
+}
+
+static uint32_t key(uint8_t n, size_t sz = ICON_SZ) {
+  return IconCache::hash(icon(n, sz), sz);
+}
+
+/// @brief Append icon @p n in uneven parts, like chunks from the PC
+/// @details The spare is prepared before, like the link task does while it's idle
+static bool add(IconCache& cache, uint8_t n, size_t sz = ICON_SZ) {
+  cache.prepare();
+  IconCache::Writer w = cache.add(key(n, sz), sz);
+  const uint8_t* data = icon(n, sz);
+  for (size_t done = 0, part = 1; done < sz; done += part, part = part * 3 + 1) {
+    part = std::min(part, sz - done);
+    w.write(data + done, part);
+  }
+  return w.commit();
+}
+
+/// @brief true if icon @p n is found, and it's read back unchanged
+static bool has(IconCache& cache, uint8_t n, size_t sz = ICON_SZ) {
+  IconCache::Reader r = cache.open(key(n, sz));
+  if (not r.found() || r.size() != sz) {
+    return false;
+  }
+  const uint8_t* expected = icon(n, sz);
+  size_t pos = 0;
+  const uint8_t* data = nullptr;
+  while (const size_t len = r.next(data)) {
+    if (0 != memcmp(expected + pos, data, len)) {
+      return false;
+    }
+    pos += len;
+  }
+  return r.intact();
+}
+
+void test_add_open() {
+  FileFlash flash(nullptr, SECTORS, SECTOR_SZ);
+  IconCache cache(flash);
+  cache.mount();
+  TEST_ASSERT_FALSE(cache.open(key(1)).found());
+
+  TEST_ASSERT_TRUE(add(cache, 1));
+  TEST_ASSERT_TRUE(add(cache, 2, 4));
+  TEST_ASSERT_TRUE(has(cache, 1));
+  TEST_ASSERT_TRUE(has(cache, 2, 4));
+  TEST_ASSERT_EQUAL(2, cache.count());
+}
+
+void test_reboot() {
+  FileFlash flash(nullptr, SECTORS, SECTOR_SZ);
+  {
+    IconCache cache(flash);
+    cache.mount();
+    for (uint8_t n = 1; n <= 4; ++n) {
+      TEST_ASSERT_TRUE(add(cache, n));
+    }
+  }
+  IconCache cache(flash);
+  cache.mount();
+  TEST_ASSERT_EQUAL(4, cache.count());
+  for (uint8_t n = 1; n <= 4; ++n) {
+    TEST_ASSERT_TRUE(has(cache, n));
+  }
+  // appended after the old ones
+  TEST_ASSERT_TRUE(add(cache, 5));
+  TEST_ASSERT_EQUAL(5, cache.count());
+}
+
+  #ifdef NATIVE
+void test_file_backed() {
+  char path[] = "/tmp/icon_cache_XXXXXX";
+  TEST_ASSERT_NOT_EQUAL(-1, mkstemp(path));
+  remove(path);
+  {
+    FileFlash flash(path, SECTORS, SECTOR_SZ);
+    IconCache cache(flash);
+    cache.mount();
+    TEST_ASSERT_TRUE(add(cache, 1));
+  }
+  FileFlash flash(path, SECTORS, SECTOR_SZ);
+  IconCache cache(flash);
+  cache.mount();
+  TEST_ASSERT_TRUE(has(cache, 1));
+  remove(path);
+}
+  #endif
+
+void test_rejected() {
+  FileFlash flash(nullptr, SECTORS, SECTOR_SZ);
+  IconCache cache(flash);
+  cache.mount();
+  TEST_ASSERT_TRUE(cache.prepare());
+
+  // the content doesn't match the key
+  IconCache::Writer w = cache.add(key(1) ^ 1, ICON_SZ);
+  TEST_ASSERT_TRUE(w.write(icon(1), ICON_SZ));
+  TEST_ASSERT_FALSE(w.commit());
+
+  // more than announced, or less
+  w = cache.add(key(2), ICON_SZ - 1);
+  TEST_ASSERT_FALSE(w.write(icon(2), ICON_SZ));
+  TEST_ASSERT_FALSE(w.commit());
+  w = cache.add(key(3), ICON_SZ);
+  TEST_ASSERT_TRUE(w.write(icon(3), ICON_SZ - 1));
+  TEST_ASSERT_FALSE(w.commit());
+
+  // larger than a sector
+  TEST_ASSERT_FALSE(cache.add(key(4, SECTOR_SZ), SECTOR_SZ).ok());
+
+  TEST_ASSERT_EQUAL(0, cache.count());
+  TEST_ASSERT_TRUE(add(cache, 5));
+  TEST_ASSERT_TRUE(has(cache, 5));
+}
+
+void test_lru_eviction() {
+  FileFlash flash(nullptr, SECTORS, SECTOR_SZ);
+  IconCache cache(flash);
+  cache.mount();
+
+  // icon 1 is shown all the time, new ones keep coming
+  TEST_ASSERT_TRUE(add(cache, 1));
+  for (uint8_t n = 2; n < 30; ++n) {
+    TEST_ASSERT_TRUE(add(cache, n));
+    TEST_ASSERT_TRUE(has(cache, 1));
+  }
+  TEST_ASSERT_GREATER_THAN(SECTORS, flash.erases());
+
+  // the newest sectors are kept, the rest is evicted
+  TEST_ASSERT_TRUE(has(cache, 29));
+  TEST_ASSERT_TRUE(has(cache, 28));
+  TEST_ASSERT_FALSE(cache.open(key(2)).found());
+  TEST_ASSERT_LESS_OR_EQUAL(SECTORS * (SECTOR_SZ / ICON_SZ), cache.count());
+}
+
+void test_move_to_newest() {
+  FileFlash flash(nullptr, SECTORS, SECTOR_SZ);
+  IconCache cache(flash);
+  cache.mount();
+
+  // two full sectors, the third one is the spare
+  for (uint8_t n = 1; n <= 6; ++n) {
+    TEST_ASSERT_TRUE(add(cache, n));
+  }
+  TEST_ASSERT_EQUAL(6, cache.count());
+
+  // icon 2 is in the older sector, it's copied to the spare, which becomes the newest sector
+  TEST_ASSERT_TRUE(has(cache, 2));
+  // the head is full, and there is no spare, so icon 5 is read where it is
+  TEST_ASSERT_TRUE(has(cache, 5));
+
+  // the oldest sector is erased ahead, the copy stays
+  TEST_ASSERT_TRUE(cache.prepare());
+  TEST_ASSERT_FALSE(cache.open(key(1)).found());
+  TEST_ASSERT_FALSE(cache.open(key(3)).found());
+  TEST_ASSERT_TRUE(has(cache, 2));
+  TEST_ASSERT_TRUE(has(cache, 4));
+
+  // after a reboot, the copy is found, the older one is gone
+  IconCache rebooted(flash);
+  rebooted.mount();
+  TEST_ASSERT_TRUE(has(rebooted, 2));
+  TEST_ASSERT_EQUAL(cache.count(), rebooted.count());
+}
+
+void test_add_does_not_erase() {
+  FileFlash flash(nullptr, SECTORS, SECTOR_SZ);
+  IconCache cache(flash);
+  cache.mount();
+
+  // the sectors are still erased, none is erased again
+  TEST_ASSERT_TRUE(cache.prepare());
+  TEST_ASSERT_EQUAL(0, flash.erases());
+
+  // fill every sector, the spare of the last one is the oldest sector, erased ahead
+  for (uint8_t n = 1; n <= 9; ++n) {
+    TEST_ASSERT_TRUE(add(cache, n));
+  }
+  TEST_ASSERT_TRUE(cache.prepare());
+  const uint32_t erases = flash.erases();
+  TEST_ASSERT_EQUAL(1, erases);
+
+  // the head is full, the icon goes into the spare
+  TEST_ASSERT_TRUE(cache.add(key(10), ICON_SZ).ok());
+  TEST_ASSERT_EQUAL(erases, flash.erases());
+
+  // fill the head again, without a spare there is no space, and still nothing is erased
+  for (uint8_t n = 11; n <= 12; ++n) {
+    IconCache::Writer w = cache.add(key(n), ICON_SZ);
+    TEST_ASSERT_TRUE(w.write(icon(n), ICON_SZ));
+    TEST_ASSERT_TRUE(w.commit());
+  }
+  TEST_ASSERT_FALSE(cache.add(key(13), ICON_SZ).ok());
+  // an older icon isn't copied either, it's read where it is
+  TEST_ASSERT_TRUE(has(cache, 4));
+  TEST_ASSERT_EQUAL(erases, flash.erases());
+
+  TEST_ASSERT_TRUE(cache.prepare());
+  TEST_ASSERT_EQUAL(erases + 1, flash.erases());
+}
+
+/// @brief Power is lost after @p cut bytes of the work, at every byte. After the reboot, the older icons are there, the
+/// interrupted one is there whole or not at all, and the cache still works
+template <typename F>
+static void power_loss(const char* name, size_t icons_before, F&& work) {
+  for (size_t cut = 0;; ++cut) {
+    FileFlash flash(nullptr, SECTORS, SECTOR_SZ);
+    {
+      IconCache cache(flash);
+      cache.mount();
+      for (uint8_t n = 1; n <= icons_before; ++n) {
+        TEST_ASSERT_TRUE(add(cache, n));
+      }
+      flash.cut_power_after(cut);
+      work(cache);
+    }
+    const bool finished = flash.powered();
+    flash.restore_power();
+
+    IconCache cache(flash);
+    cache.mount();
+    // the newest icon before the cut survives, the evicted sector may have held the oldest ones
+    if (icons_before) {
+      TEST_ASSERT_TRUE_MESSAGE(has(cache, icons_before), name);
+    }
+    const IconCache::Reader r = cache.open(key(100));
+    TEST_ASSERT_TRUE_MESSAGE(not r.found() || has(cache, 100), name);
+    if (finished) {
+      TEST_ASSERT_TRUE_MESSAGE(has(cache, 100), name);
+    }
+
+    TEST_ASSERT_TRUE_MESSAGE(add(cache, 101), name);
+    IconCache rebooted(flash);
+    rebooted.mount();
+    TEST_ASSERT_TRUE_MESSAGE(has(rebooted, 101), name);
+
+    if (finished) {
+      return;
+    }
+  }
+}
+
+void test_power_loss_append() {
+  power_loss("append", 2, [](IconCache& cache) { add(cache, 100); });
+}
+
+void test_power_loss_new_sector() {
+  // the head is full, the icon goes into an erased sector
+  power_loss("new sector", 3, [](IconCache& cache) { add(cache, 100); });
+}
+
+void test_power_loss_eviction() {
+  // every sector is full, the oldest one is erased ahead for the icon
+  power_loss("eviction", 9, [](IconCache& cache) { add(cache, 100); });
+}
+
+void test_power_loss_move() {
+  // icon 100 is moved from the older sector to the spare, then the older sector is erased ahead
+  power_loss("move", 0, [](IconCache& cache) {
+    for (uint8_t n = 1; n <= 2; ++n) {
+      add(cache, n);
+    }
+    add(cache, 100);
+    for (uint8_t n = 3; n <= 5; ++n) {
+      add(cache, n);
+    }
+    has(cache, 100);
+    cache.prepare();
+  });
+}
+
+void icon_cache_tests() {
+  RUN_TEST(test_add_open);
+  RUN_TEST(test_reboot);
+  #ifdef NATIVE
+  RUN_TEST(test_file_backed);
+  #endif
+  RUN_TEST(test_rejected);
+  RUN_TEST(test_lru_eviction);
+  RUN_TEST(test_move_to_newest);
+  RUN_TEST(test_add_does_not_erase);
+  RUN_TEST(test_power_loss_append);
+  RUN_TEST(test_power_loss_new_sector);
+  RUN_TEST(test_power_loss_eviction);
+  RUN_TEST(test_power_loss_move);
+}
+
+#endif
@@ -0,0 +1,153 @@
+/**
+ * @file ili9341_scroll.h
+ * @brief Vertical hardware scrolling of the ILI9341
+ * @details Plain C, so the ILI9341 driver in uGFX can use it. The controller scrolls an area of rows by showing its
+ * frame memory from another row (VSCRSADD), the memory itself isn't moved, and the area wraps around. So a scroll is
+ * one register write, and after it each row, which is drawn, is mapped to the memory row shown at its place. A window
+ * across the wrap is written in two parts. The rows are those of the frame memory, which are the screen rows only in
+ * the native orientation.
+ *
+ * The bus is passed in, so the register writes can be counted by a test.
+ */
+
+#pragma once
+#include <stdint.h>
+
+#if defined(TESTING) && defined(__cplusplus)
+void ili9341_scroll_tests();
+#endif
+
+#define ILI9341_CASET 0x2A     ///< column address set
+#define ILI9341_PASET 0x2B     ///< page (row) address set
+#define ILI9341_RAMWR 0x2C     ///< memory write
+#define ILI9341_VSCRDEF 0x33   ///< vertical scrolling definition
+#define ILI9341_VSCRSADD 0x37  ///< vertical scrolling start address
+
+/// @brief Writes to the controller
+typedef struct {
+  void (*index)(void* ctx, uint16_t reg);    ///< command
+  void (*data)(void* ctx, uint16_t value);   ///< parameter or pixel
+  void* ctx;
+} ili9341_bus_t;
+
+/// @brief The scroll area, and how far it's scrolled
+typedef struct {
+  uint16_t rows;    ///< rows of the frame memory
+  uint16_t top;     ///< first row of the area, the rows above are fixed
+  uint16_t height;  ///< rows of the area, 0 if there is none
+  uint16_t offset;  ///< memory row shown at the top of the area, from the top
+} ili9341_scroll_t;
+
+/// @brief Window, which is written pixel by pixel
+typedef struct {
+  uint16_t x, cx;
+  uint16_t y;          ///< next row, which isn't in the window of the controller yet
+  uint16_t rows;       ///< rows after y
+  uint32_t px_left;    ///< pixels until the end of the window of the controller
+} ili9341_stream_t;
+
+/// @brief No scroll area, rows are shown where they are drawn
+static inline void ili9341_scroll_init(ili9341_scroll_t* s, uint16_t rows) {
+  s->rows = rows;
+  s->top = 0;
+  s->height = 0;
+  s->offset = 0;
+}
+
+/// @brief Memory row shown at row @p y
+static inline uint16_t ili9341_scroll_map(const ili9341_scroll_t* s, uint16_t y) {
+  if (y < s->top || y >= s->top + s->height) {
+    return y;
+  }
+  y += s->offset;
+  return y >= s->top + s->height ? y - s->height : y;
+}
+
+/// @brief Rows from @p y, up to @p cy, which are consecutive in memory
+static inline uint16_t ili9341_scroll_run(const ili9341_scroll_t* s, uint16_t y, uint16_t cy) {
+  uint16_t run = cy;
+  if (y < s->top) {
+    // the fixed rows above, then the area starts somewhere in the memory
+    run = s->top - y;
+  } else if (y < s->top + s->height) {
+    const uint16_t to_wrap = s->top + s->height - ili9341_scroll_map(s, y);
+    const uint16_t to_end = s->top + s->height - y;
+    run = to_wrap < to_end ? to_wrap : to_end;
+  }
+  return run < cy ? run : cy;
+}
+
+static inline void ili9341_scroll_write16(const ili9341_bus_t* bus, uint16_t value) {
+  bus->data(bus->ctx, value >> 8);
+  bus->data(bus->ctx, value & 0xFF);
+}
+
+/// @brief Set the start address of the area
+static inline void ili9341_scroll_start(const ili9341_scroll_t* s, const ili9341_bus_t* bus) {
+  bus->index(bus->ctx, ILI9341_VSCRSADD);
+  ili9341_scroll_write16(bus, s->top + s->offset);
+}
+
+/// @brief Set the scroll area, it isn't scrolled after this
+/// @details Without a scroll, the memory rows are shown where they were drawn
+static inline void ili9341_scroll_define(ili9341_scroll_t* s, const ili9341_bus_t* bus, uint16_t top,
+                                         uint16_t height) {
+  s->top = top;
+  s->height = height;
+  s->offset = 0;
+  bus->index(bus->ctx, ILI9341_VSCRDEF);
+  ili9341_scroll_write16(bus, top);
+  ili9341_scroll_write16(bus, height);
+  ili9341_scroll_write16(bus, s->rows - top - height);
+  ili9341_scroll_start(s, bus);
+}
+
+/// @brief Move the content of the area up by @p lines, down if negative
+/// @details The rows, which come in at the other end, show what went out. They need to be drawn again
+static inline void ili9341_scroll_lines(ili9341_scroll_t* s, const ili9341_bus_t* bus, int lines) {
+  if (!s->height) {
+    return;
+  }
+  int offset = ((int)s->offset + lines) % (int)s->height;
+  s->offset = (uint16_t)(offset < 0 ? offset + s->height : offset);
+  ili9341_scroll_start(s, bus);
+}
+
+/// @brief Set the window of the controller to the next rows of @p st, which are consecutive in memory
+static inline void ili9341_scroll_window(const ili9341_scroll_t* s, const ili9341_bus_t* bus, ili9341_stream_t* st) {
+  const uint16_t run = ili9341_scroll_run(s, st->y, st->rows);
+  const uint16_t y = ili9341_scroll_map(s, st->y);
+
+  bus->index(bus->ctx, ILI9341_CASET);
+  ili9341_scroll_write16(bus, st->x);
+  ili9341_scroll_write16(bus, st->x + st->cx - 1);
+  bus->index(bus->ctx, ILI9341_PASET);
+  ili9341_scroll_write16(bus, y);
+  ili9341_scroll_write16(bus, y + run - 1);
+
+  st->y += run;
+  st->rows -= run;
+  st->px_left = (uint32_t)run * st->cx;
+}
+
+/// @brief Start the memory write of the window @p x, @p y, @p cx, @p cy
+static inline void ili9341_scroll_stream_start(const ili9341_scroll_t* s, const ili9341_bus_t* bus,
+                                               ili9341_stream_t* st, uint16_t x, uint16_t y, uint16_t cx,
+                                               uint16_t cy) {
+  st->x = x;
+  st->cx = cx;
+  st->y = y;
+  st->rows = cy;
+  ili9341_scroll_window(s, bus, st);
+  bus->index(bus->ctx, ILI9341_RAMWR);
+}
+
+/// @brief Call after each pixel, moves the window of the controller past the wrap
+static inline void ili9341_scroll_stream_pixel(const ili9341_scroll_t* s, const ili9341_bus_t* bus,
+                                               ili9341_stream_t* st) {
+  if (--st->px_left || !st->rows) {
+    return;
+  }
+  ili9341_scroll_window(s, bus, st);
+  bus->index(bus->ctx, ILI9341_RAMWR);
+}
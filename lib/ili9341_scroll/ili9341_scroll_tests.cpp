@@ -0,0 +1,203 @@
+#ifdef TESTING
+  #include "ili9341_scroll.h"
+  #include "unity.h"
+  #include <array>
+  #include <vector>
+
+static constexpr uint16_t ROWS = 64;  ///< a short panel, the logic doesn't depend on it
+static constexpr uint16_t COLS = 8;
+
+/// @brief Stands in for the controller on the bus, keeps its frame memory and counts the writes
+struct MockPanel {
+  std::array<std::array<uint16_t, COLS>, ROWS> mem{};
+  uint16_t reg = 0;
+  std::vector<uint16_t> params;
+  uint16_t x0 = 0, x1 = COLS - 1, y0 = 0, y1 = ROWS - 1;  ///< window
+  uint16_t x = 0, y = 0;                                  ///< next pixel
+  uint16_t tfa = 0, vsa = ROWS, vsp = 0;
+  uint32_t writes = 0;   ///< commands, parameters and pixels
+  uint32_t windows = 0;  ///< memory writes started
+
+  static void index(void* ctx, uint16_t r) {
+    auto& p = *static_cast<MockPanel*>(ctx);
+    ++p.writes;
+    p.reg = r;
+    p.params.clear();
+    if (r == ILI9341_RAMWR) {
+      ++p.windows;
+      p.x = p.x0;
+      p.y = p.y0;
+    }
+  }
+
+  static void data(void* ctx, uint16_t v) {
+    auto& p = *static_cast<MockPanel*>(ctx);
+    ++p.writes;
+    if (p.reg == ILI9341_RAMWR) {
+      p.mem[p.y][p.x] = v;
+      if (++p.x > p.x1) {
+        p.x = p.x0;
+        ++p.y;
+      }
+      return;
+    }
+    p.params.push_back(v);
+    const auto& q = p.params;
+    const auto u16 = [&q](size_t i) { return static_cast<uint16_t>(q[i] << 8 | q[i + 1]); };
+    if (p.reg == ILI9341_CASET && q.size() == 4) {
+      p.x0 = u16(0);
+      p.x1 = u16(2);
+    } else if (p.reg == ILI9341_PASET && q.size() == 4) {
+      p.y0 = u16(0);
+      p.y1 = u16(2);
+    } else if (p.reg == ILI9341_VSCRDEF && q.size() == 6) {
+      p.tfa = u16(0);
+      p.vsa = u16(2);
+      TEST_ASSERT_EQUAL(ROWS, p.tfa + p.vsa + u16(4));
+    } else if (p.reg == ILI9341_VSCRSADD && q.size() == 2) {
+      p.vsp = u16(0);
+    }
+  }
+
+  /// @brief Pixel shown on the screen
+  uint16_t shown(uint16_t sx, uint16_t sy) const {
+    if (sy < tfa || sy >= tfa + vsa) {
+      return mem[sy][sx];
+    }
+    return mem[tfa + (sy - tfa + vsp - tfa) % vsa][sx];
+  }
+
+  ili9341_bus_t bus() {
+    return { index, data, this };
+  }
+};
+
+/// @brief Color of a row, as drawn
+static uint16_t color(uint16_t row, uint16_t generation = 0) {
+  return static_cast<uint16_t>(generation << 8 | row);
+}
+
+/// @brief Draw rows @p y to @p y + @p cy - 1 through the driver functions
+static void draw_rows(const ili9341_scroll_t& s, MockPanel& panel, uint16_t y, uint16_t cy, uint16_t gen = 0) {
+  const ili9341_bus_t bus = panel.bus();
+  ili9341_stream_t st;
+  ili9341_scroll_stream_start(&s, &bus, &st, 0, y, COLS, cy);
+  for (uint16_t row = y; row < y + cy; ++row) {
+    for (uint16_t col = 0; col < COLS; ++col) {
+      MockPanel::data(&panel, color(row, gen));
+      ili9341_scroll_stream_pixel(&s, &bus, &st);
+    }
+  }
+}
+
+/// @brief Each screen row shows the color @p expected returns for it
+template <typename F>
+static void assert_screen(const MockPanel& panel, F&& expected) {
+  for (uint16_t row = 0; row < ROWS; ++row) {
+    for (uint16_t col = 0; col < COLS; ++col) {
+      TEST_ASSERT_EQUAL_UINT16(expected(row), panel.shown(col, row));
+    }
+  }
+}
+
+void test_not_scrolled() {
+  MockPanel panel;
+  ili9341_scroll_t s;
+  ili9341_scroll_init(&s, ROWS);
+  draw_rows(s, panel, 0, ROWS);
+  assert_screen(panel, [](uint16_t row) { return color(row); });
+
+  // the window is set once: CASET, PASET and RAMWR with their parameters
+  TEST_ASSERT_EQUAL_UINT32(1, panel.windows);
+  TEST_ASSERT_EQUAL_UINT32(11 + ROWS * COLS, panel.writes);
+}
+
+void test_scroll_up() {
+  MockPanel panel;
+  const ili9341_bus_t bus = panel.bus();
+  ili9341_scroll_t s;
+  ili9341_scroll_init(&s, ROWS);
+  draw_rows(s, panel, 0, ROWS);
+
+  // a list between a fixed header and footer
+  constexpr uint16_t TOP = 10, HEIGHT = 40, LINES = 3;
+  ili9341_scroll_define(&s, &bus, TOP, HEIGHT);
+  assert_screen(panel, [](uint16_t row) { return color(row); });
+
+  panel.writes = 0;
+  ili9341_scroll_lines(&s, &bus, LINES);
+  TEST_ASSERT_EQUAL_UINT32(3, panel.writes);  // VSCRSADD and its two bytes
+
+  // the content moved up, the rows, which came in at the bottom, are drawn again
+  draw_rows(s, panel, TOP + HEIGHT - LINES, LINES, 1);
+  assert_screen(panel, [](uint16_t row) {
+    if (row < TOP || row >= TOP + HEIGHT) {
+      return color(row);
+    }
+    return row >= TOP + HEIGHT - LINES ? color(row, 1) : color(row + LINES);
+  });
+}
+
+void test_scroll_down() {
+  MockPanel panel;
+  const ili9341_bus_t bus = panel.bus();
+  ili9341_scroll_t s;
+  ili9341_scroll_init(&s, ROWS);
+  draw_rows(s, panel, 0, ROWS);
+  ili9341_scroll_define(&s, &bus, 0, ROWS);
+
+  // down twice, so the offset wraps below 0
+  ili9341_scroll_lines(&s, &bus, -5);
+  ili9341_scroll_lines(&s, &bus, -5);
+  draw_rows(s, panel, 0, 10, 1);
+  assert_screen(panel, [](uint16_t row) { return row < 10 ? color(row, 1) : color(row - 10); });
+}
+
+void test_window_across_wrap() {
+  MockPanel panel;
+  const ili9341_bus_t bus = panel.bus();
+  ili9341_scroll_t s;
+  ili9341_scroll_init(&s, ROWS);
+  ili9341_scroll_define(&s, &bus, 8, 48);
+  ili9341_scroll_lines(&s, &bus, 20);
+
+  // from the fixed rows, across the wrap, into the fixed rows below
+  panel.windows = 0;
+  draw_rows(s, panel, 0, ROWS, 2);
+  assert_screen(panel, [](uint16_t row) { return color(row, 2); });
+  TEST_ASSERT_EQUAL_UINT32(4, panel.windows);
+}
+
+void test_writes_per_line() {
+  // scrolling the whole area by one line, against drawing all of it again
+  constexpr uint16_t TOP = 0, HEIGHT = ROWS;
+  MockPanel panel;
+  const ili9341_bus_t bus = panel.bus();
+  ili9341_scroll_t s;
+  ili9341_scroll_init(&s, ROWS);
+  ili9341_scroll_define(&s, &bus, TOP, HEIGHT);
+
+  uint32_t scrolled = 0;
+  for (uint16_t line = 0; line < HEIGHT; ++line) {
+    panel.writes = 0;
+    ili9341_scroll_lines(&s, &bus, 1);
+    draw_rows(s, panel, TOP + HEIGHT - 1, 1, 1);
+    scrolled = std::max(scrolled, panel.writes);
+  }
+  // the start address, a window and the new line
+  TEST_ASSERT_EQUAL_UINT32(3 + 11 + COLS, scrolled);
+
+  panel.writes = 0;
+  draw_rows(s, panel, TOP, HEIGHT, 2);
+  TEST_ASSERT_GREATER_THAN_UINT32(HEIGHT * COLS, panel.writes);
+}
+
+void ili9341_scroll_tests() {
+  RUN_TEST(test_not_scrolled);
+  RUN_TEST(test_scroll_up);
+  RUN_TEST(test_scroll_down);
+  RUN_TEST(test_window_across_wrap);
+  RUN_TEST(test_writes_per_line);
+}
+
+#endif
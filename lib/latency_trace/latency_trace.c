@@ -0,0 +1,113 @@
+#include "latency_trace.h"
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+/// @brief Last mark of a stage
+typedef struct {
+  uint32_t time;
+  uint32_t origin;  ///< time of the touch sample, which started the chain
+  uint8_t pending;  ///< not yet consumed by the next stage
+  uint8_t has_origin;
+} latency_mark_t;
+
+static uint32_t (*clock_us)(void);
+static latency_mark_t marks[LATENCY_TOTAL];
+static latency_hist_t hists[LATENCY_NUM_HISTOGRAMS];
+
+static const char* const stage_names[LATENCY_NUM_HISTOGRAMS] = {
+  "touch", "dispatch", "handle", "frame", "response", "redraw_start", "redraw_end", "total",
+};
+
+static unsigned bucket_of(uint32_t us) {
+  unsigned b = 0;
+  while (us > 1 && b < LATENCY_TRACE_BUCKETS - 1) {
+    us >>= 1;
+    ++b;
+  }
+  return b;
+}
+
+static void record(latency_hist_t* h, uint32_t us) {
+  if (h->count == 0 || us < h->min_us) {
+    h->min_us = us;
+  }
+  if (us > h->max_us) {
+    h->max_us = us;
+  }
+  ++h->count;
+  h->sum_us += us;
+  ++h->buckets[bucket_of(us)];
+}
+
+void latency_trace_init(uint32_t (*now_us)(void)) {
+  clock_us = now_us;
+  latency_trace_reset();
+}
+
+void latency_trace_reset(void) {
+  taskENTER_CRITICAL();
+  memset(marks, 0, sizeof(marks));
+  memset(hists, 0, sizeof(hists));
+  taskEXIT_CRITICAL();
+}
+
+void latency_trace_mark(latency_stage_t stage) {
+  if (!clock_us || stage >= LATENCY_TOTAL) {
+    return;
+  }
+
+  taskENTER_CRITICAL();
+  const uint32_t now = clock_us();  // inside, so the clock doesn't need to be reentrant
+  latency_mark_t* m = &marks[stage];
+  if (stage == LATENCY_TOUCH_SAMPLE) {
+    // the latest sample before the dispatch counts
+    m->origin = now;
+    m->has_origin = 1;
+  } else {
+    latency_mark_t* prev = &marks[stage - 1];
+    if (prev->pending) {
+      prev->pending = 0;
+      record(&hists[stage], now - prev->time);
+      m->origin = prev->origin;
+      m->has_origin = prev->has_origin;
+    } else if (!m->pending) {
+      // not caused by the previous stage, e.g. a poll of the PC
+      m->has_origin = 0;
+    }
+    // a pending mark keeps its origin: a poll after set_volume carries the touch on
+  }
+  if (stage == LATENCY_REDRAW_END && m->has_origin) {
+    record(&hists[LATENCY_TOTAL], now - m->origin);
+    m->has_origin = 0;
+  }
+  m->time = now;
+  m->pending = 1;
+  taskEXIT_CRITICAL();
+}
+
+void latency_trace_get(latency_stage_t stage, latency_hist_t* out) {
+  taskENTER_CRITICAL();
+  *out = hists[stage];
+  taskEXIT_CRITICAL();
+}
+
+uint32_t latency_hist_percentile(const latency_hist_t* h, unsigned pct) {
+  if (h->count == 0) {
+    return 0;
+  }
+  const uint32_t rank = (uint32_t)(((uint64_t)h->count * pct + 99) / 100);
+  uint32_t seen = 0;
+  for (unsigned b = 0; b < LATENCY_TRACE_BUCKETS; ++b) {
+    seen += h->buckets[b];
+    if (seen >= rank && seen > 0) {
+      const uint32_t upper = (2u << b) - 1;
+      return upper < h->max_us ? upper : h->max_us;
+    }
+  }
+  return h->max_us;
+}
+
+const char* latency_trace_stage_name(latency_stage_t stage) {
+  return stage < LATENCY_NUM_HISTOGRAMS ? stage_names[stage] : "?";
+}
@@ -0,0 +1,69 @@
+/**
+ * @file latency_trace.h
+ * @brief Timestamped tracepoints along the path from a touch to the display, with per-stage latency histograms
+ * @details Plain C, so the uGFX drivers can mark stages too. The stages are in the order a tap on a button goes
+ * through them: the touch panel is sampled, uGFX dispatches the event, the GUI handles it and writes a frame to the
+ * PC, the PC answers, and the GUI redraws. Each stage records the time since the previous stage, if that was marked
+ * since the last time. The origin of the chain is carried along, so a redraw caused by a touch also records the
+ * whole touch-to-display latency.
+ */
+
+#pragma once
+#include <stdint.h>
+
+#if defined(TESTING) && defined(__cplusplus)
+void latency_trace_tests();
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LATENCY_TRACE_BUCKETS 24  ///< bucket i counts latencies in [2^i, 2^(i+1)) us, the last one is open
+
+/// @brief Tracepoints, in the order of the pipeline
+typedef enum {
+  LATENCY_TOUCH_SAMPLE,       ///< touch driver read a pressed panel
+  LATENCY_GEVENT_DISPATCH,    ///< uGFX passed an event to the GUI
+  LATENCY_HANDLE_EVENT,       ///< GUI task handled the event
+  LATENCY_FRAME_WRITTEN,      ///< CommAPI wrote a frame to the PC
+  LATENCY_RESPONSE_RECEIVED,  ///< CommAPI received a valid response
+  LATENCY_REDRAW_START,       ///< gui_redraw() started
+  LATENCY_REDRAW_END,         ///< gui_redraw() finished
+  LATENCY_TOTAL,              ///< not a tracepoint: touch sample to redraw end
+  LATENCY_NUM_HISTOGRAMS,
+} latency_stage_t;
+
+/// @brief Latencies of one stage
+typedef struct {
+  uint32_t count;
+  uint32_t min_us;
+  uint32_t max_us;
+  uint64_t sum_us;
+  uint32_t buckets[LATENCY_TRACE_BUCKETS];
+} latency_hist_t;
+
+/// @brief Set the time source and clear the histograms
+/// @param now_us free running microsecond counter, may wrap. Called in a critical section
+void latency_trace_init(uint32_t (*now_us)(void));
+
+/// @brief Clear the histograms and the pending marks
+void latency_trace_reset(void);
+
+/// @brief Mark that @p stage was reached now, does nothing before latency_trace_init()
+/// @details Not for ISRs
+void latency_trace_mark(latency_stage_t stage);
+
+/// @brief Copy the histogram of @p stage
+void latency_trace_get(latency_stage_t stage, latency_hist_t* out);
+
+/// @brief Upper bound of the @p pct-th percentile in @p h, in us
+/// @details Resolution is the bucket, the result is not more than the maximum
+uint32_t latency_hist_percentile(const latency_hist_t* h, unsigned pct);
+
+/// @brief Short name of @p stage
+const char* latency_trace_stage_name(latency_stage_t stage);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,124 @@
+#ifdef TESTING
+  #include "latency_trace.h"
+  #include "unity.h"
+  #include <cstring>
+  #include <initializer_list>
+
+static uint32_t fake_now = 0;
+static uint32_t fake_clock() {
+  return fake_now;
+}
+
+/// @brief Advance the clock by @p us and mark @p stage
+static void mark_after(uint32_t us, latency_stage_t stage) {
+  fake_now += us;
+  latency_trace_mark(stage);
+}
+
+static latency_hist_t get(latency_stage_t stage) {
+  latency_hist_t h;
+  latency_trace_get(stage, &h);
+  return h;
+}
+
+void test_tap_to_redraw() {
+  latency_trace_init(fake_clock);
+  mark_after(0, LATENCY_TOUCH_SAMPLE);
+  mark_after(100, LATENCY_GEVENT_DISPATCH);
+  mark_after(200, LATENCY_HANDLE_EVENT);
+  mark_after(300, LATENCY_FRAME_WRITTEN);   // set_volume
+  mark_after(1000, LATENCY_FRAME_WRITTEN);  // poll, carries the touch on
+  mark_after(400, LATENCY_RESPONSE_RECEIVED);
+  mark_after(500, LATENCY_REDRAW_START);
+  mark_after(600, LATENCY_REDRAW_END);
+
+  TEST_ASSERT_EQUAL(0, get(LATENCY_TOUCH_SAMPLE).count);
+  TEST_ASSERT_EQUAL(100, get(LATENCY_GEVENT_DISPATCH).max_us);
+  TEST_ASSERT_EQUAL(200, get(LATENCY_HANDLE_EVENT).max_us);
+  TEST_ASSERT_EQUAL(300, get(LATENCY_FRAME_WRITTEN).max_us);
+  TEST_ASSERT_EQUAL(1, get(LATENCY_FRAME_WRITTEN).count);
+  TEST_ASSERT_EQUAL(400, get(LATENCY_RESPONSE_RECEIVED).max_us);
+  TEST_ASSERT_EQUAL(500, get(LATENCY_REDRAW_START).max_us);
+  TEST_ASSERT_EQUAL(600, get(LATENCY_REDRAW_END).max_us);
+
+  const auto total = get(LATENCY_TOTAL);
+  TEST_ASSERT_EQUAL(1, total.count);
+  TEST_ASSERT_EQUAL(3100, total.max_us);
+}
+
+void test_change_from_pc() {
+  latency_trace_init(fake_clock);
+  mark_after(0, LATENCY_FRAME_WRITTEN);
+  mark_after(700, LATENCY_RESPONSE_RECEIVED);
+  mark_after(50, LATENCY_REDRAW_START);
+  mark_after(80, LATENCY_REDRAW_END);
+
+  TEST_ASSERT_EQUAL(0, get(LATENCY_FRAME_WRITTEN).count);
+  TEST_ASSERT_EQUAL(700, get(LATENCY_RESPONSE_RECEIVED).max_us);
+  TEST_ASSERT_EQUAL(80, get(LATENCY_REDRAW_END).max_us);
+  // no touch started it
+  TEST_ASSERT_EQUAL(0, get(LATENCY_TOTAL).count);
+}
+
+void test_unpaired() {
+  latency_trace_init(fake_clock);
+  // response without a frame, redraw end without a start
+  mark_after(10, LATENCY_RESPONSE_RECEIVED);
+  mark_after(10, LATENCY_RESPONSE_RECEIVED);
+  mark_after(10, LATENCY_REDRAW_END);
+  TEST_ASSERT_EQUAL(0, get(LATENCY_RESPONSE_RECEIVED).count);
+  TEST_ASSERT_EQUAL(0, get(LATENCY_REDRAW_END).count);
+
+  // a mark is consumed once
+  mark_after(10, LATENCY_REDRAW_START);
+  mark_after(10, LATENCY_REDRAW_END);
+  mark_after(10, LATENCY_REDRAW_END);
+  TEST_ASSERT_EQUAL(1, get(LATENCY_REDRAW_END).count);
+}
+
+void test_clock_wraps() {
+  latency_trace_init(fake_clock);
+  fake_now = UINT32_MAX - 5;
+  mark_after(0, LATENCY_TOUCH_SAMPLE);
+  mark_after(20, LATENCY_GEVENT_DISPATCH);
+  TEST_ASSERT_EQUAL(20, get(LATENCY_GEVENT_DISPATCH).max_us);
+}
+
+void test_histogram() {
+  latency_trace_init(fake_clock);
+  for (uint32_t us : { 1u, 3u, 100u, 100u, 100u, 100u, 100u, 100u, 100u, 5000u }) {
+    mark_after(0, LATENCY_REDRAW_START);
+    mark_after(us, LATENCY_REDRAW_END);
+  }
+  const auto h = get(LATENCY_REDRAW_END);
+  TEST_ASSERT_EQUAL(10, h.count);
+  TEST_ASSERT_EQUAL(1, h.min_us);
+  TEST_ASSERT_EQUAL(5000, h.max_us);
+  TEST_ASSERT_EQUAL(5704, h.sum_us);
+  TEST_ASSERT_EQUAL(1, h.buckets[0]);
+  TEST_ASSERT_EQUAL(1, h.buckets[1]);
+  TEST_ASSERT_EQUAL(7, h.buckets[6]);  // 64..127
+  TEST_ASSERT_EQUAL(1, h.buckets[12]);
+
+  TEST_ASSERT_EQUAL(127, latency_hist_percentile(&h, 50));
+  TEST_ASSERT_EQUAL(127, latency_hist_percentile(&h, 90));
+  TEST_ASSERT_EQUAL(5000, latency_hist_percentile(&h, 99));
+}
+
+void test_not_initialized() {
+  latency_trace_init(nullptr);
+  latency_trace_mark(LATENCY_REDRAW_START);
+  latency_trace_mark(LATENCY_REDRAW_END);
+  TEST_ASSERT_EQUAL(0, get(LATENCY_REDRAW_END).count);
+}
+
+void latency_trace_tests() {
+  RUN_TEST(test_tap_to_redraw);
+  RUN_TEST(test_change_from_pc);
+  RUN_TEST(test_unpaired);
+  RUN_TEST(test_clock_wraps);
+  RUN_TEST(test_histogram);
+  RUN_TEST(test_not_initialized);
+}
+
+#endif
@@ -0,0 +1,76 @@
+#include "metrics.h"
+#include <cstring>
+
+// the linker puts the entries together and marks where they are, both are null without any
+extern "C" {
+  extern const metrics::Entry __start_metrics[] __attribute__((weak));
+  extern const metrics::Entry __stop_metrics[] __attribute__((weak));
+}
+
+namespace metrics {
+  namespace {
+    uint32_t (*cycles_)() = nullptr;
+    uint32_t cycles_per_us_ = 1;
+
+    uint8_t* put(uint8_t* out, uint32_t value) {
+      memcpy(out, &value, sizeof(value));
+      return out + sizeof(value);
+    }
+  }  // namespace
+
+  size_t count() {
+    return __stop_metrics - __start_metrics;
+  }
+
+  const Entry& entry(size_t i) {
+    return __start_metrics[i];
+  }
+
+  size_t encode(size_t i, uint8_t* out) {
+    const Entry& e = entry(i);
+    uint8_t* p = out;
+    *p++ = e.type;
+    switch (e.type) {
+      case COUNTER:
+        p = put(p, e.counter->get());
+        break;
+      case GAUGE:
+        p = put(p, static_cast<uint32_t>(e.gauge->get()));
+        break;
+      case HISTOGRAM: {
+        // only the buckets used, most are empty
+        const Histogram& h = *e.histogram;
+        uint8_t* head = p;
+        p += 4 + 4 + 1;
+        uint32_t total = 0;
+        uint8_t used = 0;
+        for (unsigned b = 0; b < Histogram::BUCKETS; ++b) {
+          if (const uint32_t n = h.count(b)) {
+            *p++ = b;
+            p = put(p, n);
+            total += n;
+            ++used;
+          }
+        }
+        head = put(head, total);
+        head = put(head, h.max());
+        *head = used;
+        break;
+      }
+    }
+    return p - out;
+  }
+
+  void set_clock(uint32_t (*cycles)(), uint32_t cycles_per_us) {
+    cycles_per_us_ = cycles_per_us ? cycles_per_us : 1;
+    cycles_ = cycles;
+  }
+
+  uint32_t now() {
+    return cycles_ ? cycles_() : 0;
+  }
+
+  uint32_t elapsed_us(uint32_t start) {
+    return (now() - start) / cycles_per_us_;
+  }
+}  // namespace metrics
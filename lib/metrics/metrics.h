@@ -0,0 +1,185 @@
+/**
+ * @file metrics.h
+ * @brief Counters, gauges and latency histograms of the subsystems, sent to the PC as one snapshot
+ * @details A metric is a static object in the file, which updates it, and registers itself with its name at compile
+ * time:
+ *
+ *     METRICS_COUNTER(rx_bytes, "comm.rx_bytes");
+ *     METRICS_HISTOGRAM(frame_us, "gui.frame_us");
+ *     ...
+ *     rx_bytes.add(len);
+ *     metrics::ScopedTimer t(frame_us);
+ *
+ * The registry is the `metrics` section, an array of entries the linker puts together, so nothing is allocated and
+ * nothing runs at startup. Updates are single atomic operations, from tasks and ISRs, without locks or critical
+ * sections. The values are totals since boot, the PC takes the differences. CommAPI::send_metrics() sends all of them
+ * with the METRICS command, `pc_server -e` prints them.
+ *
+ * Histograms are log-linear: values below 4 have their own bucket, above each power of two is split into 4 buckets, so
+ * a bucket is at most 25 % wide. The last bucket is open, the maximum is kept besides.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef TESTING
+void metrics_tests();
+#endif
+
+namespace metrics {
+  enum Type : uint8_t { COUNTER = 1, GAUGE, HISTOGRAM };
+
+  /// @brief Only goes up, wraps at 2^32
+  class Counter {
+  public:
+    void add(uint32_t n = 1) {
+      value_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    uint32_t get() const {
+      return value_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<uint32_t> value_{ 0 };
+  };
+
+  /// @brief The current level of something, like free memory
+  class Gauge {
+  public:
+    void set(int32_t value) {
+      value_.store(value, std::memory_order_relaxed);
+    }
+
+    void add(int32_t n) {
+      value_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    int32_t get() const {
+      return value_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<int32_t> value_{ 0 };
+  };
+
+  /// @brief Distribution of values, usually microseconds
+  class Histogram {
+  public:
+    static inline constexpr unsigned SUB_BITS = 2;  ///< 4 buckets for each power of two
+    static inline constexpr unsigned BUCKETS = 72;  ///< up to 458752, the last one is open
+
+    /// @brief Bucket of @p value
+    static constexpr unsigned bucket(uint32_t value) {
+      if (value < (1u << SUB_BITS)) {
+        return value;
+      }
+      const unsigned msb = 31 - __builtin_clz(value);
+      const unsigned b = ((msb - SUB_BITS + 1) << SUB_BITS) + ((value >> (msb - SUB_BITS)) & ((1u << SUB_BITS) - 1));
+      return b < BUCKETS ? b : BUCKETS - 1;
+    }
+
+    /// @brief Smallest value in @p bucket
+    static constexpr uint32_t lower(unsigned bucket) {
+      if (bucket < (1u << SUB_BITS)) {
+        return bucket;
+      }
+      const unsigned msb = (bucket >> SUB_BITS) + SUB_BITS - 1;
+      return ((1u << SUB_BITS) + (bucket & ((1u << SUB_BITS) - 1))) << (msb - SUB_BITS);
+    }
+
+    void record(uint32_t value) {
+      buckets_[bucket(value)].fetch_add(1, std::memory_order_relaxed);
+      uint32_t max = max_.load(std::memory_order_relaxed);
+      while (value > max && not max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+      }
+    }
+
+    uint32_t count(unsigned bucket) const {
+      return buckets_[bucket].load(std::memory_order_relaxed);
+    }
+
+    uint32_t max() const {
+      return max_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<uint32_t> buckets_[BUCKETS]{};
+    std::atomic<uint32_t> max_{ 0 };
+  };
+
+  static_assert(std::atomic<uint32_t>::is_always_lock_free, "metrics are updated from ISRs");
+
+  /// @brief A metric in the registry
+  struct Entry {
+    constexpr Entry(const char* name, Counter* c) : name(name), type(COUNTER), counter(c) {
+    }
+    constexpr Entry(const char* name, Gauge* g) : name(name), type(GAUGE), gauge(g) {
+    }
+    constexpr Entry(const char* name, Histogram* h) : name(name), type(HISTOGRAM), histogram(h) {
+    }
+
+    const char* name;
+    Type type;
+    union {
+      Counter* counter;
+      Gauge* gauge;
+      Histogram* histogram;
+    };
+  };
+
+  /// @brief Metrics in the registry, in the order the linker put them
+  size_t count();
+  const Entry& entry(size_t i);
+
+  /// @brief The most bytes encode() writes
+  static inline constexpr size_t MAX_ENCODED = 1 + 4 + 4 + 1 + Histogram::BUCKETS * 5;
+
+  /// @brief Write the type and the value of entry @p i
+  /// @details Counter: u32. Gauge: i32. Histogram: the count (u32), the maximum (u32), the buckets used (u8), then
+  /// bucket (u8) and count (u32) of each
+  /// @return bytes written
+  size_t encode(size_t i, uint8_t* out);
+
+  /// @brief Set the clock of the timers
+  /// @param cycles free running counter, may wrap. Called from any task
+  /// @param cycles_per_us of @p cycles
+  void set_clock(uint32_t (*cycles)(), uint32_t cycles_per_us);
+
+  /// @brief The clock, 0 without one
+  uint32_t now();
+
+  /// @brief Microseconds since @p start, a time of now()
+  uint32_t elapsed_us(uint32_t start);
+
+  /// @brief Records the time of its scope into a histogram
+  class ScopedTimer {
+  public:
+    explicit ScopedTimer(Histogram& h) : h_(h), start_(now()) {
+    }
+
+    ~ScopedTimer() {
+      h_.record(elapsed_us(start_));
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+  private:
+    Histogram& h_;
+    const uint32_t start_;
+  };
+}  // namespace metrics
+
+/// @brief Define a metric @p var, and register it as @p name
+/// @details The alignment is given, the compiler would align larger objects more, with gaps in the array
+#define METRICS_DEFINE_(type, var, name)                                                                      \
+  static type var;                                                                                            \
+  __attribute__((section("metrics"), used, aligned(alignof(::metrics::Entry)))) static const ::metrics::Entry \
+      var##_entry_{ name, &var }
+
+#define METRICS_COUNTER(var, name) METRICS_DEFINE_(::metrics::Counter, var, name)
+#define METRICS_GAUGE(var, name) METRICS_DEFINE_(::metrics::Gauge, var, name)
+#define METRICS_HISTOGRAM(var, name) METRICS_DEFINE_(::metrics::Histogram, var, name)
@@ -0,0 +1,135 @@
+#ifdef TESTING
+  #include "metrics.h"
+  #include "unity.h"
+  #include <cstring>
+  #ifdef NATIVE
+    #include <pthread.h>
+  #endif
+
+METRICS_COUNTER(test_counter, "test.counter");
+METRICS_GAUGE(test_gauge, "test.gauge");
+METRICS_HISTOGRAM(test_histogram, "test.histogram");
+
+/// @brief Index of @p name in the registry, -1 if it isn't there
+static int find(const char* name) {
+  for (size_t i = 0; i < metrics::count(); ++i) {
+    if (0 == strcmp(metrics::entry(i).name, name)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+template <typename T>
+static T at(const uint8_t* p) {
+  T value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+void test_metrics_buckets() {
+  using H = metrics::Histogram;
+  TEST_ASSERT_EQUAL(0, H::bucket(0));
+  TEST_ASSERT_EQUAL(3, H::bucket(3));
+  TEST_ASSERT_EQUAL(H::BUCKETS - 1, H::bucket(UINT32_MAX));
+  // each value is in its bucket, which is at most a quarter of its lower bound wide
+  for (uint32_t v = 0; v < H::lower(H::BUCKETS - 1); v += 1 + v / 64) {
+    const unsigned b = H::bucket(v);
+    TEST_ASSERT_TRUE(H::lower(b) <= v);
+    TEST_ASSERT_TRUE(v < H::lower(b + 1));
+    if (v >= 4) {
+      TEST_ASSERT_TRUE(H::lower(b + 1) - H::lower(b) <= H::lower(b) / 4);
+    }
+  }
+}
+
+void test_metrics_registry() {
+  const int counter = find("test.counter");
+  const int gauge = find("test.gauge");
+  const int histogram = find("test.histogram");
+  TEST_ASSERT_TRUE(counter >= 0 && gauge >= 0 && histogram >= 0);
+  TEST_ASSERT_EQUAL(metrics::COUNTER, metrics::entry(counter).type);
+  TEST_ASSERT_TRUE(&test_counter == metrics::entry(counter).counter);
+  TEST_ASSERT_EQUAL(metrics::GAUGE, metrics::entry(gauge).type);
+  TEST_ASSERT_EQUAL(metrics::HISTOGRAM, metrics::entry(histogram).type);
+
+  uint8_t out[metrics::MAX_ENCODED];
+  const uint32_t before = test_counter.get();
+  test_counter.add(3);
+  TEST_ASSERT_EQUAL(5, metrics::encode(counter, out));
+  TEST_ASSERT_EQUAL(metrics::COUNTER, out[0]);
+  TEST_ASSERT_EQUAL(before + 3, at<uint32_t>(out + 1));
+
+  test_gauge.set(-5);
+  test_gauge.add(2);
+  TEST_ASSERT_EQUAL(5, metrics::encode(gauge, out));
+  TEST_ASSERT_EQUAL(-3, at<int32_t>(out + 1));
+
+  // only the buckets used
+  test_histogram.record(1);
+  test_histogram.record(100);
+  test_histogram.record(100);
+  TEST_ASSERT_EQUAL(1 + 4 + 4 + 1 + 2 * 5, metrics::encode(histogram, out));
+  TEST_ASSERT_EQUAL(3, at<uint32_t>(out + 1));
+  TEST_ASSERT_EQUAL(100, at<uint32_t>(out + 5));
+  TEST_ASSERT_EQUAL(2, out[9]);
+  TEST_ASSERT_EQUAL(1, out[10]);
+  TEST_ASSERT_EQUAL(1, at<uint32_t>(out + 11));
+  TEST_ASSERT_EQUAL(metrics::Histogram::bucket(100), out[15]);
+  TEST_ASSERT_EQUAL(2, at<uint32_t>(out + 16));
+}
+
+static uint32_t fake_cycles = 0;
+
+void test_metrics_timer() {
+  metrics::Histogram h;
+  metrics::set_clock([] { return fake_cycles; }, 10);
+  fake_cycles = UINT32_MAX - 100;
+  {
+    metrics::ScopedTimer t(h);
+    fake_cycles += 1000;  // wraps
+  }
+  metrics::set_clock(nullptr, 1);
+  TEST_ASSERT_EQUAL(100, h.max());
+  TEST_ASSERT_EQUAL(1, h.count(metrics::Histogram::bucket(100)));
+  TEST_ASSERT_EQUAL(0, metrics::now());
+}
+
+  #ifdef NATIVE
+static constexpr uint32_t N_ADDS = 200000;
+
+/// @brief A thread of the host, it runs in parallel to the tasks, like an ISR
+static void* isr(void*) {
+  for (uint32_t i = 0; i < N_ADDS; ++i) {
+    test_counter.add();
+    test_histogram.record(i);
+  }
+  return nullptr;
+}
+
+void test_metrics_concurrent() {
+  const uint32_t counter = test_counter.get();
+  const uint32_t last = test_histogram.count(metrics::Histogram::BUCKETS - 1);
+  pthread_t thread;
+  pthread_create(&thread, nullptr, isr, nullptr);
+  for (uint32_t i = 0; i < N_ADDS; ++i) {
+    test_counter.add();
+    test_histogram.record(UINT32_MAX);
+  }
+  pthread_join(thread, nullptr);
+  TEST_ASSERT_EQUAL(counter + 2 * N_ADDS, test_counter.get());
+  TEST_ASSERT_EQUAL(last + N_ADDS, test_histogram.count(metrics::Histogram::BUCKETS - 1));
+  TEST_ASSERT_EQUAL(UINT32_MAX, test_histogram.max());
+}
+  #endif
+
+void metrics_tests() {
+  RUN_TEST(test_metrics_buckets);
+  RUN_TEST(test_metrics_registry);
+  RUN_TEST(test_metrics_timer);
+  #ifdef NATIVE
+  RUN_TEST(test_metrics_concurrent);
+  #endif
+}
+
+#endif
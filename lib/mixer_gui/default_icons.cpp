@@ -0,0 +1,49 @@
+#include "default_icons.h"
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+static char lower(char c) {
+  return static_cast<char>(tolower(static_cast<unsigned char>(c)));
+}
+
+uint32_t default_icons::key(const char* name) {
+  static constexpr char suffix[] = ".exe";
+  static constexpr size_t suffix_len = sizeof(suffix) - 1;
+  size_t len = strlen(name);
+  if (len >= suffix_len) {
+    bool exe = true;
+    for (size_t i = 0; i < suffix_len; ++i) {
+      exe = exe && lower(name[len - suffix_len + i]) == suffix[i];
+    }
+    len -= exe ? suffix_len : 0;
+  }
+
+  uint32_t hash = 0x811C9DC5;
+  for (size_t i = 0; i < len; ++i) {
+    hash ^= static_cast<uint8_t>(lower(name[i]));
+    hash *= 0x01000193;
+  }
+  return hash;
+}
+
+bool default_icons::draw(GDisplay* dst, gColor bg, const mixer::ProgramVolume& vol) {
+  gdispGClear(dst, bg);
+
+  char fname[16];
+  snprintf(fname, sizeof(fname), "%08lx.rle", static_cast<unsigned long>(key(vol.pid_ == -1 ? "master" : vol.name_)));
+
+  gdispImage img{};  // closing it is safe, even if there is no file
+  gdispImageInit(&img);
+  bool drawn = false;
+  if (GDISP_IMAGE_ERR_OK == gdispImageOpenFile(&img, fname)) {
+    gdispImageSetBgColor(&img, bg);
+    drawn = GDISP_IMAGE_ERR_OK == gdispGImageDraw(dst, &img, 0, 0, gdispGGetWidth(dst), gdispGGetHeight(dst), 0, 0);
+  }
+  gdispImageClose(&img);
+
+  if (not drawn) {
+    gdispGClear(dst, bg);
+  }
+  return drawn;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "comm_api.h"
+#include "gfx.h"
+#include <cstdint>
+
+#ifdef TESTING
+void default_icons_tests();
+#endif
+
+/// @brief Icons of common programs, stored in the ROMFS
+/// @details scripts/romfs_icons.py packs the icons listed in icons/icons.txt before each build. Sessions with one are
+/// drawn right away, the others are downloaded from the PC.
+namespace default_icons {
+  /// @brief FNV-1a hash of the lowercase @p name, without a ".exe" suffix
+  /// @details The ROMFS file of a program is "<key as 8 hex digits>.rle", so the names aren't stored
+  uint32_t key(const char* name);
+
+  /// @brief Draw the default icon of the session onto @p dst
+  /// @details The master volume (pid -1) uses the "master" icon
+  /// @param dst the icon is drawn at 0,0, it's cleared to @p bg first
+  /// @param bg background, shows through transparent pixels
+  /// @return false if there is no icon for the session, @p dst is left cleared then
+  bool draw(GDisplay* dst, gColor bg, const mixer::ProgramVolume& vol);
+}  // namespace default_icons
@@ -0,0 +1,47 @@
+#ifdef TESTING
+  #include "default_icons.h"
+  #include "unity.h"
+
+static constexpr gCoord ICON_SZ = 32;
+
+void test_key() {
+  // same as scripts/romfs_icons.py
+  TEST_ASSERT_EQUAL_HEX32(0x811C9DC5, default_icons::key(""));
+  TEST_ASSERT_EQUAL_HEX32(0xCA8DBF33, default_icons::key("master"));
+  TEST_ASSERT_EQUAL_HEX32(0x77D3AEB5, default_icons::key("spotify"));
+
+  // case and the .exe suffix don't matter
+  TEST_ASSERT_EQUAL_HEX32(0x77D3AEB5, default_icons::key("Spotify.exe"));
+  TEST_ASSERT_EQUAL_HEX32(0x77D3AEB5, default_icons::key("SPOTIFY.EXE"));
+  TEST_ASSERT_NOT_EQUAL(0x77D3AEB5, default_icons::key("spotify.ex"));
+  TEST_ASSERT_EQUAL_HEX32(0x811C9DC5, default_icons::key(".exe"));
+}
+
+void test_draw() {
+  GDisplay* icon = gdispPixmapCreate(ICON_SZ, ICON_SZ);
+  TEST_ASSERT_NOT_NULL(icon);
+  const gPixel* bits = gdispPixmapGetBits(icon);
+
+  // master has no name
+  TEST_ASSERT_TRUE(default_icons::draw(icon, GFX_BLACK, mixer::ProgramVolume(-1, 50)));
+  TEST_ASSERT_NOT_EQUAL(GFX_BLACK, bits[ICON_SZ / 2 * ICON_SZ + ICON_SZ / 2]);
+  // transparent corners show the background
+  TEST_ASSERT_EQUAL(GFX_BLACK, bits[0]);
+
+  TEST_ASSERT_TRUE(default_icons::draw(icon, GFX_BLACK, mixer::ProgramVolume(1234, 50, "Discord.exe")));
+
+  // unknown programs are left to the PC
+  TEST_ASSERT_FALSE(default_icons::draw(icon, GFX_BLUE, mixer::ProgramVolume(1234, 50, "unknown.exe")));
+  for (gCoord i = 0; i < ICON_SZ * ICON_SZ; ++i) {
+    TEST_ASSERT_EQUAL(GFX_BLUE, bits[i]);
+  }
+
+  gdispPixmapDelete(icon);
+}
+
+void default_icons_tests() {
+  RUN_TEST(test_key);
+  RUN_TEST(test_draw);
+}
+
+#endif
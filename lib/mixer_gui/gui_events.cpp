@@ -0,0 +1,62 @@
+#include "gui_events.h"
+#include "passert.h"
+#include "latency_trace.h"
+#include "rtos_trace.h"
+
+
+void GuiEventQueue::init() {
+  ui_ = xQueueCreate(UI_DEPTH, sizeof(GuiMessage));
+  serial_ = xQueueCreate(SERIAL_DEPTH, sizeof(GuiMessage));
+  pending_ = xSemaphoreCreateCounting(UI_DEPTH + SERIAL_DEPTH, 0);
+  passert(ui_ && serial_ && pending_);
+  rtos_trace_name_object(ui_, "GUI touch");
+  rtos_trace_name_object(serial_, "GUI serial");
+  rtos_trace_name_object(pending_, "GUI pending");
+}
+
+bool GuiEventQueue::post(QueueHandle_t queue, const GuiMessage& msg) {
+  if (pdTRUE != xQueueSend(queue, &msg, 0)) {
+    return false;
+  }
+  xSemaphoreGive(pending_);
+  return true;
+}
+
+bool GuiEventQueue::post_ui(const GEvent& ev) {
+  GuiMessage msg;
+  msg.event = UI_INPUT;
+  msg.posted = xTaskGetTickCount();
+  msg.ui = ev;
+  return post(ui_, msg);
+}
+
+bool GuiEventQueue::post_serial(gui_event event) {
+  GuiMessage msg;
+  msg.event = event;
+  msg.posted = xTaskGetTickCount();
+  return post(serial_, msg);
+}
+
+bool GuiEventQueue::post_icon(int16_t pid) {
+  GuiMessage msg;
+  msg.event = ICON;
+  msg.posted = xTaskGetTickCount();
+  msg.pid = pid;
+  return post(serial_, msg);
+}
+
+GuiMessage GuiEventQueue::wait(TickType_t timeout) {
+  GuiMessage msg;
+  if (pdTRUE != xSemaphoreTake(pending_, timeout)) {
+    return msg;
+  }
+  if (pdTRUE != xQueueReceive(ui_, &msg, 0)) {
+    xQueueReceive(serial_, &msg, 0);
+  }
+  return msg;
+}
+
+void GuiEventQueue::ugfx_callback(void* param, GEvent* pe) {
+  latency_trace_mark(LATENCY_GEVENT_DISPATCH);
+  static_cast<GuiEventQueue*>(param)->post_ui(*pe);
+}
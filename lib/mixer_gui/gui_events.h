@@ -0,0 +1,67 @@
+#pragma once
+#include "gfx.h"
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "semphr.h"
+
+#ifdef TESTING
+void gui_events_test();
+#endif
+
+/// @brief Events, which drive the GUI state machine
+enum gui_event : uint8_t {
+  NOEVENT,
+  UI_INPUT,
+  CHANGE,
+  SERIAL_ERROR,
+  SERIAL_TIMEOUT,
+  ICON,  ///< the link task loaded an icon
+  NUM_EVENTS,
+};
+
+/// @brief One entry of the GUI event queue
+struct GuiMessage {
+  gui_event event = NOEVENT;
+  TickType_t posted = 0;  ///< tick count when the message was posted
+  GEvent ui{};            ///< copy of the uGFX event, valid for UI_INPUT
+  int16_t pid = 0;        ///< session of the icon, valid for ICON
+};
+
+/// @brief Queue of the GUI task, fed by uGFX input and by the serial link
+/// @details UI input has priority: it is always handled before serial events, which are already waiting. Messages of
+/// the same priority are handled in order.
+class GuiEventQueue {
+public:
+  static inline constexpr UBaseType_t UI_DEPTH = 8;      ///< UI messages waiting at most
+  static inline constexpr UBaseType_t SERIAL_DEPTH = 4;  ///< serial messages waiting at most
+
+  /// @brief Create the queues, call before the scheduler starts
+  void init();
+
+  /// @brief Post uGFX input, doesn't block
+  /// @return false if the queue is full and the event is dropped
+  bool post_ui(const GEvent& ev);
+
+  /// @brief Post a serial link event, doesn't block
+  /// @return false if the queue is full and the event is dropped
+  bool post_serial(gui_event event);
+
+  /// @brief Post that the icon of session @p pid was loaded, doesn't block
+  /// @return false if the queue is full and the event is dropped
+  bool post_icon(int16_t pid);
+
+  /// @brief Wait for the next message
+  /// @param timeout in ticks
+  /// @return the message, or NOEVENT if @p timeout elapsed
+  GuiMessage wait(TickType_t timeout);
+
+  /// @brief Pass to geventRegisterCallback(), with the queue as @p param
+  static void ugfx_callback(void* param, GEvent* pe);
+
+private:
+  bool post(QueueHandle_t queue, const GuiMessage& msg);
+
+  QueueHandle_t ui_{};
+  QueueHandle_t serial_{};
+  SemaphoreHandle_t pending_{};  ///< counts the messages in both queues
+};
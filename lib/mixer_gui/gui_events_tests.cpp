@@ -0,0 +1,103 @@
+#ifdef TESTING
+  #include "gui_events.h"
+  #include "unity.h"
+
+static GuiEventQueue queue;
+
+static GEvent make_event(GEventType type) {
+  GEvent ev{};
+  ev.type = type;
+  return ev;
+}
+
+static void drain() {
+  while (queue.wait(0).event != NOEVENT) {
+  }
+}
+
+void test_timeout() {
+  drain();
+  const TickType_t start = xTaskGetTickCount();
+  TEST_ASSERT_EQUAL(NOEVENT, queue.wait(pdMS_TO_TICKS(10)).event);
+  TEST_ASSERT_GREATER_OR_EQUAL(pdMS_TO_TICKS(10), xTaskGetTickCount() - start);
+}
+
+void test_ui_first() {
+  drain();
+  TEST_ASSERT_TRUE(queue.post_serial(CHANGE));
+  TEST_ASSERT_TRUE(queue.post_ui(make_event(GEVENT_GWIN_BUTTON)));
+
+  const auto first = queue.wait(0);
+  TEST_ASSERT_EQUAL(UI_INPUT, first.event);
+  TEST_ASSERT_EQUAL(GEVENT_GWIN_BUTTON, first.ui.type);
+  TEST_ASSERT_EQUAL(CHANGE, queue.wait(0).event);
+  TEST_ASSERT_EQUAL(NOEVENT, queue.wait(0).event);
+}
+
+void test_ui_in_order() {
+  drain();
+  queue.post_ui(make_event(GEVENT_GWIN_BUTTON));
+  queue.post_ui(make_event(GEVENT_GWIN_SLIDER));
+  queue.post_ui(make_event(GEVENT_TOUCH));
+
+  TEST_ASSERT_EQUAL(GEVENT_GWIN_BUTTON, queue.wait(0).ui.type);
+  TEST_ASSERT_EQUAL(GEVENT_GWIN_SLIDER, queue.wait(0).ui.type);
+  TEST_ASSERT_EQUAL(GEVENT_TOUCH, queue.wait(0).ui.type);
+}
+
+void test_serial_in_order() {
+  drain();
+  queue.post_serial(SERIAL_ERROR);
+  queue.post_serial(CHANGE);
+
+  TEST_ASSERT_EQUAL(SERIAL_ERROR, queue.wait(0).event);
+  TEST_ASSERT_EQUAL(CHANGE, queue.wait(0).event);
+}
+
+void test_icon() {
+  drain();
+  queue.post_serial(CHANGE);
+  TEST_ASSERT_TRUE(queue.post_icon(1234));
+
+  TEST_ASSERT_EQUAL(CHANGE, queue.wait(0).event);
+  const auto msg = queue.wait(0);
+  TEST_ASSERT_EQUAL(ICON, msg.event);
+  TEST_ASSERT_EQUAL_INT16(1234, msg.pid);
+}
+
+void test_full() {
+  drain();
+  for (unsigned i = 0; i < GuiEventQueue::SERIAL_DEPTH; ++i) {
+    TEST_ASSERT_TRUE(queue.post_serial(CHANGE));
+  }
+  TEST_ASSERT_FALSE(queue.post_serial(CHANGE));
+
+  // a full serial queue doesn't block input
+  TEST_ASSERT_TRUE(queue.post_ui(make_event(GEVENT_GWIN_BUTTON)));
+  TEST_ASSERT_EQUAL(UI_INPUT, queue.wait(0).event);
+  drain();
+}
+
+void test_ugfx_callback() {
+  drain();
+  GEvent ev = make_event(GEVENT_GWIN_SLIDER);
+  GuiEventQueue::ugfx_callback(&queue, &ev);
+
+  const auto msg = queue.wait(0);
+  TEST_ASSERT_EQUAL(UI_INPUT, msg.event);
+  TEST_ASSERT_EQUAL(GEVENT_GWIN_SLIDER, msg.ui.type);
+  TEST_ASSERT_LESS_OR_EQUAL(xTaskGetTickCount(), msg.posted);
+}
+
+void gui_events_test() {
+  queue.init();
+  RUN_TEST(test_timeout);
+  RUN_TEST(test_ui_first);
+  RUN_TEST(test_ui_in_order);
+  RUN_TEST(test_serial_in_order);
+  RUN_TEST(test_icon);
+  RUN_TEST(test_full);
+  RUN_TEST(test_ugfx_callback);
+}
+
+#endif
@@ -0,0 +1,87 @@
+#include "icon_loader.h"
+#include "icon_stream.h"
+#include "default_icons.h"
+
+namespace {
+  uint8_t unanswered_info = 0;  ///< IMAGE_INFO requests in a row, which the PC ignored, but it sent the image
+
+  /// @brief Decode a cached icon
+  int next_cached(void* param, const gU8** data) {
+    return static_cast<IconCache::Reader*>(param)->next(*data);
+  }
+
+  /// @brief Hands the chunks from the PC to the decoder, and to the cache
+  struct Download {
+    CommAPI::ImageStream& img;
+    IconCache::Writer* writer;
+  };
+
+  int next_downloaded(void* param, const gU8** data) {
+    auto& dl = *static_cast<Download*>(param);
+    const size_t len = dl.img.next(*data);
+    if (len && dl.writer) {
+      dl.writer->write(*data, len);
+    }
+    return len;
+  }
+
+  bool from_cache(IconCache& cache, uint32_t hash, GDisplay* dst) {
+    IconCache::Reader r = cache.open(hash);
+    if (not r.found()) {
+      return false;
+    }
+    const bool drawn = icon_stream::draw(dst, gwinGetDefaultBgColor(), next_cached, &r);
+
+    // a bit flip after the last pixel still counts
+    const uint8_t* rest = nullptr;
+    while (r.next(rest)) {
+    }
+    return drawn && r.intact();
+  }
+
+  bool download(IconCache::Writer* writer, const mixer::ProgramVolume& vol, GDisplay* dst) {
+    CommAPI::ImageStream img = CommAPI::get_instance().open_image(vol.pid_);
+    if (img.failed()) {
+      return false;
+    }
+    Download dl{ img, writer };
+    const bool drawn = icon_stream::draw(dst, gwinGetDefaultBgColor(), next_downloaded, &dl);
+
+    // the decoder stops at the last pixel, receive the rest so the PC sees a complete transfer
+    const uint8_t* rest = nullptr;
+    while (next_downloaded(&dl, &rest)) {
+    }
+    if (drawn && img.complete() && writer) {
+      writer->commit();
+    }
+    return drawn && img.complete();
+  }
+}  // namespace
+
+bool icon_loader::load(IconCache* cache, const mixer::ProgramVolume& vol, GDisplay* dst) {
+  if (default_icons::draw(dst, gwinGetDefaultBgColor(), vol)) {
+    return true;
+  }
+  if (not cache || unanswered_info >= INFO_TRIES) {
+    return download(nullptr, vol, dst);
+  }
+
+  CommAPI::ImageInfo info;
+  const CommAPI::ret_t ret = CommAPI::get_instance().image_info(vol.pid_, info);
+  if (CommAPI::ret_t::OK != ret) {
+    // an older PC ignores the command. After a few times it isn't asked again until a reboot, each time would wait
+    // for the timeout. A broken answer is asked again next time
+    const bool drawn = download(nullptr, vol, dst);
+    if (drawn) {
+      unanswered_info = CommAPI::ret_t::NO_ANSWER == ret ? unanswered_info + 1 : 0;
+    }
+    return drawn;
+  }
+  unanswered_info = 0;
+  if (from_cache(*cache, info.hash, dst)) {
+    return true;
+  }
+  // the space is made before the download, erasing a sector stalls the flash for a while
+  IconCache::Writer writer = cache->add(info.hash, info.size);
+  return download(writer.ok() ? &writer : nullptr, vol, dst);
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "comm_api.h"
+#include "icon_cache.h"
+#include "gfx.h"
+
+/// @brief Find the icon of a session, with as little as possible sent by the PC
+/// @details The default icon is drawn if there is one. Else the PC is asked for the hash of the icon, and a cached
+/// copy is decoded from flash. Only unknown icons are downloaded, and they are cached while they are decoded. A PC,
+/// which doesn't report the hash, sends every icon. It's only asked for the hash, until it ignored INFO_TRIES requests
+/// in a row.
+namespace icon_loader {
+  inline constexpr uint8_t INFO_TRIES = 3;  ///< ignored IMAGE_INFO requests, until the PC is taken for an older one
+
+  /// @brief Draw the icon of the session onto @p dst
+  /// @param cache may be null, then nothing is cached
+  /// @param dst the icon is drawn at 0,0, it's cleared to the background first
+  /// @return false if the icon couldn't be loaded, @p dst is left cleared then
+  bool load(IconCache* cache, const mixer::ProgramVolume& vol, GDisplay* dst);
+}  // namespace icon_loader
@@ -0,0 +1,32 @@
+#include "icon_stream.h"
+
+static gU8 head[icon_stream::HEAD_SZ];  ///< only the GUI task decodes icons
+
+bool icon_stream::draw(GDisplay* dst, gColor bg, next_t next, void* param, size_t* peak) {
+  gdispGClear(dst, bg);
+
+  GFileStream stream{};
+  stream.next = next;
+  stream.param = param;
+  stream.head = head;
+  stream.headsize = sizeof(head);
+
+  gdispImage img;
+  gdispImageInit(&img);
+  bool drawn = false;
+  if (GDISP_IMAGE_ERR_OK == gdispImageOpenGFile(&img, gfileOpenStream(&stream, "rb"))) {
+    gdispImageSetBgColor(&img, bg);
+    drawn = GDISP_IMAGE_ERR_OK == gdispGImageDraw(dst, &img, 0, 0, gdispGGetWidth(dst), gdispGGetHeight(dst), 0, 0);
+#if GDISP_NEED_IMAGE_ACCOUNTING
+    if (peak) {
+      *peak = img.maxmemused;
+    }
+#endif
+  }
+  gdispImageClose(&img);
+
+  if (not drawn) {
+    gdispGClear(dst, bg);
+  }
+  return drawn;
+}
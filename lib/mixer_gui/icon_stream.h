@@ -0,0 +1,23 @@
+#pragma once
+#include "gfx.h"
+#include <cstddef>
+
+/// @brief Decode icons while they are received
+/// @details The decoder pulls the file through a GFileStream, piece by piece, so the whole file is never in RAM. Only
+/// the head is kept, because decoders try the header to find the format, and some read it again to draw. PNG goes on
+/// from its image data, so chunks of any length may come before it.
+namespace icon_stream {
+  inline constexpr size_t HEAD_SZ = 256;  ///< must hold the headers, which are read again
+
+  /// @brief Get the next piece of the file, see GFileStream
+  using next_t = int (*)(void* param, const gU8** data);
+
+  /// @brief Decode the file from @p next onto @p dst
+  /// @param dst the icon is drawn at 0,0, it's cleared to @p bg first
+  /// @param bg background, shows through transparent pixels
+  /// @param next supplies the file
+  /// @param param passed to @p next
+  /// @param peak if not null, set to the most memory the decoder allocated, needs GDISP_NEED_IMAGE_ACCOUNTING
+  /// @return true if the whole icon was drawn. On failure @p dst is left cleared
+  bool draw(GDisplay* dst, gColor bg, next_t next, void* param, size_t* peak = nullptr);
+}  // namespace icon_stream
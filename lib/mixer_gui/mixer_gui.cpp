@@ -1,208 +1,148 @@
 #include "mixer_gui.h"
+#include "strip_renderer.h"
+#include "gui_events.h"
+#include "volume_line.h"
+#include "icon_loader.h"
+#include "default_icons.h"
+#include "session_pager.h"
 #include "comm_api.h"
 #include "gfx.h"
-#include "src/gwin/gwin_class.h"
+#include "passert.h"
+#include "latency_trace.h"
+#include "rtos_trace.h"
+#include "dlog.h"
+#include "metrics.h"
+#include <algorithm>
 #include <array>
+#include <cstdio>
 #include <optional>
+#include <type_traits>
 
-static constexpr uint32_t MAX_LINES = 5;
 static void gui_redraw();
 
 static CommAPI& api = CommAPI::get_instance();
 
 static gFont font;
 
-/// @brief Used to render one "line" on the GUI
-struct SetVolumeHelper {
-  using img_data_t = std::array<uint8_t, 5500>;
-  /// @brief Line is set at creation, and not changed after
-  /// @param line line of this instance
-  SetVolumeHelper(int line) : line_(line) {
-  }
-
-  /// @brief Create the widgets, hidden
-  void init() {
-    GWidgetInit wi;
-    gwinWidgetClearInit(&wi);
-    wi.g.show = gFalse;
-    wi.g.x = base_x;
-    wi.g.y = base_y + line_ * multiplier;
-    wi.g.height = 32;
-    wi.g.width = 32;
-
-    img_handle_ = gwinImageCreate(0, &wi.g);
-    // gwinSetBgColor(img_handle_, GFX_BLACK);
-
-    wi.g.x += multiplier;
-    wi.text = "M";
-    btn_mute_ = gwinButtonCreate(0, &wi);
+static StripRenderer strip;  ///< whole lines are composed off-screen, to avoid tearing
 
+static GuiEventQueue events;  ///< the only thing the GUI task waits on
 
-    wi.g.x += multiplier;
-    wi.text = "-";
-    btn_minus_ = gwinButtonCreate(0, &wi);
+METRICS_COUNTER(redraws, "gui.redraws");
+METRICS_HISTOGRAM(frame_us, "gui.frame_us");  ///< drawing the lines and the page bar, without loading them
 
+static constexpr UBaseType_t LINK_COMMANDS_DEPTH = 8;
+static QueueHandle_t link_commands;  ///< GUI never blocks on serial, it queues commands for the link task
 
-    wi.g.x += multiplier;
-    wi.g.width = gdispGetWidth() - base_x - 3 * multiplier - base_x - multiplier;
-    wi.text = "%";
-    slider_ = gwinSliderCreate(0, &wi);
-
-    wi.text = "+";
-    wi.g.width = 32;
-    wi.g.x = gdispGetWidth() - base_x - 32;
-    btn_plus_ = gwinButtonCreate(0, &wi);
-  }
-
-  /// @brief Render the line, if it's set
-  /// @details Only redraw parts, which have changed since last call
-  void render() {
-    if (not volume_) {
-      return;
-    }
-    auto curr = *volume_;  // needed for debug, pio doesnt work with optional :/
+/// @brief Queue a command for the link task, drop it if the queue is full
+static void post_command(const LinkCommand& cmd) {
+  xQueueSend(link_commands, &cmd, 0);
+}
 
-    if (volume_changed_) {
-      volume_changed_ = false;
-      show_widgets();
-      if (curr.muted_) {
-        snprintf(slider_txt_.data(), slider_txt_.size() - 1, "Mute (%d%%)", curr.volume_);
-      } else {
-        snprintf(slider_txt_.data(), slider_txt_.size() - 1, "%d%%", curr.volume_);
-      }
-      gwinSliderSetPosition(slider_, curr.volume_);
-      gwinSetText(slider_, slider_txt_.data(), gFalse);
-    }
+static uint32_t now_ms() {
+  return xTaskGetTickCount() * portTICK_PERIOD_MS;
+}
 
-    if (session_change_) {
-      if (0 != api.load_image(curr.pid_, img_data_.data(), img_data_.size())) {
-        return;
-      }
-      gwinClear(img_handle_);
-      if (gTrue != gwinImageOpenMemory(img_handle_, img_data_.data())) {
-        return;
-      }
-      // all success, dont redraw next time
-      session_change_ = false;
-    }
-  }
+static std::optional<IconCache> icon_cache;  ///< icons received before, kept across reboots, only the link task uses it
 
-  /// @brief Set the session of this line
-  void set_volume(const mixer::ProgramVolume& vol) {
-    if (volume_ && volume_->pid_ == vol.pid_) {
-      // picture haven't changed
-      // session_change_ = false;
-      volume_changed_ = volume_changed_ || (vol.volume_ != volume_->volume_) || (vol.muted_ != volume_->muted_);
-    } else {
-      session_change_ = true;
-      volume_changed_ = true;
-    }
-    volume_ = vol;
-  }
+static GDisplay* loaded_icon;         ///< the link task decodes an icon into it, the GUI copies it to the line
+static SemaphoreHandle_t icon_free;  ///< given while the GUI doesn't read loaded_icon
 
-  /// @brief Hide this line and remove session info
-  void reset() {
-    volume_ = std::nullopt;
-    hide_widgets();
+/// @brief Draw the default icon of the session, or ask the link task for it
+static bool request_icon(const mixer::ProgramVolume& vol, GDisplay* icon) {
+  if (default_icons::draw(icon, gwinGetDefaultBgColor(), vol)) {
+    return true;
   }
+  post_command({ LinkCommand::LOAD_ICON, vol.pid_, 0 });
+  return false;
+}
 
-  /// @brief Check if event belongs to this line and act accordingly
-  void handle_event(const GEvent* ev) {
-    if (not volume_) {
-      return;
-    }
+static volume_lines_t gui_objs = { SetVolumeHelper(0), SetVolumeHelper(1), SetVolumeHelper(2), SetVolumeHelper(3),
+                                   SetVolumeHelper(4) };
+static session_slots_t slots;  ///< line of each session
+
+// only the link task loads the sessions
+static SessionPager pager(MAX_LINES);  ///< the lines show one page of the sessions
+static bool pc_has_pages = true;       ///< cleared when the PC only sends all sessions at once
+static uint8_t unanswered_pages = 0;   ///< LOAD_PAGE requests in a row, which the PC ignored
+static constexpr uint8_t PAGE_TRIES = 3;  ///< ignored LOAD_PAGE requests, until the PC is taken for an older one
+
+/// @brief Sessions of a page, loaded by the link task for the GUI
+struct LoadedPage {
+  std::array<CommAPI::volume_t, CommAPI::MAX_SUPPORTED_PROGRAMS> volumes;
+  uint16_t page;
+  uint16_t pages;
+};
+static_assert(std::is_trivially_copyable_v<LoadedPage>, "copied through a queue");
+static QueueHandle_t loaded_page;  ///< one slot, it holds the newest page until the GUI draws it
 
-    if (ev->type == GEVENT_GWIN_BUTTON) {
-      const auto handle = ((GEventGWinButton*)ev)->gwin;
-      handle_button_event(handle);
-    }
+/// @brief Scrolls through the pages, below the lines. Hidden while there is only one page
+struct PageBar {
+  static constexpr gCoord Y = 206;
+  static constexpr gCoord HEIGHT = 30;
+  static constexpr gCoord BTN_WIDTH = 60;
 
-    if (ev->type == GEVENT_GWIN_SLIDER) {
-      handle_slider_event((GEventGWinSlider*)ev);
-    }
-  }
+  GHandle prev{};
+  GHandle next{};
+  uint16_t shown_page = 0;   ///< what the bar shows, it's only drawn when it changes
+  uint16_t shown_pages = 0;
 
-private:
-  void hide_widgets() {
-    gwinHide(img_handle_);
-    gwinHide(btn_mute_);
-    gwinHide(btn_minus_);
-    gwinHide(btn_plus_);
-    gwinHide(slider_);
-    gwinHide(img_handle_);
-  }
+  void init() {
+    GWidgetInit wi;
+    gwinWidgetClearInit(&wi);
+    wi.g.show = gFalse;
+    wi.g.y = Y;
+    wi.g.height = HEIGHT;
+    wi.g.width = BTN_WIDTH;
 
-  void show_widgets() {
-    gwinShow(img_handle_);
-    gwinShow(btn_mute_);
-    gwinShow(btn_minus_);
-    gwinShow(btn_plus_);
-    gwinShow(slider_);
-  }
+    wi.g.x = 10;
+    wi.text = "<";
+    prev = gwinButtonCreate(0, &wi);
 
-  void handle_button_event(const GHandle h) {
-    handle_mute_btn(h);
-    handle_plus_minus_btn(h);
+    wi.g.x = gdispGetWidth() - 10 - BTN_WIDTH;
+    wi.text = ">";
+    next = gwinButtonCreate(0, &wi);
   }
 
-  void handle_plus_minus_btn(const GHandle h) {
-    if (h != btn_minus_ && h != btn_plus_) {
+  /// @brief Show the page number, or hide the bar
+  void render(uint16_t page, uint16_t pages) {
+    if (shown_page == page && shown_pages == pages) {
       return;
     }
-
-    bool need_change = false;
-
-    int16_t vol = volume_->volume_;  // so no underflow when minus
-    // finer control for master volume
-    const int16_t increment = volume_->pid_ == -1 ? 2 : 10;
-    if (h == btn_minus_) {
-      need_change = true;
-      vol -= increment;
-    } else if (h == btn_plus_) {
-      need_change = true;
-      vol += increment;
-    }
-
-    if (need_change) {
-      api.set_volume(volume_->pid_, utils::constrain(vol, 0, 100));
+    shown_page = page;
+    shown_pages = pages;
+
+    const gCoord x = 10 + BTN_WIDTH;
+    const gCoord width = gdispGetWidth() - 2 * x;
+    if (pages < 2) {
+      gwinHide(prev);
+      gwinHide(next);
+      gdispFillArea(x, Y, width, HEIGHT, gwinGetDefaultBgColor());
+      return;
     }
+    gwinShow(prev);
+    gwinShow(next);
+    char txt[16];
+    snprintf(txt, sizeof(txt), "%u / %u", static_cast<unsigned>(shown_page + 1), static_cast<unsigned>(shown_pages));
+    gdispFillStringBox(x, Y, width, HEIGHT, txt, font, gwinGetDefaultStyle()->enabled.text, gwinGetDefaultBgColor(),
+                       gJustifyCenter);
   }
 
-  void handle_mute_btn(const GHandle h) {
-    if (h != btn_mute_) {
+  /// @brief Scroll, if the event is a press of a button of the bar. The page is shown once the link task loaded it
+  void handle_event(const GEvent* ev) {
+    if (ev->type != GEVENT_GWIN_BUTTON) {
       return;
     }
-    api.set_mute(volume_->pid_, not volume_->muted_);
-  }
-
-  void handle_slider_event(const GEventGWinSlider* ev) {
-    if (ev->gwin == slider_ && ev->action == GSLIDER_EVENT_SET) {
-      api.set_volume(volume_->pid_, utils::constrain(ev->position, 0, 100));
+    const auto handle = ((GEventGWinButton*)ev)->gwin;
+    if (handle == prev) {
+      post_command({ LinkCommand::PREV_PAGE, 0, 0 });
+    } else if (handle == next) {
+      post_command({ LinkCommand::NEXT_PAGE, 0, 0 });
     }
   }
-
-  GHandle img_handle_{};
-  GHandle btn_plus_{};
-  GHandle btn_minus_{};
-  GHandle btn_mute_{};
-  GHandle slider_{};
-  const int line_;
-  std::optional<mixer::ProgramVolume> volume_;
-  bool session_change_ = true;               ///< If true, picture will be redrawn
-  bool volume_changed_ = true;               ///< If true, slider is redrawn
-  std::array<char, 30> slider_txt_ = { 0 };  ///< holds the text on the slider
-
-  static constexpr unsigned base_x = 10;      ///< X of first widget
-  static constexpr unsigned base_y = 10;      ///< Y of first widget
-  static constexpr unsigned multiplier = 40;  ///< spacing of widgets
-
-  static img_data_t img_data_;  ///< Only one storage is enough, since we dont redraw frequently
 };
 
-SetVolumeHelper::img_data_t SetVolumeHelper::img_data_;
-
-std::array<SetVolumeHelper, MAX_LINES> gui_objs = { SetVolumeHelper(0), SetVolumeHelper(1), SetVolumeHelper(2),
-                                                    SetVolumeHelper(3), SetVolumeHelper(4) };
+static PageBar page_bar;
 
 
 
@@ -215,15 +155,6 @@ enum gui_state_t : uint8_t {
   NUM_STATES,
 };
 
-enum gui_event : uint8_t {
-  NOEVENT,
-  UI_INPUT,
-  CHANGE,
-  SERIAL_ERROR,
-  SERIAL_TIMEOUT,
-  NUM_EVENTS,
-};
-
 /// @brief 2D array of size NUM_STATES x NUM_EVENTS, where index [i][j] contains the state to go to from state \e i on
 /// event \e j
 using transition_map_t = std::array<std::array<gui_state_t, NUM_EVENTS>, NUM_STATES>;
@@ -263,54 +194,263 @@ static constexpr transition_map_t create_transitions() {
 static constexpr auto transitions = create_transitions();
 
 
+void mixer_gui_init(IFlash* icon_flash) {
+  if (icon_flash) {
+    icon_cache.emplace(*icon_flash);
+    icon_cache->mount();
+    // erasing stalls the CPU, here nothing is running yet
+    icon_cache->prepare();
+  }
+  events.init();
+  link_commands = xQueueCreate(LINK_COMMANDS_DEPTH, sizeof(LinkCommand));
+  loaded_page = xQueueCreate(1, sizeof(LoadedPage));
+  icon_free = xSemaphoreCreateBinary();
+  passert(link_commands && loaded_page && icon_free);
+  xSemaphoreGive(icon_free);
+  rtos_trace_name_object(link_commands, "link commands");
+  rtos_trace_name_object(loaded_page, "loaded page");
+  rtos_trace_name_object(icon_free, "icon free");
+}
+
+/// @brief Load the first sessions, the way an older PC sends them
+/// @details Only the sessions on the lines are loaded, there is just one page
+static bool load_all() {
+  if (CommAPI::ret_t::OK != api.load_volumes()) {
+    return false;
+  }
+  pager.set_total(std::min<uint16_t>(api.total_sessions(), MAX_LINES));
+  return true;
+}
+
+/// @brief Load the sessions of the current page
+/// @return true on success
+static bool load_page() {
+  if (not pc_has_pages) {
+    return load_all();
+  }
+  const CommAPI::ret_t ret = api.load_page(pager.offset(), MAX_LINES);
+  if (CommAPI::ret_t::OK != ret) {
+    if (CommAPI::ret_t::NO_ANSWER != ret) {
+      // a broken answer, it's loaded again later
+      return false;
+    }
+    // an older PC ignores the command. After a few times it isn't asked again until a reboot, each time would wait
+    // for the timeout
+    const bool loaded = load_all();
+    if (loaded && ++unanswered_pages >= PAGE_TRIES) {
+      pc_has_pages = false;
+    }
+    return loaded;
+  }
+  unanswered_pages = 0;
+  if (pager.set_total(api.total_sessions())) {
+    // the list shrank below the page
+    return CommAPI::ret_t::OK == api.load_page(pager.offset(), MAX_LINES);
+  }
+  return true;
+}
+
+/// @brief Load the sessions of the current page and hand them to the GUI
+/// @return true on success
+static bool post_page() {
+  if (not load_page()) {
+    return false;
+  }
+  const LoadedPage loaded{ api.get_volumes(), pager.page(), pager.pages() };
+  xQueueOverwrite(loaded_page, &loaded);
+  events.post_serial(gui_event::CHANGE);
+  return true;
+}
+
+/// @brief Poll the PC for changes, post failures to the GUI
+/// @param[out] changed set if the sessions changed
+/// @return true if the link works
+static bool poll_changes(bool& changed) {
+  switch (api.changes()) {
+    case 0:  // new changes in volumes
+      changed = true;
+      return true;
+    case 1:  // no new changes
+      return true;
+    case 2:  // comm failure
+      if (api.since_last_success() > (30 * 1000)) {
+        // 30 seconds elapsed since last successful message
+        events.post_serial(gui_event::SERIAL_TIMEOUT);
+      } else {
+        events.post_serial(gui_event::SERIAL_ERROR);
+      }
+      return false;
+    default:
+      return false;
+  }
+}
+
+/// @brief Load the icon of session @p pid into loaded_icon, and hand it to the GUI
+/// @details A cached icon is read from flash, others are decoded while the PC sends them. It waits until the GUI copied
+/// the one before.
+static void load_icon(int16_t pid) {
+  // the session may have left the page, while the command waited
+  const auto& volumes = api.get_volumes();
+  const auto vol = std::find_if(volumes.begin(), volumes.end(), [pid](const auto& v) { return v && v->pid_ == pid; });
+  if (vol == volumes.end()) {
+    return;
+  }
+  xSemaphoreTake(icon_free, portMAX_DELAY);
+  if (icon_loader::load(icon_cache ? &*icon_cache : nullptr, **vol, loaded_icon)) {
+    // the GUI drains its queue quickly, it doesn't block
+    for (int tries = 0; tries < 10; ++tries) {
+      if (events.post_icon(pid)) {
+        return;
+      }
+      vTaskDelay(pdMS_TO_TICKS(10));
+    }
+  }
+  // the line keeps a blank icon, until its session changes
+  xSemaphoreGive(icon_free);
+}
+
+/// @return true if the sessions must be loaded again
+static bool execute(const LinkCommand& cmd) {
+  switch (cmd.type) {
+    case LinkCommand::SET_VOLUME:
+      api.set_volume(cmd.pid, cmd.value);
+      return false;
+    case LinkCommand::SET_MUTE:
+      api.set_mute(cmd.pid, cmd.value);
+      return false;
+    case LinkCommand::PREV_PAGE:
+      return pager.prev();
+    case LinkCommand::NEXT_PAGE:
+      return pager.next();
+    case LinkCommand::LOAD_ICON:
+      load_icon(cmd.pid);
+      return false;
+  }
+  return false;
+}
+
+/// @brief Log the latency histograms for the PC console, one line each
+static void report_latencies() {
+  for (int stage = 0; stage < LATENCY_NUM_HISTOGRAMS; ++stage) {
+    latency_hist_t h;
+    latency_trace_get(static_cast<latency_stage_t>(stage), &h);
+    if (h.count) {
+      DLOG("LAT:%s:n=%u,p50=%u,p90=%u,p99=%u,max=%uus", latency_trace_stage_name(static_cast<latency_stage_t>(stage)),
+           static_cast<unsigned>(h.count), static_cast<unsigned>(latency_hist_percentile(&h, 50)),
+           static_cast<unsigned>(latency_hist_percentile(&h, 90)),
+           static_cast<unsigned>(latency_hist_percentile(&h, 99)), static_cast<unsigned>(h.max_us));
+    }
+  }
+}
+
+/// @brief Send the deferred log to the PC
+static void send_log() {
+  static uint8_t records[dlog::QUEUE_SZ];
+  uint32_t dropped;
+  const size_t n = dlog::read(records, sizeof(records), &dropped);
+  if (n or dropped) {
+    api.send_log(records, n, dropped);
+  }
+}
+
+void mixer_link_task(void*) {
+  vTaskDelay(pdMS_TO_TICKS(500));
+
+  constexpr TickType_t report_period = pdMS_TO_TICKS(10 * 1000);
+  TickType_t last_report = xTaskGetTickCount();
+
+  constexpr TickType_t poll_period = pdMS_TO_TICKS(100);  ///< a change waits for the poll, then for the page
+  constexpr TickType_t poll_period_error = pdMS_TO_TICKS(1000);  ///< don't flood a dead link
+  TickType_t period = poll_period;
+  TickType_t last_poll = xTaskGetTickCount() - period;
+  bool load = true;  ///< the sessions are loaded at start, after a change and on scrolling, until it succeeds
+
+  constexpr TickType_t idle_period = pdMS_TO_TICKS(5 * 1000);  ///< no commands for this long, nobody uses the GUI
+  TickType_t last_command = xTaskGetTickCount();
+
+  while (1) {
+    // commands from the GUI go first, but don't starve the polling
+    const TickType_t since_poll = xTaskGetTickCount() - last_poll;
+    const TickType_t timeout = since_poll < period ? period - since_poll : 0;
+
+    LinkCommand cmd;
+    if (pdTRUE == xQueueReceive(link_commands, &cmd, timeout)) {
+      last_command = xTaskGetTickCount();
+      if (execute(cmd)) {
+        load = true;
+      }
+    }
+
+    if (xTaskGetTickCount() - last_poll >= period) {
+      last_poll = xTaskGetTickCount();
+      period = poll_changes(load) ? poll_period : poll_period_error;
+    }
+
+    if (load) {
+      load = not post_page();
+    }
+
+    if (icon_cache && not load && xTaskGetTickCount() - last_command >= idle_period) {
+      // the next icon needs a spare sector, erasing it stalls the CPU for 1-2 s. After a failure, wait to try again
+      if (not icon_cache->prepare()) {
+        last_command = xTaskGetTickCount();
+      }
+    }
+
+    if (xTaskGetTickCount() - last_report >= report_period) {
+      last_report = xTaskGetTickCount();
+      report_latencies();
+    }
+
+    if (dlog::pending()) {
+      send_log();
+    }
+  }
+}
+
 void mixer_gui_task() {
   font = gdispOpenFont("DejaVuSans12*");
   gwinSetDefaultStyle(&BlackWidgetStyle, false);
   gwinSetDefaultFont(font);
+  strip.init(GDISP);
+  // before the lines ask for icons
+  loaded_icon = gdispPixmapCreate(SetVolumeHelper::ICON_SZ, SetVolumeHelper::ICON_SZ);
+  passert(loaded_icon);
 
 
+  // the callback copies input into the queue, so nothing is lost while the GUI is busy
   GListener gl;
   geventListenerInit(&gl);
   gwinAttachListener(&gl);
+  geventRegisterCallback(&gl, GuiEventQueue::ugfx_callback, &events);
 
   // create the widgets
+  SetVolumeHelper::hooks = { request_icon, post_command, now_ms, &strip };
   for (auto& helper : gui_objs) {
     helper.init();
   }
+  page_bar.init();
 
   gui_state_t state = gui_state_t::WAKEUP;
 
   while (1) {
-    // gather events
-    gui_event event = gui_event::NOEVENT;
+    // transient states move on right away, the others sleep until something happens
+    const bool transient = state == WAKEUP || state == DRAW || state == GOSLEEP;
+    const GuiMessage msg = events.wait(transient ? 0 : portMAX_DELAY);
 
-    // wait for user input, no timeout if drawing
-    const gDelay timeout = state == DRAW ? 0 : 1000;
-    GEvent* pe = geventEventWait(&gl, timeout);
-
-    if (pe) {
-      event = gui_event::UI_INPUT;
-      // if input, handle it in widgets
+    if (msg.event == gui_event::UI_INPUT) {
+      latency_trace_mark(LATENCY_HANDLE_EVENT);
       for (auto& obj : gui_objs) {
-        obj.handle_event(pe);
+        obj.handle_event(&msg.ui);
       }
+      page_bar.handle_event(&msg.ui);
     }
 
-    switch (api.changes()) {
-      case 0:  // new changes in volumes
-        event = gui_event::CHANGE;
-        break;
-      case 1:  // no new changes
-        break;
-      case 2:  // comm failure
-        event = gui_event::SERIAL_ERROR;
-        if (api.since_last_success() > (30 * 1000)) {
-          // 30 seconds elapsed since last successful message
-          event = gui_event::SERIAL_TIMEOUT;
-        }
-        break;
-      default:
-        break;
+    if (msg.event == gui_event::ICON) {
+      for (auto& obj : gui_objs) {
+        obj.set_icon(msg.pid, loaded_icon);
+      }
+      xSemaphoreGive(icon_free);
     }
 
     // do the state machine
@@ -332,7 +472,6 @@ void mixer_gui_task() {
         break;
 
       case gui_state_t::SLEEPING:
-        xTaskNotifyWait(0, UINT32_MAX, nullptr, pdMS_TO_TICKS(60 * 1000));
         break;
 
       case gui_state_t::NUM_STATES:
@@ -340,30 +479,21 @@ void mixer_gui_task() {
     }
 
     // transition
-    state = transitions[state][event];
+    state = transitions[state][msg.event];
   }
 }
 
 
 
 static void gui_redraw() {
-  // something is new, load the volumes
-  if (CommAPI::ret_t::OK != api.load_volumes() || (not api.get_volumes()[0])) {
-    return;
+  latency_trace_mark(LATENCY_REDRAW_START);
+  // the lines already show the input, only a newly loaded page is drawn
+  static LoadedPage loaded;
+  if (pdTRUE == xQueueReceive(loaded_page, &loaded, 0) && loaded.volumes[0]) {
+    metrics::ScopedTimer frame(frame_us);
+    show_volumes(gui_objs, slots, loaded.volumes);
+    page_bar.render(loaded.page, loaded.pages);
+    redraws.add();
   }
-
-  // draw the volumes one by one
-  unsigned line = 0;
-  for (const auto& vol : api.get_volumes()) {
-    if (vol) {
-      auto& curr = gui_objs[line];
-      ++line;
-      curr.set_volume(*vol);
-      curr.render();
-    }
-  }
-  // clear the rest of the lines
-  for (; line < gui_objs.size(); ++line) {
-    gui_objs[line].reset();
-  }
-}
\ No newline at end of file
+  latency_trace_mark(LATENCY_REDRAW_END);
+}
@@ -1,4 +1,16 @@
 #pragma once
+#include "IFlash.h"
+
+/// @brief Create the queues of the GUI, call before the scheduler starts
+/// @param icon_flash keeps the icons from the PC across reboots, see IconCache. May be null
+void mixer_gui_init(IFlash* icon_flash);
 
 /// @brief Main GUI task
 void mixer_gui_task();
+
+/// @brief Talks to the PC on behalf of the GUI
+/// @details Polls for changes and executes the commands of the GUI, results are posted to the GUI event queue. It
+/// loads the sessions of the current page at start, after a change and on scrolling, the GUI only draws them.
+/// After 5 seconds without commands, it erases a spare sector for the icon cache. Every 10 seconds it logs the latency
+/// histograms with DLOG, and it sends the queued log records to the PC.
+void mixer_link_task(void*);
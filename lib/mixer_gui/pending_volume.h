@@ -0,0 +1,76 @@
+#pragma once
+#include "comm_api.h"
+#include "utils.h"
+#include <cstdint>
+#include <optional>
+
+#ifdef TESTING
+void pending_volume_tests();
+#endif
+
+/// @brief Volume and mute the user asked for, which the PC hasn't confirmed yet
+/// @details The GUI shows the target right away. Values from the PC, which don't match it, are stale echoes from
+/// before the command was applied, and are ignored until the PC confirms the target or the target times out.
+class PendingVolume {
+public:
+  static inline constexpr uint32_t TIMEOUT = 1500;  ///< ms, after this the PC wins
+
+  /// @brief The user set the volume
+  /// @param now current time in ms
+  void set_volume(uint8_t volume, uint32_t now) {
+    volume_ = Target<uint8_t>{ volume, now + TIMEOUT };
+  }
+
+  /// @brief The user set the mute
+  /// @param now current time in ms
+  void set_muted(bool muted, uint32_t now) {
+    muted_ = Target<bool>{ muted, now + TIMEOUT };
+  }
+
+  /// @brief Forget the targets, e.g. when the line shows a different session
+  void clear() {
+    volume_ = std::nullopt;
+    muted_ = std::nullopt;
+  }
+
+  /// @brief Check if a target waits for confirmation
+  [[nodiscard]] bool pending() const {
+    return volume_ || muted_;
+  }
+
+  /// @brief Combine the value from the PC with the targets
+  /// @details A target, which the PC reports, is confirmed and forgotten.
+  /// @param pc the value reported by the PC
+  /// @param now current time in ms
+  /// @return the value to show
+  [[nodiscard]] mixer::ProgramVolume reconcile(const mixer::ProgramVolume& pc, uint32_t now) {
+    mixer::ProgramVolume shown = pc;
+    shown.volume_ = reconcile_one(volume_, pc.volume_, now);
+    shown.muted_ = reconcile_one(muted_, pc.muted_, now);
+    return shown;
+  }
+
+private:
+  template <class T>
+  struct Target {
+    T value;
+    uint32_t deadline;
+  };
+
+  template <class T>
+  static T reconcile_one(std::optional<Target<T>>& target, T pc, uint32_t now) {
+    if (not target) {
+      return pc;
+    }
+    if (target->value == pc || utils::elapsed(now, target->deadline)) {
+      // confirmed, or the PC didn't take it
+      target = std::nullopt;
+      return pc;
+    }
+    // stale echo
+    return target->value;
+  }
+
+  std::optional<Target<uint8_t>> volume_;
+  std::optional<Target<bool>> muted_;
+};
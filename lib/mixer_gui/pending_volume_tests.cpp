@@ -0,0 +1,99 @@
+#ifdef TESTING
+  #include "pending_volume.h"
+  #include "unity.h"
+
+static mixer::ProgramVolume from_pc(uint8_t volume, bool muted = false) {
+  mixer::ProgramVolume vol(123, volume);
+  vol.muted_ = muted;
+  return vol;
+}
+
+void test_nothing_pending() {
+  PendingVolume p;
+  TEST_ASSERT_FALSE(p.pending());
+  const auto shown = p.reconcile(from_pc(40, true), 0);
+  TEST_ASSERT_EQUAL(40, shown.volume_);
+  TEST_ASSERT_TRUE(shown.muted_);
+  TEST_ASSERT_EQUAL(123, shown.pid_);
+}
+
+void test_stale_echo() {
+  PendingVolume p;
+  p.set_volume(50, 1000);
+  TEST_ASSERT_TRUE(p.pending());
+
+  // PC hasn't applied it yet
+  TEST_ASSERT_EQUAL(50, p.reconcile(from_pc(40), 1020).volume_);
+  TEST_ASSERT_EQUAL(50, p.reconcile(from_pc(40), 1040).volume_);
+  TEST_ASSERT_TRUE(p.pending());
+
+  // confirmed
+  TEST_ASSERT_EQUAL(50, p.reconcile(from_pc(50), 1100).volume_);
+  TEST_ASSERT_FALSE(p.pending());
+
+  // later changes from the PC are shown
+  TEST_ASSERT_EQUAL(30, p.reconcile(from_pc(30), 1200).volume_);
+}
+
+void test_newer_target() {
+  PendingVolume p;
+  p.set_volume(50, 0);
+  p.set_volume(60, 10);
+  // the PC applied the first one
+  TEST_ASSERT_EQUAL(60, p.reconcile(from_pc(50), 100).volume_);
+  TEST_ASSERT_EQUAL(60, p.reconcile(from_pc(60), 200).volume_);
+  TEST_ASSERT_FALSE(p.pending());
+}
+
+void test_pc_ignores_target() {
+  PendingVolume p;
+  p.set_volume(50, 0);
+  TEST_ASSERT_EQUAL(50, p.reconcile(from_pc(40), PendingVolume::TIMEOUT - 1).volume_);
+  // the PC didn't take it
+  TEST_ASSERT_EQUAL(40, p.reconcile(from_pc(40), PendingVolume::TIMEOUT).volume_);
+  TEST_ASSERT_FALSE(p.pending());
+}
+
+void test_timeout_overflow() {
+  PendingVolume p;
+  p.set_volume(50, UINT32_MAX - 10);
+  TEST_ASSERT_EQUAL(50, p.reconcile(from_pc(40), 5).volume_);
+  TEST_ASSERT_EQUAL(40, p.reconcile(from_pc(40), PendingVolume::TIMEOUT).volume_);
+}
+
+void test_mute_separate() {
+  PendingVolume p;
+  p.set_volume(50, 0);
+  p.set_muted(true, 0);
+
+  // volume confirmed, mute not yet
+  auto shown = p.reconcile(from_pc(50, false), 100);
+  TEST_ASSERT_EQUAL(50, shown.volume_);
+  TEST_ASSERT_TRUE(shown.muted_);
+  TEST_ASSERT_TRUE(p.pending());
+
+  shown = p.reconcile(from_pc(50, true), 200);
+  TEST_ASSERT_TRUE(shown.muted_);
+  TEST_ASSERT_FALSE(p.pending());
+}
+
+void test_clear() {
+  PendingVolume p;
+  p.set_volume(50, 0);
+  p.set_muted(true, 0);
+  p.clear();
+  TEST_ASSERT_FALSE(p.pending());
+  TEST_ASSERT_EQUAL(40, p.reconcile(from_pc(40), 10).volume_);
+}
+
+void pending_volume_tests() {
+  RUN_TEST(test_nothing_pending);
+  RUN_TEST(test_stale_echo);
+  RUN_TEST(test_newer_target);
+  RUN_TEST(test_pc_ignores_target);
+  RUN_TEST(test_timeout_overflow);
+  RUN_TEST(test_mute_separate);
+  RUN_TEST(test_clear);
+}
+
+#endif
@@ -0,0 +1,74 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+
+#ifdef TESTING
+void session_pager_tests();
+#endif
+
+/// @brief Which page of the session list the lines show
+/// @details The PC may have more sessions than there are lines. Only the sessions of the current page are loaded, so
+/// the memory doesn't depend on their number. Scrolling moves by a whole page, the sessions of a page keep their order.
+class SessionPager {
+public:
+  /// @param page_size sessions on a page, one per line
+  explicit constexpr SessionPager(uint16_t page_size) : page_size_(page_size) {
+  }
+
+  /// @brief Index of the first session on the page
+  uint16_t offset() const {
+    return page_ * page_size_;
+  }
+
+  /// @brief Current page, from 0
+  uint16_t page() const {
+    return page_;
+  }
+
+  /// @brief Number of pages, at least 1
+  uint16_t pages() const {
+    return std::max(1, (total_ + page_size_ - 1) / page_size_);
+  }
+
+  /// @brief Set the number of sessions the PC has
+  /// @details If the list shrank below the page, the last page is shown
+  /// @return true if the page changed, and must be loaded again
+  bool set_total(uint16_t total) {
+    total_ = total;
+    return clamp();
+  }
+
+  /// @brief Go to the next page
+  /// @return false if this is the last one
+  bool next() {
+    if (page_ + 1 >= pages()) {
+      return false;
+    }
+    ++page_;
+    return true;
+  }
+
+  /// @brief Go to the previous page
+  /// @return false if this is the first one
+  bool prev() {
+    if (page_ == 0) {
+      return false;
+    }
+    --page_;
+    return true;
+  }
+
+private:
+  bool clamp() {
+    const uint16_t last = pages() - 1;
+    if (page_ <= last) {
+      return false;
+    }
+    page_ = last;
+    return true;
+  }
+
+  const uint16_t page_size_;
+  uint16_t total_ = 0;
+  uint16_t page_ = 0;
+};
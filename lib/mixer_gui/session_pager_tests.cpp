@@ -0,0 +1,67 @@
+#ifdef TESTING
+  #include "session_pager.h"
+  #include "unity.h"
+
+void test_single_page() {
+  SessionPager pager(5);
+  TEST_ASSERT_EQUAL(1, pager.pages());
+  TEST_ASSERT_FALSE(pager.set_total(3));
+  TEST_ASSERT_EQUAL(1, pager.pages());
+  TEST_ASSERT_FALSE(pager.next());
+  TEST_ASSERT_FALSE(pager.prev());
+  TEST_ASSERT_EQUAL(0, pager.offset());
+}
+
+void test_scroll_hundred() {
+  SessionPager pager(5);
+  pager.set_total(100);
+  TEST_ASSERT_EQUAL(20, pager.pages());
+
+  // every session is on one page
+  uint16_t seen = 5;
+  while (pager.next()) {
+    TEST_ASSERT_EQUAL(seen, pager.offset());
+    seen += 5;
+  }
+  TEST_ASSERT_EQUAL(100, seen);
+  TEST_ASSERT_EQUAL(19, pager.page());
+
+  while (pager.prev()) {
+  }
+  TEST_ASSERT_EQUAL(0, pager.offset());
+}
+
+void test_partial_last_page() {
+  SessionPager pager(5);
+  pager.set_total(101);
+  TEST_ASSERT_EQUAL(21, pager.pages());
+  while (pager.next()) {
+  }
+  TEST_ASSERT_EQUAL(100, pager.offset());
+}
+
+void test_list_shrinks() {
+  SessionPager pager(5);
+  pager.set_total(100);
+  for (int i = 0; i < 10; ++i) {
+    pager.next();
+  }
+  TEST_ASSERT_EQUAL(50, pager.offset());
+
+  // programs closed while the page was shown, it moves to the new last page
+  TEST_ASSERT_TRUE(pager.set_total(22));
+  TEST_ASSERT_EQUAL(20, pager.offset());
+  TEST_ASSERT_FALSE(pager.set_total(23));
+
+  TEST_ASSERT_TRUE(pager.set_total(0));
+  TEST_ASSERT_EQUAL(0, pager.offset());
+}
+
+void session_pager_tests() {
+  RUN_TEST(test_single_page);
+  RUN_TEST(test_scroll_hundred);
+  RUN_TEST(test_partial_last_page);
+  RUN_TEST(test_list_shrinks);
+}
+
+#endif
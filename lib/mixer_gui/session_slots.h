@@ -0,0 +1,83 @@
+#pragma once
+#include "comm_api.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#ifdef TESTING
+void session_slots_tests();
+#endif
+
+/// @brief Which session each line of the GUI shows, keyed by PID
+/// @details A session keeps its line as long as the PC reports it, wherever it is in the list. A line is freed when its
+/// session is gone, and a new session takes the first free line. So when a session disappears, the lines below it
+/// don't change, and their icons aren't loaded again.
+template <size_t N>
+class SessionSlots {
+public:
+  /// @brief Session of each slot, nullptr if the slot is free
+  using assignment_t = std::array<const mixer::ProgramVolume*, N>;
+
+  /// @brief Assign the sessions reported by the PC to slots
+  /// @param volumes sessions in the order of the PC, sessions without a free slot are left out
+  /// @return the sessions by slot, the pointers are into @p volumes
+  template <size_t M>
+  assignment_t assign(const std::array<CommAPI::volume_t, M>& volumes) {
+    assignment_t slots{};
+
+    // sessions, which already have a slot, keep it
+    for (const auto& vol : volumes) {
+      if (vol) {
+        if (const auto slot = find(vol->pid_); slot < N && not slots[slot]) {
+          slots[slot] = &*vol;
+        }
+      }
+    }
+    // the slots of the sessions, which are gone, are free
+    for (size_t slot = 0; slot < N; ++slot) {
+      if (not slots[slot]) {
+        pids_[slot] = std::nullopt;
+      }
+    }
+    // new sessions take the first free slot
+    size_t free = 0;
+    for (const auto& vol : volumes) {
+      if (not vol || find(vol->pid_) < N) {
+        continue;
+      }
+      while (free < N && pids_[free]) {
+        ++free;
+      }
+      if (free == N) {
+        break;
+      }
+      pids_[free] = vol->pid_;
+      slots[free] = &*vol;
+    }
+    return slots;
+  }
+
+  /// @brief PID in @p slot, nothing if it's free
+  std::optional<int16_t> pid(size_t slot) const {
+    return pids_[slot];
+  }
+
+  /// @brief Free every slot
+  void clear() {
+    pids_ = {};
+  }
+
+private:
+  /// @return slot of @p pid, or N
+  size_t find(int16_t pid) const {
+    for (size_t slot = 0; slot < N; ++slot) {
+      if (pids_[slot] == pid) {
+        return slot;
+      }
+    }
+    return N;
+  }
+
+  std::array<std::optional<int16_t>, N> pids_{};
+};
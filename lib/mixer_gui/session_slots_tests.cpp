@@ -0,0 +1,85 @@
+#ifdef TESTING
+  #include "session_slots.h"
+  #include "unity.h"
+
+using volumes_t = std::array<CommAPI::volume_t, 5>;
+
+/// @brief Sessions with these PIDs, in this order
+static volumes_t sessions(std::initializer_list<int16_t> pids) {
+  volumes_t volumes;
+  size_t i = 0;
+  for (const int16_t pid : pids) {
+    volumes[i++] = mixer::ProgramVolume(pid, 50);
+  }
+  return volumes;
+}
+
+/// @brief PIDs by slot, 0 for a free slot
+template <size_t N>
+static std::array<int16_t, N> pids(const typename SessionSlots<N>::assignment_t& slots) {
+  std::array<int16_t, N> out{};
+  for (size_t i = 0; i < N; ++i) {
+    out[i] = slots[i] ? slots[i]->pid_ : 0;
+  }
+  return out;
+}
+
+void test_first_assignment() {
+  SessionSlots<5> slots;
+  const auto volumes = sessions({ -1, 10, 20 });
+  const auto assigned = slots.assign(volumes);
+  const std::array<int16_t, 5> expected = { -1, 10, 20, 0, 0 };
+  TEST_ASSERT_TRUE(expected == pids<5>(assigned));
+  TEST_ASSERT_TRUE(&*volumes[1] == assigned[1]);
+  TEST_ASSERT_EQUAL(20, *slots.pid(2));
+  TEST_ASSERT_FALSE(slots.pid(3).has_value());
+}
+
+void test_removal_keeps_lines() {
+  SessionSlots<5> slots;
+  slots.assign(sessions({ -1, 10, 20, 30 }));
+
+  // 10 is gone, the sessions after it stay on their line
+  const std::array<int16_t, 5> expected = { -1, 0, 20, 30, 0 };
+  TEST_ASSERT_TRUE(expected == pids<5>(slots.assign(sessions({ -1, 20, 30 }))));
+}
+
+void test_new_takes_free_slot() {
+  SessionSlots<5> slots;
+  slots.assign(sessions({ -1, 10, 20, 30 }));
+  slots.assign(sessions({ -1, 20, 30 }));
+
+  const std::array<int16_t, 5> expected = { -1, 40, 20, 30, 50 };
+  TEST_ASSERT_TRUE(expected == pids<5>(slots.assign(sessions({ -1, 20, 30, 40, 50 }))));
+}
+
+void test_reorder() {
+  SessionSlots<5> slots;
+  slots.assign(sessions({ -1, 10, 20 }));
+
+  const std::array<int16_t, 5> expected = { -1, 10, 20, 0, 0 };
+  TEST_ASSERT_TRUE(expected == pids<5>(slots.assign(sessions({ 20, -1, 10 }))));
+}
+
+void test_more_sessions_than_slots() {
+  SessionSlots<3> slots;
+  slots.assign(sessions({ 1, 2, 3, 4 }));
+  TEST_ASSERT_EQUAL(3, *slots.pid(2));
+
+  // a slot is freed, the session, which didn't fit, gets it
+  const std::array<int16_t, 3> expected = { 1, 4, 3 };
+  TEST_ASSERT_TRUE(expected == pids<3>(slots.assign(sessions({ 1, 3, 4 }))));
+
+  slots.clear();
+  TEST_ASSERT_FALSE(slots.pid(0).has_value());
+}
+
+void session_slots_tests() {
+  RUN_TEST(test_first_assignment);
+  RUN_TEST(test_removal_keeps_lines);
+  RUN_TEST(test_new_takes_free_slot);
+  RUN_TEST(test_reorder);
+  RUN_TEST(test_more_sessions_than_slots);
+}
+
+#endif
@@ -0,0 +1,89 @@
+#include "strip_renderer.h"
+extern "C" {
+#include "src/gwin/gwin_class.h"  // the header has no C++ guard
+}
+
+/// @brief Any visible widget can be used to take the GWIN drawing lock
+static GHandle first_visible(const GHandle* widgets, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    if (widgets[i]->flags & GWIN_FLG_SYSVISIBLE) {
+      return widgets[i];
+    }
+  }
+  return nullptr;
+}
+
+bool StripRenderer::init(GDisplay* display) {
+  display_ = display;
+  pixmap_ = gdispPixmapCreate(gdispGGetWidth(display_), HEIGHT);
+  return pixmap_ != nullptr;
+}
+
+void StripRenderer::draw(gCoord y, const GHandle* widgets, size_t n) {
+  if (not pixmap_) {
+    return;
+  }
+
+  GHandle lock = first_visible(widgets, n);
+  if (not lock || not _gwinDrawStart(lock)) {
+    return;
+  }
+
+  const gCoord width = gdispGGetWidth(pixmap_);
+  gdispGFillArea(pixmap_, 0, 0, width, HEIGHT, gwinGetDefaultBgColor());
+
+  for (size_t i = 0; i < n; ++i) {
+    GHandle gh = widgets[i];
+    if (not(gh->flags & GWIN_FLG_SYSVISIBLE)) {
+      continue;
+    }
+    // move the widget into the pixmap for the time of drawing
+    GDisplay* const display = gh->display;
+    const gCoord wy = gh->y;
+    gh->display = pixmap_;
+    gh->y = wy - y;
+    gdispGSetClip(pixmap_, gh->x, gh->y, gh->width, gh->height);
+    gh->vmt->Redraw(gh);
+    gh->display = display;
+    gh->y = wy;
+
+    // it will be on the screen after the blit, no need for the window manager to draw it
+    gh->flags &= ~(GWIN_FLG_NEEDREDRAW | GWIN_FLG_BGREDRAW);
+  }
+  gdispGUnsetClip(pixmap_);
+
+  // one window write for the whole strip
+  gdispGUnsetClip(display_);
+  gdispGBlitArea(display_, 0, y, width, HEIGHT, 0, 0, width, gdispPixmapGetBits(pixmap_));
+
+  _gwinDrawEnd(lock);
+}
+
+void StripRenderer::hide(const GHandle* widgets, size_t n) {
+  // the lock keeps the redraw timer from drawing them, or changing their flags meanwhile
+  GHandle lock = first_visible(widgets, n);
+  if (not lock || not _gwinDrawStart(lock)) {
+    return;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    widgets[i]->flags &= ~(GWIN_FLG_VISIBLE | GWIN_FLG_SYSVISIBLE | GWIN_FLG_NEEDREDRAW | GWIN_FLG_BGREDRAW);
+  }
+  _gwinDrawEnd(lock);
+}
+
+void StripRenderer::show(gCoord y, const GHandle* widgets, size_t n) {
+  if (not pixmap_) {
+    for (size_t i = 0; i < n; ++i) {
+      gwinShow(widgets[i]);
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < n; ++i) {
+    GHandle gh = widgets[i];
+    // what gwinShow() does, without the redraw request
+    gh->flags = (gh->flags | GWIN_FLG_VISIBLE | GWIN_FLG_SYSVISIBLE) & ~(GWIN_FLG_NEEDREDRAW | GWIN_FLG_BGREDRAW);
+    _gwinFixFocus(gh);
+  }
+  draw(y, widgets, n);
+}
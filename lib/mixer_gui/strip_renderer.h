@@ -0,0 +1,41 @@
+#pragma once
+#include "gfx.h"
+#include <cstddef>
+
+/// @brief Draws a horizontal strip of the screen off-screen, then writes it to the display in one window
+/// @details Widgets are drawn one after the other into a pixmap, so the display never shows a half drawn strip.
+/// The whole screen doesn't fit into RAM, but one line of the GUI does.
+class StripRenderer {
+public:
+  static inline constexpr gCoord HEIGHT = 40;  ///< height of a strip in pixels
+
+  /// @brief Allocate the off-screen buffer
+  /// @param display the strips are written to this display
+  /// @return true on success. If it fails, draw() does nothing and the widgets are drawn by GWIN as usual
+  bool init(GDisplay* display);
+
+  /// @brief Redraw widgets through the off-screen buffer
+  /// @details Hidden widgets are skipped. Pending redraws of the drawn widgets are cancelled.
+  /// @param y top of the strip on the display
+  /// @param widgets the widgets to draw, they must lie inside the strip
+  /// @param n number of @p widgets
+  void draw(gCoord y, const GHandle* widgets, size_t n);
+
+  /// @brief Hide widgets from GWIN, without clearing them from the display
+  /// @details Until show(), changes to them don't draw anything. A line is set up this way, then shown in one blit.
+  /// @param widgets the widgets to hide
+  /// @param n number of @p widgets
+  void hide(const GHandle* widgets, size_t n);
+
+  /// @brief Make widgets visible and draw them through the off-screen buffer
+  /// @details Unlike gwinShow(), GWIN isn't asked to redraw them, so it can't draw them on the display first.
+  /// Without the buffer the widgets are shown by GWIN.
+  /// @param y top of the strip on the display
+  /// @param widgets the widgets to show, they must lie inside the strip
+  /// @param n number of @p widgets
+  void show(gCoord y, const GHandle* widgets, size_t n);
+
+private:
+  GDisplay* display_ = nullptr;
+  GDisplay* pixmap_ = nullptr;
+};
@@ -0,0 +1,15 @@
+#include "volume_line.h"
+
+
+void show_volumes(volume_lines_t& lines, session_slots_t& slots,
+                  const std::array<CommAPI::volume_t, CommAPI::MAX_SUPPORTED_PROGRAMS>& volumes) {
+  const auto sessions = slots.assign(volumes);
+  for (size_t line = 0; line < lines.size(); ++line) {
+    if (sessions[line]) {
+      lines[line].set_volume(*sessions[line]);
+      lines[line].render();
+    } else {
+      lines[line].reset();
+    }
+  }
+}
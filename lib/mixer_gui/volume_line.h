@@ -0,0 +1,280 @@
+#pragma once
+#include "strip_renderer.h"
+#include "pending_volume.h"
+#include "session_slots.h"
+#include "comm_api.h"
+#include "gfx.h"
+#include <array>
+#include <cstdio>
+#include <optional>
+
+inline constexpr uint32_t MAX_LINES = 5;
+
+/// @brief Request from the GUI to the link task
+struct LinkCommand {
+  enum type_t : uint8_t {
+    SET_VOLUME,
+    SET_MUTE,
+    PREV_PAGE,  ///< scroll the sessions, @p pid and @p value are not used
+    NEXT_PAGE,
+    LOAD_ICON,  ///< load the icon of session @p pid for SetVolumeHelper::set_icon(), @p value is not used
+  } type;
+  int16_t pid;
+  uint8_t value;  ///< volume, or mute
+};
+
+/// @brief How the lines reach the rest of the firmware, set by the GUI task, or by a benchmark
+struct LineHooks {
+  /// decode the icon of @p vol into @p icon, false if it failed, or if it's passed to set_icon() later
+  bool (*load_icon)(const mixer::ProgramVolume& vol, GDisplay* icon);
+  void (*command)(const LinkCommand& cmd);                             ///< send a command to the PC, must not block
+  uint32_t (*now_ms)();                                                ///< time for PendingVolume
+  StripRenderer* strip;                                                ///< lines are composed in it
+};
+
+/// @brief Used to render one "line" on the GUI
+struct SetVolumeHelper {
+  static inline constexpr gCoord ICON_SZ = 32;  ///< icons are square
+
+  static inline LineHooks hooks{};  ///< set before init()
+
+  /// @brief Line is set at creation, and not changed after
+  /// @param line line of this instance
+  SetVolumeHelper(int line) : line_(line) {
+  }
+
+  /// @brief Create the widgets, hidden
+  void init() {
+    GWidgetInit wi;
+    gwinWidgetClearInit(&wi);
+    wi.g.show = gFalse;
+    wi.g.x = base_x;
+    wi.g.y = base_y + line_ * multiplier;
+    wi.g.height = 32;
+    wi.g.width = 32;
+
+    img_handle_ = gwinImageCreate(0, &wi.g);
+    // the icon is decoded once into its own pixmap, redraws only copy it
+    icon_ = gdispPixmapCreate(ICON_SZ, ICON_SZ);
+    if (icon_) {
+      gdispGClear(icon_, gwinGetDefaultBgColor());
+      gwinImageOpenMemory(img_handle_, gdispPixmapGetMemoryImage(icon_));
+    }
+
+    wi.g.x += multiplier;
+    wi.text = "M";
+    btn_mute_ = gwinButtonCreate(0, &wi);
+
+
+    wi.g.x += multiplier;
+    wi.text = "-";
+    btn_minus_ = gwinButtonCreate(0, &wi);
+
+
+    wi.g.x += multiplier;
+    wi.g.width = gdispGetWidth() - base_x - 3 * multiplier - base_x - multiplier;
+    wi.text = "%";
+    slider_ = gwinSliderCreate(0, &wi);
+    gwinSetCustomDraw(slider_, gwinSliderDraw_Incremental, nullptr);
+
+    wi.text = "+";
+    wi.g.width = 32;
+    wi.g.x = gdispGetWidth() - base_x - 32;
+    btn_plus_ = gwinButtonCreate(0, &wi);
+  }
+
+  /// @brief Render the line, if it's set
+  /// @details Only redraw parts, which have changed since last call
+  void render() {
+    if (not volume_) {
+      return;
+    }
+    auto curr = *volume_;  // needed for debug, pio doesnt work with optional :/
+
+    // new sessions and lines, which were hidden, are drawn whole through the strip
+    const bool full_redraw = session_change_ || icon_changed_ || not gwinGetVisible(slider_);
+    icon_changed_ = false;
+    const std::array<GHandle, 5> widgets = { img_handle_, btn_mute_, btn_minus_, slider_, btn_plus_ };
+
+    if (session_change_) {
+      load_icon(curr);
+    }
+
+    if (full_redraw) {
+      // nothing is drawn on the display until the strip is
+      hooks.strip->hide(widgets.data(), widgets.size());
+    }
+
+    if (volume_changed_) {
+      volume_changed_ = false;
+      if (curr.muted_) {
+        snprintf(slider_txt_.data(), slider_txt_.size() - 1, "Mute (%d%%)", curr.volume_);
+      } else {
+        snprintf(slider_txt_.data(), slider_txt_.size() - 1, "%d%%", curr.volume_);
+      }
+      // only repaints the moved part of the slider and the text
+      gwinSliderSetPositionText(slider_, curr.volume_, slider_txt_.data());
+    }
+
+    if (full_redraw) {
+      hooks.strip->show(strip_y(), widgets.data(), widgets.size());
+    }
+  }
+
+  /// @brief Set the session of this line
+  /// @details Values the user set, but the PC doesn't report yet, are kept
+  void set_volume(const mixer::ProgramVolume& pc_vol) {
+    if (not volume_ || volume_->pid_ != pc_vol.pid_) {
+      pending_.clear();
+    }
+    const auto vol = pending_.reconcile(pc_vol, hooks.now_ms());
+    if (volume_ && volume_->pid_ == vol.pid_) {
+      // picture haven't changed
+      // session_change_ = false;
+      volume_changed_ = volume_changed_ || (vol.volume_ != volume_->volume_) || (vol.muted_ != volume_->muted_);
+    } else {
+      session_change_ = true;
+      volume_changed_ = true;
+    }
+    volume_ = vol;
+  }
+
+  /// @brief Show the icon of session @p pid, if the line still shows the session
+  /// @param src the icon, it's copied
+  void set_icon(int16_t pid, GDisplay* src) {
+    if (not volume_ || volume_->pid_ != pid || not icon_) {
+      return;
+    }
+    gdispGBlitArea(icon_, 0, 0, ICON_SZ, ICON_SZ, 0, 0, ICON_SZ, gdispPixmapGetBits(src));
+    icon_changed_ = true;
+    render();
+  }
+
+  /// @brief Hide this line and remove session info
+  void reset() {
+    volume_ = std::nullopt;
+    pending_.clear();
+    hide_widgets();
+  }
+
+  /// @brief Check if event belongs to this line and act accordingly
+  void handle_event(const GEvent* ev) {
+    if (not volume_) {
+      return;
+    }
+
+    if (ev->type == GEVENT_GWIN_BUTTON) {
+      const auto handle = ((GEventGWinButton*)ev)->gwin;
+      handle_button_event(handle);
+    }
+
+    if (ev->type == GEVENT_GWIN_SLIDER) {
+      handle_slider_event((GEventGWinSlider*)ev);
+    }
+  }
+
+private:
+  /// @brief Decode the icon of session @p vol into the pixmap of the image widget
+  /// @details A failed icon is left blank until the session changes, else it would be downloaded on every render
+  void load_icon(const mixer::ProgramVolume& vol) {
+    session_change_ = false;
+    if (icon_) {
+      hooks.load_icon(vol, icon_);
+    }
+  }
+
+  /// @brief Top of the strip, which holds this line. The widgets are centered in it
+  gCoord strip_y() const {
+    return base_y + line_ * multiplier - (StripRenderer::HEIGHT - 32) / 2;
+  }
+
+  void hide_widgets() {
+    gwinHide(img_handle_);
+    gwinHide(btn_mute_);
+    gwinHide(btn_minus_);
+    gwinHide(btn_plus_);
+    gwinHide(slider_);
+    gwinHide(img_handle_);
+  }
+
+  void handle_button_event(const GHandle h) {
+    handle_mute_btn(h);
+    handle_plus_minus_btn(h);
+  }
+
+  void handle_plus_minus_btn(const GHandle h) {
+    if (h != btn_minus_ && h != btn_plus_) {
+      return;
+    }
+
+    bool need_change = false;
+
+    int16_t vol = volume_->volume_;  // so no underflow when minus
+    // finer control for master volume
+    const int16_t increment = volume_->pid_ == -1 ? 2 : 10;
+    if (h == btn_minus_) {
+      need_change = true;
+      vol -= increment;
+    } else if (h == btn_plus_) {
+      need_change = true;
+      vol += increment;
+    }
+
+    if (need_change) {
+      request_volume(utils::constrain(vol, 0, 100));
+    }
+  }
+
+  void handle_mute_btn(const GHandle h) {
+    if (h != btn_mute_) {
+      return;
+    }
+    const bool muted = not volume_->muted_;
+    hooks.command({ LinkCommand::SET_MUTE, volume_->pid_, muted });
+    pending_.set_muted(muted, hooks.now_ms());
+    volume_->muted_ = muted;
+    volume_changed_ = true;
+    render();
+  }
+
+  void handle_slider_event(const GEventGWinSlider* ev) {
+    if (ev->gwin == slider_ && ev->action == GSLIDER_EVENT_SET) {
+      request_volume(utils::constrain(ev->position, 0, 100));
+    }
+  }
+
+  /// @brief Send the volume to the PC, and show it without waiting for the PC to report it back
+  void request_volume(uint8_t vol) {
+    hooks.command({ LinkCommand::SET_VOLUME, volume_->pid_, vol });
+    pending_.set_volume(vol, hooks.now_ms());
+    volume_->volume_ = vol;
+    volume_changed_ = true;
+    render();
+  }
+
+  GHandle img_handle_{};
+  GHandle btn_plus_{};
+  GHandle btn_minus_{};
+  GHandle btn_mute_{};
+  GHandle slider_{};
+  GDisplay* icon_{};  ///< decoded icon, shown by img_handle_
+  const int line_;
+  std::optional<mixer::ProgramVolume> volume_;  ///< what the line shows
+  PendingVolume pending_;                       ///< what the user set, until the PC confirms it
+  bool session_change_ = true;                  ///< If true, picture will be redrawn
+  bool icon_changed_ = false;                   ///< If true, the line is drawn again with the new icon
+  bool volume_changed_ = true;                  ///< If true, slider is redrawn
+  std::array<char, 30> slider_txt_ = { 0 };     ///< holds the text on the slider
+
+  static constexpr unsigned base_x = 10;      ///< X of first widget
+  static constexpr unsigned base_y = 10;      ///< Y of first widget
+  static constexpr unsigned multiplier = 40;  ///< spacing of widgets
+};
+
+using volume_lines_t = std::array<SetVolumeHelper, MAX_LINES>;
+using session_slots_t = SessionSlots<MAX_LINES>;
+
+/// @brief Show each session on the line of its slot, hide the free lines
+/// @details Sessions stay on their line when others come and go, so only the lines of new sessions load an icon
+void show_volumes(volume_lines_t& lines, session_slots_t& slots,
+                  const std::array<CommAPI::volume_t, CommAPI::MAX_SUPPORTED_PROGRAMS>& volumes);
@@ -0,0 +1,1514 @@
+#include "pc_server.h"
+#include "utils.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <elf.h>
+#include <string>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+namespace pc_server {
+  namespace {
+    constexpr size_t ICON_SIDE = 32;
+    constexpr size_t MAX_PER_LOAD = 5;        ///< CommAPI::MAX_SUPPORTED_PROGRAMS, more sessions aren't read
+    constexpr uint32_t MAX_CHUNK = 1024;      ///< larger chunk sizes of a device are cut
+    constexpr size_t CRC_SZ = sizeof(uint32_t);
+    constexpr size_t TRACE_CHUNK = 32;        ///< CommAPI::TRACE_CHUNK, records in a frame
+    constexpr size_t LOG_CHUNK = 128;         ///< CommAPI::LOG_CHUNK, bytes of log records in a frame
+    constexpr size_t LOG_HEAD = 3;            ///< dlog::HEAD_SZ, id and length of the arguments of a record
+    constexpr unsigned METRICS_SUB_BITS = 2;  ///< metrics::Histogram::SUB_BITS
+    constexpr uint32_t ISR_TID = 1000;        ///< threads of the ISRs in the Chrome trace, after the tasks
+
+    uint64_t now_us() {
+      timespec t;
+      clock_gettime(CLOCK_MONOTONIC, &t);
+      return static_cast<uint64_t>(t.tv_sec) * 1000000 + t.tv_nsec / 1000;
+    }
+
+    /// @brief xorshift32, the same sequence on every host
+    uint32_t next_random(uint32_t& state) {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      return state;
+    }
+
+    /// @brief Bytes after the command byte, -1 if @p cmd doesn't start a frame with a fixed length
+    int payload(uint8_t cmd) {
+      switch (cmd) {
+        case LOAD_ALL:
+        case QUERY_CHANGES:
+          return 0;
+        case READ_IMG:
+        case IMAGE_INFO:
+          return sizeof(int16_t) + CRC_SZ;
+        case SET_VOLUME:
+        case SET_MUTE:
+          return sizeof(int16_t) + sizeof(uint8_t) + CRC_SZ;
+        case LOAD_PAGE:
+          return sizeof(uint16_t) + sizeof(uint8_t) + CRC_SZ;
+        case RESPONSE_OK:
+        case RESPONSE_FAIL:
+          return CRC_SZ;
+        default:
+          return -1;
+      }
+    }
+
+    /// @brief true if the CRC after @p n bytes of @p data matches
+    bool checked(const uint8_t* data, size_t n) {
+      return utils::mem2T<uint32_t>(data + n) == utils::crc32mpeg2(data, n);
+    }
+
+    /// @brief Nearest rank, @p values is sorted
+    uint32_t percentile(std::vector<uint32_t>& values, unsigned pct) {
+      if (values.empty()) {
+        return 0;
+      }
+      const size_t rank = (values.size() * pct + 99) / 100;
+      return values[rank ? rank - 1 : 0];
+    }
+
+    /// @brief printf at the end of @p out
+    __attribute__((format(printf, 2, 3))) void append(std::string& out, const char* fmt, ...) {
+      va_list args, again;
+      va_start(args, fmt);
+      va_copy(again, args);
+      const int n = vsnprintf(nullptr, 0, fmt, args);
+      va_end(args);
+      if (n > 0) {
+        const size_t at = out.size();
+        out.resize(at + n + 1);
+        vsnprintf(&out[at], n + 1, fmt, again);
+        out.resize(at + n);
+      }
+      va_end(again);
+    }
+
+    /// @brief Copy the section @p name of an ELF in @p file to @p out
+    template <typename Ehdr, typename Shdr>
+    bool elf_section(const std::vector<uint8_t>& file, const char* name, std::vector<char>& out) {
+      Ehdr eh;
+      if (file.size() < sizeof(eh)) {
+        return false;
+      }
+      memcpy(&eh, file.data(), sizeof(eh));
+      const auto header = [&](size_t i, Shdr& sh) {
+        const size_t at = eh.e_shoff + i * eh.e_shentsize;
+        if (eh.e_shentsize < sizeof(sh) || at + sizeof(sh) > file.size()) {
+          return false;
+        }
+        memcpy(&sh, file.data() + at, sizeof(sh));
+        return true;
+      };
+      Shdr names;
+      if (not header(eh.e_shstrndx, names)) {
+        return false;
+      }
+      for (size_t i = 0; i < eh.e_shnum; ++i) {
+        Shdr sh;
+        if (not header(i, sh)) {
+          return false;
+        }
+        const size_t at = names.sh_offset + sh.sh_name;
+        if (at >= file.size() || strncmp(reinterpret_cast<const char*>(&file[at]), name, file.size() - at) != 0) {
+          continue;
+        }
+        if (sh.sh_type == SHT_NOBITS || sh.sh_offset + sh.sh_size > file.size()) {
+          return false;
+        }
+        out.assign(file.begin() + sh.sh_offset, file.begin() + sh.sh_offset + sh.sh_size);
+        return true;
+      }
+      return false;
+    }
+
+    /// @brief Some have a default icon in the ROMFS, the others are downloaded
+    const char* const NAMES[] = { "chrome.exe", "Spotify.exe", "SomeGame.exe", "Discord.exe",
+                                  "steam.exe",  "vlc.exe",     "obs64.exe",    "Teams.exe" };
+    constexpr size_t N_NAMES = sizeof(NAMES) / sizeof(NAMES[0]);
+
+    /// @brief @p s as a JSON string, with the quotes
+    std::string json(const std::string& s) {
+      std::string out = "\"";
+      for (const char c : s) {
+        if (c == '"' || c == '\\') {
+          out += '\\';
+          out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+          char esc[8];
+          snprintf(esc, sizeof(esc), "\\u%04x", c);
+          out += esc;
+        } else {
+          out += c;
+        }
+      }
+      return out + '"';
+    }
+  }  // namespace
+
+  const char* command_name(uint8_t cmd) {
+    switch (cmd) {
+      case LOAD_ALL:
+        return "LOAD_ALL";
+      case READ_IMG:
+        return "READ_IMG";
+      case SET_VOLUME:
+        return "SET_VOLUME";
+      case ECHO:
+        return "ECHO";
+      case SET_MUTE:
+        return "SET_MUTE";
+      case QUERY_CHANGES:
+        return "QUERY_CHANGES";
+      case IMAGE_INFO:
+        return "IMAGE_INFO";
+      case LOAD_PAGE:
+        return "LOAD_PAGE";
+      case TASK_STATS:
+        return "TASK_STATS";
+      case TRACE:
+        return "TRACE";
+      case LOG:
+        return "LOG";
+      case METRICS:
+        return "METRICS";
+      default:
+        return nullptr;
+    }
+  }
+
+  int decode_task_stats(const uint8_t* data, size_t n, TaskStats& out) {
+    constexpr size_t HEAD = sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint8_t);
+    constexpr size_t TASK = 3 * sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint32_t) + sizeof(uint16_t) + 1;
+    if (n < HEAD + CRC_SZ) {
+      return 0;
+    }
+    if (not checked(data, HEAD)) {
+      return -1;
+    }
+    out.interval_us = utils::mem2T<uint32_t>(data);
+    out.idle_permille = utils::mem2T<uint16_t>(data + 4);
+    out.tasks.resize(data[6]);
+    size_t pos = HEAD + CRC_SZ;
+    for (auto& t : out.tasks) {
+      const uint8_t* task = data + pos;
+      if (n < pos + TASK || n < pos + TASK + task[TASK - 1] + CRC_SZ) {
+        return 0;
+      }
+      const size_t len = TASK + task[TASK - 1];
+      if (not checked(task, len)) {
+        return -1;
+      }
+      t.number = task[0];
+      t.priority = task[1];
+      t.state = task[2];
+      t.permille = utils::mem2T<uint16_t>(task + 3);
+      t.run_us = utils::mem2T<uint32_t>(task + 5);
+      t.stack_free = utils::mem2T<uint16_t>(task + 9);
+      t.name.assign(reinterpret_cast<const char*>(task + TASK), task[TASK - 1]);
+      pos += len + CRC_SZ;
+    }
+    return pos;
+  }
+
+  void print_task_stats(const TaskStats& stats, FILE* out) {
+    static const char* const STATES[] = { "running", "ready", "blocked", "suspended", "deleted" };
+    std::vector<const TaskStats::Task*> tasks;
+    for (const auto& t : stats.tasks) {
+      tasks.push_back(&t);
+    }
+    std::stable_sort(tasks.begin(), tasks.end(), [](auto* a, auto* b) { return a->permille > b->permille; });
+
+    fprintf(out, "tasks over %u ms, idle %u.%u %%\n", stats.interval_us / 1000, stats.idle_permille / 10,
+            stats.idle_permille % 10);
+    for (const auto* t : tasks) {
+      fprintf(out, "  %3u %-16s prio %2u %-9s %3u.%u %% %8u us, stack free %u\n", t->number, t->name.c_str(),
+              t->priority, t->state < 5 ? STATES[t->state] : "?", t->permille / 10, t->permille % 10, t->run_us,
+              t->stack_free);
+    }
+  }
+
+  int decode_trace(const uint8_t* data, size_t n, Trace& out) {
+    constexpr size_t HEAD = 2 * sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    constexpr size_t NAME = sizeof(uint8_t) + sizeof(uint16_t) + 2 * sizeof(uint8_t);
+    constexpr size_t RECORD = 8;
+    if (n < HEAD + CRC_SZ) {
+      return 0;
+    }
+    if (not checked(data, HEAD)) {
+      return -1;
+    }
+    out.clock_hz = utils::mem2T<uint32_t>(data);
+    out.lost = utils::mem2T<uint32_t>(data + 4);
+    const uint8_t names = data[8];
+    const uint16_t records = utils::mem2T<uint16_t>(data + 9);
+    size_t pos = HEAD + CRC_SZ;
+
+    out.names.clear();
+    for (uint8_t i = 0; i < names; ++i) {
+      const uint8_t* name = data + pos;
+      if (n < pos + NAME || n < pos + NAME + name[NAME - 1] + CRC_SZ) {
+        return 0;
+      }
+      const size_t len = NAME + name[NAME - 1];
+      if (not checked(name, len)) {
+        return -1;
+      }
+      auto& entry = out.names[{ name[0], utils::mem2T<uint16_t>(name + 1) }];
+      entry.info = name[3];
+      entry.name.assign(reinterpret_cast<const char*>(name + NAME), name[NAME - 1]);
+      pos += len + CRC_SZ;
+    }
+
+    out.records.resize(records);
+    for (size_t done = 0; done < records;) {
+      const size_t chunk = std::min(TRACE_CHUNK, records - done);
+      const uint8_t* rec = data + pos;
+      if (n < pos + chunk * RECORD + CRC_SZ) {
+        return 0;
+      }
+      if (not checked(rec, chunk * RECORD)) {
+        return -1;
+      }
+      for (size_t i = 0; i < chunk; ++i, rec += RECORD) {
+        auto& r = out.records[done + i];
+        r.time = utils::mem2T<uint32_t>(rec);
+        r.arg = utils::mem2T<uint16_t>(rec + 4);
+        r.event = rec[6];
+        r.info = rec[7];
+      }
+      pos += chunk * RECORD + CRC_SZ;
+      done += chunk;
+    }
+    return pos;
+  }
+
+  int decode_log(const uint8_t* data, size_t n, Log& out) {
+    constexpr size_t HEAD = sizeof(uint32_t) + sizeof(uint16_t);
+    if (n < HEAD + CRC_SZ) {
+      return 0;
+    }
+    if (not checked(data, HEAD)) {
+      return -1;
+    }
+    out.dropped = utils::mem2T<uint32_t>(data);
+    const uint16_t bytes = utils::mem2T<uint16_t>(data + 4);
+    size_t pos = HEAD + CRC_SZ;
+
+    // records may go on in the next frame
+    std::vector<uint8_t> records;
+    for (size_t done = 0; done < bytes;) {
+      const size_t chunk = std::min<size_t>(LOG_CHUNK, bytes - done);
+      if (n < pos + chunk + CRC_SZ) {
+        return 0;
+      }
+      if (not checked(data + pos, chunk)) {
+        return -1;
+      }
+      records.insert(records.end(), data + pos, data + pos + chunk);
+      pos += chunk + CRC_SZ;
+      done += chunk;
+    }
+
+    out.records.clear();
+    for (size_t i = 0; i < records.size();) {
+      if (i + LOG_HEAD > records.size() || i + LOG_HEAD + records[i + 2] > records.size()) {
+        return -1;
+      }
+      Log::Record r;
+      r.id = utils::mem2T<uint16_t>(&records[i]);
+      r.args.assign(records.begin() + i + LOG_HEAD, records.begin() + i + LOG_HEAD + records[i + 2]);
+      i += LOG_HEAD + records[i + 2];
+      out.records.push_back(std::move(r));
+    }
+    return pos;
+  }
+
+  uint32_t Metrics::lower(unsigned bucket) {
+    constexpr unsigned SUB = 1u << METRICS_SUB_BITS;
+    if (bucket < SUB) {
+      return bucket;
+    }
+    const unsigned msb = (bucket >> METRICS_SUB_BITS) + METRICS_SUB_BITS - 1;
+    return static_cast<uint32_t>((SUB + (bucket & (SUB - 1))) << (msb - METRICS_SUB_BITS));
+  }
+
+  uint32_t Metrics::percentile(const Metric& m, unsigned pct) {
+    // nearest rank, the last bucket used is open
+    const uint64_t rank = (static_cast<uint64_t>(m.count) * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (auto it = m.buckets.begin(); it != m.buckets.end(); ++it) {
+      seen += it->second;
+      if (seen >= rank && std::next(it) != m.buckets.end()) {
+        return std::min(m.max, lower(it->first + 1) - 1);
+      }
+    }
+    return m.max;
+  }
+
+  int decode_metrics(const uint8_t* data, size_t n, Metrics& out) {
+    constexpr size_t HEAD = sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint8_t);
+    constexpr size_t NAME = 2 * sizeof(uint8_t);
+    if (n < HEAD + CRC_SZ) {
+      return 0;
+    }
+    if (not checked(data, HEAD)) {
+      return -1;
+    }
+    out.ms = utils::mem2T<uint32_t>(data);
+    const uint16_t count = utils::mem2T<uint16_t>(data + 4);
+    out.names = data[6];
+    out.frames = 0;
+    size_t pos = HEAD + CRC_SZ;
+
+    out.metrics.assign(count, {});
+    for (uint16_t i = 0; out.names && i < count; ++i) {
+      const uint8_t* name = data + pos;
+      if (n < pos + NAME || n < pos + NAME + name[1] + CRC_SZ) {
+        return 0;
+      }
+      if (not checked(name, NAME + name[1])) {
+        return -1;
+      }
+      out.metrics[i].type = name[0];
+      out.metrics[i].name.assign(reinterpret_cast<const char*>(name + NAME), name[1]);
+      pos += NAME + name[1] + CRC_SZ;
+    }
+
+    // as many values in a frame as fit
+    for (uint16_t i = 0; i < count;) {
+      if (n < pos + sizeof(uint16_t)) {
+        return 0;
+      }
+      const uint16_t len = utils::mem2T<uint16_t>(data + pos);
+      if (n < pos + sizeof(uint16_t) + len + CRC_SZ) {
+        return 0;
+      }
+      if (not checked(data + pos, sizeof(uint16_t) + len)) {
+        return -1;
+      }
+      const uint8_t* p = data + pos + sizeof(uint16_t);
+      const uint8_t* end = p + len;
+      for (; p < end && i < count; ++i) {
+        auto& m = out.metrics[i];
+        m.type = *p++;
+        if (m.type == Metrics::COUNTER || m.type == Metrics::GAUGE) {
+          if (end - p < 4) {
+            return -1;
+          }
+          m.value = m.type == Metrics::COUNTER ? int64_t{ utils::mem2T<uint32_t>(p) } : utils::mem2T<int32_t>(p);
+          p += 4;
+        } else if (m.type == Metrics::HISTOGRAM) {
+          if (end - p < 9 || end - p < 9 + 5 * p[8]) {
+            return -1;
+          }
+          m.count = utils::mem2T<uint32_t>(p);
+          m.max = utils::mem2T<uint32_t>(p + 4);
+          const uint8_t used = p[8];
+          p += 9;
+          for (uint8_t b = 0; b < used; ++b, p += 5) {
+            m.buckets[p[0]] = utils::mem2T<uint32_t>(p + 1);
+          }
+        } else {
+          return -1;
+        }
+      }
+      if (p != end) {
+        return -1;
+      }
+      pos += sizeof(uint16_t) + len + CRC_SZ;
+      ++out.frames;
+    }
+    return pos;
+  }
+
+  void print_metrics(const Metrics& metrics, FILE* out) {
+    fprintf(out, "metrics at %u ms\n", metrics.ms);
+    for (size_t i = 0; i < metrics.metrics.size(); ++i) {
+      const auto& m = metrics.metrics[i];
+      const std::string name = m.name.empty() ? "metric " + std::to_string(i) : m.name;
+      switch (m.type) {
+        case Metrics::COUNTER:
+          fprintf(out, "  %-20s counter   %lld\n", name.c_str(), static_cast<long long>(m.value));
+          break;
+        case Metrics::GAUGE:
+          fprintf(out, "  %-20s gauge     %lld\n", name.c_str(), static_cast<long long>(m.value));
+          break;
+        default:
+          fprintf(out, "  %-20s histogram n=%u,p50=%u,p90=%u,p99=%u,max=%u\n", name.c_str(), m.count,
+                  Metrics::percentile(m, 50), Metrics::percentile(m, 90), Metrics::percentile(m, 99), m.max);
+          break;
+      }
+    }
+  }
+
+  bool LogFormats::load(const char* elf) {
+    FILE* f = fopen(elf, "rb");
+    if (not f) {
+      return false;
+    }
+    std::vector<uint8_t> file;
+    uint8_t buff[4096];
+    for (size_t n; (n = fread(buff, 1, sizeof(buff), f)) > 0;) {
+      file.insert(file.end(), buff, buff + n);
+    }
+    fclose(f);
+
+    // both the Cortex-M4 and the hosts are little endian
+    if (file.size() < EI_NIDENT || memcmp(file.data(), ELFMAG, SELFMAG) != 0 || file[EI_DATA] != ELFDATA2LSB) {
+      return false;
+    }
+    if (file[EI_CLASS] == ELFCLASS64) {
+      long_size_ = 8;
+      return elf_section<Elf64_Ehdr, Elf64_Shdr>(file, "dlog_fmt", formats_);
+    }
+    long_size_ = 4;
+    return elf_section<Elf32_Ehdr, Elf32_Shdr>(file, "dlog_fmt", formats_);
+  }
+
+  std::string LogFormats::expand(const Log::Record& record) const {
+    std::string out;
+    if (record.id >= formats_.size()) {
+      append(out, "dlog %u:", record.id);
+      for (const uint8_t b : record.args) {
+        append(out, " %02x", b);
+      }
+      return out;
+    }
+
+    const auto& args = record.args;
+    size_t pos = 0;
+    const auto take = [&](size_t n, uint64_t& value) {
+      if (pos + n > args.size()) {
+        return false;
+      }
+      value = 0;
+      memcpy(&value, &args[pos], n);
+      pos += n;
+      return true;
+    };
+
+    const char* end = formats_.data() + formats_.size();
+    for (const char* f = formats_.data() + record.id; f < end && *f;) {
+      if (*f != '%') {
+        out += *f++;
+        continue;
+      }
+      if (f + 1 < end && f[1] == '%') {
+        out += '%';
+        f += 2;
+        continue;
+      }
+
+      // flags, width and precision stay, a * takes an int argument
+      std::string spec = "%";
+      bool ok = true;
+      for (++f; ok && f < end && *f && strchr("-+ #0123456789.*", *f); ++f) {
+        uint64_t value;
+        if (*f != '*') {
+          spec += *f;
+        } else if ((ok = take(4, value))) {
+          spec += std::to_string(static_cast<int32_t>(value));
+        }
+      }
+      // the length modifier is the size of the argument on the device, shorter ones are stored in 4 bytes
+      std::string length;
+      for (; f < end && *f && strchr("hlLqjzt", *f); ++f) {
+        length += *f;
+      }
+      size_t size = 4;
+      if (length == "ll" || length == "j" || length == "q") {
+        size = 8;
+      } else if (length == "l" || length == "z" || length == "t") {
+        size = long_size_;
+      }
+      const char conversion = f < end ? *f++ : 0;
+
+      uint64_t value = 0;
+      switch (conversion) {
+        case 'd':
+        case 'i':
+          if ((ok = ok && take(size, value))) {
+            const long long v = size == 4 ? static_cast<int32_t>(value) : static_cast<int64_t>(value);
+            append(out, (spec + "lld").c_str(), v);
+          }
+          break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+          if ((ok = ok && take(size, value))) {
+            append(out, (spec + "ll" + conversion).c_str(), static_cast<unsigned long long>(value));
+          }
+          break;
+        case 'c':
+          if ((ok = ok && take(4, value))) {
+            append(out, (spec + 'c').c_str(), static_cast<int>(value));
+          }
+          break;
+        case 's':
+          if ((ok = ok && take(1, value) && pos + value <= args.size())) {
+            const std::string str(reinterpret_cast<const char*>(&args[pos]), value);
+            pos += value;
+            append(out, (spec + 's').c_str(), str.c_str());
+          }
+          break;
+        case 'p':
+          if ((ok = ok && take(long_size_, value))) {
+            append(out, "0x%llx", static_cast<unsigned long long>(value));
+          }
+          break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+          if ((ok = ok && take(sizeof(double), value))) {
+            double d;
+            memcpy(&d, &value, sizeof(d));
+            append(out, (spec + conversion).c_str(), d);
+          }
+          break;
+        default:
+          // not a conversion printf knows, as it is
+          out += spec + length;
+          if (conversion) {
+            out += conversion;
+          }
+          break;
+      }
+      if (not ok) {
+        out += "<?>";
+        break;
+      }
+    }
+    return out;
+  }
+
+  struct ChromeTrace::Device {
+    struct Wait {
+      double since;
+      std::string what;
+    };
+
+    uint32_t pid = 0;
+    double hz = 1;
+    bool started = false;
+    uint32_t last = 0;   ///< time of the latest record
+    uint64_t ticks = 0;  ///< of the clock since the first record, unwrapped
+
+    std::map<uint16_t, std::string> tasks;
+    std::map<uint16_t, Trace::Name> objects;
+    std::map<uint16_t, std::string> markers;
+    std::map<uint16_t, std::string> isr_names;  ///< written for the threads of the ISRs
+
+    int running = -1;  ///< task, -1 if it isn't known
+    double running_since = 0;
+    std::map<uint16_t, Wait> waits;                  ///< of the blocked tasks
+    std::vector<std::pair<uint16_t, double>> isrs;  ///< marker and start of the nested ISRs, the innermost last
+
+    std::string task(uint16_t number) const {
+      const auto it = tasks.find(number);
+      return it != tasks.end() ? it->second : "task " + std::to_string(number);
+    }
+
+    std::string marker(uint16_t id) const {
+      const auto it = markers.find(id);
+      return it != markers.end() ? it->second : "marker " + std::to_string(id);
+    }
+
+    /// @brief Name of an object, its type and number without one
+    std::string object(uint16_t id) const {
+      static const char* const TYPES[] = { "queue", "mutex", "semaphore", "semaphore", "mutex" };
+      const auto it = objects.find(id);
+      if (it != objects.end() && not it->second.name.empty()) {
+        return it->second.name;
+      }
+      const uint8_t type = it != objects.end() ? it->second.info : 0;
+      return std::string(type < 5 ? TYPES[type] : "object") + " " + std::to_string(id);
+    }
+
+    /// @brief Mutexes and semaphores are taken and given, queues received and sent
+    bool semaphore(uint16_t id) const {
+      const auto it = objects.find(id);
+      return it != objects.end() && it->second.info != 0;
+    }
+
+    /// @brief Thread of the running ISR or task, events of ISRs and markers happen there
+    uint32_t context() const {
+      return not isrs.empty() ? ISR_TID + isrs.back().first : running >= 0 ? running : 0;
+    }
+  };
+
+  ChromeTrace::ChromeTrace(FILE* out) : out_(out) {
+    fputs("[\n", out_);
+  }
+
+  ChromeTrace::~ChromeTrace() {
+    // the tasks still running at the end
+    for (auto& [device, d] : devices_) {
+      if (d->running >= 0) {
+        const double us = d->ticks * 1e6 / d->hz;
+        begin("X", d->pid, d->running, d->running_since, d->task(d->running));
+        fprintf(out_, ",\"dur\":%.3f}", us - d->running_since);
+      }
+    }
+    fputs("\n]\n", out_);
+    fflush(out_);
+  }
+
+  void ChromeTrace::begin(const char* ph, uint32_t pid, uint32_t tid, double us, const std::string& name) {
+    fprintf(out_, "%s{\"ph\":\"%s\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f,\"name\":%s", events_ ? ",\n" : "", ph, pid, tid,
+            us, json(name).c_str());
+    ++events_;
+  }
+
+  void ChromeTrace::add(uint32_t device, const Trace& trace) {
+    auto& slot = devices_[device];
+    if (not slot) {
+      slot = std::make_unique<Device>();
+      slot->pid = device + 1;
+      begin("M", slot->pid, 0, 0, "process_name");
+      fprintf(out_, ",\"args\":{\"name\":%s}}", json("device " + std::to_string(device)).c_str());
+    }
+    Device& d = *slot;
+    d.hz = trace.clock_hz ? trace.clock_hz : 1;
+
+    for (const auto& [key, name] : trace.names) {
+      const auto [table, id] = key;
+      if (table == Trace::TASK && d.tasks[id] != name.name) {
+        d.tasks[id] = name.name;
+        begin("M", d.pid, id, 0, "thread_name");
+        fprintf(out_, ",\"args\":{\"name\":%s}}", json(name.name + " (" + std::to_string(name.info) + ")").c_str());
+      } else if (table == Trace::OBJECT) {
+        d.objects[id] = name;
+      } else if (table == Trace::MARKER) {
+        d.markers[id] = name.name;
+      }
+    }
+    // an ISR may have run before its name was sent
+    for (auto& [id, written] : d.isr_names) {
+      if (written != d.marker(id)) {
+        written = d.marker(id);
+        begin("M", d.pid, ISR_TID + id, 0, "thread_name");
+        fprintf(out_, ",\"args\":{\"name\":%s}}", json(written).c_str());
+      }
+    }
+
+    if (trace.lost && d.started) {
+      // what was running or waiting isn't known anymore
+      begin("i", d.pid, 0, d.ticks * 1e6 / d.hz, "lost " + std::to_string(trace.lost) + " records");
+      fputs(",\"s\":\"p\"}", out_);
+      d.running = -1;
+      d.waits.clear();
+      d.isrs.clear();
+    }
+
+    for (const auto& r : trace.records) {
+      if (not d.started) {
+        d.started = true;
+        d.last = r.time;
+      }
+      // an ISR above the kernel may record between the claim of a slot and the time of the one it interrupted
+      const int32_t delta = r.time - d.last;
+      if (delta > 0) {
+        d.ticks += delta;
+        d.last = r.time;
+      }
+      const double us = d.ticks * 1e6 / d.hz;
+      const uint32_t tid = d.context();
+
+      auto instant = [&](uint32_t on, const std::string& name) {
+        begin("i", d.pid, on, us, name);
+        fputs(",\"s\":\"t\"", out_);
+      };
+      auto wait = [&](const std::string& what) {
+        if (d.running >= 0) {
+          d.waits[d.running] = { us, what };
+        }
+      };
+
+      switch (r.event) {
+        case Trace::TASK_SWITCHED_IN: {
+          if (d.running >= 0 && (d.running != r.arg || us > d.running_since)) {
+            begin("X", d.pid, d.running, d.running_since, d.task(d.running));
+            fprintf(out_, ",\"dur\":%.3f}", us - d.running_since);
+          }
+          const auto w = d.waits.find(r.arg);
+          if (w != d.waits.end()) {
+            begin("X", d.pid, r.arg, w->second.since, w->second.what);
+            fprintf(out_, ",\"dur\":%.3f}", us - w->second.since);
+            d.waits.erase(w);
+          }
+          d.running = r.arg;
+          d.running_since = us;
+          break;
+        }
+        case Trace::TASK_READY:
+          instant(r.arg, "ready");
+          fputs("}", out_);
+          break;
+        case Trace::TASK_CREATE:
+          instant(r.arg, "create");
+          fprintf(out_, ",\"args\":{\"priority\":%u}}", r.info);
+          break;
+        case Trace::TASK_DELETE:
+          d.waits.erase(r.arg);
+          instant(r.arg, "delete");
+          fputs("}", out_);
+          break;
+        case Trace::TASK_DELAY:
+          wait("delay");
+          break;
+        case Trace::QUEUE_CREATE:
+          d.objects[r.arg].info = r.info;
+          break;
+        case Trace::QUEUE_BLOCK_SEND:
+          wait("wait " + d.object(r.arg));
+          break;
+        case Trace::QUEUE_BLOCK_RECEIVE:
+          wait((d.semaphore(r.arg) ? "take " : "wait ") + d.object(r.arg));
+          break;
+        case Trace::NOTIFY_BLOCK:
+          wait("wait notification");
+          break;
+        case Trace::QUEUE_SEND:
+        case Trace::QUEUE_SEND_FAILED:
+        case Trace::QUEUE_SEND_FROM_ISR:
+        case Trace::QUEUE_RECEIVE:
+        case Trace::QUEUE_RECEIVE_FAILED:
+        case Trace::QUEUE_RECEIVE_FROM_ISR: {
+          const bool send = r.event == Trace::QUEUE_SEND || r.event == Trace::QUEUE_SEND_FAILED ||
+                            r.event == Trace::QUEUE_SEND_FROM_ISR;
+          const bool failed = r.event == Trace::QUEUE_SEND_FAILED || r.event == Trace::QUEUE_RECEIVE_FAILED;
+          const char* op = d.semaphore(r.arg) ? (send ? "give " : "take ") : (send ? "send " : "receive ");
+          instant(tid, op + d.object(r.arg) + (failed ? " failed" : ""));
+          fprintf(out_, ",\"args\":{\"items\":%u}}", r.info);
+          break;
+        }
+        case Trace::NOTIFY:
+        case Trace::NOTIFY_FROM_ISR:
+          instant(tid, "notify " + d.task(r.arg));
+          fputs("}", out_);
+          break;
+        case Trace::ISR_ENTER:
+          if (not d.isr_names.count(r.arg)) {
+            d.isr_names[r.arg] = d.marker(r.arg);
+            begin("M", d.pid, ISR_TID + r.arg, 0, "thread_name");
+            fprintf(out_, ",\"args\":{\"name\":%s}}", json(d.isr_names[r.arg]).c_str());
+          }
+          d.isrs.emplace_back(r.arg, us);
+          break;
+        case Trace::ISR_EXIT:
+          if (not d.isrs.empty() && d.isrs.back().first == r.arg) {
+            begin("X", d.pid, ISR_TID + r.arg, d.isrs.back().second, d.marker(r.arg));
+            fprintf(out_, ",\"dur\":%.3f}", us - d.isrs.back().second);
+            d.isrs.pop_back();
+          }
+          break;
+        case Trace::MARK:
+          instant(tid, d.marker(r.arg));
+          fprintf(out_, ",\"args\":{\"value\":%u}}", r.info);
+          break;
+        case Trace::BEGIN:
+        case Trace::END:
+          begin(r.event == Trace::BEGIN ? "b" : "e", d.pid, tid, us, d.marker(r.arg));
+          fprintf(out_, ",\"cat\":\"marker\",\"id\":%u,\"args\":{\"value\":%u}}", r.arg, r.info);
+          break;
+        default:
+          break;
+      }
+    }
+    fflush(out_);
+  }
+
+  std::vector<uint8_t> synthetic_icon(int16_t pid) {
+    uint32_t random = 0x9E3779B9u * static_cast<uint16_t>(pid) + 1;
+    // RLE header, big endian: width, height, flags, colors - 1. 16 colors, the literals are nibbles
+    std::vector<uint8_t> icon = { 'R', 'L', 0, ICON_SIDE, 0, ICON_SIDE, 0x01, 15 };
+    for (int c = 0; c < 16; ++c) {
+      const uint16_t rgb565 = next_random(random);
+      icon.push_back(rgb565 >> 8);
+      icon.push_back(rgb565 & 0xFF);
+    }
+
+    // blocks of 4x4 pixels in a pattern of the pid, with some noise
+    std::vector<uint8_t> indexes(ICON_SIDE * ICON_SIDE);
+    for (size_t y = 0; y < ICON_SIDE; ++y) {
+      for (size_t x = 0; x < ICON_SIDE; ++x) {
+        const uint32_t r = next_random(random);
+        indexes[y * ICON_SIDE + x] = (r % 8 == 0) ? (r >> 8) & 15 : (((x ^ y) >> 2) + pid) & 15;
+      }
+    }
+
+    // runs of 5 and more, literals in between, like scripts/icon2rle.py
+    std::vector<uint8_t> literal;
+    auto flush_literal = [&] {
+      for (size_t at = 0; at < literal.size(); at += 128) {
+        const size_t n = std::min<size_t>(128, literal.size() - at);
+        icon.push_back(0x80 | (n - 1));
+        for (size_t i = 0; i < n; i += 2) {
+          icon.push_back(literal[at + i] << 4 | (i + 1 < n ? literal[at + i + 1] : 0));
+        }
+      }
+      literal.clear();
+    };
+    for (size_t i = 0; i < indexes.size();) {
+      size_t run = 1;
+      while (i + run < indexes.size() && run < 128 && indexes[i + run] == indexes[i]) {
+        ++run;
+      }
+      if (run >= 5) {
+        flush_literal();
+        icon.push_back(run - 1);
+        icon.push_back(indexes[i]);
+        i += run;
+      } else {
+        literal.push_back(indexes[i++]);
+      }
+    }
+    flush_literal();
+    return icon;
+  }
+
+  static Session make_session(int16_t pid, const std::string& name) {
+    Session s;
+    s.pid = pid;
+    s.volume = static_cast<uint8_t>((pid * 17 + 50) % 101);
+    s.name = name.substr(0, Mixer::NAME_MAX);
+    auto icon = std::make_shared<std::vector<uint8_t>>(synthetic_icon(pid));
+    s.hash = utils::crc32mpeg2(icon->data(), icon->size());
+    s.icon = std::move(icon);
+    return s;
+  }
+
+  Mixer::Mixer(uint16_t programs) : fallback_(make_session(0, "")) {
+    sessions_.push_back(make_session(-1, ""));
+    for (uint16_t i = 0; i < programs; ++i) {
+      add(i < N_NAMES ? NAMES[i] : "program" + std::to_string(i) + ".exe");
+    }
+    version_ = 0;
+  }
+
+  Session* Mixer::lookup(int16_t pid) {
+    for (auto& s : sessions_) {
+      if (s.pid == pid) {
+        return &s;
+      }
+    }
+    return nullptr;
+  }
+
+  const Session* Mixer::find(int16_t pid) const {
+    return const_cast<Mixer*>(this)->lookup(pid);
+  }
+
+  bool Mixer::set_volume(int16_t pid, uint8_t volume) {
+    Session* s = lookup(pid);
+    if (not s || volume > 100) {
+      return false;
+    }
+    s->volume = volume;
+    ++version_;
+    return true;
+  }
+
+  bool Mixer::set_mute(int16_t pid, bool muted) {
+    Session* s = lookup(pid);
+    if (not s) {
+      return false;
+    }
+    s->muted = muted;
+    ++version_;
+    return true;
+  }
+
+  int16_t Mixer::add(const std::string& name) {
+    while (lookup(next_pid_) || next_pid_ <= 0) {
+      next_pid_ = next_pid_ <= 0 ? 1 : next_pid_ + 1;
+    }
+    sessions_.push_back(make_session(next_pid_, name));
+    ++version_;
+    return next_pid_++;
+  }
+
+  bool Mixer::remove(int16_t pid) {
+    const auto it = std::find_if(sessions_.begin(), sessions_.end(), [pid](const Session& s) { return s.pid == pid; });
+    if (it == sessions_.end() || pid < 0) {
+      return false;
+    }
+    sessions_.erase(it);
+    ++version_;
+    return true;
+  }
+
+  std::vector<Event> parse_script(FILE* script, uint32_t seed) {
+    std::vector<Event> events;
+    // mixed, close seeds start far apart. xorshift never leaves 0
+    uint32_t random = (seed ^ 0x9E3779B9u) * 0x85EBCA6Bu;
+    random = random ? random : 1;
+    char line[256];
+    for (unsigned number = 1; fgets(line, sizeof(line), script); ++number) {
+      if (char* comment = strchr(line, '#')) {
+        *comment = '\0';
+      }
+      unsigned ms, a = 0, b = 0;
+      char action[16], arg[64] = { 0 };
+      const int n = sscanf(line, "%u %15s %63s", &ms, action, arg);
+      if (n < 2) {
+        continue;
+      }
+      const bool numbers = sscanf(line, "%*u %*s %u %u", &a, &b) == 2;
+      Event e{ Event::QUIT, ms };
+      if (0 == strcmp(action, "volume") && numbers) {
+        e = { Event::VOLUME, ms, static_cast<int16_t>(a), static_cast<uint8_t>(std::min(b, 100u)) };
+      } else if (0 == strcmp(action, "mute") && numbers) {
+        e = { Event::MUTE, ms, static_cast<int16_t>(a), static_cast<uint8_t>(b != 0) };
+      } else if (0 == strcmp(action, "add") && n == 3) {
+        e = { Event::ADD, ms, 0, 0, arg };
+      } else if (0 == strcmp(action, "remove") && n == 3) {
+        e = { Event::REMOVE, ms, static_cast<int16_t>(atoi(arg)) };
+      } else if (0 == strcmp(action, "storm") && numbers) {
+        // pid 0 picks a session when it's played, the sessions may have changed by then
+        for (unsigned i = 0; i < a; ++i) {
+          Event change{ Event::VOLUME, ms + static_cast<uint32_t>(uint64_t(b) * i / a), 0 };
+          change.value = next_random(random) % 101;
+          change.pick = next_random(random);
+          events.push_back(change);
+        }
+        continue;
+      } else if (0 != strcmp(action, "quit")) {
+        fprintf(stderr, "pc_server: line %u of the script: can't read '%s'\n", number, action);
+        return {};
+      }
+      events.push_back(e);
+    }
+    std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.ms < b.ms; });
+    return events;
+  }
+
+  void report(const Stats& stats, size_t devices, FILE* out) {
+    const uint32_t ms = stats.ms ? stats.ms : 1;
+    fprintf(out,
+            "pc_server: %zu devices, %llu frames/s, in %llu B/s, out %llu B/s, %u crc errors, %u garbage bytes, "
+            "%u timeouts, %u echoes, %u task reports, %u trace records, %u lost, %u log lines, %u dropped, "
+            "%u metric snapshots\n",
+            devices, static_cast<unsigned long long>((stats.frames_in + stats.frames_out) * 1000 / ms),
+            static_cast<unsigned long long>(stats.bytes_in * 1000 / ms),
+            static_cast<unsigned long long>(stats.bytes_out * 1000 / ms), stats.crc_errors, stats.garbage,
+            stats.timeouts, stats.echoes, stats.task_reports, stats.trace_records, stats.trace_lost, stats.log_lines,
+            stats.log_dropped, stats.metric_snapshots);
+    for (uint8_t cmd = 0; cmd < COMMANDS; ++cmd) {
+      const auto& c = stats.commands[cmd];
+      if (not command_name(cmd) || (c.done == 0 && c.failed == 0)) {
+        continue;
+      }
+      std::vector<uint32_t> us = c.us;
+      std::sort(us.begin(), us.end());
+      fprintf(out, "  %-14s %7u done %5u failed  p50 %7u us  p90 %7u us  p99 %7u us  max %7u us\n",
+              command_name(cmd), c.done, c.failed, percentile(us, 50), percentile(us, 90), percentile(us, 99),
+              us.empty() ? 0 : us.back());
+    }
+    fflush(out);
+  }
+
+  struct Server::Device {
+    enum State {
+      IDLE,
+      WAIT_RESULT,    ///< for the success of the device, after a load or the image info
+      WAIT_CHUNK_SZ,  ///< of READ_IMG, after the size was sent
+      WAIT_ACK,       ///< of an image chunk
+    };
+
+    Device(int fd, uint32_t index) : fd(fd), index(index) {
+    }
+
+    int fd;
+    uint32_t index;  ///< in devices_, the data of its epoll events
+    bool gone = false;
+    bool writable_wanted = false;
+    std::vector<uint8_t> rx;
+    size_t pos = 0;  ///< of the first byte, which wasn't handled
+    std::vector<uint8_t> tx;
+
+    State state = IDLE;
+    uint64_t frame_us = 0;  ///< the first byte of the pending frame came then, 0 if there is none
+    uint8_t cmd = 0;        ///< of the transaction
+    uint64_t start_us = 0;
+    uint64_t progress_us = 0;
+
+    uint32_t seen = 0;                      ///< version of the mixer, which the device has loaded
+    std::vector<std::string> metric_names;  ///< sent with a snapshot, for the next ones
+    uint32_t loading = 0;
+
+    std::shared_ptr<const std::vector<uint8_t>> icon;
+    uint32_t icon_sent = 0;
+    uint32_t chunk = 0;
+  };
+
+  Server::Server(Mixer& mixer) : mixer_(mixer), epoll_(epoll_create1(0)), stats_since_us_(now_us()) {
+  }
+
+  Server::~Server() {
+    if (epoll_ >= 0) {
+      close(epoll_);
+    }
+  }
+
+  bool Server::add(int fd) {
+    const uint32_t index = devices_.size();
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u32 = index;
+    if (epoll_ < 0 || epoll_ctl(epoll_, EPOLL_CTL_ADD, fd, &ev) != 0) {
+      return false;
+    }
+    devices_.push_back(std::make_unique<Device>(fd, index));
+    devices_.back()->seen = mixer_.version();
+    return true;
+  }
+
+  Stats Server::take_stats() {
+    const uint64_t now = now_us();
+    Stats taken = std::move(stats_);
+    taken.ms = (now - stats_since_us_) / 1000;
+    stats_ = Stats();
+    stats_since_us_ = now;
+    return taken;
+  }
+
+  void Server::run(uint32_t ms, uint32_t report_ms, FILE* out) {
+    const uint64_t start = now_us();
+    uint64_t next_report = start + uint64_t(report_ms) * 1000;
+    next_event_ = 0;
+    while (not stop_) {
+      epoll_event events[64];
+      const int n = epoll_wait(epoll_, events, 64, TICK_MS);
+      for (int i = 0; i < n; ++i) {
+        Device& d = *devices_[events[i].data.u32];
+        if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+          receive(d);
+        }
+        if (events[i].events & EPOLLOUT) {
+          flush(d);
+        }
+      }
+
+      const uint64_t now = now_us();
+      play_script((now - start) / 1000);
+      for (auto& d : devices_) {
+        if (not d->gone) {
+          serve(*d, now);
+          flush(*d);
+        }
+      }
+      if (report_ms && out && now >= next_report) {
+        report(take_stats(), devices(), out);
+        next_report += uint64_t(report_ms) * 1000;
+      }
+      if (ms && now - start >= uint64_t(ms) * 1000) {
+        break;
+      }
+    }
+  }
+
+  void Server::play_script(uint32_t ms) {
+    for (; next_event_ < script_.size() && script_[next_event_].ms <= ms; ++next_event_) {
+      const Event& e = script_[next_event_];
+      int16_t pid = e.pid;
+      if (pid == 0 && not mixer_.sessions().empty()) {
+        pid = mixer_.sessions()[e.pick % mixer_.sessions().size()].pid;
+      }
+      switch (e.action) {
+        case Event::VOLUME:
+          mixer_.set_volume(pid, e.value);
+          break;
+        case Event::MUTE:
+          mixer_.set_mute(pid, e.value);
+          break;
+        case Event::ADD:
+          mixer_.add(e.name);
+          break;
+        case Event::REMOVE:
+          mixer_.remove(pid);
+          break;
+        case Event::QUIT:
+          stop_ = true;
+          break;
+      }
+    }
+  }
+
+  void Server::receive(Device& d) {
+    uint8_t buff[4096];
+    while (true) {
+      const ssize_t n = read(d.fd, buff, sizeof(buff));
+      if (n > 0) {
+        d.rx.insert(d.rx.end(), buff, buff + n);
+        stats_.bytes_in += n;
+        continue;
+      }
+      if (n < 0 && errno == EINTR) {
+        continue;
+      }
+      if (n == 0 || errno != EAGAIN) {
+        // the device is gone, the pseudo-terminal hangs up
+        d.gone = true;
+        epoll_ctl(epoll_, EPOLL_CTL_DEL, d.fd, nullptr);
+      }
+      return;
+    }
+  }
+
+  void Server::send(Device& d, const void* data, size_t n) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    const uint32_t crc = utils::crc32mpeg2(bytes, n);
+    d.tx.insert(d.tx.end(), bytes, bytes + n);
+    d.tx.insert(d.tx.end(), reinterpret_cast<const uint8_t*>(&crc), reinterpret_cast<const uint8_t*>(&crc) + CRC_SZ);
+    ++stats_.frames_out;
+  }
+
+  void Server::flush(Device& d) {
+    size_t done = 0;
+    while (done < d.tx.size()) {
+      const ssize_t n = write(d.fd, d.tx.data() + done, d.tx.size() - done);
+      if (n > 0) {
+        done += n;
+      } else if (n < 0 && errno == EINTR) {
+        continue;
+      } else {
+        break;
+      }
+    }
+    stats_.bytes_out += done;
+    d.tx.erase(d.tx.begin(), d.tx.begin() + done);
+
+    // the rest goes when the device reads
+    const bool wanted = not d.tx.empty();
+    if (wanted != d.writable_wanted && not d.gone) {
+      epoll_event ev{};
+      ev.events = wanted ? EPOLLIN | EPOLLOUT : EPOLLIN;
+      ev.data.u32 = d.index;
+      epoll_ctl(epoll_, EPOLL_CTL_MOD, d.fd, &ev);
+      d.writable_wanted = wanted;
+    }
+  }
+
+  void Server::finish(Device& d, bool ok, uint64_t now) {
+    auto& c = stats_.commands[d.cmd];
+    if (ok) {
+      ++c.done;
+      c.us.push_back(now - d.start_us);
+    } else {
+      ++c.failed;
+    }
+    d.state = Device::IDLE;
+    d.icon.reset();
+  }
+
+  void Server::send_sessions(Device& d, size_t offset, size_t n) {
+    for (size_t i = offset; i < offset + n; ++i) {
+      const Session& s = mixer_.sessions()[i];
+      uint8_t head[5];
+      memcpy(head, &s.pid, sizeof(s.pid));
+      head[2] = s.volume;
+      head[3] = s.muted;
+      head[4] = s.name.size();
+      send(d, head, sizeof(head));
+      send(d, s.name.data(), s.name.size());
+    }
+  }
+
+  void Server::serve(Device& d, uint64_t now) {
+    const uint64_t timeout_us = uint64_t(TIMEOUT_MS) * 1000;
+    while (true) {
+      const uint8_t* in = d.rx.data() + d.pos;
+      const size_t avail = d.rx.size() - d.pos;
+
+      if (d.state != Device::IDLE) {
+        if (avail == 0) {
+          if (now - d.progress_us > timeout_us) {
+            ++stats_.timeouts;
+            finish(d, false, now);
+          }
+          break;
+        }
+        const bool failure = in[0] == RESPONSE_FAIL;
+        if (d.state != Device::WAIT_CHUNK_SZ && in[0] != RESPONSE_OK && not failure) {
+          // the device gave up and sent something else, it's read as a command
+          finish(d, false, now);
+          continue;
+        }
+        const size_t need = d.state == Device::WAIT_CHUNK_SZ && not failure ? 2 * CRC_SZ : 1 + CRC_SZ;
+        if (avail < need) {
+          if (now - d.progress_us > timeout_us) {
+            ++stats_.timeouts;
+            finish(d, false, now);
+            continue;
+          }
+          break;
+        }
+        if (not checked(in, need - CRC_SZ)) {
+          ++stats_.crc_errors;
+          finish(d, false, now);
+          continue;
+        }
+        d.pos += need;
+        d.progress_us = now;
+        ++stats_.frames_in;
+        if (failure) {
+          finish(d, false, now);
+          continue;
+        }
+
+        if (d.state == Device::WAIT_RESULT) {
+          d.seen = d.cmd == LOAD_ALL || d.cmd == LOAD_PAGE ? d.loading : d.seen;
+          finish(d, true, now);
+        } else if (d.state == Device::WAIT_CHUNK_SZ) {
+          d.chunk = std::clamp<uint32_t>(utils::mem2T<uint32_t>(in), 1, MAX_CHUNK);
+          d.state = Device::WAIT_ACK;
+          send(d, d.icon->data(), std::min<size_t>(d.chunk, d.icon->size()));
+        } else {
+          // the ack of the last chunk is the success of the transfer
+          d.icon_sent = std::min<size_t>(d.icon_sent + d.chunk, d.icon->size());
+          if (d.icon_sent == d.icon->size()) {
+            finish(d, true, now);
+          } else {
+            send(d, d.icon->data() + d.icon_sent, std::min<size_t>(d.chunk, d.icon->size() - d.icon_sent));
+          }
+        }
+        continue;
+      }
+
+      if (avail == 0) {
+        d.frame_us = 0;
+        break;
+      }
+      if (d.frame_us == 0) {
+        d.frame_us = now;
+      }
+      const uint8_t cmd = in[0];
+      const bool stale = now - d.frame_us > timeout_us;
+
+      if (cmd == ECHO) {
+        const auto* end = static_cast<const uint8_t*>(memchr(in + 1, 0, avail - 1));
+        if (not end) {
+          if (stale) {
+            ++stats_.timeouts;
+            ++stats_.garbage;
+            ++d.pos;
+            d.frame_us = 0;
+            continue;
+          }
+          break;
+        }
+        if (echo_) {
+          fprintf(echo_, "%d: %s\n", d.fd, reinterpret_cast<const char*>(in + 1));
+        }
+        ++stats_.echoes;
+        ++stats_.commands[ECHO].done;
+        stats_.commands[ECHO].us.push_back(now - d.frame_us);
+        d.pos += end - in + 1;
+        d.frame_us = 0;
+        continue;
+      }
+
+      if (cmd == TASK_STATS || cmd == TRACE || cmd == LOG || cmd == METRICS) {
+        TaskStats tasks;
+        Trace trace;
+        Log log;
+        Metrics metrics;
+        const int len = cmd == TASK_STATS ? decode_task_stats(in + 1, avail - 1, tasks)
+                        : cmd == TRACE    ? decode_trace(in + 1, avail - 1, trace)
+                        : cmd == LOG      ? decode_log(in + 1, avail - 1, log)
+                                          : decode_metrics(in + 1, avail - 1, metrics);
+        if (len == 0 && not stale) {
+          break;
+        }
+        if (len <= 0) {
+          // a wrong CRC or cut off, the next byte may start a command
+          if (len < 0) {
+            ++stats_.crc_errors;
+          } else {
+            ++stats_.timeouts;
+          }
+          ++stats_.garbage;
+          ++stats_.commands[cmd].failed;
+          ++d.pos;
+          d.frame_us = 0;
+          continue;
+        }
+        if (cmd == TASK_STATS) {
+          if (echo_) {
+            fprintf(echo_, "%d: ", d.fd);
+            print_task_stats(tasks, echo_);
+          }
+          ++stats_.task_reports;
+          stats_.frames_in += 1 + tasks.tasks.size();
+        } else if (cmd == TRACE) {
+          if (trace_) {
+            trace_->add(d.index, trace);
+          }
+          stats_.trace_records += trace.records.size();
+          stats_.trace_lost += trace.lost;
+          stats_.frames_in += 1 + trace.names.size() + (trace.records.size() + TRACE_CHUNK - 1) / TRACE_CHUNK;
+        } else if (cmd == METRICS) {
+          // the names come now and then, they are the same until the device restarts
+          if (metrics.names) {
+            d.metric_names.clear();
+            for (const auto& m : metrics.metrics) {
+              d.metric_names.push_back(m.name);
+            }
+          } else if (d.metric_names.size() == metrics.metrics.size()) {
+            for (size_t i = 0; i < metrics.metrics.size(); ++i) {
+              metrics.metrics[i].name = d.metric_names[i];
+            }
+          }
+          if (echo_) {
+            fprintf(echo_, "%d: ", d.fd);
+            print_metrics(metrics, echo_);
+          }
+          ++stats_.metric_snapshots;
+          stats_.frames_in += 1 + (metrics.names ? metrics.metrics.size() : 0) + metrics.frames;
+        } else {
+          static const LogFormats no_formats;
+          const LogFormats& formats = log_formats_ ? *log_formats_ : no_formats;
+          if (echo_) {
+            if (log.dropped) {
+              fprintf(echo_, "%d: %u log records dropped\n", d.fd, log.dropped);
+            }
+            for (const auto& r : log.records) {
+              fprintf(echo_, "%d: %s\n", d.fd, formats.expand(r).c_str());
+            }
+          }
+          stats_.log_lines += log.records.size();
+          stats_.log_dropped += log.dropped;
+          stats_.frames_in += 1 + (utils::mem2T<uint16_t>(in + 5) + LOG_CHUNK - 1) / LOG_CHUNK;
+        }
+        ++stats_.commands[cmd].done;
+        stats_.commands[cmd].us.push_back(now - d.frame_us);
+        d.pos += 1 + len;
+        d.frame_us = 0;
+        continue;
+      }
+
+      const int len = payload(cmd);
+      if (len < 0) {
+        ++stats_.garbage;
+        ++d.pos;
+        d.frame_us = 0;
+        continue;
+      }
+      if (avail < size_t(1 + len)) {
+        if (stale) {
+          // cut off, the next byte may start a command
+          ++stats_.timeouts;
+          ++stats_.garbage;
+          ++d.pos;
+          d.frame_us = 0;
+          continue;
+        }
+        break;
+      }
+      if (len && not checked(in + 1, len - CRC_SZ)) {
+        ++stats_.crc_errors;
+        ++stats_.garbage;
+        if (cmd < COMMANDS) {
+          ++stats_.commands[cmd].failed;
+        }
+        ++d.pos;
+        d.frame_us = 0;
+        continue;
+      }
+      d.pos += 1 + len;
+      ++stats_.frames_in;
+      d.cmd = cmd;
+      d.start_us = d.frame_us;
+      d.progress_us = now;
+      d.frame_us = 0;
+      const uint8_t* msg = in + 1;
+
+      switch (cmd) {
+        case LOAD_ALL: {
+          const size_t n = mixer_.sessions().size();
+          const uint8_t count = std::min<size_t>(n, UINT8_MAX);
+          send(d, &count, sizeof(count));
+          send_sessions(d, 0, std::min(n, MAX_PER_LOAD));
+          d.loading = mixer_.version();
+          d.state = Device::WAIT_RESULT;
+          break;
+        }
+        case LOAD_PAGE: {
+          const size_t n = mixer_.sessions().size();
+          const size_t offset = std::min<size_t>(utils::mem2T<uint16_t>(msg), n);
+          const size_t count = std::min({ size_t(msg[2]), n - offset, MAX_PER_LOAD });
+          uint8_t head[3];
+          const uint16_t total = std::min<size_t>(n, UINT16_MAX);
+          memcpy(head, &total, sizeof(total));
+          head[2] = count;
+          send(d, head, sizeof(head));
+          send_sessions(d, offset, count);
+          d.loading = mixer_.version();
+          d.state = Device::WAIT_RESULT;
+          break;
+        }
+        case IMAGE_INFO:
+        case READ_IMG: {
+          const Session* s = mixer_.find(utils::mem2T<int16_t>(msg));
+          if (not s) {
+            s = &mixer_.fallback();
+          }
+          const uint32_t size = s->icon->size();
+          if (cmd == IMAGE_INFO) {
+            const uint32_t info[2] = { s->hash, size };
+            send(d, info, sizeof(info));
+            d.state = Device::WAIT_RESULT;
+          } else {
+            send(d, &size, sizeof(size));
+            d.icon = s->icon;
+            d.icon_sent = 0;
+            d.state = Device::WAIT_CHUNK_SZ;
+          }
+          break;
+        }
+        case SET_VOLUME:
+        case SET_MUTE: {
+          // the change goes to the other devices, not back to this one
+          const uint32_t before = mixer_.version();
+          const int16_t pid = utils::mem2T<int16_t>(msg);
+          const bool changed = cmd == SET_VOLUME ? mixer_.set_volume(pid, msg[2]) : mixer_.set_mute(pid, msg[2]);
+          if (changed && d.seen == before) {
+            d.seen = mixer_.version();
+          }
+          finish(d, changed, now);
+          break;
+        }
+        case QUERY_CHANGES: {
+          const uint8_t changed = d.seen != mixer_.version();
+          send(d, &changed, sizeof(changed));
+          finish(d, true, now);
+          break;
+        }
+        default:
+          // a late success or failure, its transaction has timed out
+          break;
+      }
+    }
+
+    if (d.pos == d.rx.size()) {
+      d.rx.clear();
+      d.pos = 0;
+    } else if (d.pos > 4096) {
+      d.rx.erase(d.rx.begin(), d.rx.begin() + d.pos);
+      d.pos = 0;
+    }
+  }
+}  // namespace pc_server
@@ -0,0 +1,394 @@
+/**
+ * @file pc_server.h
+ * @brief Reference PC side of the protocol, for load tests with many simulated devices (env:pc_server)
+ * @details The PC app isn't part of this repository. This server answers every command of CommAPI like it does, from
+ * a synthetic mixer: the master volume and numbered programs, each with its own palette RLE icon. One thread serves
+ * every device with an epoll loop over their pseudo-terminals, see the simulator in lib/simulator/simulator.h.
+ *
+ * A script changes the mixer while the devices are served, to load them with change storms. One event per line, at
+ * milliseconds since start, in ascending order. `#` starts a comment.
+ *
+ *     1000 volume 3 80       # session pid 3 is set to 80
+ *     1500 mute   3 1
+ *     2000 add    game.exe   # a new session, the next free pid
+ *     2500 remove 3
+ *     3000 storm  200 1000   # 200 random volume changes, spread over a second
+ *     9000 quit
+ *
+ * Each device is told about changes until it has loaded the sessions again. Its own SET_VOLUME and SET_MUTE aren't
+ * reported back to it.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef TESTING
+void pc_server_tests();
+#endif
+
+namespace pc_server {
+  /// @brief The same as mixer::commands of CommAPI
+  enum Command : uint8_t {
+    LOAD_ALL = 0x01,
+    READ_IMG = 0x02,
+    SET_VOLUME = 0x03,
+    ECHO = 0x04,
+    SET_MUTE = 0x05,
+    QUERY_CHANGES = 0x06,
+    IMAGE_INFO = 0x07,
+    LOAD_PAGE = 0x08,
+    TASK_STATS = 0x09,
+    TRACE = 0x0A,
+    LOG = 0x0B,
+    METRICS = 0x0C,
+    COMMANDS,
+    RESPONSE_OK = 0xA0,
+    RESPONSE_FAIL = 0xB0,
+  };
+
+  /// @brief Name of a command for the reports, nullptr if it isn't one
+  const char* command_name(uint8_t cmd);
+
+  /// @brief Palette RLE icon of 32x32 pixels, different for every pid
+  std::vector<uint8_t> synthetic_icon(int16_t pid);
+
+  struct Session {
+    int16_t pid = 0;
+    uint8_t volume = 0;
+    bool muted = false;
+    std::string name;
+    std::shared_ptr<const std::vector<uint8_t>> icon;  ///< kept by a transfer, while the session is removed
+    uint32_t hash = 0;                                 ///< of the icon, utils::crc32mpeg2()
+  };
+
+  /// @brief Sessions of the synthetic PC
+  class Mixer {
+  public:
+    static inline constexpr size_t NAME_MAX = 29;  ///< longer names are cut, like ProgramVolume does
+
+    /// @brief The master volume, pid -1 without a name, and @p programs sessions from pid 1
+    explicit Mixer(uint16_t programs);
+
+    const std::vector<Session>& sessions() const {
+      return sessions_;
+    }
+
+    /// @return nullptr if there is no session with @p pid
+    const Session* find(int16_t pid) const;
+
+    /// @brief Icon of sessions, which aren't there anymore
+    const Session& fallback() const {
+      return fallback_;
+    }
+
+    bool set_volume(int16_t pid, uint8_t volume);
+    bool set_mute(int16_t pid, bool muted);
+
+    /// @return pid of the new session
+    int16_t add(const std::string& name);
+    bool remove(int16_t pid);
+
+    /// @brief Incremented by every change
+    uint32_t version() const {
+      return version_;
+    }
+
+  private:
+    Session* lookup(int16_t pid);
+
+    std::vector<Session> sessions_;
+    Session fallback_;
+    int16_t next_pid_ = 1;
+    uint32_t version_ = 0;
+  };
+
+  /// @brief One change of the mixer at a time since start
+  struct Event {
+    enum Action { VOLUME, MUTE, ADD, REMOVE, QUIT } action;
+    uint32_t ms = 0;
+    int16_t pid = 0;
+    uint8_t value = 0;
+    std::string name;
+    uint32_t pick = 0;  ///< with pid 0, sessions()[pick % size] is changed
+  };
+
+  /// @brief Read a script, storms are expanded into volume changes
+  /// @param seed picks the sessions and volumes of the storms
+  /// @return the events in the order of their time, nothing on a syntax error, which is printed to stderr
+  std::vector<Event> parse_script(FILE* script, uint32_t seed = 1);
+
+  /// @brief CPU load of the tasks of a device, sent by CommAPI::report_tasks()
+  struct TaskStats {
+    struct Task {
+      uint8_t number = 0;
+      uint8_t priority = 0;
+      uint8_t state = 0;  ///< eTaskState of FreeRTOS
+      uint16_t permille = 0;
+      uint32_t run_us = 0;
+      uint16_t stack_free = 0;  ///< words
+      std::string name;
+    };
+    uint32_t interval_us = 0;
+    uint16_t idle_permille = 0;
+    std::vector<Task> tasks;
+  };
+
+  /// @brief Decode a report, which starts after the command byte
+  /// @return bytes of the report, 0 if @p n bytes don't hold all of it yet, -1 if a CRC is wrong
+  int decode_task_stats(const uint8_t* data, size_t n, TaskStats& out);
+
+  /// @brief Print a report like top does, the busiest task first
+  void print_task_stats(const TaskStats& stats, FILE* out);
+
+  /// @brief Records of the RTOS tracer of a device, sent by CommAPI::send_trace()
+  struct Trace {
+    /// @brief The same as rtos_trace_event_t of lib/rtos_trace
+    enum Event : uint8_t {
+      TASK_SWITCHED_IN = 1,
+      TASK_READY,
+      TASK_CREATE,
+      TASK_DELETE,
+      TASK_DELAY,
+      QUEUE_CREATE,
+      QUEUE_SEND,
+      QUEUE_SEND_FAILED,
+      QUEUE_BLOCK_SEND,
+      QUEUE_RECEIVE,
+      QUEUE_RECEIVE_FAILED,
+      QUEUE_BLOCK_RECEIVE,
+      QUEUE_SEND_FROM_ISR,
+      QUEUE_RECEIVE_FROM_ISR,
+      NOTIFY,
+      NOTIFY_FROM_ISR,
+      NOTIFY_BLOCK,
+      ISR_ENTER,
+      ISR_EXIT,
+      MARK,
+      BEGIN,
+      END,
+    };
+    enum Table : uint8_t { TASK, OBJECT, MARKER };  ///< of the names, rtos_trace_name_t
+
+    struct Record {
+      uint32_t time = 0;  ///< low bits of the run time clock
+      uint16_t arg = 0;
+      uint8_t event = 0;
+      uint8_t info = 0;
+    };
+    struct Name {
+      uint8_t info = 0;  ///< priority of a task, queueQUEUE_TYPE_* of an object
+      std::string name;
+    };
+
+    uint32_t clock_hz = 0;
+    uint32_t lost = 0;                                   ///< records overwritten before these
+    std::map<std::pair<uint8_t, uint16_t>, Name> names;  ///< by table and id
+    std::vector<Record> records;
+  };
+
+  /// @brief Decode a trace, which starts after the command byte
+  /// @return bytes of the trace, 0 if @p n bytes don't hold all of it yet, -1 if a CRC is wrong
+  int decode_trace(const uint8_t* data, size_t n, Trace& out);
+
+  /// @brief Writes the traces of the devices as Chrome trace JSON, for chrome://tracing and ui.perfetto.dev
+  /// @details A device is a process, its tasks and ISRs are threads. The running task is a slice, from its switch in
+  /// to the next one. Waiting for a queue, a semaphore, a mutex, a notification or a delay is a slice too, until the
+  /// task runs again. Queue operations are instant events, markers too, and begin/end markers are async slices.
+  /// Times start with the first record of each device
+  class ChromeTrace {
+  public:
+    explicit ChromeTrace(FILE* out);
+    ~ChromeTrace();
+    ChromeTrace(const ChromeTrace&) = delete;
+    ChromeTrace& operator=(const ChromeTrace&) = delete;
+
+    /// @brief Add the next trace of @p device, traces of a device must come in order
+    void add(uint32_t device, const Trace& trace);
+
+    /// @brief Events written
+    size_t events() const {
+      return events_;
+    }
+
+  private:
+    struct Device;
+
+    /// @brief Start an event, the caller writes its other fields and the closing brace
+    void begin(const char* ph, uint32_t pid, uint32_t tid, double us, const std::string& name);
+
+    FILE* out_;
+    size_t events_ = 0;
+    std::map<uint32_t, std::unique_ptr<Device>> devices_;
+  };
+
+  /// @brief Records of the deferred log of a device, sent by CommAPI::send_log(), see lib/dlog/dlog.h
+  struct Log {
+    struct Record {
+      uint16_t id = 0;  ///< offset of the format in the dlog_fmt section
+      std::vector<uint8_t> args;
+    };
+    uint32_t dropped = 0;  ///< records the device dropped before these
+    std::vector<Record> records;
+  };
+
+  /// @brief Decode a log, which starts after the command byte
+  /// @return bytes of the log, 0 if @p n bytes don't hold all of it yet, -1 if a CRC is wrong or the records are cut
+  int decode_log(const uint8_t* data, size_t n, Log& out);
+
+  /// @brief Format strings of the DLOG macros, from the ELF of the firmware
+  class LogFormats {
+  public:
+    /// @brief Read the dlog_fmt section of @p elf, false if the file or the section isn't there
+    bool load(const char* elf);
+
+    /// @brief Format a record like printf does
+    /// @details Without the format, the id and the arguments in hex. Missing arguments are printed as <?>
+    std::string expand(const Log::Record& record) const;
+
+  private:
+    std::vector<char> formats_;
+    size_t long_size_ = 4;  ///< of long, size_t and pointers on the device, 8 with an ELF64 of a host build
+  };
+
+  /// @brief Snapshot of the metrics of a device, sent by CommAPI::send_metrics(), see lib/metrics/metrics.h
+  struct Metrics {
+    enum Type : uint8_t { COUNTER = 1, GAUGE, HISTOGRAM };  ///< the same as metrics::Type
+
+    struct Metric {
+      uint8_t type = 0;
+      std::string name;                     ///< empty, if the device didn't send the names yet
+      int64_t value = 0;                    ///< of a counter or a gauge
+      uint32_t count = 0;                   ///< of a histogram
+      uint32_t max = 0;                     ///< of a histogram
+      std::map<uint8_t, uint32_t> buckets;  ///< counts of the buckets used
+    };
+
+    uint32_t ms = 0;     ///< time of the device
+    bool names = false;  ///< the names came with this snapshot
+    size_t frames = 0;   ///< of the values
+    std::vector<Metric> metrics;
+
+    /// @brief Smallest value in a histogram bucket, like metrics::Histogram::lower()
+    static uint32_t lower(unsigned bucket);
+
+    /// @brief Upper bound of the @p pct-th percentile of a histogram, not more than its maximum
+    static uint32_t percentile(const Metric& m, unsigned pct);
+  };
+
+  /// @brief Decode a snapshot, which starts after the command byte
+  /// @return bytes of the snapshot, 0 if @p n bytes don't hold all of it yet, -1 if a CRC is wrong or the values are cut
+  int decode_metrics(const uint8_t* data, size_t n, Metrics& out);
+
+  /// @brief Print a metric a line, histograms with their percentiles
+  void print_metrics(const Metrics& metrics, FILE* out);
+
+  /// @brief What the devices did since the previous Server::take_stats()
+  struct Stats {
+    /// @brief Transactions of one command, from its first byte to the end of the response, or the device's last ack
+    struct PerCommand {
+      uint32_t done = 0;
+      uint32_t failed = 0;       ///< a wrong CRC, an abort or a timeout
+      std::vector<uint32_t> us;  ///< time of each successful one
+    };
+    uint64_t frames_in = 0;  ///< commands, acks and payloads with a CRC
+    uint64_t frames_out = 0;
+    uint64_t bytes_in = 0;
+    uint64_t bytes_out = 0;
+    uint32_t crc_errors = 0;
+    uint32_t garbage = 0;  ///< bytes skipped, which didn't start a command
+    uint32_t timeouts = 0;
+    uint32_t echoes = 0;
+    uint32_t task_reports = 0;
+    uint32_t trace_records = 0;
+    uint32_t trace_lost = 0;  ///< records the devices overwrote before sending them
+    uint32_t log_lines = 0;
+    uint32_t log_dropped = 0;  ///< records the devices dropped with a full queue
+    uint32_t metric_snapshots = 0;
+    uint32_t ms = 0;  ///< of the interval
+    PerCommand commands[COMMANDS];
+  };
+
+  /// @brief Print frames per second, traffic and the latency percentiles of each command
+  void report(const Stats& stats, size_t devices, FILE* out);
+
+  /// @brief Serves every device from one thread
+  class Server {
+  public:
+    static inline constexpr uint32_t TIMEOUT_MS = 1000;  ///< a transaction or a frame without progress is dropped
+    static inline constexpr int TICK_MS = 5;             ///< the script and the timeouts are checked this often
+
+    explicit Server(Mixer& mixer);
+    ~Server();
+    Server(const Server&) = delete;
+    Server& operator=(const Server&) = delete;
+
+    /// @brief Serve the device on @p fd, the PC end of its link, made non-blocking. It isn't closed by the server
+    bool add(int fd);
+
+    size_t devices() const {
+      return devices_.size();
+    }
+
+    /// @brief Play @p events while running, their times start with run()
+    void set_script(std::vector<Event> events) {
+      script_ = std::move(events);
+    }
+
+    /// @brief Print what the devices send with ECHO, TASK_STATS, LOG and METRICS there, nothing if nullptr
+    void set_echo(FILE* out) {
+      echo_ = out;
+    }
+
+    /// @brief Write the traces of the devices there, nothing if nullptr
+    void set_trace(ChromeTrace* trace) {
+      trace_ = trace;
+    }
+
+    /// @brief Expand the logs of the devices with @p formats, their ids and arguments are printed if nullptr
+    void set_log_formats(const LogFormats* formats) {
+      log_formats_ = formats;
+    }
+
+    /// @brief Serve until @p ms passed, the script quits, or stop() is called
+    /// @param ms 0 for no end
+    /// @param report_ms print the stats this often to @p out, 0 for never
+    void run(uint32_t ms, uint32_t report_ms = 0, FILE* out = nullptr);
+
+    /// @brief End run() from another thread or a signal handler
+    void stop() {
+      stop_ = true;
+    }
+
+    /// @brief The stats since the previous call, call while run() doesn't
+    Stats take_stats();
+
+  private:
+    struct Device;
+
+    void receive(Device& d);
+    void serve(Device& d, uint64_t now);
+    void send(Device& d, const void* data, size_t n);
+    void flush(Device& d);
+    void play_script(uint32_t ms);
+    void finish(Device& d, bool ok, uint64_t now);
+    void send_sessions(Device& d, size_t offset, size_t n);
+
+    Mixer& mixer_;
+    int epoll_ = -1;
+    std::vector<std::unique_ptr<Device>> devices_;
+    std::vector<Event> script_;
+    size_t next_event_ = 0;
+    FILE* echo_ = nullptr;
+    ChromeTrace* trace_ = nullptr;
+    const LogFormats* log_formats_ = nullptr;
+    Stats stats_;
+    uint64_t stats_since_us_ = 0;
+    std::atomic<bool> stop_{ false };
+  };
+}  // namespace pc_server
@@ -0,0 +1,136 @@
+#ifdef PC_SERVER_MAIN
+  #include "pc_server.h"
+  #include <csignal>
+  #include <cstdlib>
+  #include <memory>
+  #include <fcntl.h>
+  #include <termios.h>
+  #include <unistd.h>
+
+namespace {
+  pc_server::Server* running = nullptr;
+
+  void usage() {
+    fprintf(stderr,
+            "usage: pc_server [-s sessions] [-S script] [-t seconds] [-r report seconds] [-e] [-T trace.json]\n"
+            "                 [-L firmware.elf] <tty>...\n"
+            "  serves every device on the given pseudo-terminals, see lib/pc_server/pc_server.h\n"
+            "  -s  programs besides the master volume, 8 by default\n"
+            "  -S  script of mixer changes\n"
+            "  -t  end after this many seconds, or the script quits\n"
+            "  -r  report the stats this often, 5 by default\n"
+            "  -e  print what the devices echo\n"
+            "  -T  write the RTOS traces of the devices as Chrome trace JSON, for ui.perfetto.dev\n"
+            "  -L  expand the DLOG lines of the devices with the format strings in this ELF, printed with -e\n");
+  }
+
+  /// @brief Open the PC end like the COM port of a board: raw, not blocking
+  int open_tty(const char* path) {
+    const int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0) {
+      return -1;
+    }
+    termios t;
+    if (tcgetattr(fd, &t) == 0) {
+      cfmakeraw(&t);
+      tcsetattr(fd, TCSANOW, &t);
+    }
+    return fd;
+  }
+}  // namespace
+
+int main(int argc, char** argv) {
+  unsigned sessions = 8, seconds = 0, report_s = 5;
+  const char* script = nullptr;
+  const char* trace_path = nullptr;
+  const char* elf = nullptr;
+  bool echo = false;
+  for (int opt; (opt = getopt(argc, argv, "s:S:t:r:eT:L:")) != -1;) {
+    switch (opt) {
+      case 's':
+        sessions = atoi(optarg);
+        break;
+      case 'S':
+        script = optarg;
+        break;
+      case 't':
+        seconds = atoi(optarg);
+        break;
+      case 'r':
+        report_s = atoi(optarg);
+        break;
+      case 'e':
+        echo = true;
+        break;
+      case 'T':
+        trace_path = optarg;
+        break;
+      case 'L':
+        elf = optarg;
+        break;
+      default:
+        usage();
+        return 2;
+    }
+  }
+  if (optind == argc) {
+    usage();
+    return 2;
+  }
+
+  pc_server::Mixer mixer(sessions);
+  pc_server::Server server(mixer);
+  if (script) {
+    FILE* f = fopen(script, "r");
+    if (not f) {
+      fprintf(stderr, "pc_server: can't open the script %s\n", script);
+      return 1;
+    }
+    auto events = pc_server::parse_script(f);
+    fclose(f);
+    if (events.empty()) {
+      return 1;
+    }
+    server.set_script(std::move(events));
+  }
+  server.set_echo(echo ? stdout : nullptr);
+
+  pc_server::LogFormats formats;
+  if (elf) {
+    if (not formats.load(elf)) {
+      fprintf(stderr, "pc_server: no DLOG format strings in %s\n", elf);
+      return 1;
+    }
+    server.set_log_formats(&formats);
+  }
+
+  // the trace ends its JSON array before the file is closed
+  std::unique_ptr<FILE, int (*)(FILE*)> trace_file(nullptr, fclose);
+  std::unique_ptr<pc_server::ChromeTrace> trace;
+  if (trace_path) {
+    trace_file.reset(fopen(trace_path, "w"));
+    if (not trace_file) {
+      fprintf(stderr, "pc_server: can't write %s\n", trace_path);
+      return 1;
+    }
+    trace = std::make_unique<pc_server::ChromeTrace>(trace_file.get());
+    server.set_trace(trace.get());
+  }
+
+  for (int i = optind; i < argc; ++i) {
+    const int fd = open_tty(argv[i]);
+    if (fd < 0 || not server.add(fd)) {
+      fprintf(stderr, "pc_server: can't open %s\n", argv[i]);
+      return 1;
+    }
+  }
+
+  // Ctrl+C prints the stats of the last interval
+  running = &server;
+  signal(SIGINT, [](int) { running->stop(); });
+  signal(SIGTERM, [](int) { running->stop(); });
+  server.run(seconds * 1000, report_s * 1000, stdout);
+  pc_server::report(server.take_stats(), server.devices(), stdout);
+  return 0;
+}
+#endif
@@ -0,0 +1,484 @@
+#ifdef TESTING
+  #include "pc_server.h"
+  #include "comm_api.h"
+  #include "comm_class.h"
+  #include "PTY_Adaptor.h"
+  #include "FreeRTOS.h"
+  #include "task.h"
+  #include "utils.h"
+  #include "rtos_trace.h"
+  #include "dlog.h"
+  #include "metrics.h"
+  #include "semphr.h"
+  #include "unity.h"
+  #include <csignal>
+  #include <fcntl.h>
+  #include <pthread.h>
+  #include <unistd.h>
+
+static CommClass uart;
+static CommAPI& api = CommAPI::get_instance();
+
+static void tx_task(void*) {
+  uart.set_tx_task(xTaskGetCurrentTaskHandle());
+  while (1) {
+    uart.send_task();
+  }
+}
+
+/// @brief The server in a thread of the host, serving CommAPI over a pseudo-terminal
+class Served {
+public:
+  Served(uint16_t programs, std::vector<pc_server::Event> script = {}) : mixer(programs), server(mixer) {
+    link.set_receive_cb([](const void* buff, size_t sz) { uart.receive(buff, sz); });
+    uart.set_hw_msg(&link);
+    uart.init();
+    pc_ = open(link.path(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    TEST_ASSERT_TRUE(server.add(pc_));
+    server.set_script(std::move(script));
+
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+    pthread_create(&thread_, nullptr, run, this);
+    pthread_sigmask(SIG_SETMASK, &old, nullptr);
+  }
+
+  /// @brief Stop the server, its mixer and stats may be read after
+  void stop() {
+    if (pc_ >= 0) {
+      server.stop();
+      pthread_join(thread_, nullptr);
+      link.deinit();
+      close(pc_);
+      pc_ = -1;
+    }
+  }
+
+  ~Served() {
+    stop();
+  }
+
+  pc_server::Mixer mixer;
+  pc_server::Server server;
+  PTY_Adaptor link;
+
+private:
+  static void* run(void* self) {
+    static_cast<Served*>(self)->server.run(0);
+    return nullptr;
+  }
+
+  int pc_ = -1;
+  pthread_t thread_{};
+};
+
+/// @brief Pixels of a palette RLE image, -1 if it's cut or malformed
+static int rle_pixels(const std::vector<uint8_t>& icon) {
+  if (icon.size() < 8 || icon[0] != 'R' || icon[1] != 'L') {
+    return -1;
+  }
+  const bool nibbles = icon[6] & 0x01;
+  size_t pos = 8 + 2 * (icon[7] + 1);
+  int pixels = 0;
+  while (pos < icon.size()) {
+    const uint8_t op = icon[pos++];
+    const int n = (op & 0x7F) + 1;
+    pos += op & 0x80 ? (nibbles ? (n + 1) / 2 : n) : 1;
+    pixels += n;
+  }
+  return pos == icon.size() ? pixels : -1;
+}
+
+void test_synthetic_icons() {
+  const auto a = pc_server::synthetic_icon(1);
+  TEST_ASSERT_EQUAL(32 * 32, rle_pixels(a));
+  TEST_ASSERT_EQUAL(32 * 32, rle_pixels(pc_server::synthetic_icon(-1)));
+  TEST_ASSERT_TRUE(a != pc_server::synthetic_icon(2));
+  TEST_ASSERT_TRUE(a == pc_server::synthetic_icon(1));
+}
+
+void test_parse_script() {
+  const char text[] = "# changes\n"
+                      "100 volume 2 80\n"
+                      "200 mute 2 1   # muted\n"
+                      "300 add game.exe\n"
+                      "400 storm 10 100\n"
+                      "450 remove 3\n"
+                      "900 quit\n";
+  FILE* f = fmemopen(const_cast<char*>(text), sizeof(text) - 1, "r");
+  const auto events = pc_server::parse_script(f);
+  fclose(f);
+
+  TEST_ASSERT_EQUAL(15, events.size());
+  TEST_ASSERT_EQUAL(pc_server::Event::VOLUME, events[0].action);
+  TEST_ASSERT_EQUAL(2, events[0].pid);
+  TEST_ASSERT_EQUAL(80, events[0].value);
+  TEST_ASSERT_EQUAL(pc_server::Event::MUTE, events[1].action);
+  TEST_ASSERT_EQUAL_STRING("game.exe", events[2].name.c_str());
+  // the storm is spread over its time, the removal is in between
+  for (size_t i = 1; i < events.size(); ++i) {
+    TEST_ASSERT_LESS_OR_EQUAL(events[i].ms, events[i - 1].ms);
+  }
+  TEST_ASSERT_EQUAL(pc_server::Event::REMOVE, events[9].action);
+  TEST_ASSERT_EQUAL(3, events[9].pid);
+  TEST_ASSERT_EQUAL(pc_server::Event::QUIT, events.back().action);
+
+  const char wrong[] = "100 louder 2\n";
+  f = fmemopen(const_cast<char*>(wrong), sizeof(wrong) - 1, "r");
+  TEST_ASSERT_TRUE(pc_server::parse_script(f).empty());
+  fclose(f);
+}
+
+void test_serve_sessions() {
+  Served s(7);
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_page(5, 5));
+  TEST_ASSERT_EQUAL(8, api.total_sessions());
+  const auto& volumes = api.get_volumes();
+  TEST_ASSERT_TRUE(volumes[2]);
+  TEST_ASSERT_FALSE(volumes[3]);
+  TEST_ASSERT_EQUAL(s.mixer.sessions()[6].pid, volumes[1]->pid_);
+  TEST_ASSERT_EQUAL_STRING(s.mixer.sessions()[6].name.c_str(), volumes[1]->name_);
+
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_volumes());
+  TEST_ASSERT_EQUAL(-1, volumes[0]->pid_);
+  TEST_ASSERT_EQUAL_STRING("chrome.exe", volumes[1]->name_);
+  TEST_ASSERT_EQUAL(1, api.changes());
+
+  s.stop();
+  const auto stats = s.server.take_stats();
+  TEST_ASSERT_EQUAL(1, stats.commands[pc_server::LOAD_PAGE].done);
+  TEST_ASSERT_EQUAL(1, stats.commands[pc_server::LOAD_ALL].done);
+  TEST_ASSERT_EQUAL(1, stats.commands[pc_server::QUERY_CHANGES].done);
+  TEST_ASSERT_EQUAL(0, stats.crc_errors + stats.garbage + stats.timeouts);
+}
+
+void test_serve_icon() {
+  Served s(3);
+  const auto* session = s.mixer.find(2);
+  CommAPI::ImageInfo info{};
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.image_info(2, info));
+  TEST_ASSERT_EQUAL_HEX32(session->hash, info.hash);
+  TEST_ASSERT_EQUAL(session->icon->size(), info.size);
+
+  static uint8_t icon[2048];
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_image(2, icon, sizeof(icon)));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(session->icon->data(), icon, info.size);
+
+  s.stop();
+  const auto stats = s.server.take_stats();
+  TEST_ASSERT_EQUAL(1, stats.commands[pc_server::READ_IMG].done);
+  TEST_ASSERT_EQUAL(1, stats.commands[pc_server::IMAGE_INFO].done);
+}
+
+void test_serve_changes() {
+  // the script changes a session, the device changes another one
+  pc_server::Event change{ pc_server::Event::VOLUME, 100, 1, 33 };
+  Served s(3, { change });
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_volumes());
+  TEST_ASSERT_EQUAL(1, api.changes());
+
+  unsigned polls = 0;
+  while (api.changes() != 0 && polls++ < 100) {
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  TEST_ASSERT_LESS_THAN(100, polls);
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_volumes());
+  TEST_ASSERT_EQUAL(33, api.get_volumes()[1]->volume_);
+  TEST_ASSERT_EQUAL(1, api.changes());
+
+  // not reported back to the device, which made it
+  api.set_volume(2, 77);
+  api.set_mute(3, true);
+  vTaskDelay(pdMS_TO_TICKS(50));
+  TEST_ASSERT_EQUAL(1, api.changes());
+  s.stop();
+  TEST_ASSERT_EQUAL(77, s.mixer.find(2)->volume);
+  TEST_ASSERT_TRUE(s.mixer.find(3)->muted);
+}
+
+void test_serve_garbage() {
+  Served s(3);
+  // noise on the line, then a cut frame, the server finds the next command
+  const uint8_t noise[] = { 0x55, 0xAA, 0x00, 0x03, 0x01 };
+  TEST_ASSERT_EQUAL(sizeof(noise), s.link.transmit(noise, sizeof(noise)));
+  vTaskDelay(pdMS_TO_TICKS(pc_server::Server::TIMEOUT_MS + 100));
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_volumes());
+
+  s.stop();
+  const auto stats = s.server.take_stats();
+  TEST_ASSERT_GREATER_OR_EQUAL(3, stats.garbage);
+  TEST_ASSERT_EQUAL(1, stats.commands[pc_server::LOAD_ALL].done);
+}
+
+void test_serve_task_stats() {
+  Served s(3);
+  char* text = nullptr;
+  size_t len = 0;
+  FILE* out = open_memstream(&text, &len);
+  s.server.set_echo(out);
+
+  task_stats::Report report;
+  report.interval_us = 5000000;
+  report.idle_permille = 874;
+  report.n = 2;
+  report.tasks[0] = { "GFX", 3, 10, eBlocked, 120, 600000, 87 };
+  report.tasks[1] = { "IDLE", 1, 0, eReady, 874, 4370000, 35 };
+  api.report_tasks(report);
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_volumes());
+
+  s.stop();
+  fclose(out);
+  const auto stats = s.server.take_stats();
+  TEST_ASSERT_EQUAL(1, stats.task_reports);
+  TEST_ASSERT_EQUAL(0, stats.crc_errors + stats.garbage);
+  // the busiest first
+  TEST_ASSERT_NOT_NULL(strstr(text, "idle 87.4 %"));
+  const char* idle = strstr(text, "IDLE");
+  const char* gfx = strstr(text, "GFX");
+  TEST_ASSERT_TRUE(idle && gfx && idle < gfx);
+  TEST_ASSERT_NOT_NULL(strstr(gfx, "prio 10 blocked    12.0 %   600000 us, stack free 87"));
+  free(text);
+
+  // a wrong CRC in a task frame
+  std::vector<uint8_t> frame = { 0x10, 0, 0, 0, 0, 0, 1 };
+  const uint32_t crc = utils::crc32mpeg2(frame.data(), frame.size());
+  frame.insert(frame.end(), reinterpret_cast<const uint8_t*>(&crc), reinterpret_cast<const uint8_t*>(&crc) + 4);
+  pc_server::TaskStats decoded;
+  TEST_ASSERT_EQUAL(0, pc_server::decode_task_stats(frame.data(), frame.size(), decoded));
+  frame.insert(frame.end(), { 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 'x', 0, 0, 0, 0 });
+  TEST_ASSERT_EQUAL(-1, pc_server::decode_task_stats(frame.data(), frame.size(), decoded));
+  TEST_ASSERT_EQUAL(0x10, decoded.interval_us);
+}
+
+void test_chrome_trace() {
+  // 1 kHz, so the times are in ms
+  pc_server::Trace trace;
+  using T = pc_server::Trace;
+  trace.clock_hz = 1000;
+  trace.names[{ T::TASK, 2 }] = { 10, "GFX" };
+  trace.names[{ T::TASK, 3 }] = { 9, "uart" };
+  trace.names[{ T::OBJECT, 1 }] = { 0, "GUI serial" };
+  trace.names[{ T::MARKER, 1 }] = { 0, "USB ISR" };
+  trace.records = { { 100, 2, T::TASK_SWITCHED_IN, 10 },  { 102, 1, T::QUEUE_BLOCK_RECEIVE, 0 },
+                    { 103, 3, T::TASK_SWITCHED_IN, 9 },   { 104, 1, T::ISR_ENTER, 0 },
+                    { 105, 1, T::QUEUE_SEND_FROM_ISR, 0 }, { 105, 2, T::TASK_READY, 0 },
+                    { 106, 1, T::ISR_EXIT, 0 },           { 106, 2, T::TASK_SWITCHED_IN, 10 },
+                    { 107, 1, T::QUEUE_RECEIVE, 1 } };
+
+  char* text = nullptr;
+  size_t len = 0;
+  FILE* out = open_memstream(&text, &len);
+  {
+    pc_server::ChromeTrace chrome(out);
+    chrome.add(0, trace);
+    // the next trace lost records, then the clock wraps
+    pc_server::Trace next;
+    next.clock_hz = 1000;
+    next.lost = 12;
+    next.records = { { 0x7FFFFFF0, 3, T::TASK_SWITCHED_IN, 9 },
+                     { 0xFFFFFF00, 2, T::TASK_SWITCHED_IN, 10 },
+                     { 0x10, 3, T::TASK_SWITCHED_IN, 9 } };
+    chrome.add(0, next);
+  }
+  fclose(out);
+
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"tid\":2,\"ts\":0.000,\"name\":\"thread_name\",\"args\":{\"name\":\"GFX (10)\"}"));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"ph\":\"X\",\"pid\":1,\"tid\":2,\"ts\":0.000,\"name\":\"GFX\",\"dur\":3000.000"));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"tid\":2,\"ts\":2000.000,\"name\":\"wait GUI serial\",\"dur\":4000.000"));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"tid\":1001,\"ts\":4000.000,\"name\":\"USB ISR\",\"dur\":2000.000"));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"tid\":1001,\"ts\":5000.000,\"name\":\"send GUI serial\""));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"name\":\"lost 12 records\""));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"tid\":2,\"ts\":4294966940000.000,\"name\":\"GFX\",\"dur\":272000.000"));
+  TEST_ASSERT_EQUAL_STRING("\n]\n", text + len - 3);
+  free(text);
+}
+
+  #ifdef RTOS_TRACE
+void test_serve_trace() {
+  Served s(3);
+  char* text = nullptr;
+  size_t len = 0;
+  FILE* out = open_memstream(&text, &len);
+  auto chrome = std::make_unique<pc_server::ChromeTrace>(out);
+  s.server.set_trace(chrome.get());
+
+  SemaphoreHandle_t lock = xSemaphoreCreateMutex();
+  rtos_trace_name_object(lock, "test lock");
+  const uint16_t frame = rtos_trace_marker("test frame");
+  rtos_trace_clear();
+  rtos_trace_begin(frame, 1);
+  xSemaphoreTake(lock, 0);
+  xSemaphoreGive(lock);
+  rtos_trace_end(frame, 1);
+  static rtos_trace_record_t records[64];
+  uint32_t lost = 0;
+  const size_t n = rtos_trace_read(records, std::size(records), &lost);
+  api.send_trace(records, n, 0, true);
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_volumes());
+  vSemaphoreDelete(lock);
+
+  s.stop();
+  chrome.reset();
+  fclose(out);
+  const auto stats = s.server.take_stats();
+  TEST_ASSERT_EQUAL(n, stats.trace_records);
+  TEST_ASSERT_EQUAL(1, stats.commands[pc_server::TRACE].done);
+  TEST_ASSERT_EQUAL(0, stats.crc_errors + stats.garbage);
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"name\":\"process_name\",\"args\":{\"name\":\"device 0\"}"));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"name\":\"take test lock\",\"s\":\"t\",\"args\":{\"items\":1}"));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"name\":\"give test lock\",\"s\":\"t\",\"args\":{\"items\":0}"));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"ph\":\"b\""));
+  TEST_ASSERT_NOT_NULL(strstr(text, "\"name\":\"test frame\",\"cat\":\"marker\""));
+  free(text);
+
+  // a wrong CRC in a record frame
+  std::vector<uint8_t> head = { 0xE8, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0 };
+  const uint32_t crc = utils::crc32mpeg2(head.data(), head.size());
+  head.insert(head.end(), reinterpret_cast<const uint8_t*>(&crc), reinterpret_cast<const uint8_t*>(&crc) + 4);
+  pc_server::Trace decoded;
+  TEST_ASSERT_EQUAL(0, pc_server::decode_trace(head.data(), head.size(), decoded));
+  head.insert(head.end(), { 1, 2, 3, 4, 5, 6, 7, 8, 0, 0, 0, 0 });
+  TEST_ASSERT_EQUAL(-1, pc_server::decode_trace(head.data(), head.size(), decoded));
+  TEST_ASSERT_EQUAL(1000, decoded.clock_hz);
+}
+  #endif
+
+void test_serve_log() {
+  Served s(3);
+  char* text = nullptr;
+  size_t len = 0;
+  FILE* out = open_memstream(&text, &len);
+  s.server.set_echo(out);
+  // the test is its own firmware
+  pc_server::LogFormats formats;
+  TEST_ASSERT_TRUE(formats.load("/proc/self/exe"));
+  s.server.set_log_formats(&formats);
+
+  static uint8_t records[dlog::QUEUE_SZ];
+  uint32_t dropped;
+  dlog::read(records, sizeof(records), &dropped);
+  DLOG("log test %s: %d %u 0x%x %c", "pc", -5, 7u, 0xBEEFu, 'z');
+  DLOG("log test %lld %zu %.2f %5.1f%% %*d|", -1234567890123LL, sizeof(uint64_t), 3.14159, 2.5f, 4, 12);
+  // more than a frame of records
+  for (int i = 0; i < 4; ++i) {
+    DLOG("log test line %d of %s", i, "a string longer than thirty two characters");
+  }
+  const size_t n = dlog::read(records, sizeof(records), &dropped);
+  TEST_ASSERT_GREATER_THAN(CommAPI::LOG_CHUNK, n);
+  api.send_log(records, n, 3);
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_volumes());
+
+  s.stop();
+  fclose(out);
+  const auto stats = s.server.take_stats();
+  TEST_ASSERT_EQUAL(6, stats.log_lines);
+  TEST_ASSERT_EQUAL(3, stats.log_dropped);
+  TEST_ASSERT_EQUAL(1, stats.commands[pc_server::LOG].done);
+  TEST_ASSERT_EQUAL(0, stats.crc_errors + stats.garbage);
+  TEST_ASSERT_NOT_NULL(strstr(text, ": 3 log records dropped\n"));
+  TEST_ASSERT_NOT_NULL(strstr(text, ": log test pc: -5 7 0xbeef z\n"));
+  TEST_ASSERT_NOT_NULL(strstr(text, ": log test -1234567890123 8 3.14   2.5%   12|\n"));
+  TEST_ASSERT_NOT_NULL(strstr(text, ": log test line 3 of a string longer than thirty two \n"));
+  free(text);
+
+  // without the formats, and with arguments missing
+  pc_server::Log::Record record;
+  record.id = 0xFFFF;
+  record.args = { 1, 0xAB };
+  TEST_ASSERT_EQUAL_STRING("dlog 65535: 01 ab", pc_server::LogFormats().expand(record).c_str());
+  __attribute__((section("dlog_fmt"), used)) static const char fmt[] = "log test %d %d";
+  record.id = dlog::id(fmt);
+  record.args = { 1, 0, 0, 0 };
+  TEST_ASSERT_EQUAL_STRING("log test 1 <?>", formats.expand(record).c_str());
+
+  // a record cut by the frames, and a wrong CRC
+  std::vector<uint8_t> head = { 0, 0, 0, 0, 4, 0 };
+  uint32_t crc = utils::crc32mpeg2(head.data(), head.size());
+  head.insert(head.end(), reinterpret_cast<const uint8_t*>(&crc), reinterpret_cast<const uint8_t*>(&crc) + 4);
+  pc_server::Log decoded;
+  TEST_ASSERT_EQUAL(0, pc_server::decode_log(head.data(), head.size(), decoded));
+  std::vector<uint8_t> frame = head;
+  const uint8_t cut[] = { 1, 0, 2, 9 };
+  crc = utils::crc32mpeg2(cut, sizeof(cut));
+  frame.insert(frame.end(), cut, cut + sizeof(cut));
+  frame.insert(frame.end(), reinterpret_cast<const uint8_t*>(&crc), reinterpret_cast<const uint8_t*>(&crc) + 4);
+  TEST_ASSERT_EQUAL(-1, pc_server::decode_log(frame.data(), frame.size(), decoded));
+  frame[frame.size() - 1] ^= 1;
+  TEST_ASSERT_EQUAL(-1, pc_server::decode_log(frame.data(), frame.size(), decoded));
+}
+
+void test_serve_metrics() {
+  Served s(3);
+  char* text = nullptr;
+  size_t len = 0;
+  FILE* out = open_memstream(&text, &len);
+  s.server.set_echo(out);
+
+  // the names come only with the first
+  api.send_metrics(1234, true);
+  api.send_metrics(2000, false);
+  TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_volumes());
+
+  s.stop();
+  fclose(out);
+  const auto stats = s.server.take_stats();
+  TEST_ASSERT_EQUAL(2, stats.metric_snapshots);
+  TEST_ASSERT_EQUAL(2, stats.commands[pc_server::METRICS].done);
+  TEST_ASSERT_EQUAL(0, stats.crc_errors + stats.garbage);
+  TEST_ASSERT_NOT_NULL(strstr(text, "metrics at 1234 ms\n"));
+  const char* second = strstr(text, "metrics at 2000 ms\n");
+  TEST_ASSERT_NOT_NULL(second);
+  TEST_ASSERT_NOT_NULL(strstr(second, "  comm.crc_errors"));
+  TEST_ASSERT_NOT_NULL(strstr(second, "  comm.rtt_us          histogram n="));
+  TEST_ASSERT_NOT_NULL(strstr(second, "  gui.frame_us"));
+  free(text);
+
+  // the percentiles are the upper bounds of the buckets, the open one ends at the maximum
+  pc_server::Metrics::Metric m;
+  m.type = pc_server::Metrics::HISTOGRAM;
+  m.count = 10;
+  m.max = 700;
+  m.buckets = { { metrics::Histogram::bucket(5), 1 }, { metrics::Histogram::bucket(100), 8 },
+                { metrics::Histogram::bucket(700), 1 } };
+  TEST_ASSERT_EQUAL(5, pc_server::Metrics::percentile(m, 10));
+  TEST_ASSERT_EQUAL(metrics::Histogram::lower(metrics::Histogram::bucket(100) + 1) - 1,
+                    pc_server::Metrics::percentile(m, 50));
+  TEST_ASSERT_EQUAL(700, pc_server::Metrics::percentile(m, 99));
+  for (unsigned b = 0; b < metrics::Histogram::BUCKETS; ++b) {
+    TEST_ASSERT_EQUAL(metrics::Histogram::lower(b), pc_server::Metrics::lower(b));
+  }
+
+  // values cut in the middle of a histogram
+  std::vector<uint8_t> frame = { 0, 0, 0, 0, 1, 0, 0 };
+  uint32_t crc = utils::crc32mpeg2(frame.data(), frame.size());
+  frame.insert(frame.end(), reinterpret_cast<const uint8_t*>(&crc), reinterpret_cast<const uint8_t*>(&crc) + 4);
+  pc_server::Metrics decoded;
+  TEST_ASSERT_EQUAL(0, pc_server::decode_metrics(frame.data(), frame.size(), decoded));
+  const uint8_t values[] = { 6, 0, pc_server::Metrics::HISTOGRAM, 1, 0, 0, 0, 5 };
+  crc = utils::crc32mpeg2(values, sizeof(values));
+  frame.insert(frame.end(), values, values + sizeof(values));
+  frame.insert(frame.end(), reinterpret_cast<const uint8_t*>(&crc), reinterpret_cast<const uint8_t*>(&crc) + 4);
+  TEST_ASSERT_EQUAL(-1, pc_server::decode_metrics(frame.data(), frame.size(), decoded));
+}
+
+void pc_server_tests() {
+  api.init(&uart);
+  xTaskCreate(tx_task, "uart", 256, nullptr, 11, nullptr);
+
+  RUN_TEST(test_synthetic_icons);
+  RUN_TEST(test_parse_script);
+  RUN_TEST(test_serve_sessions);
+  RUN_TEST(test_serve_icon);
+  RUN_TEST(test_serve_changes);
+  RUN_TEST(test_serve_garbage);
+  RUN_TEST(test_serve_task_stats);
+  RUN_TEST(test_chrome_trace);
+  #ifdef RTOS_TRACE
+  RUN_TEST(test_serve_trace);
+  #endif
+  RUN_TEST(test_serve_log);
+  RUN_TEST(test_serve_metrics);
+}
+
+#endif
@@ -287,6 +287,7 @@ namespace pin_api {
       default:
         break;
     }
+    init_clock_for_gpio(pin);
     HAL_GPIO_Init(pin_name_to_port(pin), &gpio);
   }
 
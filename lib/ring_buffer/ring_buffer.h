@@ -6,6 +6,7 @@
 #pragma once
 #include "passert.h"
 #include <cstdint>
+#include <cstddef>
 #include <array>
 
 #ifdef TESTING
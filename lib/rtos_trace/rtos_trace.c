@@ -0,0 +1,173 @@
+#include "rtos_trace.h"
+
+#ifdef RTOS_TRACE
+  #include <string.h>
+  #include "FreeRTOS.h"
+  #include "queue.h"
+
+  #ifdef NATIVE
+    #include <signal.h>
+    #include <pthread.h>
+
+/* the ticks of the POSIX port are signals, the kernel blocks them for its critical sections. The threads of the host
+ * links record too, they run in parallel */
+static uint8_t host_lock = 0;
+    #define TRACE_LOCK()                                            \
+      sigset_t all_signals, old_signals;                            \
+      sigfillset(&all_signals);                                     \
+      pthread_sigmask(SIG_BLOCK, &all_signals, &old_signals);       \
+      while (__atomic_test_and_set(&host_lock, __ATOMIC_ACQUIRE)) { \
+      }
+    #define TRACE_UNLOCK()                                 \
+      __atomic_clear(&host_lock, __ATOMIC_RELEASE);        \
+      pthread_sigmask(SIG_SETMASK, &old_signals, NULL)
+    #define TRACE_CLOCK() ((uint32_t)ullRunTimeClock())
+  #else
+    #define TRACE_LOCK()   const UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR()
+    #define TRACE_UNLOCK() portCLEAR_INTERRUPT_MASK_FROM_ISR(mask)
+    #define TRACE_CLOCK()  (*(volatile uint32_t*)0xE0001004UL) /* DWT CYCCNT, the run time clock */
+  #endif
+
+_Static_assert((RTOS_TRACE_RECORDS & (RTOS_TRACE_RECORDS - 1)) == 0, "RTOS_TRACE_RECORDS must be a power of two");
+_Static_assert(sizeof(rtos_trace_record_t) == 8, "records are sent as they are");
+
+typedef struct {
+  const char* name;
+  uint8_t type;
+  uint8_t created;
+} trace_object_t;
+
+static rtos_trace_record_t ring[RTOS_TRACE_RECORDS];
+static uint32_t head = 0;  ///< records written, claimed atomically
+static uint32_t tail = 0;  ///< records read
+static volatile uint8_t enabled = 1;
+
+static char task_names[RTOS_TRACE_TASKS][configMAX_TASK_NAME_LEN];
+static uint8_t task_priorities[RTOS_TRACE_TASKS];
+static trace_object_t objects[RTOS_TRACE_OBJECTS];
+static uint16_t n_objects = 0;
+static const char* markers[RTOS_TRACE_MARKERS];
+static uint32_t names_changed = 0;
+
+void rtos_trace_event(uint8_t event, uint16_t arg, uint8_t info) {
+  if (!enabled) {
+    return;
+  }
+  // masked for the kernel and its ISRs, the slot is claimed atomically for the ISRs above them
+  TRACE_LOCK();
+  const uint32_t i = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED);
+  rtos_trace_record_t* r = &ring[i & (RTOS_TRACE_RECORDS - 1)];
+  r->time = TRACE_CLOCK();
+  r->arg = arg;
+  r->event = event;
+  r->info = info;
+  TRACE_UNLOCK();
+}
+
+void rtos_trace_enable(uint8_t on) {
+  enabled = on;
+}
+
+void rtos_trace_task_created(uint16_t number, const char* name, uint8_t priority) {
+  if (number < RTOS_TRACE_TASKS) {
+    strncpy(task_names[number], name, configMAX_TASK_NAME_LEN - 1);
+    task_priorities[number] = priority;
+    __atomic_add_fetch(&names_changed, 1, __ATOMIC_RELAXED);
+  }
+  rtos_trace_event(RTOS_TRACE_TASK_CREATE, number, priority);
+}
+
+uint16_t rtos_trace_object_created(uint8_t type) {
+  // queues are created by tasks, the kernel holds no lock here
+  const uint16_t number = __atomic_add_fetch(&n_objects, 1, __ATOMIC_RELAXED);
+  if (number < RTOS_TRACE_OBJECTS) {
+    objects[number].type = type;
+    objects[number].created = 1;
+    __atomic_add_fetch(&names_changed, 1, __ATOMIC_RELAXED);
+  }
+  rtos_trace_event(RTOS_TRACE_QUEUE_CREATE, number, type);
+  return number;
+}
+
+uint16_t rtos_trace_marker(const char* name) {
+  // lock free, ISRs of any priority may name their marker
+  for (uint16_t id = 1; id < RTOS_TRACE_MARKERS; ++id) {
+    const char* expected = NULL;
+    if (__atomic_compare_exchange_n(&markers[id], &expected, name, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+      __atomic_add_fetch(&names_changed, 1, __ATOMIC_RELAXED);
+      return id;
+    }
+    if (expected == name) {
+      return id;
+    }
+  }
+  return 0;
+}
+
+void rtos_trace_name_object(void* queue, const char* name) {
+  const UBaseType_t number = uxQueueGetQueueNumber(queue);
+  if (number < RTOS_TRACE_OBJECTS) {
+    objects[number].name = name;
+    __atomic_add_fetch(&names_changed, 1, __ATOMIC_RELAXED);
+  }
+}
+
+uint32_t rtos_trace_names_changed(void) {
+  return __atomic_load_n(&names_changed, __ATOMIC_RELAXED);
+}
+
+const char* rtos_trace_name(rtos_trace_name_t table, uint16_t id, uint8_t* info) {
+  switch (table) {
+    case RTOS_TRACE_NAME_TASK:
+      if (id < RTOS_TRACE_TASKS && task_names[id][0]) {
+        *info = task_priorities[id];
+        return task_names[id];
+      }
+      break;
+    case RTOS_TRACE_NAME_OBJECT:
+      if (id < RTOS_TRACE_OBJECTS && objects[id].created) {
+        *info = objects[id].type;
+        return objects[id].name ? objects[id].name : "";
+      }
+      break;
+    case RTOS_TRACE_NAME_MARKER:
+      if (id < RTOS_TRACE_MARKERS && markers[id]) {
+        *info = 0;
+        return markers[id];
+      }
+      break;
+  }
+  return NULL;
+}
+
+size_t rtos_trace_read(rtos_trace_record_t* out, size_t max, uint32_t* lost) {
+  TRACE_LOCK();
+  const uint32_t written = __atomic_load_n(&head, __ATOMIC_RELAXED);
+  *lost = 0;
+  if (written - tail > RTOS_TRACE_RECORDS) {
+    *lost = written - tail - RTOS_TRACE_RECORDS;
+    tail = written - RTOS_TRACE_RECORDS;
+  }
+  size_t n = written - tail;
+  if (n > max) {
+    n = max;
+  }
+  const size_t first = tail & (RTOS_TRACE_RECORDS - 1);
+  const size_t until_end = RTOS_TRACE_RECORDS - first;
+  if (n <= until_end) {
+    memcpy(out, &ring[first], n * sizeof(*out));
+  } else {
+    memcpy(out, &ring[first], until_end * sizeof(*out));
+    memcpy(out + until_end, ring, (n - until_end) * sizeof(*out));
+  }
+  tail += n;
+  TRACE_UNLOCK();
+  return n;
+}
+
+void rtos_trace_clear(void) {
+  TRACE_LOCK();
+  tail = __atomic_load_n(&head, __ATOMIC_RELAXED);
+  TRACE_UNLOCK();
+}
+#endif
@@ -0,0 +1,127 @@
+/**
+ * @file rtos_trace.h
+ * @brief Binary trace of the RTOS events: task switches, queue and semaphore operations, notifications, ISRs and
+ * user markers
+ * @details Plain C, the kernel calls it from its trace hooks, see rtos_trace_hooks.h. Only builds with `RTOS_TRACE`
+ * defined have the tracer, elsewhere the markers are empty. Every event is a record of 8 bytes in a RAM ring. When the
+ * ring is full, the oldest records are overwritten and counted as lost. CommAPI::send_trace() drains it to the PC, and
+ * the PC server writes Chrome trace JSON, which chrome://tracing and ui.perfetto.dev open.
+ *
+ * The time of a record is the low 32 bits of the run time clock of FreeRTOS: cycles on the board, nanoseconds on the
+ * host. The decoder unwraps it, so records must not be further apart than half a wrap, 12 s at 168 MHz.
+ */
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(TESTING) && defined(__cplusplus)
+void rtos_trace_tests();
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef RTOS_TRACE_RECORDS
+  #define RTOS_TRACE_RECORDS 1024  ///< records in the ring, a power of two
+#endif
+#define RTOS_TRACE_TASKS   16  ///< tasks with a name, by their number
+#define RTOS_TRACE_OBJECTS 32  ///< queues, semaphores and mutexes with a type and maybe a name
+#define RTOS_TRACE_MARKERS 16  ///< names of markers and ISRs
+
+/// @brief Event of a record, what its arg and info are
+typedef enum {
+  RTOS_TRACE_TASK_SWITCHED_IN = 1,    ///< task, its priority
+  RTOS_TRACE_TASK_READY,              ///< task which became ready
+  RTOS_TRACE_TASK_CREATE,             ///< task, its priority
+  RTOS_TRACE_TASK_DELETE,             ///< task
+  RTOS_TRACE_TASK_DELAY,              ///< the running task, it sleeps
+  RTOS_TRACE_QUEUE_CREATE,            ///< object, queueQUEUE_TYPE_*
+  RTOS_TRACE_QUEUE_SEND,              ///< object, items before. A give of a semaphore
+  RTOS_TRACE_QUEUE_SEND_FAILED,       ///< object, items
+  RTOS_TRACE_QUEUE_BLOCK_SEND,        ///< object, items. The running task waits for space
+  RTOS_TRACE_QUEUE_RECEIVE,           ///< object, items before. A take of a semaphore
+  RTOS_TRACE_QUEUE_RECEIVE_FAILED,    ///< object, items
+  RTOS_TRACE_QUEUE_BLOCK_RECEIVE,     ///< object, items. The running task waits for an item, or a mutex
+  RTOS_TRACE_QUEUE_SEND_FROM_ISR,     ///< object, items before
+  RTOS_TRACE_QUEUE_RECEIVE_FROM_ISR,  ///< object, items before
+  RTOS_TRACE_NOTIFY,                  ///< task notified, index
+  RTOS_TRACE_NOTIFY_FROM_ISR,         ///< task notified, index
+  RTOS_TRACE_NOTIFY_BLOCK,            ///< the running task, index. It waits for a notification
+  RTOS_TRACE_ISR_ENTER,               ///< marker
+  RTOS_TRACE_ISR_EXIT,                ///< marker
+  RTOS_TRACE_MARK,                    ///< marker, a value
+  RTOS_TRACE_BEGIN,                   ///< marker, a value. Starts a span of the running task
+  RTOS_TRACE_END,                     ///< marker, a value
+} rtos_trace_event_t;
+
+/// @brief One event, sent to the PC as it is, little endian
+typedef struct {
+  uint32_t time;  ///< low bits of the run time clock
+  uint16_t arg;   ///< task number, object number or marker
+  uint8_t event;  ///< rtos_trace_event_t
+  uint8_t info;
+} rtos_trace_record_t;
+
+/// @brief Tables of names
+typedef enum {
+  RTOS_TRACE_NAME_TASK,
+  RTOS_TRACE_NAME_OBJECT,
+  RTOS_TRACE_NAME_MARKER,
+} rtos_trace_name_t;
+
+#ifdef RTOS_TRACE
+/// @brief Record an event, from a task, an ISR, or with the scheduler suspended
+/// @details Lock free against the ISRs above the kernel priority, like the USB one
+void rtos_trace_event(uint8_t event, uint16_t arg, uint8_t info);
+
+/// @brief Pause or resume recording, it's on from the start
+void rtos_trace_enable(uint8_t on);
+
+/// @brief Name for markers and ISRs, also from ISRs
+/// @param name kept, not copied
+/// @return its id, the same for the same pointer, 0 if the table is full
+uint16_t rtos_trace_marker(const char* name);
+
+/// @brief Name a queue, semaphore or mutex
+/// @param name kept, not copied
+void rtos_trace_name_object(void* queue, const char* name);
+
+/// @brief Counts the names added, so they are only sent to the PC when there are new ones
+uint32_t rtos_trace_names_changed(void);
+
+/// @brief Name in a table, and its info: the priority of a task, the type of an object
+/// @return nullptr if there is none, "" for an object without a name
+const char* rtos_trace_name(rtos_trace_name_t table, uint16_t id, uint8_t* info);
+
+/// @brief Move the oldest records to @p out
+/// @param lost set to the records overwritten since the previous read
+/// @return records moved
+size_t rtos_trace_read(rtos_trace_record_t* out, size_t max, uint32_t* lost);
+
+/// @brief Drop every record, for tests and benchmarks
+void rtos_trace_clear(void);
+
+  #define rtos_trace_mark(marker, value)  rtos_trace_event(RTOS_TRACE_MARK, (marker), (value))
+  #define rtos_trace_begin(marker, value) rtos_trace_event(RTOS_TRACE_BEGIN, (marker), (value))
+  #define rtos_trace_end(marker, value)   rtos_trace_event(RTOS_TRACE_END, (marker), (value))
+  #define rtos_trace_isr_enter(marker)    rtos_trace_event(RTOS_TRACE_ISR_ENTER, (marker), 0)
+  #define rtos_trace_isr_exit(marker)     rtos_trace_event(RTOS_TRACE_ISR_EXIT, (marker), 0)
+
+/// @brief Called by the hooks
+void rtos_trace_task_created(uint16_t number, const char* name, uint8_t priority);
+uint16_t rtos_trace_object_created(uint8_t type);
+#else
+  #define rtos_trace_marker(name)             ((uint16_t)0)
+  #define rtos_trace_name_object(queue, name) ((void)0)
+  #define rtos_trace_mark(marker, value)      ((void)0)
+  #define rtos_trace_begin(marker, value)     ((void)0)
+  #define rtos_trace_end(marker, value)       ((void)0)
+  #define rtos_trace_isr_enter(marker)        ((void)0)
+  #define rtos_trace_isr_exit(marker)         ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,40 @@
+/* The trace hooks of FreeRTOS, included by FreeRTOSConfig.h when RTOS_TRACE is defined. They are expanded in tasks.c
+ * and queue.c, where the TCB and the queue are known */
+#pragma once
+#include "rtos_trace.h"
+
+#define traceTASK_SWITCHED_IN() \
+  rtos_trace_event(RTOS_TRACE_TASK_SWITCHED_IN, pxCurrentTCB->uxTCBNumber, pxCurrentTCB->uxPriority)
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB) rtos_trace_event(RTOS_TRACE_TASK_READY, (pxTCB)->uxTCBNumber, 0)
+#define traceTASK_CREATE(pxNewTCB) \
+  rtos_trace_task_created((pxNewTCB)->uxTCBNumber, (pxNewTCB)->pcTaskName, (pxNewTCB)->uxPriority)
+#define traceTASK_DELETE(pxTCB)             rtos_trace_event(RTOS_TRACE_TASK_DELETE, (pxTCB)->uxTCBNumber, 0)
+#define traceTASK_DELAY()                   rtos_trace_event(RTOS_TRACE_TASK_DELAY, pxCurrentTCB->uxTCBNumber, 0)
+#define traceTASK_DELAY_UNTIL(xTimeToWake)  rtos_trace_event(RTOS_TRACE_TASK_DELAY, pxCurrentTCB->uxTCBNumber, 0)
+
+/* the number of a queue is only used for tracing, every queue gets its own */
+#define traceQUEUE_CREATE(pxNewQueue) \
+  ((pxNewQueue)->uxQueueNumber = rtos_trace_object_created((pxNewQueue)->ucQueueType))
+#define RTOS_TRACE_QUEUE(event, pxQueue) \
+  rtos_trace_event((event), (pxQueue)->uxQueueNumber, (pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_SEND(pxQueue)                   RTOS_TRACE_QUEUE(RTOS_TRACE_QUEUE_SEND, pxQueue)
+#define traceQUEUE_SEND_FAILED(pxQueue)            RTOS_TRACE_QUEUE(RTOS_TRACE_QUEUE_SEND_FAILED, pxQueue)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)       RTOS_TRACE_QUEUE(RTOS_TRACE_QUEUE_BLOCK_SEND, pxQueue)
+#define traceQUEUE_RECEIVE(pxQueue)                RTOS_TRACE_QUEUE(RTOS_TRACE_QUEUE_RECEIVE, pxQueue)
+#define traceQUEUE_RECEIVE_FAILED(pxQueue)         RTOS_TRACE_QUEUE(RTOS_TRACE_QUEUE_RECEIVE_FAILED, pxQueue)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)    RTOS_TRACE_QUEUE(RTOS_TRACE_QUEUE_BLOCK_RECEIVE, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)          RTOS_TRACE_QUEUE(RTOS_TRACE_QUEUE_SEND_FROM_ISR, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue)   RTOS_TRACE_QUEUE(RTOS_TRACE_QUEUE_SEND_FAILED, pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)       RTOS_TRACE_QUEUE(RTOS_TRACE_QUEUE_RECEIVE_FROM_ISR, pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED(pxQueue) RTOS_TRACE_QUEUE(RTOS_TRACE_QUEUE_RECEIVE_FAILED, pxQueue)
+
+#define traceTASK_NOTIFY(uxIndexToNotify) \
+  rtos_trace_event(RTOS_TRACE_NOTIFY, pxTCB->uxTCBNumber, (uxIndexToNotify))
+#define traceTASK_NOTIFY_FROM_ISR(uxIndexToNotify) \
+  rtos_trace_event(RTOS_TRACE_NOTIFY_FROM_ISR, pxTCB->uxTCBNumber, (uxIndexToNotify))
+#define traceTASK_NOTIFY_GIVE_FROM_ISR(uxIndexToNotify) \
+  rtos_trace_event(RTOS_TRACE_NOTIFY_FROM_ISR, pxTCB->uxTCBNumber, (uxIndexToNotify))
+#define traceTASK_NOTIFY_WAIT_BLOCK(uxIndexToWait) \
+  rtos_trace_event(RTOS_TRACE_NOTIFY_BLOCK, pxCurrentTCB->uxTCBNumber, (uxIndexToWait))
+#define traceTASK_NOTIFY_TAKE_BLOCK(uxIndexToWait) \
+  rtos_trace_event(RTOS_TRACE_NOTIFY_BLOCK, pxCurrentTCB->uxTCBNumber, (uxIndexToWait))
@@ -0,0 +1,142 @@
+#ifdef TESTING
+  #include "rtos_trace.h"
+  #include "FreeRTOS.h"
+  #include "task.h"
+  #include "queue.h"
+  #include "semphr.h"
+  #include "unity.h"
+
+static rtos_trace_record_t records[RTOS_TRACE_RECORDS];
+
+/// @brief Index of the first record of @p event with @p arg from @p from, -1 if there is none
+static int find(size_t n, uint8_t event, uint16_t arg, int from = 0) {
+  for (size_t i = from; i < n; ++i) {
+    if (records[i].event == event && records[i].arg == arg) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static void pong(void* queue) {
+  uint8_t item;
+  while (1) {
+    xQueueReceive(static_cast<QueueHandle_t>(queue), &item, portMAX_DELAY);
+  }
+}
+
+void test_trace_queue() {
+  QueueHandle_t queue = xQueueCreate(4, 1);
+  rtos_trace_name_object(queue, "ping");
+  const uint16_t object = uxQueueGetQueueNumber(queue);
+  TaskHandle_t task;
+  rtos_trace_clear();
+  xTaskCreate(pong, "pong", 256, queue, configMAX_PRIORITIES - 1, &task);
+  TaskStatus_t status;
+  vTaskGetInfo(task, &status, pdFALSE, eRunning);
+  const uint16_t number = status.xTaskNumber;
+  const uint8_t item = 1;
+  xQueueSend(queue, &item, 0);
+  vTaskDelete(task);
+
+  uint32_t lost = 1;
+  const size_t n = rtos_trace_read(records, RTOS_TRACE_RECORDS, &lost);
+  TEST_ASSERT_EQUAL(0, lost);
+
+  // pong runs at once, waits for the queue, gets the item as soon as it's sent
+  const int created = find(n, RTOS_TRACE_TASK_CREATE, number);
+  const int first_run = find(n, RTOS_TRACE_TASK_SWITCHED_IN, number, created);
+  const int waits = find(n, RTOS_TRACE_QUEUE_BLOCK_RECEIVE, object, first_run);
+  const int sent = find(n, RTOS_TRACE_QUEUE_SEND, object, waits);
+  const int woken = find(n, RTOS_TRACE_TASK_READY, number, waits);
+  const int runs = find(n, RTOS_TRACE_TASK_SWITCHED_IN, number, sent);
+  const int received = find(n, RTOS_TRACE_QUEUE_RECEIVE, object, runs);
+  TEST_ASSERT_GREATER_OR_EQUAL(0, created);
+  TEST_ASSERT_GREATER_THAN(created, first_run);
+  TEST_ASSERT_GREATER_THAN(first_run, waits);
+  TEST_ASSERT_GREATER_THAN(waits, sent);
+  TEST_ASSERT_GREATER_THAN(sent, woken);
+  TEST_ASSERT_GREATER_THAN(woken, runs);
+  TEST_ASSERT_GREATER_THAN(runs, received);
+  TEST_ASSERT_EQUAL(configMAX_PRIORITIES - 1, records[runs].info);
+  TEST_ASSERT_EQUAL(0, records[sent].info);
+  TEST_ASSERT_EQUAL(1, records[received].info);
+  TEST_ASSERT_GREATER_OR_EQUAL(0, find(n, RTOS_TRACE_TASK_DELETE, number, received));
+  for (size_t i = 1; i < n; ++i) {
+    TEST_ASSERT_TRUE(int32_t(records[i].time - records[i - 1].time) >= 0);
+  }
+
+  uint8_t info = 0;
+  TEST_ASSERT_EQUAL_STRING("pong", rtos_trace_name(RTOS_TRACE_NAME_TASK, number, &info));
+  TEST_ASSERT_EQUAL(configMAX_PRIORITIES - 1, info);
+  TEST_ASSERT_EQUAL_STRING("ping", rtos_trace_name(RTOS_TRACE_NAME_OBJECT, object, &info));
+  TEST_ASSERT_EQUAL(queueQUEUE_TYPE_BASE, info);
+  vQueueDelete(queue);
+
+  // a mutex without a name
+  SemaphoreHandle_t mtx = xSemaphoreCreateMutex();
+  TEST_ASSERT_EQUAL_STRING("", rtos_trace_name(RTOS_TRACE_NAME_OBJECT, uxQueueGetQueueNumber(mtx), &info));
+  TEST_ASSERT_EQUAL(queueQUEUE_TYPE_MUTEX, info);
+  vSemaphoreDelete(mtx);
+}
+
+void test_trace_markers() {
+  const char* frame = "frame";
+  const uint32_t names = rtos_trace_names_changed();
+  const uint16_t id = rtos_trace_marker(frame);
+  TEST_ASSERT_NOT_EQUAL(0, id);
+  TEST_ASSERT_EQUAL(id, rtos_trace_marker(frame));
+  TEST_ASSERT_EQUAL(names + 1, rtos_trace_names_changed());
+  TEST_ASSERT_NOT_EQUAL(id, rtos_trace_marker("other"));
+  uint8_t info = 1;
+  TEST_ASSERT_EQUAL_STRING("frame", rtos_trace_name(RTOS_TRACE_NAME_MARKER, id, &info));
+  TEST_ASSERT_NULL(rtos_trace_name(RTOS_TRACE_NAME_MARKER, RTOS_TRACE_MARKERS - 1, &info));
+
+  vTaskSuspendAll();
+  rtos_trace_clear();
+  rtos_trace_begin(id, 7);
+  rtos_trace_mark(id, 8);
+  rtos_trace_enable(0);
+  rtos_trace_mark(id, 9);
+  rtos_trace_enable(1);
+  rtos_trace_end(id, 7);
+  uint32_t lost = 0;
+  const size_t n = rtos_trace_read(records, RTOS_TRACE_RECORDS, &lost);
+  xTaskResumeAll();
+
+  TEST_ASSERT_EQUAL(3, n);
+  TEST_ASSERT_EQUAL(RTOS_TRACE_BEGIN, records[0].event);
+  TEST_ASSERT_EQUAL(RTOS_TRACE_MARK, records[1].event);
+  TEST_ASSERT_EQUAL(8, records[1].info);
+  TEST_ASSERT_EQUAL(RTOS_TRACE_END, records[2].event);
+  TEST_ASSERT_EQUAL(id, records[2].arg);
+}
+
+void test_trace_lost() {
+  // the oldest records are overwritten, the reader is told how many
+  vTaskSuspendAll();
+  rtos_trace_clear();
+  for (uint32_t i = 0; i < RTOS_TRACE_RECORDS + 10; ++i) {
+    rtos_trace_mark(1, i);
+  }
+  uint32_t lost = 0;
+  const size_t half = rtos_trace_read(records, RTOS_TRACE_RECORDS / 2, &lost);
+  TEST_ASSERT_EQUAL(RTOS_TRACE_RECORDS / 2, half);
+  TEST_ASSERT_EQUAL(10, lost);
+  TEST_ASSERT_EQUAL(10, records[0].info);
+
+  // the rest wraps around the end of the ring
+  const size_t rest = rtos_trace_read(records, RTOS_TRACE_RECORDS, &lost);
+  xTaskResumeAll();
+  TEST_ASSERT_EQUAL(RTOS_TRACE_RECORDS / 2, rest);
+  TEST_ASSERT_EQUAL(0, lost);
+  TEST_ASSERT_EQUAL(uint8_t(RTOS_TRACE_RECORDS + 9), records[rest - 1].info);
+}
+
+void rtos_trace_tests() {
+  RUN_TEST(test_trace_queue);
+  RUN_TEST(test_trace_markers);
+  RUN_TEST(test_trace_lost);
+}
+
+#endif
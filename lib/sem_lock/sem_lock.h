@@ -1,3 +1,4 @@
+#pragma once
 #include "FreeRTOS.h"
 #include "semphr.h"
 
@@ -0,0 +1,151 @@
+#include "simulator.h"
+#include "PTY_Adaptor.h"
+#include "FileFlash.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "gfx.h"
+#include "gdisp_memory.h"
+#include "gmouse_memory.h"
+#include "utils.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <unistd.h>
+
+namespace {
+  const char* frames_dir = nullptr;
+  FILE* script = nullptr;
+  timespec start;
+  gCoord touch_x = 0, touch_y = 0;  ///< released where it was last touched
+
+  /// @brief One line of the touch script
+  struct Event {
+    uint32_t ms = UINT32_MAX;  ///< UINT32_MAX at the end of the script
+    char action[16] = { 0 };
+    char arg[64] = { 0 };
+    int x = 0, y = 0;
+  };
+
+  /// @brief Read the next event, skipping comments and empty lines
+  Event next_event() {
+    Event e;
+    char line[128];
+    while (script && fgets(line, sizeof(line), script)) {
+      if (char* comment = strchr(line, '#')) {
+        *comment = '\0';
+      }
+      unsigned ms;
+      const int n = sscanf(line, "%u %15s %63s", &ms, e.action, e.arg);
+      if (n < 2) {
+        continue;
+      }
+      e.ms = ms;
+      sscanf(e.arg, "%d", &e.x);
+      sscanf(line, "%*u %*s %*d %d", &e.y);
+      return e;
+    }
+    return e;
+  }
+
+  void dump(const char* name) {
+    if (not frames_dir) {
+      return;
+    }
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.ppm", frames_dir, name);
+    if (not gdispMemoryDumpPPM(GDISP, path)) {
+      fprintf(stderr, "sim: can't write %s\n", path);
+    }
+  }
+
+  void run(const Event& e) {
+    if (0 == strcmp(e.action, "down") || 0 == strcmp(e.action, "move")) {
+      touch_x = e.x;
+      touch_y = e.y;
+      gmouseMemorySet(touch_x, touch_y, gTrue);
+    } else if (0 == strcmp(e.action, "up")) {
+      gmouseMemorySet(touch_x, touch_y, gFalse);
+    } else if (0 == strcmp(e.action, "frame")) {
+      dump(e.arg);
+    } else if (0 == strcmp(e.action, "quit")) {
+      printf("sim: quit at %u ms\n", static_cast<unsigned>(e.ms));
+      fflush(stdout);
+      exit(0);
+    } else {
+      fprintf(stderr, "sim: unknown action '%s' at %u ms\n", e.action, static_cast<unsigned>(e.ms));
+    }
+  }
+
+  /// @brief Hash of the display, to find the frames, which changed
+  uint32_t frame_hash() {
+    const size_t px = static_cast<size_t>(gdispGGetWidth(GDISP)) * gdispGGetHeight(GDISP);
+    return utils::crc32mpeg2(reinterpret_cast<const uint8_t*>(gdispMemoryFramebuffer(GDISP)), px * sizeof(gU16));
+  }
+}  // namespace
+
+namespace sim {
+  void init() {
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    frames_dir = getenv("SIM_FRAMES");
+    if (const char* path = getenv("SIM_TOUCH")) {
+      script = fopen(path, "r");
+      if (not script) {
+        fprintf(stderr, "sim: can't open the touch script %s\n", path);
+      }
+    }
+
+    auto& pty = PTY_Adaptor::get_instance();
+    if (not pty.open()) {
+      fprintf(stderr, "sim: can't create a pseudo-terminal\n");
+      exit(1);
+    }
+    if (const char* link = getenv("SIM_LINK")) {
+      unlink(link);
+      if (symlink(pty.path(), link) != 0) {
+        fprintf(stderr, "sim: can't link %s\n", link);
+      }
+    }
+    printf("sim: link on %s\n", pty.path());
+    fflush(stdout);
+  }
+
+  IHWMessage& link() {
+    return PTY_Adaptor::get_instance();
+  }
+
+  IFlash& flash() {
+    static FileFlash flash(getenv("SIM_FLASH"), 2, 128 * 1024);
+    return flash;
+  }
+
+  uint32_t clock_us() {
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint32_t>((now.tv_sec - start.tv_sec) * 1000000 + (now.tv_nsec - start.tv_nsec) / 1000);
+  }
+
+  void task(void*) {
+    Event e = next_event();
+    uint32_t last_hash = 0;
+    TickType_t wake = xTaskGetTickCount();
+    while (1) {
+      vTaskDelayUntil(&wake, pdMS_TO_TICKS(FRAME_PERIOD_MS));
+      const uint32_t now = xTaskGetTickCount() * portTICK_PERIOD_MS;
+      for (; e.ms <= now; e = next_event()) {
+        run(e);
+      }
+
+      // uGFX is started by the GFX task
+      if (frames_dir && GDISP) {
+        const uint32_t hash = frame_hash();
+        if (hash != last_hash) {
+          last_hash = hash;
+          char name[16];
+          snprintf(name, sizeof(name), "%08u", static_cast<unsigned>(now));
+          dump(name);
+        }
+      }
+    }
+  }
+}  // namespace sim
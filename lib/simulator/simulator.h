@@ -0,0 +1,44 @@
+/**
+ * @file simulator.h
+ * @brief Stand-ins for the board, when the firmware runs as a Linux process (env:sim)
+ * @details main.cpp runs its tasks unchanged, on the FreeRTOS POSIX port. The display and the touch panel are the
+ * Memory drivers of uGFX, the USB CDC is a pseudo-terminal, and the icon flash is a file. It's configured from the
+ * environment:
+ *
+ * - SIM_LINK: the path of the pseudo-terminal is linked there, for the PC stand-in to open. It's printed in any case
+ * - SIM_TOUCH: touch script, see below
+ * - SIM_FRAMES: directory, every frame, which differs from the previous one, is written there as `<ms>.ppm`
+ * - SIM_FLASH: file keeping the icon cache across runs, in RAM only if it's not set
+ *
+ * The touch script has one event per line, at milliseconds since start, in ascending order. `#` starts a comment.
+ *
+ *     500  down 40 100   # the panel is touched at x 40, y 100
+ *     600  move 80 100
+ *     700  up
+ *     900  frame volume  # write the display to SIM_FRAMES/volume.ppm
+ *     5000 quit          # end the process
+ */
+
+#pragma once
+#include "IFlash.h"
+#include "IHWMessage.h"
+#include <cstdint>
+
+namespace sim {
+  static inline constexpr uint32_t FRAME_PERIOD_MS = 20;  ///< the display is compared, and the script run, this often
+
+  /// @brief Read the environment and open the link, call before the scheduler starts
+  void init();
+
+  /// @brief The link to the PC, a pseudo-terminal
+  IHWMessage& link();
+
+  /// @brief Flash of the icon cache, the size of the two sectors of the board
+  IFlash& flash();
+
+  /// @brief Microseconds since start, for latency_trace
+  uint32_t clock_us();
+
+  /// @brief Plays the touch script and dumps the frames
+  void task(void*);
+}  // namespace sim
@@ -0,0 +1,48 @@
+#include "task_stats.h"
+#include <algorithm>
+#include <cstring>
+
+namespace task_stats {
+  const Report& Sampler::sample() {
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    const UBaseType_t n = uxTaskGetSystemState(status_, MAX_TASKS, &total);
+    const configRUN_TIME_COUNTER_TYPE interval = total - total_;
+    const TaskHandle_t idle = xTaskGetIdleTaskHandle();
+
+    const uint32_t per_us = ulRunTimeClockHz() / 1000000;
+
+    std::array<Previous, MAX_TASKS> now;
+    report_.n = n;
+    report_.idle_permille = 0;
+    report_.interval_us = interval / per_us;
+    for (UBaseType_t i = 0; i < n; ++i) {
+      const TaskStatus_t& s = status_[i];
+      // a task created during the interval ran only since
+      configRUN_TIME_COUNTER_TYPE before = 0;
+      const auto end = previous_.begin() + n_previous_;
+      const auto prev =
+        std::find_if(previous_.begin(), end, [&s](const Previous& p) { return p.number == s.xTaskNumber; });
+      if (prev != end) {
+        before = prev->run;
+      }
+      const configRUN_TIME_COUNTER_TYPE run = s.ulRunTimeCounter - before;
+      now[i] = { s.xTaskNumber, s.ulRunTimeCounter };
+
+      Task& t = report_.tasks[i];
+      strncpy(t.name, s.pcTaskName, sizeof(t.name) - 1);
+      t.number = s.xTaskNumber;
+      t.priority = s.uxCurrentPriority;
+      t.state = s.eCurrentState;
+      t.permille = interval ? std::min<configRUN_TIME_COUNTER_TYPE>(run * 1000 / interval, 1000) : 0;
+      t.run_us = run / per_us;
+      t.stack_free = s.usStackHighWaterMark;
+      if (s.xHandle == idle) {
+        report_.idle_permille = t.permille;
+      }
+    }
+    previous_ = now;
+    n_previous_ = n;
+    total_ = total;
+    return report_;
+  }
+}  // namespace task_stats
@@ -0,0 +1,66 @@
+/**
+ * @file task_stats.h
+ * @brief CPU load of each task, from the run time stats of FreeRTOS
+ * @details The kernel adds the time of the run time clock to a task each time it's switched out, see
+ * port/run_time_clock.c of FreeRTOS: cycles on the board, nanoseconds on the host. The sampler reports what each task
+ * ran since the previous sample, so a report shows the load of its interval, not the average since boot. The idle
+ * task gets what no other task used. CommAPI::report_tasks() sends a report to the PC.
+ */
+
+#pragma once
+#include "FreeRTOS.h"
+#include "task.h"
+#include <array>
+#include <cstdint>
+
+#ifdef TESTING
+void task_stats_tests();
+#endif
+
+namespace task_stats {
+  static inline constexpr size_t MAX_TASKS = 12;  ///< more tasks aren't reported
+
+  /// @brief One task during the interval
+  struct Task {
+    char name[configMAX_TASK_NAME_LEN] = { 0 };
+    uint8_t number = 0;  ///< unique, in the order of creation
+    uint8_t priority = 0;
+    uint8_t state = 0;        ///< eTaskState at the sample
+    uint16_t permille = 0;    ///< of the interval
+    uint32_t run_us = 0;      ///< run during the interval
+    uint16_t stack_free = 0;  ///< least free stack ever, in words
+  };
+
+  struct Report {
+    uint32_t interval_us = 0;
+    uint16_t idle_permille = 0;
+    uint8_t n = 0;  ///< tasks
+    std::array<Task, MAX_TASKS> tasks;
+  };
+
+  /// @brief Samples the run time of every task, not thread safe
+  class Sampler {
+  public:
+    /// @brief Load of each task since the previous call, or since the scheduler started
+    /// @details Holds the scheduler while the states are copied. Tasks deleted during the interval are left out. With
+    /// more than MAX_TASKS tasks nothing is reported
+    const Report& sample();
+
+    const Report& last() const {
+      return report_;
+    }
+
+  private:
+    /// @brief Run time of a task at the previous sample
+    struct Previous {
+      UBaseType_t number = 0;
+      configRUN_TIME_COUNTER_TYPE run = 0;
+    };
+
+    TaskStatus_t status_[MAX_TASKS];
+    std::array<Previous, MAX_TASKS> previous_;
+    size_t n_previous_ = 0;
+    configRUN_TIME_COUNTER_TYPE total_ = 0;
+    Report report_;
+  };
+}  // namespace task_stats
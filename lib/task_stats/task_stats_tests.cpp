@@ -0,0 +1,88 @@
+#ifdef TESTING
+  #include "task_stats.h"
+  #include "unity.h"
+  #include <cstring>
+
+/// @brief Busy half of the time, in turns of 5 ticks
+static void half_busy(void*) {
+  while (1) {
+    const TickType_t start = xTaskGetTickCount();
+    while (xTaskGetTickCount() - start < 5) {
+    }
+    vTaskDelay(5);
+  }
+}
+
+static void sleeping(void*) {
+  while (1) {
+    vTaskDelay(pdMS_TO_TICKS(1000));
+  }
+}
+
+static const task_stats::Task* find(const task_stats::Report& r, const char* name) {
+  for (size_t i = 0; i < r.n; ++i) {
+    if (0 == strcmp(r.tasks[i].name, name)) {
+      return &r.tasks[i];
+    }
+  }
+  return nullptr;
+}
+
+void test_task_load() {
+  TaskHandle_t busy, asleep;
+  xTaskCreate(half_busy, "busy", 256, nullptr, 5, &busy);
+  xTaskCreate(sleeping, "sleeping", 256, nullptr, 5, &asleep);
+
+  task_stats::Sampler sampler;
+  sampler.sample();
+  vTaskDelay(pdMS_TO_TICKS(500));
+  const auto& r = sampler.sample();
+
+  TEST_ASSERT_UINT32_WITHIN(50000, 500000, r.interval_us);
+  const auto* b = find(r, "busy");
+  const auto* s = find(r, "sleeping");
+  TEST_ASSERT_NOT_NULL(b);
+  TEST_ASSERT_NOT_NULL(s);
+  TEST_ASSERT_UINT32_WITHIN(150, 500, b->permille);
+  TEST_ASSERT_UINT32_WITHIN(150000, 250000, b->run_us);
+  TEST_ASSERT_LESS_THAN(10, s->permille);
+  TEST_ASSERT_EQUAL(5, b->priority);
+  TEST_ASSERT_GREATER_THAN(0, b->stack_free);
+
+  // the idle task got the rest, every task together the whole interval
+  TEST_ASSERT_UINT32_WITHIN(150, 500, r.idle_permille);
+  uint32_t sum = 0;
+  for (size_t i = 0; i < r.n; ++i) {
+    sum += r.tasks[i].permille;
+  }
+  TEST_ASSERT_UINT32_WITHIN(60, 960, sum);
+
+  vTaskDelete(busy);
+  vTaskDelete(asleep);
+}
+
+void test_task_load_interval() {
+  // each sample reports its own interval, not the average since the start
+  TaskHandle_t busy;
+  task_stats::Sampler sampler;
+  sampler.sample();
+  vTaskDelay(pdMS_TO_TICKS(200));
+  TEST_ASSERT_GREATER_THAN(900, sampler.sample().idle_permille);
+
+  xTaskCreate(half_busy, "busy", 256, nullptr, 5, &busy);
+  vTaskDelay(pdMS_TO_TICKS(200));
+  TEST_ASSERT_UINT32_WITHIN(150, 500, find(sampler.sample(), "busy")->permille);
+  vTaskDelete(busy);
+
+  vTaskDelay(pdMS_TO_TICKS(200));
+  const auto& r = sampler.sample();
+  TEST_ASSERT_NULL(find(r, "busy"));
+  TEST_ASSERT_GREATER_THAN(900, r.idle_permille);
+}
+
+void task_stats_tests() {
+  RUN_TEST(test_task_load);
+  RUN_TEST(test_task_load_interval);
+}
+
+#endif
@@ -0,0 +1,57 @@
+/**
+ * @file touch_filter.h
+ * @brief Integer filter for touch panel readings
+ * @details Plain C, so the ADS7843 driver in uGFX can use it. Each reading is made of several ADC samples,
+ * their median removes spikes, then a fixed-point IIR low-pass smooths the jitter between readings.
+ */
+
+#pragma once
+#include <stdint.h>
+
+#if defined(TESTING) && defined(__cplusplus)
+void touch_filter_tests();
+#endif
+
+#define TOUCH_FILTER_SAMPLES 5  ///< ADC samples per reading
+#define TOUCH_FILTER_SHIFT 1    ///< a new reading has weight 1/2^SHIFT in the IIR
+#define TOUCH_FILTER_FRAC 4     ///< fractional bits of the IIR state
+
+/// @brief State of one axis
+typedef struct {
+  int32_t state;  ///< filtered value, with TOUCH_FILTER_FRAC fractional bits
+  uint8_t valid;  ///< state holds a value
+} touch_filter_t;
+
+/// @brief Forget the previous readings, call it when the pen is lifted
+static inline void touch_filter_reset(touch_filter_t* f) {
+  f->valid = 0;
+}
+
+/// @brief Median of TOUCH_FILTER_SAMPLES samples, @p s is sorted in place
+static inline uint16_t touch_filter_median(uint16_t* s) {
+  for (int i = 1; i < TOUCH_FILTER_SAMPLES; ++i) {
+    const uint16_t v = s[i];
+    int j = i;
+    for (; j > 0 && s[j - 1] > v; --j) {
+      s[j] = s[j - 1];
+    }
+    s[j] = v;
+  }
+  return s[TOUCH_FILTER_SAMPLES / 2];
+}
+
+/// @brief Filter one reading
+/// @param f state of the axis
+/// @param samples TOUCH_FILTER_SAMPLES ADC samples, they are reordered
+/// @return filtered value, in ADC units
+static inline uint16_t touch_filter_update(touch_filter_t* f, uint16_t* samples) {
+  const int32_t m = (int32_t)touch_filter_median(samples) << TOUCH_FILTER_FRAC;
+  if (f->valid) {
+    f->state += (m - f->state) / (1 << TOUCH_FILTER_SHIFT);
+  } else {
+    // first reading after pen down, don't drag the old position along
+    f->state = m;
+    f->valid = 1;
+  }
+  return (uint16_t)((f->state + (1 << (TOUCH_FILTER_FRAC - 1))) >> TOUCH_FILTER_FRAC);
+}
@@ -0,0 +1,101 @@
+#ifdef TESTING
+  #include "touch_filter.h"
+  #include "unity.h"
+  #include <cstdlib>
+  #include <array>
+
+using reading_t = std::array<uint16_t, TOUCH_FILTER_SAMPLES>;
+
+/// @brief Samples of a finger resting on the panel, with ADC noise and two spikes from a bad contact
+static constexpr reading_t press_trace[] = {
+  { 2051, 2047, 2049, 2046, 2052 }, { 2044, 2050, 2048, 2053, 2049 }, { 2049, 4095, 2046, 2051, 2047 },
+  { 2048, 2045, 2052, 2050, 2049 }, { 2053, 2047, 2044, 2049, 2051 }, { 2046, 2050, 2048, 12, 2052 },
+  { 2049, 2052, 2047, 2045, 2050 }, { 2051, 2046, 2049, 2048, 2053 }, { 2047, 2049, 2051, 2050, 2044 },
+  { 2050, 2048, 2046, 2052, 2049 },
+};
+static constexpr uint16_t press_value = 2049;
+
+/// @brief Filter one reading, the filter reorders the samples so work on a copy
+static uint16_t update(touch_filter_t& f, reading_t r) {
+  return touch_filter_update(&f, r.data());
+}
+
+void test_median() {
+  reading_t r = { 5, 1, 4, 2, 3 };
+  TEST_ASSERT_EQUAL(3, touch_filter_median(r.data()));
+
+  r = { 2000, 2001, 4095, 1999, 2002 };
+  TEST_ASSERT_EQUAL(2001, touch_filter_median(r.data()));
+
+  // two spikes out of five are removed
+  r = { 0, 2000, 4095, 2001, 1999 };
+  TEST_ASSERT_EQUAL(2000, touch_filter_median(r.data()));
+}
+
+void test_first_reading() {
+  touch_filter_t f;
+  touch_filter_reset(&f);
+  TEST_ASSERT_EQUAL(3000, update(f, { 3000, 3000, 3000, 3000, 3000 }));
+
+  // a new press doesn't start from the old position
+  touch_filter_reset(&f);
+  TEST_ASSERT_EQUAL(500, update(f, { 500, 500, 500, 500, 500 }));
+}
+
+void test_press_trace() {
+  touch_filter_t f;
+  touch_filter_reset(&f);
+
+  int max_err = 0;
+  for (const auto& r : press_trace) {
+    const int err = std::abs(update(f, r) - press_value);
+    max_err = err > max_err ? err : max_err;
+  }
+  // the spikes don't show and the noise is below the raw sample spread
+  TEST_ASSERT_LESS_OR_EQUAL(2, max_err);
+}
+
+void test_step() {
+  touch_filter_t f;
+  touch_filter_reset(&f);
+  update(f, { 1000, 1000, 1000, 1000, 1000 });
+
+  // finger moved quickly, the output follows without overshoot
+  uint16_t prev = 1000;
+  int n = 0;
+  for (; n < 20; ++n) {
+    const uint16_t out = update(f, { 3000, 3000, 3000, 3000, 3000 });
+    TEST_ASSERT_GREATER_OR_EQUAL(prev, out);
+    TEST_ASSERT_LESS_OR_EQUAL(3000, out);
+    prev = out;
+    if (out == 3000) {
+      break;
+    }
+  }
+  TEST_ASSERT_EQUAL(3000, prev);
+  // 5 ms polling, the position settles within 60 ms
+  TEST_ASSERT_LESS_THAN(12, n);
+}
+
+void test_drag() {
+  touch_filter_t f;
+  touch_filter_reset(&f);
+
+  // slow drag of 10 units per reading, the lag stays constant and small
+  uint16_t out = 0;
+  for (uint16_t pos = 1000; pos < 1500; pos += 10) {
+    const uint16_t p = pos;
+    out = update(f, { uint16_t(p - 2), uint16_t(p + 1), p, uint16_t(p + 3), uint16_t(p - 1) });
+  }
+  TEST_ASSERT_INT_WITHIN(12, 1490, out);
+}
+
+void touch_filter_tests() {
+  RUN_TEST(test_median);
+  RUN_TEST(test_first_reading);
+  RUN_TEST(test_press_trace);
+  RUN_TEST(test_step);
+  RUN_TEST(test_drag);
+}
+
+#endif
@@ -7,7 +7,7 @@
 
 #include "gfx.h"
 
-#if GFX_USE_GDISP
+#if GFX_USE_GDISP && !GDISP_DRIVER_MEMORY
 
 #if defined(GDISP_SCREEN_HEIGHT) || defined(GDISP_SCREEN_HEIGHT)
 	#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
@@ -43,6 +43,9 @@
 #endif
 
 #include "ILI9341.h"
+#if GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL
+	#include "ili9341_scroll.h"
+#endif
 
 /*===========================================================================*/
 /* Driver local functions.                                                   */
@@ -69,6 +72,32 @@ static void set_viewport(GDisplay *g) {
 	write_data(g, (gU8) (g->p.y + g->p.cy - 1));
 }
 
+#if GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL
+	// Rows are mapped to the frame memory, after the display was scrolled. There is only one display
+	static ili9341_scroll_t scroll;
+	static ili9341_stream_t stream;
+
+	static void bus_index(void *g, gU16 reg) {
+		write_index((GDisplay *)g, reg);
+	}
+	static void bus_data(void *g, gU16 value) {
+		write_data((GDisplay *)g, value);
+	}
+
+	// Fill the area with the color, the scroll mapping applies
+	static void fill_area(GDisplay *g, const ili9341_bus_t *bus, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color) {
+		gU32 n = (gU32)cx * cy;
+		ili9341_scroll_stream_start(&scroll, bus, &stream, x, y, cx, cy);
+		for(; n; --n) {
+			#if GDISP_NEED_PIXEL_ACCOUNTING
+				g->pixelsWritten++;
+			#endif
+			write_data16(g, gdispColor2Native(color));
+			ili9341_scroll_stream_pixel(&scroll, bus, &stream);
+		}
+	}
+#endif
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -231,23 +260,65 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	g->g.Powermode = gPowerOn;
 	g->g.Backlight = GDISP_INITIAL_BACKLIGHT;
 	g->g.Contrast = GDISP_INITIAL_CONTRAST;
+	#if GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL
+		ili9341_scroll_init(&scroll, GDISP_SCREEN_HEIGHT);
+	#endif
 	return gTrue;
 }
 
 #if GDISP_HARDWARE_STREAM_WRITE
 	LLDSPEC	void gdisp_lld_write_start(GDisplay *g) {
 		acquire_bus(g);
-		set_viewport(g);
-		write_index(g, 0x2C);
+		#if GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL
+			const ili9341_bus_t bus = { bus_index, bus_data, g };
+			ili9341_scroll_stream_start(&scroll, &bus, &stream, g->p.x, g->p.y, g->p.cx, g->p.cy);
+		#else
+			set_viewport(g);
+			write_index(g, 0x2C);
+		#endif
 	}
 	LLDSPEC	void gdisp_lld_write_color(GDisplay *g) {
+		#if GDISP_NEED_PIXEL_ACCOUNTING
+			g->pixelsWritten++;
+		#endif
 		write_data16(g, gdispColor2Native(g->p.color));
+		#if GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL
+			{
+				const ili9341_bus_t bus = { bus_index, bus_data, g };
+				ili9341_scroll_stream_pixel(&scroll, &bus, &stream);
+			}
+		#endif
 	}
 	LLDSPEC	void gdisp_lld_write_stop(GDisplay *g) {
 		release_bus(g);
 	}
 #endif
 
+#if GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL
+	// The controller scrolls whole rows of its frame memory, which are the screen rows only in the native orientation.
+	// Other areas can't be moved without reading them back, they are cleared, and have to be drawn again.
+	LLDSPEC void gdisp_lld_vertical_scroll(GDisplay *g) {
+		const ili9341_bus_t bus = { bus_index, bus_data, g };
+		const gCoord x = g->p.x, y = g->p.y, cx = g->p.cx, cy = g->p.cy;
+
+		acquire_bus(g);
+		if (g->g.Orientation != gOrientation0 || x != 0 || cx != g->g.Width) {
+			fill_area(g, &bus, x, y, cx, cy, g->p.color);
+			release_bus(g);
+			return;
+		}
+		if (scroll.top != y || scroll.height != cy) {
+			// the rows of the previous area are shown rotated, until it's redefined
+			if (scroll.offset)
+				fill_area(g, &bus, 0, scroll.top, g->g.Width, scroll.height, g->p.color);
+			ili9341_scroll_define(&scroll, &bus, y, cy);
+		}
+		// one register write, GDISP fills the rows, which came in, with the background
+		ili9341_scroll_lines(&scroll, &bus, g->p.y1);
+		release_bus(g);
+	}
+#endif
+
 #if GDISP_HARDWARE_STREAM_READ
 	LLDSPEC	void gdisp_lld_read_start(GDisplay *g) {
 		acquire_bus(g);
@@ -296,6 +367,15 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		case GDISP_CONTROL_ORIENTATION:
 			if (g->g.Orientation == (gOrientation)g->p.ptr)
 				return;
+			#if GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL
+				if (scroll.offset) {
+					// the scroll is along the rows of the memory, drawing starts over in the new orientation
+					const ili9341_bus_t bus = { bus_index, bus_data, g };
+					acquire_bus(g);
+					ili9341_scroll_define(&scroll, &bus, scroll.top, scroll.height);
+					release_bus(g);
+				}
+			#endif
 			switch((gOrientation)g->p.ptr) {
 			case gOrientation0:
 				acquire_bus(g);
@@ -345,4 +425,4 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	}
 #endif
 
-#endif /* GFX_USE_GDISP */
+#endif /* GFX_USE_GDISP && !GDISP_DRIVER_MEMORY */
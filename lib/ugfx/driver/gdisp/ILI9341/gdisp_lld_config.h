@@ -17,6 +17,7 @@
 #define GDISP_HARDWARE_STREAM_WRITE		GFXON
 //#define GDISP_HARDWARE_STREAM_READ		GFXON
 #define GDISP_HARDWARE_CONTROL			GFXON
+#define GDISP_HARDWARE_SCROLL			GFXON	// VSCRSADD, in the native orientation, see ili9341_scroll.h
 
 #define GDISP_LLD_PIXELFORMAT			GDISP_PIXELFORMAT_RGB565
 
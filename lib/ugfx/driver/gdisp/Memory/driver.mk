@@ -0,0 +1,2 @@
+GFXINC += $(GFXLIB)/drivers/gdisp/Memory
+GFXSRC += $(GFXLIB)/drivers/gdisp/Memory/gdisp_lld_Memory.c
@@ -0,0 +1,159 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+#include "gfx.h"
+
+#if GFX_USE_GDISP && GDISP_DRIVER_MEMORY
+
+#include <stdio.h>
+#include <string.h>
+
+#define GDISP_DRIVER_VMT			GDISPVMT_Memory
+#include "gdisp_lld_config.h"
+#include "../../../src/gdisp/gdisp_driver.h"
+#include "gdisp_memory.h"
+
+/*===========================================================================*/
+/* Driver local definitions.                                                 */
+/*===========================================================================*/
+
+// The size of the ILI9341, in its native orientation
+#ifndef GDISP_SCREEN_HEIGHT
+	#define GDISP_SCREEN_HEIGHT		320
+#endif
+#ifndef GDISP_SCREEN_WIDTH
+	#define GDISP_SCREEN_WIDTH		240
+#endif
+#ifndef GDISP_INITIAL_CONTRAST
+	#define GDISP_INITIAL_CONTRAST	50
+#endif
+#ifndef GDISP_INITIAL_BACKLIGHT
+	#define GDISP_INITIAL_BACKLIGHT	100
+#endif
+
+typedef struct memoryPriv {
+	gU16		*fb;		// pixels in the current orientation, Width x Height
+	gCoord		x0, y0;		// stream write window, latched at the start like the ILI9341 does,
+	gCoord		x1, y1;		//	the core may change g->p while streaming
+	gCoord		x, y;		// stream write position
+} memoryPriv;
+
+#define PRIV(g)		((memoryPriv *)(g)->priv)
+
+/*===========================================================================*/
+/* Driver exported functions.                                                */
+/*===========================================================================*/
+
+LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
+	memoryPriv	*priv;
+
+	if (!(priv = gfxAlloc(sizeof(memoryPriv))))
+		return gFalse;
+	if (!(priv->fb = gfxAlloc(GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT * sizeof(gU16)))) {
+		gfxFree(priv);
+		return gFalse;
+	}
+	memset(priv->fb, 0, GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT * sizeof(gU16));
+	g->priv = priv;
+
+	/* Initialise the GDISP structure */
+	g->g.Width = GDISP_SCREEN_WIDTH;
+	g->g.Height = GDISP_SCREEN_HEIGHT;
+	g->g.Orientation = gOrientation0;
+	g->g.Powermode = gPowerOn;
+	g->g.Backlight = GDISP_INITIAL_BACKLIGHT;
+	g->g.Contrast = GDISP_INITIAL_CONTRAST;
+	return gTrue;
+}
+
+#if GDISP_HARDWARE_STREAM_WRITE
+	LLDSPEC	void gdisp_lld_write_start(GDisplay *g) {
+		memoryPriv	*priv = PRIV(g);
+
+		priv->x = priv->x0 = g->p.x;
+		priv->y = priv->y0 = g->p.y;
+		priv->x1 = g->p.x + g->p.cx;
+		priv->y1 = g->p.y + g->p.cy;
+	}
+	LLDSPEC	void gdisp_lld_write_color(GDisplay *g) {
+		memoryPriv	*priv = PRIV(g);
+
+		// the window is filled row by row, and wraps around at the end
+		priv->fb[priv->y * g->g.Width + priv->x] = gdispColor2Native(g->p.color);
+		if (++priv->x >= priv->x1) {
+			priv->x = priv->x0;
+			if (++priv->y >= priv->y1)
+				priv->y = priv->y0;
+		}
+		#if GDISP_NEED_PIXEL_ACCOUNTING
+			g->pixelsWritten++;
+		#endif
+	}
+	LLDSPEC	void gdisp_lld_write_stop(GDisplay *g) {
+		(void)g;
+	}
+#endif
+
+#if GDISP_NEED_CONTROL && GDISP_HARDWARE_CONTROL
+	LLDSPEC void gdisp_lld_control(GDisplay *g) {
+		switch(g->p.x) {
+		case GDISP_CONTROL_POWER:
+			g->g.Powermode = (gPowermode)g->p.ptr;
+			return;
+
+		case GDISP_CONTROL_ORIENTATION:
+			// the content is not rotated, the orientation is set before drawing
+			switch((gOrientation)g->p.ptr) {
+			case gOrientation0:
+			case gOrientation180:
+				g->g.Height = GDISP_SCREEN_HEIGHT;
+				g->g.Width = GDISP_SCREEN_WIDTH;
+				break;
+			case gOrientation90:
+			case gOrientation270:
+				g->g.Height = GDISP_SCREEN_WIDTH;
+				g->g.Width = GDISP_SCREEN_HEIGHT;
+				break;
+			default:
+				return;
+			}
+			g->g.Orientation = (gOrientation)g->p.ptr;
+			return;
+
+		case GDISP_CONTROL_BACKLIGHT:
+			if ((unsigned)g->p.ptr > 100)
+				g->p.ptr = (void *)100;
+			g->g.Backlight = (unsigned)g->p.ptr;
+			return;
+
+		default:
+			return;
+		}
+	}
+#endif
+
+const gU16 *gdispMemoryFramebuffer(GDisplay *g) {
+	return PRIV(g)->fb;
+}
+
+gBool gdispMemoryDumpPPM(GDisplay *g, const char *path) {
+	const gU16	*fb = PRIV(g)->fb;
+	FILE		*f;
+	int			i;
+
+	if (!(f = fopen(path, "wb")))
+		return gFalse;
+	fprintf(f, "P6\n%d %d\n255\n", g->g.Width, g->g.Height);
+	for (i = 0; i < g->g.Width * g->g.Height; i++) {
+		const gColor	c = gdispNative2Color(fb[i]);
+		const gU8		rgb[3] = { RED_OF(c), GREEN_OF(c), BLUE_OF(c) };
+		fwrite(rgb, 1, sizeof(rgb), f);
+	}
+	return fclose(f) == 0 ? gTrue : gFalse;
+}
+
+#endif /* GFX_USE_GDISP && GDISP_DRIVER_MEMORY */
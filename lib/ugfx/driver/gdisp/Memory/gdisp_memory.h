@@ -0,0 +1,42 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    driver/gdisp/Memory/gdisp_memory.h
+ * @brief   Access to the framebuffer of the in-memory display
+ * @details The driver is used instead of the ILI9341 in host builds, when GDISP_DRIVER_MEMORY is GFXON.
+ */
+
+#ifndef _GDISP_MEMORY_H
+#define _GDISP_MEMORY_H
+
+#include "gfx.h"
+
+#if GFX_USE_GDISP && GDISP_DRIVER_MEMORY
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief	The pixels of the display, RGB565, gdispGGetWidth() x gdispGGetHeight(), row by row
+ */
+const gU16 *gdispMemoryFramebuffer(GDisplay *g);
+
+/**
+ * @brief	Write the display into a binary PPM file
+ * @return	gFalse if the file can't be written
+ */
+gBool gdispMemoryDumpPPM(GDisplay *g, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GFX_USE_GDISP && GDISP_DRIVER_MEMORY */
+
+#endif /* _GDISP_MEMORY_H */
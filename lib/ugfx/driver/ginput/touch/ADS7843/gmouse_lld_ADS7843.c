@@ -8,7 +8,7 @@
 #include "gfx.h"
 #include <string.h>
 
-#if (GFX_USE_GINPUT && GINPUT_NEED_MOUSE) 
+#if (GFX_USE_GINPUT && GINPUT_NEED_MOUSE) && !GINPUT_DRIVER_MEMORY
 
 #define GMOUSE_DRIVER_VMT		GMOUSEVMT_ADS7843
 #include "../../../../src/ginput/ginput_driver_mouse.h"
@@ -20,13 +20,26 @@
 #define CMD_Y				0x91
 #define CMD_ENABLE_IRQ		0x80
 
-#define LPF_FACTOR	(0.9)
+#include "touch_filter.h"
+#include "latency_trace.h"
 
-static gCoord xPrev = 240 / 4, yPrev = 320/4;
+static touch_filter_t xFilter, yFilter;
+static GMouse *penMouse;
+
+/* Called from the pen down interrupt, the mouse is only read after a wakeup */
+void ADS7843_PenIRQ(void) {
+	_gmouseWakeupI(penMouse);
+}
+
+static gBool MouseInit(GMouse* m, unsigned driverinstance) {
+	penMouse = m;
+	return init_board(m, driverinstance);
+}
 
 static gBool MouseXYZ(GMouse* m, GMouseReading* pdr)
 {
-	(void)m;
+	gU16	samples[TOUCH_FILTER_SAMPLES];
+	int		i;
 
 	// No buttons
 	pdr->buttons = 0;
@@ -38,19 +51,23 @@ static gBool MouseXYZ(GMouse* m, GMouseReading* pdr)
 		aquire_bus(m);
 		
 		read_value(m, CMD_X);				// Dummy read - disable PenIRQ
-		float v = read_value(m, CMD_X);		// Read X-Value
-		pdr->x = LPF_FACTOR*xPrev + (1-LPF_FACTOR)*v;
-		v = pdr->x;
+		for (i = 0; i < TOUCH_FILTER_SAMPLES; i++)
+			samples[i] = read_value(m, CMD_X);		// Read X-Value
+		pdr->x = touch_filter_update(&xFilter, samples);
 
 		read_value(m, CMD_Y);				// Dummy read - disable PenIRQ
-		v = read_value(m, CMD_Y);		// Read Y-Value
-		pdr->y = LPF_FACTOR*yPrev + (1-LPF_FACTOR)*v;
-		v = pdr->y;
+		for (i = 0; i < TOUCH_FILTER_SAMPLES; i++)
+			samples[i] = read_value(m, CMD_Y);		// Read Y-Value
+		pdr->y = touch_filter_update(&yFilter, samples);
 
 		read_value(m, CMD_ENABLE_IRQ);		// Enable IRQ
 
 		release_bus(m);
+	} else {
+		touch_filter_reset(&xFilter);
+		touch_filter_reset(&yFilter);
 	}
+	latency_trace_mark(LATENCY_TOUCH_SAMPLE);	// buttons fire on the release reading, so mark both
 	return gTrue;
 }
 
@@ -58,13 +75,14 @@ static gBool MouseXYZ(GMouse* m, GMouseReading* pdr)
 static gBool calibration_load(GMouse *m, void *buf, gMemSize sz) {
 
 	(void)m;
+	// Measured on raw ADC values
 	const GMouseCalibration cal = {
-		.ax = -0.62154454,
-		.bx = -0.0104754698,
-		.cx = 280.954254,
-		.ay = -0.0186230578,
-		.by = 0.898562551,
-		.cy = -78.7429428
+		.ax = -0.062154454,
+		.bx = -0.00104754698,
+		.cx = 246.636615,
+		.ay = -0.00186230578,
+		.by = 0.0898562551,
+		.cy = -15.0520843
 	};
 
 	if (sz != sizeof(cal)) {
@@ -78,7 +96,7 @@ static gBool calibration_load(GMouse *m, void *buf, gMemSize sz) {
 const GMouseVMT const GMOUSE_DRIVER_VMT[1] = {{
 	{
 		GDRIVER_TYPE_TOUCH,
-		GMOUSE_VFLG_TOUCH | GMOUSE_VFLG_CALIBRATE | GMOUSE_VFLG_CAL_TEST |
+		GMOUSE_VFLG_TOUCH | GMOUSE_VFLG_NOPOLL | GMOUSE_VFLG_CALIBRATE | GMOUSE_VFLG_CAL_TEST |
 			GMOUSE_VFLG_ONLY_DOWN | GMOUSE_VFLG_POORUPDOWN | GMOUSE_VFLG_DEFAULTFINGER,
 		sizeof(GMouse)+GMOUSE_ADS7843_BOARD_DATA_SIZE,
 		_gmouseInitDriver,
@@ -99,12 +117,12 @@ const GMouseVMT const GMOUSE_DRIVER_VMT[1] = {{
 		GMOUSE_ADS7843_FINGER_CLICK_ERROR,			// click
 		GMOUSE_ADS7843_FINGER_MOVE_ERROR			// move
 	},
-	init_board, 	// init
+	MouseInit, 		// init
 	0,				// deinit
 	MouseXYZ,		// get
 	0,				// calsave
 	calibration_load				// calload
 }};
 
-#endif /* GFX_USE_GINPUT && GINPUT_NEED_MOUSE */
+#endif /* GFX_USE_GINPUT && GINPUT_NEED_MOUSE && !GINPUT_DRIVER_MEMORY */
 
@@ -19,6 +19,9 @@
 // How much extra data to allocate at the end of the GMouse structure for the board's use
 #define GMOUSE_ADS7843_BOARD_DATA_SIZE			0
 
+/// The board calls this from the T_PEN falling edge interrupt
+void ADS7843_PenIRQ(void);
+
 extern gBool TOUCH_init_board();
 static GFXINLINE gBool init_board(GMouse* m, unsigned driverinstance) {
     return TOUCH_init_board();
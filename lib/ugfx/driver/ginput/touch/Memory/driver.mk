@@ -0,0 +1,2 @@
+GFXINC += $(GFXLIB)/drivers/ginput/touch/Memory
+GFXSRC += $(GFXLIB)/drivers/ginput/touch/Memory/gmouse_lld_Memory.c
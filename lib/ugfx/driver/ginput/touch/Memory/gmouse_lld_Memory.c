@@ -0,0 +1,71 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+#include "gfx.h"
+
+#if GFX_USE_GINPUT && GINPUT_NEED_MOUSE && GINPUT_DRIVER_MEMORY
+
+#define GMOUSE_DRIVER_VMT		GMOUSEVMT_Memory
+#include "../../../../src/ginput/ginput_driver_mouse.h"
+#include "gmouse_memory.h"
+
+static volatile gCoord	touchX, touchY;
+static volatile gBool	touchDown;
+
+void gmouseMemorySet(gCoord x, gCoord y, gBool pressed) {
+	touchX = x;
+	touchY = y;
+	touchDown = pressed;
+}
+
+static gBool MouseInit(GMouse* m, unsigned driverinstance) {
+	(void)m;
+	(void)driverinstance;
+	touchDown = gFalse;
+	return gTrue;
+}
+
+static gBool MouseXYZ(GMouse* m, GMouseReading* pdr) {
+	(void)m;
+	pdr->buttons = 0;
+	pdr->x = touchX;
+	pdr->y = touchY;
+	pdr->z = touchDown ? 1 : 0;
+	return gTrue;
+}
+
+const GMouseVMT const GMOUSE_DRIVER_VMT[1] = {{
+	{
+		GDRIVER_TYPE_TOUCH,
+		GMOUSE_VFLG_TOUCH | GMOUSE_VFLG_ONLY_DOWN | GMOUSE_VFLG_DEFAULTFINGER | GMOUSE_VFLG_SELFROTATION,	// already in display coordinates
+		sizeof(GMouse),
+		_gmouseInitDriver,
+		_gmousePostInitDriver,
+		_gmouseDeInitDriver
+	},
+	1,				// z_max
+	0,				// z_min
+	1,				// z_touchon
+	0,				// z_touchoff
+	{				// pen_jitter
+		0,			// calibrate
+		0,			// click
+		0			// move
+	},
+	{				// finger_jitter
+		0,			// calibrate
+		0,			// click
+		0			// move
+	},
+	MouseInit, 		// init
+	0,				// deinit
+	MouseXYZ,		// get
+	0,				// calsave
+	0				// calload
+}};
+
+#endif /* GFX_USE_GINPUT && GINPUT_NEED_MOUSE && GINPUT_DRIVER_MEMORY */
@@ -0,0 +1,39 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    driver/ginput/touch/Memory/gmouse_memory.h
+ * @brief   Touch panel of host builds, the program sets the touch
+ * @details The readings are in display coordinates, there is no calibration. Used instead of the ADS7843 when
+ *			GINPUT_DRIVER_MEMORY is GFXON.
+ */
+
+#ifndef _GMOUSE_MEMORY_H
+#define _GMOUSE_MEMORY_H
+
+#include "gfx.h"
+
+#if GFX_USE_GINPUT && GINPUT_NEED_MOUSE && GINPUT_DRIVER_MEMORY
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief	Set the reading, which the driver returns from now on
+ * @param	x, y	position on the display
+ * @param	pressed	gTrue while touched
+ */
+void gmouseMemorySet(gCoord x, gCoord y, gBool pressed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GFX_USE_GINPUT && GINPUT_NEED_MOUSE && GINPUT_DRIVER_MEMORY */
+
+#endif /* _GMOUSE_MEMORY_H */
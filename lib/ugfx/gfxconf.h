@@ -95,7 +95,8 @@
 //    #define GDISP_NEED_TEXT_WORDWRAP                 GFXOFF
 //    #define GDISP_NEED_TEXT_BOXPADLR                 1
 //    #define GDISP_NEED_TEXT_BOXPADTB                 1
-//    #define GDISP_NEED_ANTIALIAS                     GFXON
+    #define GDISP_NEED_ANTIALIAS                     GFXON
+    #define GDISP_NEED_TEXT_GLYPHCACHE               GFXON       // labels are redrawn on every volume change
 //    #define GDISP_NEED_UTF8                          GFXOFF
 //    #define GDISP_NEED_TEXT_KERNING                  GFXOFF
 //    #define GDISP_INCLUDE_FONT_UI1                   GFXOFF
@@ -120,7 +121,7 @@
 //    #define GDISP_INCLUDE_USER_FONTS                 GFXOFF
 
 #define GDISP_NEED_IMAGE                             GFXON
-//    #define GDISP_NEED_IMAGE_NATIVE                  GFXOFF
+    #define GDISP_NEED_IMAGE_NATIVE                  GFXON       // icons are kept decoded in pixmaps
 //    #define GDISP_NEED_IMAGE_GIF                     GFXOFF
 //        #define GDISP_IMAGE_GIF_BLIT_BUFFER_SIZE     32
     #define GDISP_NEED_IMAGE_BMP                     GFXON
@@ -152,11 +153,26 @@
 //        #define GDISP_NEED_IMAGE_PNG_RGBALPHA_16     GFXON
 //        #define GDISP_IMAGE_PNG_BLIT_BUFFER_SIZE     32
 //        #define GDISP_IMAGE_PNG_FILE_BUFFER_SIZE     8
-//        #define GDISP_IMAGE_PNG_Z_BUFFER_SIZE        32768
+        #define GDISP_IMAGE_PNG_Z_BUFFER_SIZE        8192        // a 32x32 RGBA icon inflates to 4128 bytes
+    #define GDISP_NEED_IMAGE_RLE                     GFXON       // palette and runs, made by scripts/icon2rle.py
+//        #define GDISP_IMAGE_RLE_BLIT_BUFFER_SIZE     32
+//        #define GDISP_IMAGE_RLE_FILE_BUFFER_SIZE     16
 //    #define GDISP_NEED_IMAGE_ACCOUNTING              GFXOFF
 
-//#define GDISP_NEED_PIXMAP                            GFXOFF
-//    #define GDISP_NEED_PIXMAP_IMAGE                  GFXOFF
+#define GDISP_NEED_PIXMAP                            GFXON       // lines are composed off-screen
+    #define GDISP_NEED_PIXMAP_IMAGE                  GFXON
+
+#ifdef TESTING
+    #define GDISP_NEED_PIXEL_ACCOUNTING              GFXON       // benchmarks count the written pixels
+    #define GDISP_NEED_IMAGE_ACCOUNTING              GFXON       // and the memory of the decoders
+#endif
+
+// Host builds draw into RAM instead of the ILI9341, see driver/gdisp/Memory
+#ifdef NATIVE
+    #define GDISP_DRIVER_MEMORY                      GFXON
+#else
+    #define GDISP_DRIVER_MEMORY                      GFXOFF
+#endif
 
 #define GDISP_DEFAULT_ORIENTATION                    gOrientation270    // If not defined the native hardware
 //orientation is used. #define GDISP_LINEBUF_SIZE                           128 #define GDISP_STARTUP_COLOR GFX_BLACK
@@ -288,7 +304,15 @@
 //    #define GINPUT_TOUCH_NOTOUCH                     GFXOFF
 //    #define GINPUT_TOUCH_NOCALIBRATE                 GFXOFF
 //    #define GINPUT_TOUCH_NOCALIBRATE_GUI             GFXOFF
+    #define GINPUT_TOUCH_FIXEDPOINT_CALIBRATION      GFXON
     #define GINPUT_MOUSE_POLL_PERIOD                 5
+    // Host builds take the touch from the program instead of the ADS7843, see driver/ginput/touch/Memory. TOUCH_ADS7843
+    // keeps the ADS7843 driver, for a test which simulates the panel
+    #if defined(NATIVE) && !defined(TOUCH_ADS7843)
+        #define GINPUT_DRIVER_MEMORY                 GFXON
+    #else
+        #define GINPUT_DRIVER_MEMORY                 GFXOFF
+    #endif
 //    #define GINPUT_MOUSE_CLICK_TIME                  300
 //    #define GINPUT_TOUCH_CXTCLICK_TIME               700
 //    #define GINPUT_TOUCH_USER_CALIBRATION_LOAD       GFXOFF
@@ -322,6 +346,7 @@
 
 #define GFILE_NEED_MEMFS                             GFXON
 #define GFILE_NEED_ROMFS                             GFXON
+#define GFILE_NEED_STREAMFS                          GFXON       // icons are decoded while they arrive
 //#define GFILE_NEED_RAMFS                             GFXOFF
 //#define GFILE_NEED_FATFS                             GFXOFF
 //#define GFILE_NEED_NATIVEFS                          GFXOFF
@@ -330,7 +355,7 @@
 
 //#define GFILE_ALLOW_FLOATS                           GFXOFF
 //#define GFILE_ALLOW_DEVICESPECIFIC                   GFXOFF
-#define GFILE_MAX_GFILES                             5
+#define GFILE_MAX_GFILES                             6           // an icon per line, and the one being received
 
 ///////////////////////////////////////////////////////////////////////////
 // GADC                                                                  //
@@ -28,6 +28,16 @@
 	static GTimer	FlushTimer;
 #endif
 
+#if GDISP_NEED_TEXT && GDISP_NEED_TEXT_GLYPHCACHE && GDISP_NEED_MULTITHREAD
+	// The glyph cache is shared by all displays, which may be drawn from different threads
+	static gfxMutex	GlyphCacheMutex;
+	#define GLYPHCACHE_ENTER()	gfxMutexEnter(&GlyphCacheMutex)
+	#define GLYPHCACHE_EXIT()	gfxMutexExit(&GlyphCacheMutex)
+#else
+	#define GLYPHCACHE_ENTER()
+	#define GLYPHCACHE_EXIT()
+#endif
+
 GDisplay	*GDISP;
 
 #if GDISP_NEED_MULTITHREAD
@@ -557,6 +567,10 @@ static void line_clip(GDisplay *g) {
 
 void _gdispInit(void)
 {
+	#if GDISP_NEED_TEXT && GDISP_NEED_TEXT_GLYPHCACHE && GDISP_NEED_MULTITHREAD
+		gfxMutexInit(&GlyphCacheMutex);
+	#endif
+
 	// GDISP_DRIVER_LIST is defined - create each driver instance
 	#if defined(GDISP_DRIVER_LIST)
 		{
@@ -715,6 +729,10 @@ gPowermode gdispGGetPowerMode(GDisplay *g)		{ return g->g.Powermode; }
 gOrientation gdispGGetOrientation(GDisplay *g)	{ return g->g.Orientation; }
 gU8 gdispGGetBacklight(GDisplay *g)			{ return g->g.Backlight; }
 gU8 gdispGGetContrast(GDisplay *g)			{ return g->g.Contrast; }
+#if GDISP_NEED_PIXEL_ACCOUNTING
+	gU32 gdispGGetPixelsWritten(GDisplay *g)	{ return g->pixelsWritten; }
+	void gdispGResetPixelsWritten(GDisplay *g)	{ g->pixelsWritten = 0; }
+#endif
 
 void gdispGFlush(GDisplay *g) {
 	#if GDISP_HARDWARE_FLUSH
@@ -3269,6 +3287,16 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 			}
 			if (x+count > GD->t.clipx1)
 				count = GD->t.clipx1 - x;
+			#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
+				// Pixmaps can be read back, but not every display. Those get the non anti-aliased approximation.
+				if (!gvmt(GD)->get) {
+					if (alpha > 0x80) {
+						GD->p.x = x; GD->p.y = y; GD->p.x1 = x+count-1; GD->p.color = GD->t.color;
+						hline_clip(GD);
+					}
+					return;
+				}
+			#endif
 			if (alpha == 255) {
 				GD->p.x = x; GD->p.y = y; GD->p.x1 = x+count-1; GD->p.color = GD->t.color;
 				hline_clip(GD);
@@ -3324,9 +3352,195 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		#define fillcharline	drawcharline
 	#endif
 
+	#if GDISP_NEED_TEXT_GLYPHCACHE
+		typedef struct glyphspan {
+			gI8				x, y;			// Relative to the glyph origin
+			gU8				count;
+			gColor			color;
+		} glyphspan;
+
+		typedef struct glyphentry {
+			gFont			font;
+			gColor			color;
+			gColor			bgcolor;		// Only valid for filled glyphs
+			gU16			ch;
+			gU16			first;			// Index of the first span
+			gU16			count;			// Number of spans
+			gU8				width;			// Advance returned by mcufont
+			gBool			fill;
+		} glyphentry;
+
+		static struct {
+			gBool			disabled;
+			gBool			lutvalid;
+			gColor			lutcolor;
+			gColor			lutbgcolor;
+			gColor			lut[16];		// Blend of color and bgcolor for each mcufont alpha level
+			gU16			glyphs;
+			gU16			spans;
+			glyphentry		glyph[GDISP_TEXT_GLYPHCACHE_GLYPHS];
+			glyphspan		span[GDISP_TEXT_GLYPHCACHE_SPANS];
+		} gcache;
+
+		typedef struct glyphcapture {
+			glyphentry *	pe;
+			gI16			x0, y0;
+			gBool			failed;
+		} glyphcapture;
+
+		static void glyphcache_flush(void) {
+			gcache.glyphs = 0;
+			gcache.spans = 0;
+		}
+
+		void gdispGlyphCacheEnable(gBool enabled) {
+			GLYPHCACHE_ENTER();
+			gcache.disabled = !enabled;
+			glyphcache_flush();
+			GLYPHCACHE_EXIT();
+		}
+
+		/* Pixel callback which stores the spans of a glyph instead of drawing them */
+		static void capturecharline(gI16 x, gI16 y, gU8 count, gU8 alpha, void *state) {
+			#define GC	((glyphcapture *)state)
+			glyphspan *	ps;
+			gColor		color;
+
+			if (GC->failed)
+				return;
+			#if GDISP_NEED_ANTIALIAS
+				if (GC->pe->fill) {
+					color = alpha == 255 ? GC->pe->color : gcache.lut[alpha >> 4];
+				} else
+			#endif
+			{
+				// Same approximation as drawcharline()
+				if (alpha <= 0x80)
+					return;
+				color = GC->pe->color;
+			}
+			x -= GC->x0;
+			y -= GC->y0;
+			if (gcache.spans >= GDISP_TEXT_GLYPHCACHE_SPANS || x < -128 || x > 127 || y < -128 || y > 127) {
+				GC->failed = gTrue;
+				return;
+			}
+			ps = &gcache.span[gcache.spans++];
+			ps->x = x;
+			ps->y = y;
+			ps->count = count;
+			ps->color = color;
+			GC->pe->count++;
+			#undef GC
+		}
+
+		/* Find the glyph in the cache, render it into the cache if it is not there */
+		static glyphentry *glyphcache_get(GDisplay *g, mf_char ch, gBool fill) {
+			glyphentry *	pe;
+			glyphcapture	cap;
+			gU16			i;
+
+			for (i = 0, pe = gcache.glyph; i < gcache.glyphs; i++, pe++) {
+				if (pe->ch == ch && pe->font == g->t.font && pe->fill == fill && pe->color == g->t.color && (!fill || pe->bgcolor == g->t.bgcolor))
+					return pe;
+			}
+
+			#if GDISP_NEED_ANTIALIAS
+				if (fill && (!gcache.lutvalid || gcache.lutcolor != g->t.color || gcache.lutbgcolor != g->t.bgcolor)) {
+					for (i = 0; i < 16; i++)
+						gcache.lut[i] = gdispBlendColor(g->t.color, g->t.bgcolor, i * 0x11);
+					gcache.lutcolor = g->t.color;
+					gcache.lutbgcolor = g->t.bgcolor;
+					gcache.lutvalid = gTrue;
+				}
+			#endif
+
+			// Start again when the cache is full, the glyphs in use come back quickly
+			if (gcache.glyphs >= GDISP_TEXT_GLYPHCACHE_GLYPHS)
+				glyphcache_flush();
+
+			for (i = 0; i < 2; i++) {
+				pe = &gcache.glyph[gcache.glyphs];
+				pe->font = g->t.font;
+				pe->color = g->t.color;
+				pe->bgcolor = g->t.bgcolor;
+				pe->ch = ch;
+				pe->first = gcache.spans;
+				pe->count = 0;
+				pe->fill = fill;
+
+				cap.pe = pe;
+				cap.x0 = 0;
+				cap.y0 = 0;
+				cap.failed = gFalse;
+				pe->width = mf_render_character(g->t.font, 0, 0, ch, capturecharline, &cap);
+				if (!cap.failed) {
+					gcache.glyphs++;
+					return pe;
+				}
+
+				// Out of spans, try once more with an empty cache
+				if (!gcache.glyphs)
+					break;
+				glyphcache_flush();
+			}
+			gcache.spans = 0;
+			return 0;
+		}
+
+		/* Whether drawcharline() blends with the display, decided per display as pixmaps can be read back */
+		#if GDISP_NEED_ANTIALIAS && GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
+			#define blendtext(g)	(gvmt(g)->get != 0)
+		#elif GDISP_NEED_ANTIALIAS && GDISP_HARDWARE_PIXELREAD
+			#define blendtext(g)	gTrue
+		#else
+			#define blendtext(g)	gFalse
+		#endif
+
+		/* Draw the stored spans of a glyph. The caller holds the display, the cache is locked on its own */
+		static gU8 glyphcache_render(GDisplay *g, gI16 x, gI16 y, mf_char ch, gBool fill) {
+			glyphentry *	pe;
+			glyphspan *		ps;
+			gI16			sx;
+			gU8				count;
+			gU8				width;
+			gU16			i;
+
+			GLYPHCACHE_ENTER();
+			if (gcache.disabled || !(pe = glyphcache_get(g, ch, fill))) {
+				GLYPHCACHE_EXIT();
+				return mf_render_character(g->t.font, x, y, ch, fill ? fillcharline : drawcharline, g);
+			}
+
+			for (i = 0, ps = &gcache.span[pe->first]; i < pe->count; i++, ps++) {
+				sx = x + ps->x;
+				g->p.y = y + ps->y;
+				count = ps->count;
+				if (g->p.y < g->t.clipy0 || g->p.y >= g->t.clipy1 || sx+count <= g->t.clipx0 || sx >= g->t.clipx1)
+					continue;
+				if (sx < g->t.clipx0) {
+					count -= g->t.clipx0 - sx;
+					sx = g->t.clipx0;
+				}
+				if (sx+count > g->t.clipx1)
+					count = g->t.clipx1 - sx;
+				g->p.x = sx; g->p.x1 = sx+count-1; g->p.color = ps->color;
+				hline_clip(g);
+			}
+			width = pe->width;
+			GLYPHCACHE_EXIT();
+			return width;
+		}
+	#endif
+
 	/* Callback to render characters. */
 	static gU8 drawcharglyph(gI16 x, gI16 y, mf_char ch, void *state) {
 		#define GD	((GDisplay *)state)
+			#if GDISP_NEED_TEXT_GLYPHCACHE
+				// Anti-aliased transparent text depends on what is already on the display, if it can be read back
+				if (!blendtext(GD))
+					return glyphcache_render(GD, x, y, ch, gFalse);
+			#endif
 			return mf_render_character(GD->t.font, x, y, ch, drawcharline, state);
 		#undef GD
 	}
@@ -3334,7 +3548,11 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	/* Callback to render characters. */
 	static gU8 fillcharglyph(gI16 x, gI16 y, mf_char ch, void *state) {
 		#define GD	((GDisplay *)state)
-			return mf_render_character(GD->t.font, x, y, ch, fillcharline, state);
+			#if GDISP_NEED_TEXT_GLYPHCACHE
+				return glyphcache_render(GD, x, y, ch, GDISP_NEED_ANTIALIAS ? gTrue : gFalse);
+			#else
+				return mf_render_character(GD->t.font, x, y, ch, fillcharline, state);
+			#endif
 		#undef GD
 	}
 
@@ -313,6 +313,32 @@ gCoord gdispGGetWidth(GDisplay *g);
 gCoord gdispGGetHeight(GDisplay *g);
 #define gdispGetHeight()							gdispGGetHeight(GDISP)
 
+#if GDISP_NEED_PIXEL_ACCOUNTING || defined(__DOXYGEN__)
+	/**
+	 * @brief   Get the number of pixels written to the display since the last reset.
+	 * @pre		GDISP_NEED_PIXEL_ACCOUNTING must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use
+	 *
+	 * @return	The number of pixels written by the low level driver
+	 *
+	 * @api
+	 */
+	gU32 gdispGGetPixelsWritten(GDisplay *g);
+	#define gdispGetPixelsWritten()						gdispGGetPixelsWritten(GDISP)
+
+	/**
+	 * @brief   Reset the written pixel counter of the display.
+	 * @pre		GDISP_NEED_PIXEL_ACCOUNTING must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use
+	 *
+	 * @api
+	 */
+	void gdispGResetPixelsWritten(GDisplay *g);
+	#define gdispResetPixelsWritten()					gdispGResetPixelsWritten(GDISP)
+#endif
+
 /**
  * @brief   Get the current display power mode.
  *
@@ -1113,6 +1139,21 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	 * @api
 	 */
 	gBool gdispAddFont(gFont font);
+
+	#if GDISP_NEED_TEXT_GLYPHCACHE || defined(__DOXYGEN__)
+		/**
+		 * @brief	Turn the glyph cache on or off.
+		 * @details	The cache is emptied in both cases. It is on after start-up.
+		 * @pre		GDISP_NEED_TEXT_GLYPHCACHE must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] enabled	gTrue to use the cache
+		 *
+		 * @note	Meant for measuring the cache and for freeing it from stale fonts.
+		 *
+		 * @api
+		 */
+		void gdispGlyphCacheEnable(gBool enabled);
+	#endif
 #endif
 
 /* Extra Arc Functions */
@@ -11,7 +11,8 @@ GFXSRC +=   $(GFXLIB)/src/gdisp/gdisp.c \
 			$(GFXLIB)/src/gdisp/gdisp_image_gif.c \
 			$(GFXLIB)/src/gdisp/gdisp_image_bmp.c \
 			$(GFXLIB)/src/gdisp/gdisp_image_jpg.c \
-			$(GFXLIB)/src/gdisp/gdisp_image_png.c
+			$(GFXLIB)/src/gdisp/gdisp_image_png.c \
+			$(GFXLIB)/src/gdisp/gdisp_image_rle.c
 			
 MFDIR = $(GFXLIB)/src/gdisp/mcufont
 include $(GFXLIB)/src/gdisp/mcufont/mcufont.mk
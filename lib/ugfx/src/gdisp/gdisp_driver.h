@@ -341,6 +341,11 @@ struct GDisplay {
 		gMutex				mutex;
 	#endif
 
+	// Pixel accounting - incremented by the driver
+	#if GDISP_NEED_PIXEL_ACCOUNTING
+		gU32					pixelsWritten;
+	#endif
+
 	// Software clipping
 	#if GDISP_HARDWARE_CLIP != GFXON && (GDISP_NEED_CLIP || GDISP_NEED_VALIDATION)
 		gCoord					clipx0, clipy0;
@@ -733,7 +738,7 @@ typedef struct GDISPVMT {
 
 	// Build the VMT
 	const GDISPVMT const GDISP_DRIVER_VMT[1] = {{
-		{ GDRIVER_TYPE_DISPLAY, 0, sizeof(GDisplay), _gdispInitDriver, _gdispPostInitDriver, _gdispDeInitDriver },
+		{ GDRIVER_TYPE_DISPLAY, GDISP_DRIVER_VMT_FLAGS, sizeof(GDisplay), _gdispInitDriver, _gdispPostInitDriver, _gdispDeInitDriver },
 		gdisp_lld_init,
 		#if GDISP_HARDWARE_DEINIT
 			gdisp_lld_deinit,
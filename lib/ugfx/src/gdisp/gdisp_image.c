@@ -54,6 +54,17 @@
 	extern gDelay gdispImageNext_PNG(gdispImage *img);
 #endif
 
+#if GDISP_NEED_IMAGE_RLE
+	extern gdispImageError gdispImageOpen_RLE(gdispImage *img);
+	extern void gdispImageClose_RLE(gdispImage *img);
+	extern gdispImageError gdispImageCache_RLE(gdispImage *img);
+	extern gdispImageError gdispGImageDraw_RLE(GDisplay *g, gdispImage *img, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord sx, gCoord sy);
+	extern gDelay gdispImageNext_RLE(gdispImage *img);
+	extern gU16 gdispImageGetPaletteSize_RLE(gdispImage *img);
+	extern gColor gdispImageGetPalette_RLE(gdispImage *img, gU16 index);
+	extern gBool gdispImageAdjustPalette_RLE(gdispImage *img, gU16 index, gColor newColor);
+#endif
+
 /* The structure defining the routines for image drawing */
 typedef struct gdispImageHandlers {
 	gdispImageError	(*open)(gdispImage *img);					/* The open function */
@@ -101,6 +112,12 @@ static gdispImageHandlers ImageHandlers[] = {
 			0,						0,						0
 		},
 	#endif
+	#if GDISP_NEED_IMAGE_RLE
+		{	gdispImageOpen_RLE,				gdispImageClose_RLE,
+			gdispImageCache_RLE,			gdispGImageDraw_RLE,		gdispImageNext_RLE,
+			gdispImageGetPaletteSize_RLE,	gdispImageGetPalette_RLE,	gdispImageAdjustPalette_RLE
+		},
+	#endif
 };
 
 void gdispImageInit(gdispImage *img) {
@@ -116,6 +133,10 @@ gdispImageError gdispImageOpenGFile(gdispImage *img, GFILE *f) {
 		return GDISP_IMAGE_ERR_NOSUCHFILE;
 	img->f = f;
 	img->bgcolor = GFX_WHITE;
+	#if GDISP_NEED_IMAGE_ACCOUNTING
+		img->memused = 0;
+		img->maxmemused = 0;
+	#endif
 	for(img->fns = ImageHandlers; img->fns < ImageHandlers+sizeof(ImageHandlers)/sizeof(ImageHandlers[0]); img->fns++) {
 		err = img->fns->open(img);
 		if (err != GDISP_IMAGE_ERR_BADFORMAT) {
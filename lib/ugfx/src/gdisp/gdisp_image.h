@@ -30,6 +30,7 @@ typedef gU16	gdispImageType;
 	#define GDISP_IMAGE_TYPE_BMP		3
 	#define GDISP_IMAGE_TYPE_JPG		4
 	#define GDISP_IMAGE_TYPE_PNG		5
+	#define GDISP_IMAGE_TYPE_RLE		6
 
 /**
  * @brief	An image error code
@@ -33,6 +33,9 @@ typedef struct PNG_info {
 		#define PNG_COLORMODE_RGBA			0x06		// RGBA
 	gU8		bpp;								// Bits per pixel
 
+	gU32	idatpos;							// The file position of the first image data chunk
+	gU32	idatlen;							// Its length
+
 	gU8		*cache;								// The image cache
 	unsigned	cachesz;							// The image cache size
 
@@ -130,10 +133,12 @@ static void PNG_iInit(PNG_decode *d) {
 		d->i.buflen = d->pinfo->cachesz;
 		d->i.f = 0;
 	} else {
+		// Start in the first image data chunk found by the open, a stream can't go back to the chunks before it
 		d->i.buflen = 0;
-		d->i.chunklen = 0;
-		d->i.chunknext = 8;
+		d->i.chunklen = d->pinfo->idatlen;
+		d->i.chunknext = d->pinfo->idatpos + d->pinfo->idatlen + 12;
 		d->i.f = d->img->f;
+		gfileSetPos(d->i.f, d->pinfo->idatpos + 8);
 	}
 }
 
@@ -1319,6 +1324,8 @@ gdispImageError gdispImageOpen_PNG(gdispImage *img) {
 			#endif
 
 			// All good
+			pinfo->idatpos = pos;
+			pinfo->idatlen = len;
 			return GDISP_IMAGE_ERR_OK;
 
 		#if GDISP_NEED_IMAGE_PNG_PALETTE_124 || GDISP_NEED_IMAGE_PNG_PALETTE_8
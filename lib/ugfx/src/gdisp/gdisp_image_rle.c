@@ -0,0 +1,289 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+#include "../../gfx.h"
+
+#if GFX_USE_GDISP && GDISP_NEED_IMAGE && GDISP_NEED_IMAGE_RLE
+
+#include "gdisp_image_support.h"
+
+/**
+ * The file format, all values are big endian
+ *
+ *	Header		8 bytes		'R', 'L', width (16 bits), height (16 bits), flags, number of palette colors - 1
+ *	Palette		2 bytes		per color, RGB565
+ *	Data		runs of palette indexes, rows follow each other, a run may continue on the next row
+ *		0nnnnnnn iiiiiiii			n+1 pixels of color i
+ *		1nnnnnnn iiiiiiii ...		n+1 pixels, one index each. With RLE_FLG_NIBBLES two indexes per byte, high nibble first
+ */
+#define HEADER_SIZE_RLE			8
+#define RLE_FLG_NIBBLES			0x01		// Literal indexes are 4 bits, the palette has at most 16 colors
+#define RLE_FLG_TRANSPARENT		0x02		// Index 0 is not drawn
+#define RLE_LITERAL				0x80
+
+/**
+ * Runs at least this long are filled, instead of being added to the blit buffer
+ */
+#define RLE_FILL_MIN			8
+
+/**
+ * Helper Routines Needed
+ */
+void *gdispImageAlloc(gdispImage *img, gMemSize sz);
+void gdispImageFree(gdispImage *img, void *ptr, gMemSize sz);
+
+typedef struct gdispImagePrivate_RLE {
+	gU8			flags;
+	gU16		palsize;
+	gColor		*palette;
+	gFileSize	datapos;
+	gPixel		buf[GDISP_IMAGE_RLE_BLIT_BUFFER_SIZE];
+	gU8			fbuf[GDISP_IMAGE_RLE_FILE_BUFFER_SIZE];
+	} gdispImagePrivate_RLE;
+
+typedef struct RLE_decode {
+	GDisplay				*g;
+	gdispImage				*img;
+	gdispImagePrivate_RLE	*priv;
+	gCoord					x, y;			// Where the window is drawn
+	gCoord					sx, sy;			// The window in the image
+	gCoord					ex, ey;			// The end of the window in the image
+	gCoord					ix, iy;			// The next pixel of the image
+	gCoord					bx;				// The image x of buf[0]
+	unsigned				cnt;			// Pixels in buf
+	unsigned				flen;			// Bytes in fbuf
+	unsigned				fpos;			// Next byte in fbuf
+	} RLE_decode;
+
+// Get the next byte of the run data, -1 at the end of the file
+static int RLE_getbyte(RLE_decode *d) {
+	if (d->fpos >= d->flen) {
+		d->flen = gfileRead(d->img->f, d->priv->fbuf, GDISP_IMAGE_RLE_FILE_BUFFER_SIZE);
+		d->fpos = 0;
+		if (!d->flen)
+			return -1;
+	}
+	return d->priv->fbuf[d->fpos++];
+}
+
+// Draw the buffered pixels
+static void RLE_oFlush(RLE_decode *d) {
+	switch(d->cnt) {
+	case 0:		return;
+	case 1:		gdispGDrawPixel(d->g, d->x+d->bx-d->sx, d->y+d->iy-d->sy, d->priv->buf[0]); 						break;
+	default:	gdispGBlitArea(d->g, d->x+d->bx-d->sx, d->y+d->iy-d->sy, d->cnt, 1, 0, 0, d->cnt, d->priv->buf);	break;
+	}
+	d->cnt = 0;
+}
+
+// Output n pixels of one palette index, on the current line and the ones after it
+static void RLE_oRun(RLE_decode *d, unsigned idx, unsigned n) {
+	gdispImagePrivate_RLE *	priv;
+	gColor					c;
+	gCoord					len, from, to;
+
+	priv = d->priv;
+	c = priv->palette[idx];
+	while(n && d->iy < d->ey) {
+		// The part of the run on this line
+		len = d->img->width - d->ix;
+		if ((unsigned)len > n)
+			len = n;
+
+		// The part of that in the window
+		from = d->ix < d->sx ? d->sx : d->ix;
+		to = d->ix+len > d->ex ? d->ex : d->ix+len;
+		if (d->iy >= d->sy && from < to) {
+			if (!idx && (priv->flags & RLE_FLG_TRANSPARENT)) {
+				// Just skip the pixels
+				RLE_oFlush(d);
+			} else if (to - from >= RLE_FILL_MIN) {
+				RLE_oFlush(d);
+				gdispGFillArea(d->g, d->x+from-d->sx, d->y+d->iy-d->sy, to-from, 1, c);
+			} else {
+				// Buffer them, if they follow the buffered ones
+				if (d->cnt && d->bx+(gCoord)d->cnt != from)
+					RLE_oFlush(d);
+				if (!d->cnt)
+					d->bx = from;
+				for(; from < to; from++) {
+					if (d->cnt >= GDISP_IMAGE_RLE_BLIT_BUFFER_SIZE) {
+						RLE_oFlush(d);
+						d->bx = from;
+					}
+					priv->buf[d->cnt++] = c;
+				}
+			}
+		}
+
+		// Move on, to the next line if this one is done
+		d->ix += len;
+		n -= len;
+		if (d->ix >= d->img->width) {
+			RLE_oFlush(d);
+			d->ix = 0;
+			d->iy++;
+		}
+	}
+}
+
+void gdispImageClose_RLE(gdispImage *img) {
+	gdispImagePrivate_RLE *	priv;
+
+	priv = (gdispImagePrivate_RLE *)img->priv;
+	if (priv) {
+		if (priv->palette)
+			gdispImageFree(img, (void *)priv->palette, priv->palsize * sizeof(gColor));
+		gdispImageFree(img, (void *)priv, sizeof(gdispImagePrivate_RLE));
+		img->priv = 0;
+	}
+}
+
+gdispImageError gdispImageOpen_RLE(gdispImage *img) {
+	gdispImagePrivate_RLE *	priv;
+	gU8						hdr[HEADER_SIZE_RLE];
+	gU16					i, rgb;
+
+	/* Read the 8 byte header */
+	if (gfileRead(img->f, hdr, HEADER_SIZE_RLE) != HEADER_SIZE_RLE)
+		return GDISP_IMAGE_ERR_BADFORMAT;		// It can't be us
+
+	if (hdr[0] != 'R' || hdr[1] != 'L')
+		return GDISP_IMAGE_ERR_BADFORMAT;		// It can't be us
+
+	/* We know we are a palette RLE image */
+	img->flags = (hdr[6] & RLE_FLG_TRANSPARENT) ? GDISP_IMAGE_FLG_TRANSPARENT : 0;
+	img->width = gdispImageGetAlignedBE16(hdr, 2);
+	img->height = gdispImageGetAlignedBE16(hdr, 4);
+	if (img->width < 1 || img->height < 1)
+		return GDISP_IMAGE_ERR_BADDATA;
+	if ((hdr[6] & RLE_FLG_NIBBLES) && hdr[7] >= 16)
+		return GDISP_IMAGE_ERR_BADDATA;
+	if (!(img->priv = gdispImageAlloc(img, sizeof(gdispImagePrivate_RLE))))
+		return GDISP_IMAGE_ERR_NOMEMORY;
+	priv = (gdispImagePrivate_RLE *)img->priv;
+	priv->flags = hdr[6];
+	priv->palsize = (gU16)hdr[7] + 1;
+	priv->datapos = HEADER_SIZE_RLE + priv->palsize * 2;
+
+	/* Convert the palette to our pixel format */
+	if (!(priv->palette = (gColor *)gdispImageAlloc(img, priv->palsize * sizeof(gColor)))) {
+		gdispImageClose_RLE(img);
+		return GDISP_IMAGE_ERR_NOMEMORY;
+	}
+	for(i = 0; i < priv->palsize; i++) {
+		if (gfileRead(img->f, hdr, 2) != 2) {
+			gdispImageClose_RLE(img);
+			return GDISP_IMAGE_ERR_BADDATA;
+		}
+		rgb = gdispImageGetAlignedBE16(hdr, 0);
+		priv->palette[i] = RGB2COLOR(((rgb >> 8) & 0xF8) | (rgb >> 13), ((rgb >> 3) & 0xFC) | ((rgb >> 9) & 0x03), ((rgb << 3) & 0xF8) | ((rgb >> 2) & 0x07));
+	}
+
+	img->type = GDISP_IMAGE_TYPE_RLE;
+	return GDISP_IMAGE_ERR_OK;
+}
+
+gdispImageError gdispImageCache_RLE(gdispImage *img) {
+	(void) img;
+
+	/* Decoding the runs is not much slower than copying a cached frame */
+	return GDISP_IMAGE_ERR_UNSUPPORTED;
+}
+
+gdispImageError gdispGImageDraw_RLE(GDisplay *g, gdispImage *img, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord sx, gCoord sy) {
+	RLE_decode	d;
+	int			op, idx, n, lit;
+
+	/* Check some reasonableness */
+	if (sx >= img->width || sy >= img->height) return GDISP_IMAGE_ERR_OK;
+	if (sx + cx > img->width) cx = img->width - sx;
+	if (sy + cy > img->height) cy = img->height - sy;
+
+	d.g = g;
+	d.img = img;
+	d.priv = (gdispImagePrivate_RLE *)img->priv;
+	d.x = x;
+	d.y = y;
+	d.sx = sx;
+	d.sy = sy;
+	d.ex = sx + cx;
+	d.ey = sy + cy;
+	d.ix = d.iy = 0;
+	d.bx = 0;
+	d.cnt = d.flen = d.fpos = 0;
+
+	/* The runs can't be skipped, decode from the start until the window is done */
+	gfileSetPos(img->f, d.priv->datapos);
+	while(d.iy < d.ey) {
+		if ((op = RLE_getbyte(&d)) < 0)
+			return GDISP_IMAGE_ERR_BADDATA;
+		n = (op & ~RLE_LITERAL) + 1;
+
+		if (!(op & RLE_LITERAL)) {
+			if ((idx = RLE_getbyte(&d)) < 0 || idx >= d.priv->palsize)
+				return GDISP_IMAGE_ERR_BADDATA;
+			RLE_oRun(&d, idx, n);
+			continue;
+		}
+
+		for(lit = 0; lit < n; lit++) {
+			if (d.priv->flags & RLE_FLG_NIBBLES) {
+				if (!(lit & 1)) {
+					if ((idx = RLE_getbyte(&d)) < 0)
+						return GDISP_IMAGE_ERR_BADDATA;
+					op = idx;
+					idx >>= 4;
+				} else
+					idx = op & 0x0F;
+			} else if ((idx = RLE_getbyte(&d)) < 0)
+				return GDISP_IMAGE_ERR_BADDATA;
+			if (idx >= d.priv->palsize)
+				return GDISP_IMAGE_ERR_BADDATA;
+			RLE_oRun(&d, idx, 1);
+		}
+	}
+
+	return GDISP_IMAGE_ERR_OK;
+}
+
+gDelay gdispImageNext_RLE(gdispImage *img) {
+	(void) img;
+
+	/* No more frames/pages */
+	return gDelayForever;
+}
+
+gU16 gdispImageGetPaletteSize_RLE(gdispImage *img) {
+	gdispImagePrivate_RLE *	priv;
+
+	priv = (gdispImagePrivate_RLE *)img->priv;
+	if (!priv)
+		return 0;
+	return priv->palsize;
+}
+
+gColor gdispImageGetPalette_RLE(gdispImage *img, gU16 index) {
+	gdispImagePrivate_RLE *	priv;
+
+	priv = (gdispImagePrivate_RLE *)img->priv;
+	if (!priv || index >= priv->palsize)
+		return 0;
+	return priv->palette[index];
+}
+
+gBool gdispImageAdjustPalette_RLE(gdispImage *img, gU16 index, gColor newColor) {
+	gdispImagePrivate_RLE *	priv;
+
+	priv = (gdispImagePrivate_RLE *)img->priv;
+	if (!priv || index >= priv->palsize)
+		return gFalse;
+	priv->palette[index] = newColor;
+	return gTrue;
+}
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_IMAGE && GDISP_NEED_IMAGE_RLE */
@@ -192,6 +192,15 @@
 	#ifndef GDISP_NEED_PIXMAP
 		#define GDISP_NEED_PIXMAP				GFXOFF
 	#endif
+	/**
+	 * @brief   Count the pixels the low level driver writes to the display.
+	 * @details	Defaults to GFXOFF
+	 * @note	Used to measure the cost of redraws. The low level driver must
+	 * 			increment the counter, drivers that don't will always report 0.
+	 */
+	#ifndef GDISP_NEED_PIXEL_ACCOUNTING
+		#define GDISP_NEED_PIXEL_ACCOUNTING		GFXOFF
+	#endif
 /**
  * @}
  *
@@ -318,6 +327,15 @@
 	#ifndef GDISP_NEED_IMAGE_PNG
 		#define GDISP_NEED_IMAGE_PNG			GFXOFF
 	#endif
+	/**
+	 * @brief   Is palette RLE image decoding required.
+	 * @details	Defaults to GFXOFF
+	 * @note	A small format for icons, up to 256 RGB565 colors with run length encoded indexes.
+	 * 			See gdisp_image_rle.c for the layout, and scripts/icon2rle.py for the encoder.
+	 */
+	#ifndef GDISP_NEED_IMAGE_RLE
+		#define GDISP_NEED_IMAGE_RLE			GFXOFF
+	#endif
 	/**
 	 * @brief   Is memory accounting required during image decoding.
 	 * @details	Defaults to GFXOFF
@@ -560,6 +578,29 @@
 	#ifndef GDISP_IMAGE_PNG_Z_BUFFER_SIZE
 		#define GDISP_IMAGE_PNG_Z_BUFFER_SIZE	32768
 	#endif
+/**
+ * @}
+ *
+ * @name    GDISP RLE Image Options
+ * @pre		GDISP_NEED_IMAGE and GDISP_NEED_IMAGE_RLE must be GFXON
+ * @{
+ */
+	/**
+	 * @brief   The RLE blit buffer size in pixels.
+	 * @details	Defaults to 32
+	 * @note 	Bigger is faster but requires more RAM.
+	 */
+	#ifndef GDISP_IMAGE_RLE_BLIT_BUFFER_SIZE
+		#define GDISP_IMAGE_RLE_BLIT_BUFFER_SIZE	32
+	#endif
+	/**
+	 * @brief   The RLE input buffer size in bytes.
+	 * @details	Defaults to 16
+	 * @note 	Bigger is faster but requires more RAM.
+	 */
+	#ifndef GDISP_IMAGE_RLE_FILE_BUFFER_SIZE
+		#define GDISP_IMAGE_RLE_FILE_BUFFER_SIZE	16
+	#endif
 /**
  * @}
  *
@@ -613,6 +654,37 @@
 	#ifndef GDISP_NEED_ANTIALIAS
 		#define GDISP_NEED_ANTIALIAS			GFXOFF
 	#endif
+	/**
+	 * @brief	Cache the rendered glyphs.
+	 * @details	Defaults to GFXOFF
+	 * @details	A glyph is decoded once per font, character and color pair. Its spans are stored
+	 * 			with their final color, anti-aliased spans are blended through a 16 entry table.
+	 * 			Later draws of the same glyph only write the stored spans.
+	 * @note	Transparent anti-aliased text is only cached on displays which can't be read back, like
+	 * 			the ILI9341, where it is drawn with the alpha > 0x80 approximation. On those which can,
+	 * 			like pixmaps, it is blended with the display and not cached.
+	 * @note	With the defaults the cache takes 6956 bytes of static RAM on a 32 bit MCU.
+	 * @note	The cache is shared by all displays, GDISP_NEED_MULTITHREAD only protects it
+	 * 			when there is one display.
+	 */
+	#ifndef GDISP_NEED_TEXT_GLYPHCACHE
+		#define GDISP_NEED_TEXT_GLYPHCACHE		GFXOFF
+	#endif
+	/**
+	 * @brief	Number of glyphs the glyph cache holds.
+	 * @details	Defaults to 48
+	 */
+	#ifndef GDISP_TEXT_GLYPHCACHE_GLYPHS
+		#define GDISP_TEXT_GLYPHCACHE_GLYPHS	48
+	#endif
+	/**
+	 * @brief	Number of spans the glyph cache holds, for all glyphs together.
+	 * @details	Defaults to 1024
+	 * @note	A span takes 6 bytes. When the cache is full, it is emptied.
+	 */
+	#ifndef GDISP_TEXT_GLYPHCACHE_SPANS
+		#define GDISP_TEXT_GLYPHCACHE_SPANS		1024
+	#endif
 /**
  * @}
  *
@@ -339,6 +339,43 @@ gBool gfileSync(GFILE *f);
 	GFILE *		gfileOpenMemory(void *memptr, const char *mode);
 #endif
 
+#if GFILE_NEED_STREAMFS || defined(__DOXYGEN__)
+	/**
+	 * @brief	A file which arrives piece by piece, eg. over a serial link
+	 * @details	Only the fields up to @p headsize are set by the user.
+	 */
+	typedef struct GFileStream {
+		int			(*next)(void *param, const gU8 **data);	/* @< Get the next piece, returns its length, 0 at the end. The piece must stay valid until the next call. */
+		void		*param;									/* @< Passed to next() */
+		gU8			*head;									/* @< The start of the file is kept here, so it can be read again */
+		gFileSize	headsize;								/* @< Size of @p head */
+		// Internal
+		const gU8	*data;
+		gFileSize	datalen;
+		gFileSize	datapos;
+		gFileSize	headlen;
+		gBool		end;
+		gBool		lost;
+	} GFileStream;
+
+	/**
+	 * @brief					Open a file, which is read while it's received
+	 *
+	 * @param[in] s				The stream, only @p next, @p param, @p head and @p headsize need to be set
+	 * @param[in] mode			The mode.
+	 *
+	 * @return					Valid GFILE on success, 0 otherwise
+	 *
+	 * @note					The file can be read forward as it arrives. Seeking back only works
+	 * 							into the head, or inside the last piece. If a decoder reads further back,
+	 * 							the read fails and @p s->lost is set, then a bigger head is needed.
+	 * @note					Supported operations are: read, getpos, setpos, eof
+	 *
+	 * @api
+	 */
+	GFILE *		gfileOpenStream(GFileStream *s, const char *mode);
+#endif
+
 #if GFILE_NEED_STRINGS || defined(__DOXYGEN__)
 	/**
 	 * @brief					Open file from a null terminated C string
@@ -10,6 +10,7 @@ GFXSRC +=   $(GFXLIB)/src/gfile/gfile.c \
             $(GFXLIB)/src/gfile/gfile_fs_fatfs.c \
             $(GFXLIB)/src/gfile/gfile_fs_petitfs.c \
             $(GFXLIB)/src/gfile/gfile_fs_mem.c \
+            $(GFXLIB)/src/gfile/gfile_fs_stream.c \
             $(GFXLIB)/src/gfile/gfile_fs_chibios.c \
             $(GFXLIB)/src/gfile/gfile_fs_strings.c \
             $(GFXLIB)/src/gfile/gfile_printg.c \
@@ -0,0 +1,140 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/********************************************************
+ * The stream file-system
+ ********************************************************/
+
+#include "../../gfx.h"
+
+#if GFX_USE_GFILE && GFILE_NEED_STREAMFS
+
+#include "gfile_fs.h"
+
+#include <string.h>
+
+static int STRRead(GFILE *f, void *buf, int size);
+static gBool STRSetpos(GFILE *f, gFileSize pos);
+static gBool STREof(GFILE *f);
+
+static const GFILEVMT FsStreamVMT = {
+	GFSFLG_SEEKABLE,									// flags
+	0,													// prefix
+	0, 0, 0, 0,
+	0, 0, STRRead, 0,
+	STRSetpos, 0, STREof,
+	0, 0, 0,
+	#if GFILE_NEED_FILELISTS
+		0, 0, 0,
+	#endif
+};
+
+#define STR(f)		((GFileStream *)(f)->obj)
+
+// Get the next piece. Its start is copied into the head, so it can be read again.
+static gBool STRNext(GFileStream *s) {
+	const gU8	*data;
+	int			len;
+
+	if (s->end)
+		return gFalse;
+	if ((len = s->next(s->param, &data)) <= 0) {
+		s->end = gTrue;
+		return gFalse;
+	}
+	s->datapos += s->datalen;
+	s->data = data;
+	s->datalen = len;
+	if (s->datapos < s->headsize) {
+		if (len > s->headsize - s->datapos)
+			len = s->headsize - s->datapos;
+		memcpy(s->head + s->datapos, data, len);
+		s->headlen = s->datapos + len;
+	}
+	return gTrue;
+}
+
+static int STRRead(GFILE *f, void *buf, int size) {
+	GFileStream	*s = STR(f);
+	gFileSize	pos = f->pos;
+	gU8			*p = (gU8 *)buf;
+	int			len;
+
+	// Once anything is lost, the decoder would only read garbage
+	if (s->lost)
+		return 0;
+
+	while(size) {
+		if (pos < s->headlen) {
+			// From the head, this is how the start of the file is read again
+			len = s->headlen - pos;
+			if (len > size)
+				len = size;
+			memcpy(p, s->head + pos, len);
+		} else if (pos >= s->datapos && pos < s->datapos + s->datalen) {
+			// From the current piece
+			len = s->datapos + s->datalen - pos;
+			if (len > size)
+				len = size;
+			memcpy(p, s->data + (pos - s->datapos), len);
+		} else if (pos >= s->datapos + s->datalen) {
+			// Forward, wait for the next piece
+			if (!STRNext(s))
+				break;
+			continue;
+		} else {
+			// Gone, it was neither kept in the head nor is it in the current piece
+			s->lost = gTrue;
+			break;
+		}
+		p += len;
+		pos += len;
+		size -= len;
+	}
+	return p - (gU8 *)buf;
+}
+
+static gBool STRSetpos(GFILE *f, gFileSize pos) {
+	GFileStream	*s = STR(f);
+
+	// Any position forward is fine, the pieces are skipped when read
+	if (pos < s->headlen || pos >= s->datapos)
+		return gTrue;
+	s->lost = gTrue;
+	return gFalse;
+}
+
+static gBool STREof(GFILE *f) {
+	GFileStream	*s = STR(f);
+
+	return s->end && f->pos >= s->datapos + s->datalen;
+}
+
+GFILE *	gfileOpenStream(GFileStream *s, const char *mode) {
+	GFILE	*f;
+
+	// Get an empty file and set the flags
+	if (!(f = _gfileFindSlot(mode)))
+		return 0;
+
+	// Nothing is received yet
+	s->data = 0;
+	s->datalen = 0;
+	s->datapos = 0;
+	s->headlen = 0;
+	s->end = gFalse;
+	s->lost = gFalse;
+
+	// File is open - fill in all the details
+	f->vmt = &FsStreamVMT;
+	f->obj = s;
+	f->pos = 0;
+	f->flags |= GFILEFLG_OPEN|GFILEFLG_CANSEEK;
+	return f;
+}
+
+#endif //GFX_USE_GFILE && GFILE_NEED_STREAMFS
@@ -179,6 +179,15 @@
 	#ifndef GFILE_NEED_MEMFS
 		#define GFILE_NEED_MEMFS		GFXOFF
 	#endif
+	/**
+	 * @brief   Include support for files, which are read while they are received
+	 * @details	Defaults to GFXOFF
+	 * @note	Use the @p gfileOpenStream() call to open a GFILE from a @p GFileStream.
+	 * @note	A GFile of this type cannot be opened by filename.
+	 */
+	#ifndef GFILE_NEED_STREAMFS
+		#define GFILE_NEED_STREAMFS		GFXOFF
+	#endif
 	/**
 	 * @brief   Include support for file list functions
 	 * @details	Defaults to GFXOFF
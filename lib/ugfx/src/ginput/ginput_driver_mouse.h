@@ -36,6 +36,18 @@ typedef struct GMouseReading {
 		float	by;
 		float	cy;
 	} GMouseCalibration;
+
+	#if GINPUT_TOUCH_FIXEDPOINT_CALIBRATION
+		// The calibration in Q16.16
+		typedef struct GMouseCalibrationFixed {
+			gI32	ax;
+			gI32	bx;
+			gI32	cx;
+			gI32	ay;
+			gI32	by;
+			gI32	cy;
+		} GMouseCalibrationFixed;
+	#endif
 #endif
 
 typedef struct GMouse {
@@ -55,10 +67,48 @@ typedef struct GMouse {
 	GDisplay *							display;			// The display the mouse is associated with
 	#if !GINPUT_TOUCH_NOCALIBRATE
 		GMouseCalibration				caldata;			// The calibration data
+		#if GINPUT_TOUCH_FIXEDPOINT_CALIBRATION
+			GMouseCalibrationFixed		calfixed;			// The calibration data converted for the transform
+		#endif
 	#endif
 	// Other driver specific fields may follow.
 } GMouse;
 
+#if !GINPUT_TOUCH_NOCALIBRATE && GINPUT_TOUCH_FIXEDPOINT_CALIBRATION
+	static GFXINLINE gI32 _gmouseFloatToQ16(float f) {
+		return (gI32)(f * 65536.0f + (f < 0 ? -0.5f : 0.5f));
+	}
+
+	/**
+	 * @brief	Convert the calibration for @p _gmouseCalibrationTransformFixed()
+	 *
+	 * @notapi
+	 */
+	static GFXINLINE void _gmouseCalibrationToFixed(GMouseCalibrationFixed *q, const GMouseCalibration *c) {
+		q->ax = _gmouseFloatToQ16(c->ax);
+		q->bx = _gmouseFloatToQ16(c->bx);
+		q->cx = _gmouseFloatToQ16(c->cx);
+		q->ay = _gmouseFloatToQ16(c->ay);
+		q->by = _gmouseFloatToQ16(c->by);
+		q->cy = _gmouseFloatToQ16(c->cy);
+	}
+
+	/**
+	 * @brief	Calibrate a reading, the result is rounded down like the float version truncates it
+	 *
+	 * @notapi
+	 */
+	static GFXINLINE void _gmouseCalibrationTransformFixed(GMouseReading *pt, const GMouseCalibrationFixed *q) {
+		gCoord x, y;
+
+		x = (gCoord) (((gI64)q->ax * pt->x + (gI64)q->bx * pt->y + q->cx) >> 16);
+		y = (gCoord) (((gI64)q->ay * pt->x + (gI64)q->by * pt->y + q->cy) >> 16);
+
+		pt->x = x;
+		pt->y = y;
+	}
+#endif
+
 typedef struct GMouseJitter {
 	gCoord		calibrate;									// Maximum error for a calibration to succeed
 	gCoord		click;										// Movement allowed without discarding the CLICK or CLICKCXT event
@@ -71,14 +71,28 @@ static GTIMER_DECL(MouseTimer);
 #if !GINPUT_TOUCH_NOCALIBRATE
 	#include <string.h>							// Required for memcpy
 
-	static GFXINLINE void CalibrationTransform(GMouseReading *pt, const GMouseCalibration *c) {
-		gCoord x, y;
+	static GFXINLINE void CalibrationTransform(GMouseReading *pt, const GMouse *m) {
+		#if GINPUT_TOUCH_FIXEDPOINT_CALIBRATION
+			_gmouseCalibrationTransformFixed(pt, &m->calfixed);
+		#else
+			const GMouseCalibration *c = &m->caldata;
+			gCoord x, y;
 
-		x = (gCoord) (c->ax * pt->x + c->bx * pt->y + c->cx);
-		y = (gCoord) (c->ay * pt->x + c->by * pt->y + c->cy);
+			x = (gCoord) (c->ax * pt->x + c->bx * pt->y + c->cx);
+			y = (gCoord) (c->ay * pt->x + c->by * pt->y + c->cy);
 
-		pt->x = x;
-		pt->y = y;
+			pt->x = x;
+			pt->y = y;
+		#endif
+	}
+
+	// Call when the float calibration data has changed
+	static GFXINLINE void CalibrationUpdated(GMouse *m) {
+		#if GINPUT_TOUCH_FIXEDPOINT_CALIBRATION
+			_gmouseCalibrationToFixed(&m->calfixed, &m->caldata);
+		#else
+			(void) m;
+		#endif
 	}
 #endif
 
@@ -191,7 +205,7 @@ static void GetMouseReading(GMouse *m) {
 			#if !GINPUT_TOUCH_NOCALIBRATE
 				// Do we need to calibrate the reading?
 				if ((m->flags & GMOUSE_FLG_CALIBRATE))
-					CalibrationTransform(&r, &m->caldata);
+					CalibrationTransform(&r, m);
 			#endif
 
 			// We can't clip or rotate if we don't have a display
@@ -335,13 +349,43 @@ static void GetMouseReading(GMouse *m) {
 	m->r.buttons = r.buttons;
 }
 
+// Is the poll timer periodic or does it wait for a wakeup
+static gBool MousePolling;
+
+static void MousePoll(void *param);
+
+static void MouseSchedule(gBool polling) {
+	if (polling == MousePolling && gtimerIsActive(&MouseTimer))
+		return;
+	MousePolling = polling;
+	gtimerStart(&MouseTimer, MousePoll, 0, gTrue, polling ? GINPUT_MOUSE_POLL_PERIOD : gDelayForever);
+}
+
 static void MousePoll(void *param) {
 	GMouse *	m;
+	gBool		polling;
 	(void) 		param;
 
+	polling = gFalse;
 	for(m = (GMouse *)gdriverGetNext(GDRIVER_TYPE_MOUSE, 0); m; m = (GMouse *)gdriverGetNext(GDRIVER_TYPE_MOUSE, (GDriver *)m)) {
-		if (!(gmvmt(m)->d.flags & GMOUSE_VFLG_NOPOLL) || (m->flags & GMOUSE_FLG_NEEDREAD))
+		// An interrupt driven touch panel only wakes us on pen down, keep reading it until the pen is lifted, and while
+		// a pen down or up waits for the next reading to confirm it
+		if (!(gmvmt(m)->d.flags & GMOUSE_VFLG_NOPOLL) || (m->flags & (GMOUSE_FLG_NEEDREAD|GMOUSE_FLG_INDELTA)) || (m->r.buttons & GINPUT_MOUSE_BTN_LEFT))
 			GetMouseReading(m);
+
+		if (!(gmvmt(m)->d.flags & GMOUSE_VFLG_NOPOLL) || (m->flags & GMOUSE_FLG_INDELTA) || (m->r.buttons & GINPUT_MOUSE_BTN_LEFT))
+			polling = gTrue;
+	}
+	MouseSchedule(polling);
+
+	// Restarting the timer clears a wakeup which came in the meantime
+	if (!polling) {
+		for(m = (GMouse *)gdriverGetNext(GDRIVER_TYPE_MOUSE, 0); m; m = (GMouse *)gdriverGetNext(GDRIVER_TYPE_MOUSE, (GDriver *)m)) {
+			if ((m->flags & GMOUSE_FLG_NEEDREAD)) {
+				gtimerJab(&MouseTimer);
+				break;
+			}
+		}
 	}
 }
 
@@ -459,6 +503,8 @@ static void MousePoll(void *param) {
 		m->caldata.cy = (c0 * ((float)points[1].x * (float)points[2].y - (float)points[2].x * (float)points[1].y)
 							- c1 * ((float)points[0].x * (float)points[2].y - (float)points[2].x * (float)points[0].y)
 							+ c2 * ((float)points[0].x * (float)points[1].y - (float)points[1].x * (float)points[0].y)) / dx;
+
+		CalibrationUpdated(m);
 	}
 
 	static gU32 CalibrateMouse(GMouse *m) {
@@ -565,7 +611,7 @@ static void MousePoll(void *param) {
 			pj = (m->flags & GMOUSE_FLG_FINGERMODE) ? &gmvmt(m)->finger_jitter : &gmvmt(m)->pen_jitter;
 
 			// Transform the co-ordinates
-			CalibrationTransform((GMouseReading *)&points[3], &m->caldata);
+			CalibrationTransform((GMouseReading *)&points[3], m);
 
 			// Do we need to rotate the reading to match the display
 			#if GDISP_NEED_CONTROL
@@ -693,9 +739,8 @@ gBool _gmouseInitDriver(GDriver *g, void *display, unsigned driverinstance, unsi
     if (!gmvmt(m)->init((GMouse *)g, driverinstance))
         return gFalse;
 
-	// Ensure the Poll timer is started
-	if (!gtimerIsActive(&MouseTimer))
-		gtimerStart(&MouseTimer, MousePoll, 0, gTrue, GINPUT_MOUSE_POLL_PERIOD);
+	// Ensure the Poll timer is started. Interrupt driven mice don't need it until they wake us up
+	MouseSchedule(!(gmvmt(m)->d.flags & GMOUSE_VFLG_NOPOLL) || MousePolling);
 
     return gTrue;
 
@@ -722,6 +767,10 @@ void _gmousePostInitDriver(GDriver *g) {
 				else
 					while (CalibrateMouse(m));
 			#endif
+
+			// Convert the loaded calibration once, not for every reading
+			if ((m->flags & GMOUSE_FLG_CALIBRATE))
+				CalibrationUpdated(m);
         }
     #endif
 
@@ -822,14 +871,18 @@ gBool ginputGetMouseStatus(unsigned instance, GEventMouse *pe) {
 void _gmouseWakeup(GMouse *m) {
 	if (m)
 		m->flags |= GMOUSE_FLG_NEEDREAD;
-	gtimerJab(&MouseTimer);
+	// While polling, the next poll reads anyway. MousePoll() checks for a wakeup when it stops polling
+	if (!MousePolling)
+		gtimerJab(&MouseTimer);
 }
 
 /* Wake up the mouse driver from an interrupt service routine (there may be new readings available) */
 void _gmouseWakeupI(GMouse *m) {
 	if (m)
 		m->flags |= GMOUSE_FLG_NEEDREAD;
-	gtimerJabI(&MouseTimer);
+	// A touch panel's own conversions may toggle its pen interrupt, they must not make it read again and again
+	if (!MousePolling)
+		gtimerJabI(&MouseTimer);
 }
 
 #endif /* GFX_USE_GINPUT && GINPUT_NEED_MOUSE */
@@ -104,6 +104,16 @@
 	#ifndef GINPUT_TOUCH_NOCALIBRATE
 		#define GINPUT_TOUCH_NOCALIBRATE				GFXOFF
 	#endif
+	/**
+	 * @brief   Apply the touch calibration in fixed point.
+	 * @details	Defaults to GFXOFF
+	 * @note	The calibration is still calculated, saved and loaded as float. It is converted
+	 * 			to Q16.16 once, and each reading is transformed with integer multiply-adds only.
+	 * @note	After clipping to the display, the result is within 1 pixel of the float calculation.
+	 */
+	#ifndef GINPUT_TOUCH_FIXEDPOINT_CALIBRATION
+		#define GINPUT_TOUCH_FIXEDPOINT_CALIBRATION		GFXOFF
+	#endif
 	/**
 	 * @brief   Turn off all touch support.
 	 * @details	Defaults to GFXOFF
@@ -90,6 +90,21 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 		gsw->dpos = (gsw->w.g.width-1)*(gsw->pos-gsw->min)/(gsw->max-gsw->min);
 }
 
+// Redraw the slider after its position or text changed
+static void SliderUpdate(GSliderObject *gsw) {
+	// The incremental renderer can draw just the change, as long as the last drawing is still on the screen
+	if (gsw->w.fnDraw == gwinSliderDraw_Incremental && !(gsw->w.g.flags & GWIN_FLG_NEEDREDRAW)) {
+		if (_gwinDrawStart(&gsw->w.g)) {
+			gsw->w.g.flags |= GSLIDER_FLG_PARTIAL;
+			gsw->w.fnDraw(&gsw->w, gsw->w.fnParam);
+			gsw->w.g.flags &= ~GSLIDER_FLG_PARTIAL;
+			_gwinDrawEnd(&gsw->w.g);
+		}
+		return;
+	}
+	_gwinUpdate(&gsw->w.g);
+}
+
 #if GINPUT_NEED_MOUSE
 	// Set the display position from the mouse position
 	static void SetDisplayPosFromMouse(GSliderObject *gsw, gCoord x, gCoord y) {
@@ -108,7 +123,7 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 			if (x < 0 || x >= gsw->w.g.width || y < 0 || y >= gsw->w.g.height) {
 				// No - restore the slider
 				SliderResetDisplayPos(gsw);
-				_gwinUpdate(&gsw->w.g);
+				SliderUpdate(gsw);
 				SendSliderEvent(gsw, GSLIDER_EVENT_CANCEL);
 				return;
 			}
@@ -135,7 +150,7 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 		#else
 			SliderResetDisplayPos(gsw);
 		#endif
-		_gwinUpdate(&gsw->w.g);
+		SliderUpdate(gsw);
 
 		// Generate the event
 		SendSliderEvent(gsw, GSLIDER_EVENT_SET);
@@ -151,7 +166,7 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 		SetDisplayPosFromMouse(gsw, x, y);
 
 		// Update the display
-		_gwinUpdate(&gsw->w.g);
+		SliderUpdate(gsw);
 
 		// Send the event
 		SendSliderEvent(gsw, GSLIDER_EVENT_START);
@@ -167,7 +182,7 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 		SetDisplayPosFromMouse(gsw, x, y);
 
 		// Update the display
-		_gwinUpdate(&gsw->w.g);
+		SliderUpdate(gsw);
 
 		// Send the event
 		SendSliderEvent(gsw, GSLIDER_EVENT_MOVE);
@@ -213,7 +228,7 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 		gsw->pos = (gU16)((gU32)value*(gsw->max-gsw->min)/max + gsw->min);
 
 		SliderResetDisplayPos(gsw);
-		_gwinUpdate(&gsw->w.g);
+		SliderUpdate(gsw);
 
 		// Generate the event
 		SendSliderEvent(gsw, GSLIDER_EVENT_SET);
@@ -285,6 +300,9 @@ GHandle gwinGSliderCreate(GDisplay *g, GSliderObject *gs, const GWidgetInit *pIn
 	gs->min = 0;
 	gs->max = 100;
 	gs->pos = 0;
+	gs->ddpos = -1;
+	gs->dtxt0 = 0;
+	gs->dtxt1 = -1;
 	SliderResetDisplayPos(gs);
 	gwinSetVisible((GHandle)gs, pInit->g.show);
 	return (GHandle)gs;
@@ -321,7 +339,26 @@ void gwinSliderSetPosition(GHandle gh, int pos) {
 		else gsw->pos = pos;
 	}
 	SliderResetDisplayPos(gsw);
-	_gwinUpdate(gh);
+	SliderUpdate(gsw);
+
+	#undef gsw
+}
+
+void gwinSliderSetPositionText(GHandle gh, int pos, const char *text) {
+	#define gsw		((GSliderObject *)gh)
+
+	if (gh->vmt != (gwinVMT *)&sliderVMT)
+		return;
+
+	// Allocated text is released by gwinSetText(), which also does a full redraw
+	if ((gh->flags & GWIN_FLG_ALLOCTXT)) {
+		gwinSetText(gh, text, gFalse);
+		gwinSliderSetPosition(gh, pos);
+		return;
+	}
+
+	gsw->w.text = (text && *text) ? text : "";
+	gwinSliderSetPosition(gh, pos);
 
 	#undef gsw
 }
@@ -386,6 +423,97 @@ void gwinSliderDraw_Std(GWidgetObject *gw, void *param) {
 	#undef gsw
 }
 
+#if GDISP_NEED_CLIP
+	// Get the span along the slider axis covered by the text, with a pixel of margin for rounding
+	static void SliderTextSpan(GSliderObject *gsw, gCoord *p0, gCoord *p1) {
+		gCoord	len, sz;
+
+		if (!gsw->w.g.font || !*gsw->w.text) {
+			*p0 = 0;
+			*p1 = -1;
+			return;
+		}
+
+		if (gsw->w.g.width < gsw->w.g.height) {
+			len = gsw->w.g.height;
+			sz = gdispGetFontMetric(gsw->w.g.font, gFontHeight);
+		} else {
+			len = gsw->w.g.width;
+			sz = gdispGetStringWidth(gsw->w.text, gsw->w.g.font);
+		}
+
+		// The text is centered in the box inside the edge
+		*p0 = 1 + (len-2-sz)/2 - 1;
+		*p1 = *p0 + sz + 1;
+		if (*p0 < 0) *p0 = 0;
+		if (*p1 > len-1) *p1 = len-1;
+	}
+
+	// Redraw the slider between p0 and p1 (inclusive) along the slider axis
+	static void SliderDrawSpan(GWidgetObject *gw, gCoord p0, gCoord p1) {
+		if (p1 < p0)
+			return;
+		if (gw->g.width < gw->g.height)
+			gdispGSetClip(gw->g.display, gw->g.x, gw->g.y+p0, gw->g.width, p1-p0+1);
+		else
+			gdispGSetClip(gw->g.display, gw->g.x+p0, gw->g.y, p1-p0+1, gw->g.height);
+		gwinSliderDraw_Std(gw, 0);
+	}
+#endif
+
+void gwinSliderDraw_Incremental(GWidgetObject *gw, void *param) {
+	#define gsw			((GSliderObject *)gw)
+
+	if (gw->g.vmt != (gwinVMT *)&sliderVMT)
+		return;
+
+	#if GDISP_NEED_CLIP
+		if ((gw->g.flags & GSLIDER_FLG_PARTIAL) && gsw->ddpos >= 0) {
+			gCoord	len, b0, b1, t0, t1;
+
+			len = gw->g.width < gw->g.height ? gw->g.height : gw->g.width;
+
+			// The band the thumb moved across, including the thumb lines on both sides
+			b0 = (gsw->ddpos < gsw->dpos ? gsw->ddpos : gsw->dpos) - 2;
+			b1 = (gsw->ddpos > gsw->dpos ? gsw->ddpos : gsw->dpos) + 2;
+			if (b0 < 0) b0 = 0;
+			if (b1 > len-1) b1 = len-1;
+
+			// The text area, covering both the old and the new text
+			SliderTextSpan(gsw, &t0, &t1);
+			if (gsw->dtxt0 <= gsw->dtxt1) {
+				if (t0 > t1) {
+					t0 = gsw->dtxt0;
+					t1 = gsw->dtxt1;
+				} else {
+					if (gsw->dtxt0 < t0) t0 = gsw->dtxt0;
+					if (gsw->dtxt1 > t1) t1 = gsw->dtxt1;
+				}
+			}
+
+			// Don't paint the same pixels twice if the areas touch
+			if (t0 <= t1 && t0 <= b1+1 && b0 <= t1+1) {
+				SliderDrawSpan(gw, t0 < b0 ? t0 : b0, t1 > b1 ? t1 : b1);
+			} else {
+				SliderDrawSpan(gw, b0, b1);
+				SliderDrawSpan(gw, t0, t1);
+			}
+
+			// Restore the clipping set up by the window manager
+			gdispGSetClip(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height);
+		} else
+	#endif
+			gwinSliderDraw_Std(gw, param);
+
+	// Remember what is on the screen now
+	gsw->ddpos = gsw->dpos;
+	#if GDISP_NEED_CLIP
+		SliderTextSpan(gsw, &gsw->dtxt0, &gsw->dtxt1);
+	#endif
+
+	#undef gsw
+}
+
 #if GDISP_NEED_IMAGE
 void gwinSliderDraw_Image(GWidgetObject *gw, void *param) {
 	#define gsw			((GSliderObject *)gw)
@@ -51,6 +51,7 @@ typedef struct GEventGWinSlider {
  * @{
  */
 #define GSLIDER_FLG_EXTENDED_EVENTS		0x01
+#define GSLIDER_FLG_PARTIAL				0x02		/* The draw routine may only repaint the changes */
 /** @} */
 
 // A slider window
@@ -67,6 +68,8 @@ typedef struct GSliderObject {
 	int					min;
 	int					max;
 	int					pos;
+	gCoord				ddpos;				// The display position when last drawn (-1 if not drawn)
+	gCoord				dtxt0, dtxt1;		// The span covered by the text when last drawn
 } GSliderObject;
 
 /**
@@ -135,6 +138,22 @@ void gwinSliderSetPosition(GHandle gh, int pos);
  */
 #define gwinSliderGetPosition(gh)		(((GSliderObject *)(gh))->pos)
 
+/**
+ * @brief   Set the slider position and text in one step.
+ * @details	When the slider uses @p gwinSliderDraw_Incremental and is already on screen, only the band between
+ * 			the old and the new thumb position and the text area are redrawn.
+ *
+ * @param[in] gh		The window handle (must be a slider window)
+ * @param[in] pos		The new position
+ * @param[in] text		The new text. It is not copied, so it must remain valid while the slider uses it.
+ *
+ * @note	If the new position is outside the slider range then the position
+ * 			is set to the closest end of the range.
+ *
+ * @api
+ */
+void gwinSliderSetPositionText(GHandle gh, int pos, const char *text);
+
 /**
  * @brief   Should the slider send extended events.
  *
@@ -173,6 +192,21 @@ void gwinSliderSendExtendedEvents(GHandle gh, gBool enabled);
  */
 void gwinSliderDraw_Std(GWidgetObject *gw, void *param);
 
+/**
+ * @brief				Rendering function that redraws only what changed since the last draw.
+ *
+ * @param[in] gw		The widget object (must be a slider object).
+ * @param[in] param		A parameter passed in from the user. Ignored by this function.
+ *
+ * @note				It looks exactly like @p gwinSliderDraw_Std(). Full redraws (showing the widget, window
+ * 						manager redraws) repaint everything, position and text updates repaint only the band
+ * 						between the old and the new thumb position and the text area.
+ * @note				Without GDISP_NEED_CLIP it always draws the whole widget.
+ *
+ * @api
+ */
+void gwinSliderDraw_Incremental(GWidgetObject *gw, void *param);
+
 #if GDISP_NEED_IMAGE || defined(__DOXYGEN__)
 	/**
 	 * @brief				The default rendering function
@@ -0,0 +1,217 @@
+"""Convert a PNG icon to the palette RLE image format of uGFX (GDISP_NEED_IMAGE_RLE)
+
+The layout is described in lib/ugfx/src/gdisp/gdisp_image_rle.c. Colors are reduced to RGB565 the way the display
+does it, so an icon with up to 256 colors decodes to the same pixels as the PNG. Icons with more colors are reduced
+with median cut.
+
+  python scripts/icon2rle.py icon.png icon.rle
+  python scripts/icon2rle.py icon.png icon.h --c-array icon_rle
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+FLG_NIBBLES = 0x01
+FLG_TRANSPARENT = 0x02
+LITERAL = 0x80
+MAX_RUN = 128
+ALPHA_CLIFF = 32  # GDISP_NEED_IMAGE_PNG_ALPHACLIFF, less is transparent
+
+
+def read_png(path):
+    """Return width, height and rows of (r, g, b, a) pixels. Only 8 bit, not interlaced images"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path} is not a PNG")
+
+    pos, idat, palette, trns = 8, b"", [], b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        pos += length + 12
+
+    if depth != 8 or interlace:
+        raise ValueError(f"{path}: only 8 bit, not interlaced PNGs are supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    raw = zlib.decompress(idat)
+    stride = width * channels
+
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        prev = line
+
+        pixels = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color == 0:
+                pixels.append((px[0], px[0], px[0], 255))
+            elif color == 2:
+                pixels.append((px[0], px[1], px[2], 255))
+            elif color == 3:
+                alpha = trns[px[0]] if px[0] < len(trns) else 255
+                pixels.append(palette[px[0]] + (alpha,))
+            elif color == 4:
+                pixels.append((px[0], px[0], px[0], px[1]))
+            else:
+                pixels.append(tuple(px))
+        rows.append(pixels)
+    return width, height, rows
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def median_cut(counts, n):
+    """Reduce {rgb565: count} to at most n colors, return {rgb565: palette rgb565}"""
+
+    def channels(c):
+        return ((c >> 11) & 0x1F) << 1, (c >> 5) & 0x3F, (c & 0x1F) << 1
+
+    boxes = [list(counts)]
+    while len(boxes) < n:
+        # split the box with the widest channel
+        best = None
+        for i, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            for ch in range(3):
+                values = [channels(c)[ch] for c in box]
+                spread = max(values) - min(values)
+                if best is None or spread > best[0]:
+                    best = (spread, i, ch)
+        if best is None or best[0] == 0:
+            break
+        _, i, ch = best
+        box = sorted(boxes.pop(i), key=lambda c: channels(c)[ch])
+        total, half = sum(counts[c] for c in box), 0
+        for cut, c in enumerate(box):
+            half += counts[c]
+            if half * 2 >= total:
+                break
+        cut = min(max(cut, 0), len(box) - 2) + 1
+        boxes += [box[:cut], box[cut:]]
+
+    mapping = {}
+    for box in boxes:
+        weight = sum(counts[c] for c in box)
+        avg = [sum(channels(c)[ch] * counts[c] for c in box) // weight for ch in range(3)]
+        color = ((avg[0] >> 1) << 11) | (avg[1] << 5) | (avg[2] >> 1)
+        for c in box:
+            mapping[c] = color
+    return mapping
+
+
+def encode_runs(indexes, nibbles):
+    """Split the indexes into runs and literals, see the layout in gdisp_image_rle.c"""
+    min_run = 5 if nibbles else 3  # shorter runs are cheaper as literals
+    out, literal, i = bytearray(), [], 0
+
+    def flush_literal():
+        while literal:
+            part = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(LITERAL | (len(part) - 1))
+            if nibbles:
+                part = part + [0] * (len(part) & 1)
+                out.extend((part[j] << 4) | part[j + 1] for j in range(0, len(part), 2))
+            else:
+                out.extend(part)
+
+    while i < len(indexes):
+        run = 1
+        while i + run < len(indexes) and run < MAX_RUN and indexes[i + run] == indexes[i]:
+            run += 1
+        if run >= min_run:
+            flush_literal()
+            out += bytes((run - 1, indexes[i]))
+            i += run
+        else:
+            literal.append(indexes[i])
+            i += 1
+    flush_literal()
+    return out
+
+
+def encode(width, height, rows, max_colors=256):
+    """Return the RLE file of the pixels"""
+    pixels = [p for row in rows for p in row]
+    transparent = any(a < ALPHA_CLIFF for _, _, _, a in pixels)
+    counts = {}
+    for r, g, b, a in pixels:
+        if a >= ALPHA_CLIFF:
+            c = rgb565(r, g, b)
+            counts[c] = counts.get(c, 0) + 1
+
+    # index 0 is the transparent color, if there is one
+    room = max_colors - (1 if transparent else 0)
+    mapping = {c: c for c in counts} if len(counts) <= room else median_cut(counts, room)
+    palette = ([0] if transparent else []) + sorted(set(mapping.values()), key=lambda c: (-counts.get(c, 0), c))
+    index = {c: palette.index(mapping[c]) for c in mapping}
+
+    indexes = [index[rgb565(r, g, b)] if a >= ALPHA_CLIFF else 0 for r, g, b, a in pixels]
+    nibbles = len(palette) <= 16
+    flags = (FLG_NIBBLES if nibbles else 0) | (FLG_TRANSPARENT if transparent else 0)
+
+    out = bytearray(b"RL") + struct.pack(">HHBB", width, height, flags, len(palette) - 1)
+    for c in palette:
+        out += struct.pack(">H", c)
+    return bytes(out + encode_runs(indexes, nibbles))
+
+
+def c_array(name, data):
+    lines = [f"inline constexpr uint8_t {name}[] = {{"]
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("png", help="source icon")
+    parser.add_argument("out", help="destination, '-' for stdout")
+    parser.add_argument("--colors", type=int, default=256, choices=range(2, 257), metavar="2-256",
+                        help="most colors in the palette, 16 or less packs two pixels per byte")
+    parser.add_argument("--c-array", metavar="NAME", help="write a C++ array instead of the binary file")
+    args = parser.parse_args()
+
+    width, height, rows = read_png(args.png)
+    data = encode(width, height, rows, args.colors)
+    out = c_array(args.c_array, data).encode() if args.c_array else data
+    if args.out == "-":
+        sys.stdout.buffer.write(out)
+    else:
+        with open(args.out, "wb") as f:
+            f.write(out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,116 @@
+"""Pack the default session icons into the uGFX ROMFS
+
+Reads icons/icons.txt, converts each PNG with icon2rle.py and writes src/romfs_icons.h, which src/romfs_files.h
+includes. Each program gets a ROMFS file named after the hash of its executable name, see
+lib/mixer_gui/default_icons.h, so the firmware doesn't store the names. The header is only rewritten when it
+changes, so unchanged icons don't trigger a rebuild.
+
+Runs before every build from platformio.ini, or by hand:
+
+  python scripts/romfs_icons.py
+"""
+
+import os
+import sys
+
+try:
+    Import("env")  # noqa: F821, run by platformio, which doesn't set __file__
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+sys.path.insert(0, os.path.join(ROOT, "scripts"))
+import icon2rle  # noqa: E402
+
+FNV_OFFSET = 0x811C9DC5
+FNV_PRIME = 0x01000193
+
+
+def key(name):
+    """FNV-1a of the lowercase name, without .exe, must match default_icons::key()"""
+    name = name.lower()
+    if name.endswith(".exe"):
+        name = name[:-4]
+    h = FNV_OFFSET
+    for c in name.encode():
+        h = ((h ^ c) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def read_config(path):
+    """Return [(program, png file)] in the order of the file"""
+    entries = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            program, sep, png = (part.strip() for part in line.partition("="))
+            if not sep or not program or not png:
+                raise ValueError(f"{path}:{number}: expected '<program> = <png>'")
+            entries.append((program, png))
+    return entries
+
+
+def generate(config):
+    entries = read_config(config)
+    folder = os.path.dirname(config)
+    out = [
+        "/**",
+        " * The default session icons, generated by scripts/romfs_icons.py from icons/icons.txt. Don't edit.",
+        " *",
+        " * The ROMFS file of a program is named after default_icons::key() of its executable name.",
+        " */",
+        "",
+    ]
+
+    # the data of a PNG is stored once, all its programs point to it
+    arrays, keys = {}, {}
+    for program, png in entries:
+        h = key(program)
+        if h in keys:
+            raise ValueError(f"{config}: '{program}' has the same key as '{keys[h]}'")
+        keys[h] = program
+
+        if png not in arrays:
+            width, height, rows = icon2rle.read_png(os.path.join(folder, png))
+            data = icon2rle.encode(width, height, rows)
+            name = "romfs_icon_" + "".join(c if c.isalnum() else "_" for c in os.path.splitext(png)[0])
+            arrays[png] = (name, len(data))
+            out.append(f"static const char {name}[] = {{")
+            for i in range(0, len(data), 16):
+                out.append("\t" + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+            out += ["};", ""]
+
+        name, size = arrays[png]
+        out += [
+            f"// {program}",
+            "#ifdef ROMFS_DIRENTRY_HEAD",
+            f"\tstatic const ROMFS_DIRENTRY romfs_icon_{h:08x}_dir = "
+            f"{{ 0, 0, ROMFS_DIRENTRY_HEAD, \"{h:08x}.rle\", {size}, {name} }};",
+            "\t#undef ROMFS_DIRENTRY_HEAD",
+            f"\t#define ROMFS_DIRENTRY_HEAD &romfs_icon_{h:08x}_dir",
+            "#endif",
+            "",
+        ]
+    return "\n".join(out)
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return False
+    with open(path, "w", newline="\n") as f:
+        f.write(text)
+    return True
+
+
+def main():
+    config = os.path.join(ROOT, "icons", "icons.txt")
+    header = os.path.join(ROOT, "src", "romfs_icons.h")
+    if write_if_changed(header, generate(config)):
+        print(f"romfs_icons: wrote {os.path.relpath(header, ROOT)}")
+
+
+main()
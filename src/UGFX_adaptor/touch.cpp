@@ -9,6 +9,7 @@
 extern "C" {
 #endif
 
+void ADS7843_PenIRQ(void);
 
 
 gBool TOUCH_init_board() {
@@ -16,11 +17,21 @@ gBool TOUCH_init_board() {
   pin_mode(pins::T_CLK, pin_mode_t::ALTERNATE_PP, GPIO_AF5_SPI2);
   pin_mode(pins::T_MOSI, pin_mode_t::ALTERNATE_PP, GPIO_AF5_SPI2);
   pin_mode(pins::T_MISO, pin_mode_t::ALTERNATE_PP, GPIO_AF5_SPI2);
-  pin_mode(pins::T_PEN, pin_mode_t::INPUT_PU);
+  pin_mode(pins::T_PEN, pin_mode_t::IT_FALLING_PU);
   MX_SPI2_Init();
+
+  // the panel is read only after pen down, the ISR wakes up GINPUT
+  HAL_NVIC_SetPriority(EXTI9_5_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1, 0);
+  HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
   return gTrue;
 }
 
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+  if (GPIO_Pin == pin_api::pin_name_to_num(pins::T_PEN)) {
+    ADS7843_PenIRQ();
+  }
+}
+
 gBool TOUCH_getpin_pressed() {
   return not read_pin(pins::T_PEN);
 }
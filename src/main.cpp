@@ -1,56 +1,132 @@
 #include "STHAL.h"
 #include "FreeRTOS.h"
 #include "task.h"
-#include "pin_api.h"
 #include "gfx.h"
-#include "usb_device.h"
 #include "comm_api.h"
 #include "mixer_gui.h"
 
 #include "comm_class.h"
 
-#include "CDC_Adaptor.h"
+#include "latency_trace.h"
+#include "task_stats.h"
+#include "rtos_trace.h"
+#include "dlog.h"
+#include "metrics.h"
+#include <iterator>
+
+#ifdef NATIVE
+  // the whole firmware as a Linux process, see simulator.h
+  #include "simulator.h"
+#else
+  #include "pin_api.h"
+  #include "usb_device.h"
+  #include "CDC_Adaptor.h"
+  #include "Flash_Adaptor.h"
+#endif
 
 
 static CommClass uart;
 
+#ifndef NATIVE
+/// @brief Microseconds from the DWT cycle counter, carried past its overflow
+/// @details Only called from latency_trace_mark(), inside a critical section
+static uint32_t cycle_counter_us() {
+  static uint32_t last_cycles = 0;
+  static uint32_t rest = 0;
+  static uint32_t us = 0;
+
+  const uint32_t now = DWT->CYCCNT;
+  const uint32_t cycles_per_us = SystemCoreClock / 1000000;
+  rest += now - last_cycles;
+  last_cycles = now;
+  us += rest / cycles_per_us;
+  rest %= cycles_per_us;
+  return us;
+}
+
+/// @brief The clock of the metrics, any task may read it
+static uint32_t cycle_counter() {
+  return DWT->CYCCNT;
+}
+
+METRICS_GAUGE(heap_free, "heap.free");
+METRICS_GAUGE(heap_min_free, "heap.min_free");
+#endif
+
 void monitor_task(void*) {
   vTaskDelay(pdMS_TO_TICKS(30000));
 
-  const auto num_of_tasks = uxTaskGetNumberOfTasks();
-  auto statuses = static_cast<TaskStatus_t*>(pvPortMalloc(num_of_tasks * sizeof(TaskStatus_t)));
-  constexpr size_t memory_low_th{ 999999 };
-  static char buff[100];
-  while (1) {
-    if (auto n = uxTaskGetSystemState(statuses, num_of_tasks, NULL)) {
-      for (unsigned int i = 0; i < n; ++i) {
-        if (statuses[i].usStackHighWaterMark < memory_low_th) {
-          sprintf(buff, "MEM:%s:%d\n", statuses[i].pcTaskName, statuses[i].usStackHighWaterMark);
-          CommAPI::get_instance().echo(buff);
-        }
-      }
-    }
+  // the first report covers the time since the scheduler started
+  static task_stats::Sampler sampler;
+  for (uint32_t snapshot = 0;; ++snapshot) {
+    CommAPI::get_instance().report_tasks(sampler.sample());
 
+#ifndef NATIVE
+    // the heap of the host is malloc, it isn't counted
+    heap_free.set(xPortGetFreeHeapSize());
+    heap_min_free.set(xPortGetMinimumEverFreeHeapSize());
+    constexpr size_t memory_low_th{ 999999 };
     if (xPortGetFreeHeapSize() < memory_low_th) {
-      sprintf(buff, "HEAP:%u\t%u\n", static_cast<unsigned>(xPortGetFreeHeapSize()),
-              static_cast<unsigned>(xPortGetMinimumEverFreeHeapSize()));
-      CommAPI::get_instance().echo(buff);
+      DLOG("HEAP:%u\t%u", static_cast<unsigned>(xPortGetFreeHeapSize()),
+           static_cast<unsigned>(xPortGetMinimumEverFreeHeapSize()));
     }
+#endif
+    // the names once a minute, for a PC which connects later
+    CommAPI::get_instance().send_metrics(xTaskGetTickCount() * portTICK_PERIOD_MS, snapshot % 12 == 0);
     vTaskDelay(pdMS_TO_TICKS(5000));
   }
 }
 
+#ifdef RTOS_TRACE
+/// @brief Send the RTOS trace to the PC as it's recorded
+/// @details The lowest priority, so tracing doesn't delay the other tasks. When they keep the CPU busy, the ring
+/// overflows and the PC is told how many records were lost. Sending makes records as well, the uart task runs for
+/// every frame, so the ring is emptied and then left alone for a while
+void trace_task(void*) {
+  static rtos_trace_record_t records[256];
+  uint32_t names_sent = 0;
+  TickType_t names_at = 0;
+  vTaskDelay(pdMS_TO_TICKS(1000));
+  while (1) {
+    // the names when there are new ones, and now and then for a PC, which connects later
+    const uint32_t names = rtos_trace_names_changed();
+    bool with_names = names != names_sent || xTaskGetTickCount() - names_at > pdMS_TO_TICKS(5000);
+    size_t n;
+    do {
+      uint32_t lost = 0;
+      n = rtos_trace_read(records, std::size(records), &lost);
+      if (n || lost || with_names) {
+        CommAPI::get_instance().send_trace(records, n, lost, with_names);
+      }
+      if (with_names) {
+        names_sent = names;
+        names_at = xTaskGetTickCount();
+        with_names = false;
+      }
+    } while (n == std::size(records));
+    vTaskDelay(pdMS_TO_TICKS(100));
+  }
+}
+#endif
+
 void uart_task(void*) {
+#ifdef NATIVE
+  IHWMessage& hw_msg = sim::link();
+#else
   pin_mode(pins::LED1, pin_mode_t::OUT_PP);
+  IHWMessage& hw_msg = CDC_Adaptor::get_instance();
+#endif
 
-  CDC_Adaptor::get_instance().set_receive_cb([](const void* buff, size_t sz) { uart.receive(buff, sz); });
-  uart.set_hw_msg(&(CDC_Adaptor::get_instance()));
+  hw_msg.set_receive_cb([](const void* buff, size_t sz) { uart.receive(buff, sz); });
+  uart.set_hw_msg(&hw_msg);
 
   uart.init();
   uart.set_tx_task(xTaskGetCurrentTaskHandle());
   CommAPI::get_instance().init(&uart);
   while (1) {
+#ifndef NATIVE
     toggle_pin(pins::LED1);
+#endif
     uart.send_task();
   }
 }
@@ -70,12 +146,30 @@ int main(void) {
   HAL_Init();
   SystemClock_Config();
 
+#ifdef NATIVE
+  sim::init();
+  mixer_gui_init(&sim::flash());
+  latency_trace_init(sim::clock_us);
+  metrics::set_clock(sim::clock_us, 1);
+  xTaskCreate(sim::task, "sim", 256, NULL, 11, NULL);
+#else
   MX_CRC_Init();
+  mixer_gui_init(&Flash_Adaptor::get_instance());
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  latency_trace_init(cycle_counter_us);
+  metrics::set_clock(cycle_counter, SystemCoreClock / 1000000);
+#endif
 
 #ifdef DEBUG
   xTaskCreate(monitor_task, "monitor", 256, NULL, 8, NULL);
+#endif
+#ifdef RTOS_TRACE
+  xTaskCreate(trace_task, "trace", 256, NULL, 1, NULL);
 #endif
   xTaskCreate(uart_task, "uart", 256, NULL, 9, NULL);
+  xTaskCreate(mixer_link_task, "link", 256, NULL, 9, NULL);
   xTaskCreate(gfx_task, "GFX", 256, NULL, 10, NULL);
 
   vTaskStartScheduler();
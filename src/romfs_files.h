@@ -4,3 +4,6 @@
  * The files have been converted using...
  * 		file2c -dbcs infile outfile
  */
+
+// default session icons, regenerated before each build by scripts/romfs_icons.py
+#include "romfs_icons.h"
@@ -0,0 +1,231 @@
+/**
+ * The default session icons, generated by scripts/romfs_icons.py from icons/icons.txt. Don't edit.
+ *
+ * The ROMFS file of a program is named after default_icons::key() of its executable name.
+ */
+
+static const char romfs_icon_speaker[] = {
+	0x52, 0x4C, 0x00, 0x20, 0x00, 0x20, 0x03, 0x02, 0x00, 0x00, 0x3A, 0x09, 0xF7, 0x9E, 0x22, 0x00,
+	0x19, 0x01, 0x04, 0x00, 0x1B, 0x01, 0x82, 0x00, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81,
+	0x00, 0x1D, 0x01, 0x81, 0x00, 0x0F, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x81, 0x00, 0x0E, 0x01, 0x86,
+	0x22, 0x11, 0x12, 0x20, 0x07, 0x01, 0x81, 0x00, 0x0D, 0x01, 0x89, 0x22, 0x21, 0x11, 0x22, 0x22,
+	0x05, 0x01, 0x81, 0x00, 0x0C, 0x01, 0x83, 0x22, 0x22, 0x04, 0x01, 0x82, 0x22, 0x20, 0x04, 0x01,
+	0x81, 0x00, 0x0B, 0x01, 0x04, 0x02, 0x05, 0x01, 0x81, 0x22, 0x04, 0x01, 0x81, 0x00, 0x0A, 0x01,
+	0x05, 0x02, 0x8E, 0x11, 0x22, 0x11, 0x12, 0x21, 0x11, 0x10, 0x00, 0x05, 0x01, 0x0A, 0x02, 0x8E,
+	0x11, 0x22, 0x21, 0x12, 0x21, 0x11, 0x10, 0x00, 0x05, 0x01, 0x0A, 0x02, 0x8E, 0x11, 0x12, 0x21,
+	0x11, 0x22, 0x11, 0x10, 0x00, 0x05, 0x01, 0x0A, 0x02, 0x8E, 0x11, 0x11, 0x22, 0x11, 0x22, 0x11,
+	0x10, 0x00, 0x05, 0x01, 0x0A, 0x02, 0x8E, 0x11, 0x11, 0x22, 0x11, 0x22, 0x11, 0x10, 0x00, 0x05,
+	0x01, 0x0A, 0x02, 0x8E, 0x11, 0x11, 0x22, 0x11, 0x22, 0x11, 0x10, 0x00, 0x05, 0x01, 0x0A, 0x02,
+	0x8E, 0x11, 0x11, 0x22, 0x11, 0x22, 0x11, 0x10, 0x00, 0x05, 0x01, 0x0A, 0x02, 0x8E, 0x11, 0x12,
+	0x21, 0x11, 0x22, 0x11, 0x10, 0x00, 0x05, 0x01, 0x0A, 0x02, 0x8E, 0x11, 0x22, 0x21, 0x12, 0x21,
+	0x11, 0x10, 0x00, 0x0A, 0x01, 0x05, 0x02, 0x8E, 0x11, 0x22, 0x11, 0x12, 0x21, 0x11, 0x10, 0x00,
+	0x0B, 0x01, 0x04, 0x02, 0x05, 0x01, 0x81, 0x22, 0x04, 0x01, 0x81, 0x00, 0x0C, 0x01, 0x83, 0x22,
+	0x22, 0x04, 0x01, 0x82, 0x22, 0x20, 0x04, 0x01, 0x81, 0x00, 0x0D, 0x01, 0x89, 0x22, 0x21, 0x11,
+	0x22, 0x22, 0x05, 0x01, 0x81, 0x00, 0x0E, 0x01, 0x86, 0x22, 0x11, 0x12, 0x20, 0x07, 0x01, 0x81,
+	0x00, 0x0F, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81,
+	0x00, 0x1D, 0x01, 0x82, 0x00, 0x00, 0x1B, 0x01, 0x04, 0x00, 0x19, 0x01, 0x22, 0x00,
+};
+
+// master
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_ca8dbf33_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "ca8dbf33.rle", 302, romfs_icon_speaker };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_ca8dbf33_dir
+#endif
+
+static const char romfs_icon_browser[] = {
+	0x52, 0x4C, 0x00, 0x20, 0x00, 0x20, 0x03, 0x02, 0x00, 0x00, 0x23, 0x7A, 0xFF, 0xDF, 0x4B, 0x00,
+	0x07, 0x01, 0x15, 0x00, 0x0B, 0x01, 0x11, 0x00, 0x0F, 0x01, 0x0E, 0x00, 0x11, 0x01, 0x0C, 0x00,
+	0x06, 0x01, 0x05, 0x02, 0x06, 0x01, 0x0A, 0x00, 0x05, 0x01, 0x09, 0x02, 0x05, 0x01, 0x08, 0x00,
+	0x04, 0x01, 0x0D, 0x02, 0x04, 0x01, 0x07, 0x00, 0x97, 0x11, 0x11, 0x22, 0x21, 0x22, 0x12, 0x21,
+	0x22, 0x12, 0x22, 0x11, 0x11, 0x06, 0x00, 0x04, 0x01, 0x8F, 0x22, 0x11, 0x22, 0x12, 0x21, 0x22,
+	0x11, 0x22, 0x04, 0x01, 0x05, 0x00, 0x99, 0x11, 0x11, 0x22, 0x11, 0x12, 0x11, 0x22, 0x11, 0x21,
+	0x11, 0x22, 0x11, 0x11, 0x04, 0x00, 0x04, 0x01, 0x91, 0x22, 0x11, 0x12, 0x11, 0x22, 0x11, 0x21,
+	0x11, 0x22, 0x04, 0x01, 0xC7, 0x00, 0x00, 0x11, 0x11, 0x22, 0x11, 0x12, 0x21, 0x12, 0x21, 0x12,
+	0x21, 0x11, 0x22, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x22, 0x11, 0x12, 0x21, 0x12, 0x21, 0x12,
+	0x21, 0x11, 0x22, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x13, 0x02, 0x8B, 0x11, 0x11, 0x00, 0x00,
+	0x11, 0x11, 0x13, 0x02, 0xC7, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x22, 0x11, 0x12, 0x21, 0x12,
+	0x21, 0x12, 0x21, 0x11, 0x22, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x22, 0x11, 0x12, 0x21, 0x12,
+	0x21, 0x12, 0x21, 0x11, 0x22, 0x11, 0x11, 0x00, 0x00, 0x04, 0x01, 0x91, 0x22, 0x11, 0x12, 0x11,
+	0x22, 0x11, 0x21, 0x11, 0x22, 0x04, 0x01, 0x04, 0x00, 0x99, 0x11, 0x11, 0x22, 0x11, 0x12, 0x11,
+	0x22, 0x11, 0x21, 0x11, 0x22, 0x11, 0x11, 0x05, 0x00, 0x04, 0x01, 0x8F, 0x22, 0x11, 0x22, 0x12,
+	0x21, 0x22, 0x11, 0x22, 0x04, 0x01, 0x06, 0x00, 0x97, 0x11, 0x11, 0x22, 0x21, 0x22, 0x12, 0x21,
+	0x22, 0x12, 0x22, 0x11, 0x11, 0x07, 0x00, 0x04, 0x01, 0x0D, 0x02, 0x04, 0x01, 0x08, 0x00, 0x05,
+	0x01, 0x09, 0x02, 0x05, 0x01, 0x0A, 0x00, 0x06, 0x01, 0x05, 0x02, 0x06, 0x01, 0x0C, 0x00, 0x11,
+	0x01, 0x0E, 0x00, 0x0F, 0x01, 0x11, 0x00, 0x0B, 0x01, 0x15, 0x00, 0x07, 0x01, 0x4B, 0x00,
+};
+
+// chrome
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_1018be33_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "1018be33.rle", 303, romfs_icon_browser };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_1018be33_dir
+#endif
+
+// firefox
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_f4d4d03a_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "f4d4d03a.rle", 303, romfs_icon_browser };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_f4d4d03a_dir
+#endif
+
+// msedge
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_8c6cf2a8_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "8c6cf2a8.rle", 303, romfs_icon_browser };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_8c6cf2a8_dir
+#endif
+
+// opera
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_8e254614_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "8e254614.rle", 303, romfs_icon_browser };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_8e254614_dir
+#endif
+
+// brave
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_ac0cfc01_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "ac0cfc01.rle", 303, romfs_icon_browser };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_ac0cfc01_dir
+#endif
+
+static const char romfs_icon_music[] = {
+	0x52, 0x4C, 0x00, 0x20, 0x00, 0x20, 0x03, 0x02, 0x00, 0x00, 0x2D, 0x4B, 0xFF, 0xDF, 0x4B, 0x00,
+	0x07, 0x01, 0x15, 0x00, 0x0B, 0x01, 0x11, 0x00, 0x0F, 0x01, 0x0E, 0x00, 0x11, 0x01, 0x0C, 0x00,
+	0x13, 0x01, 0x0A, 0x00, 0x10, 0x01, 0x84, 0x22, 0x21, 0x10, 0x08, 0x00, 0x0B, 0x01, 0x08, 0x02,
+	0x82, 0x11, 0x10, 0x07, 0x00, 0x09, 0x01, 0x07, 0x02, 0x85, 0x12, 0x21, 0x11, 0x06, 0x00, 0x0A,
+	0x01, 0x82, 0x22, 0x20, 0x05, 0x01, 0x85, 0x22, 0x11, 0x11, 0x05, 0x00, 0x0A, 0x01, 0x81, 0x22,
+	0x06, 0x01, 0x85, 0x22, 0x11, 0x11, 0x04, 0x00, 0x0B, 0x01, 0x81, 0x22, 0x06, 0x01, 0x81, 0x22,
+	0x04, 0x01, 0x83, 0x00, 0x00, 0x0B, 0x01, 0x81, 0x22, 0x06, 0x01, 0x81, 0x22, 0x04, 0x01, 0x83,
+	0x00, 0x00, 0x0B, 0x01, 0x81, 0x22, 0x06, 0x01, 0x81, 0x22, 0x04, 0x01, 0x83, 0x00, 0x00, 0x0B,
+	0x01, 0x81, 0x22, 0x06, 0x01, 0x81, 0x22, 0x04, 0x01, 0x83, 0x00, 0x00, 0x0B, 0x01, 0x84, 0x22,
+	0x11, 0x10, 0x05, 0x02, 0x04, 0x01, 0x83, 0x00, 0x00, 0x0B, 0x01, 0x83, 0x22, 0x11, 0x06, 0x02,
+	0x04, 0x01, 0x83, 0x00, 0x00, 0x07, 0x01, 0x05, 0x02, 0x80, 0x10, 0x07, 0x02, 0x04, 0x01, 0x83,
+	0x00, 0x00, 0x06, 0x01, 0x06, 0x02, 0x80, 0x10, 0x07, 0x02, 0x04, 0x01, 0x04, 0x00, 0x04, 0x01,
+	0x07, 0x02, 0x81, 0x11, 0x05, 0x02, 0x04, 0x01, 0x05, 0x00, 0x04, 0x01, 0x07, 0x02, 0x86, 0x11,
+	0x12, 0x22, 0x20, 0x05, 0x01, 0x06, 0x00, 0x04, 0x01, 0x05, 0x02, 0x0C, 0x01, 0x07, 0x00, 0x05,
+	0x01, 0x83, 0x22, 0x22, 0x0D, 0x01, 0x08, 0x00, 0x15, 0x01, 0x0A, 0x00, 0x13, 0x01, 0x0C, 0x00,
+	0x11, 0x01, 0x0E, 0x00, 0x0F, 0x01, 0x11, 0x00, 0x0B, 0x01, 0x15, 0x00, 0x07, 0x01, 0x4B, 0x00,
+};
+
+// spotify
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_77d3aeb5_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "77d3aeb5.rle", 256, romfs_icon_music };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_77d3aeb5_dir
+#endif
+
+// itunes
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_6e487073_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "6e487073.rle", 256, romfs_icon_music };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_6e487073_dir
+#endif
+
+// foobar2000
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_175f410a_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "175f410a.rle", 256, romfs_icon_music };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_175f410a_dir
+#endif
+
+static const char romfs_icon_video[] = {
+	0x52, 0x4C, 0x00, 0x20, 0x00, 0x20, 0x03, 0x02, 0x00, 0x00, 0xE3, 0xC2, 0xFF, 0xDF, 0x22, 0x00,
+	0x19, 0x01, 0x04, 0x00, 0x1B, 0x01, 0x82, 0x00, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81,
+	0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81,
+	0x00, 0x1D, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x81, 0x22, 0x10, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x83,
+	0x22, 0x22, 0x0E, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x04, 0x02, 0x0D, 0x01, 0x81, 0x00, 0x0A, 0x01,
+	0x06, 0x02, 0x0B, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x08, 0x02, 0x09, 0x01, 0x81, 0x00, 0x0A, 0x01,
+	0x09, 0x02, 0x08, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x09, 0x02, 0x08, 0x01, 0x81, 0x00, 0x0A, 0x01,
+	0x08, 0x02, 0x09, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x06, 0x02, 0x0B, 0x01, 0x81, 0x00, 0x0A, 0x01,
+	0x04, 0x02, 0x0D, 0x01, 0x81, 0x00, 0x0A, 0x01, 0x83, 0x22, 0x22, 0x0E, 0x01, 0x81, 0x00, 0x0A,
+	0x01, 0x81, 0x22, 0x10, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D,
+	0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D,
+	0x01, 0x82, 0x00, 0x00, 0x1B, 0x01, 0x04, 0x00, 0x19, 0x01, 0x22, 0x00,
+};
+
+// vlc
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_a31f5354_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "a31f5354.rle", 188, romfs_icon_video };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_a31f5354_dir
+#endif
+
+// mpc-hc64
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_8b747fc7_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "8b747fc7.rle", 188, romfs_icon_video };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_8b747fc7_dir
+#endif
+
+static const char romfs_icon_chat[] = {
+	0x52, 0x4C, 0x00, 0x20, 0x00, 0x20, 0x03, 0x02, 0x00, 0x00, 0x62, 0xDB, 0xFF, 0xDF, 0x22, 0x00,
+	0x19, 0x01, 0x04, 0x00, 0x1B, 0x01, 0x82, 0x00, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81,
+	0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x05, 0x01, 0x11,
+	0x02, 0x05, 0x01, 0x81, 0x00, 0x05, 0x01, 0x11, 0x02, 0x05, 0x01, 0x81, 0x00, 0x05, 0x01, 0x11,
+	0x02, 0x05, 0x01, 0x81, 0x00, 0x05, 0x01, 0x82, 0x22, 0x20, 0x0B, 0x01, 0x82, 0x22, 0x20, 0x05,
+	0x01, 0x81, 0x00, 0x05, 0x01, 0x82, 0x22, 0x20, 0x0B, 0x01, 0x82, 0x22, 0x20, 0x05, 0x01, 0x81,
+	0x00, 0x05, 0x01, 0x11, 0x02, 0x05, 0x01, 0x81, 0x00, 0x05, 0x01, 0x11, 0x02, 0x05, 0x01, 0x81,
+	0x00, 0x05, 0x01, 0x82, 0x22, 0x20, 0x0B, 0x01, 0x82, 0x22, 0x20, 0x05, 0x01, 0x81, 0x00, 0x05,
+	0x01, 0x82, 0x22, 0x20, 0x0B, 0x01, 0x82, 0x22, 0x20, 0x05, 0x01, 0x81, 0x00, 0x05, 0x01, 0x11,
+	0x02, 0x05, 0x01, 0x81, 0x00, 0x05, 0x01, 0x11, 0x02, 0x05, 0x01, 0x81, 0x00, 0x05, 0x01, 0x11,
+	0x02, 0x05, 0x01, 0x81, 0x00, 0x08, 0x01, 0x83, 0x22, 0x22, 0x10, 0x01, 0x81, 0x00, 0x08, 0x01,
+	0x83, 0x22, 0x22, 0x10, 0x01, 0x81, 0x00, 0x08, 0x01, 0x82, 0x22, 0x20, 0x11, 0x01, 0x81, 0x00,
+	0x08, 0x01, 0x81, 0x22, 0x12, 0x01, 0x81, 0x00, 0x08, 0x01, 0x80, 0x20, 0x13, 0x01, 0x81, 0x00,
+	0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x82, 0x00,
+	0x00, 0x1B, 0x01, 0x04, 0x00, 0x19, 0x01, 0x22, 0x00,
+};
+
+// discord
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_9a50cbcf_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "9a50cbcf.rle", 233, romfs_icon_chat };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_9a50cbcf_dir
+#endif
+
+// teams
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_140c8eed_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "140c8eed.rle", 233, romfs_icon_chat };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_140c8eed_dir
+#endif
+
+// slack
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_ea9b2927_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "ea9b2927.rle", 233, romfs_icon_chat };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_ea9b2927_dir
+#endif
+
+// zoom
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_df92e232_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "df92e232.rle", 233, romfs_icon_chat };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_df92e232_dir
+#endif
+
+static const char romfs_icon_game[] = {
+	0x52, 0x4C, 0x00, 0x20, 0x00, 0x20, 0x03, 0x02, 0x00, 0x00, 0x19, 0x47, 0xCE, 0x9C, 0x22, 0x00,
+	0x19, 0x01, 0x04, 0x00, 0x1B, 0x01, 0x82, 0x00, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81,
+	0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81,
+	0x00, 0x1D, 0x01, 0x81, 0x00, 0x0C, 0x01, 0x83, 0x22, 0x22, 0x0C, 0x01, 0x81, 0x00, 0x08, 0x01,
+	0x0B, 0x02, 0x08, 0x01, 0x81, 0x00, 0x06, 0x01, 0x0F, 0x02, 0x06, 0x01, 0x81, 0x00, 0x05, 0x01,
+	0x11, 0x02, 0x05, 0x01, 0x81, 0x00, 0x04, 0x01, 0x85, 0x22, 0x22, 0x11, 0x0D, 0x02, 0x04, 0x01,
+	0x81, 0x00, 0x04, 0x01, 0x85, 0x22, 0x22, 0x11, 0x06, 0x02, 0x81, 0x11, 0x04, 0x02, 0x04, 0x01,
+	0x81, 0x00, 0x04, 0x01, 0x81, 0x22, 0x05, 0x01, 0x04, 0x02, 0x81, 0x11, 0x04, 0x02, 0x04, 0x01,
+	0x81, 0x00, 0x04, 0x01, 0x81, 0x22, 0x05, 0x01, 0x0B, 0x02, 0x04, 0x01, 0x81, 0x00, 0x04, 0x01,
+	0x85, 0x22, 0x22, 0x11, 0x08, 0x02, 0x84, 0x11, 0x22, 0x20, 0x04, 0x01, 0x81, 0x00, 0x04, 0x01,
+	0x85, 0x22, 0x22, 0x11, 0x08, 0x02, 0x84, 0x11, 0x22, 0x20, 0x04, 0x01, 0x81, 0x00, 0x05, 0x01,
+	0x11, 0x02, 0x05, 0x01, 0x81, 0x00, 0x06, 0x01, 0x0F, 0x02, 0x06, 0x01, 0x81, 0x00, 0x08, 0x01,
+	0x0B, 0x02, 0x08, 0x01, 0x81, 0x00, 0x0C, 0x01, 0x83, 0x22, 0x22, 0x0C, 0x01, 0x81, 0x00, 0x1D,
+	0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D, 0x01, 0x81, 0x00, 0x1D,
+	0x01, 0x82, 0x00, 0x00, 0x1B, 0x01, 0x04, 0x00, 0x19, 0x01, 0x22, 0x00,
+};
+
+// steam
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY romfs_icon_0e0aa0f3_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "0e0aa0f3.rle", 236, romfs_icon_game };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &romfs_icon_0e0aa0f3_dir
+#endif
@@ -0,0 +1,100 @@
+#include "gfx.h"
+#include "unity.h"
+#include "bench.h"
+#include "bench_icon.h"
+#include "volume_line.h"
+#include "icon_stream.h"
+#include "default_icons.h"
+#include <algorithm>
+
+static constexpr size_t CHUNK = 252;       ///< image chunk of CommAPI
+static constexpr uint32_t LINK_US = 1000;  ///< from the ack to the next chunk, one USB frame
+
+static StripRenderer strip;
+static volume_lines_t lines = { SetVolumeHelper(0), SetVolumeHelper(1), SetVolumeHelper(2), SetVolumeHelper(3),
+                                SetVolumeHelper(4) };
+static session_slots_t slots;
+static std::array<CommAPI::volume_t, CommAPI::MAX_SUPPORTED_PROGRAMS> volumes;
+static uint32_t downloads = 0;
+
+/// @brief Stands in for the PC, every icon is the same PNG, each chunk arrives LINK_US after the previous one
+static int next_chunk(void* param, const gU8** data) {
+  auto& [sent, since_ack] = *static_cast<std::pair<size_t, bench::Stopwatch>*>(param);
+  while (since_ack.us() < LINK_US) {
+  }
+  const size_t len = std::min(CHUNK, sizeof(bench::icon_png) - sent);
+  *data = bench::icon_png + sent;
+  sent += len;
+  since_ack.restart();
+  return len;
+}
+
+/// @brief Download every icon, like before the ROMFS had any
+static bool download_icon(const mixer::ProgramVolume&, GDisplay* icon) {
+  std::pair<size_t, bench::Stopwatch> link{ 0, {} };
+  ++downloads;
+  return icon_stream::draw(icon, gwinGetDefaultBgColor(), next_chunk, &link);
+}
+
+/// @brief Like the mixer GUI, download only the icons without a default
+static bool romfs_icon(const mixer::ProgramVolume& vol, GDisplay* icon) {
+  return default_icons::draw(icon, gwinGetDefaultBgColor(), vol) || download_icon(vol, icon);
+}
+
+static void drop_command(const LinkCommand&) {
+}
+
+static uint32_t now_ms() {
+  return 0;
+}
+
+/// @brief From the first sessions to the frame with every icon, return the icons downloaded
+/// @details Each line holds an open file of its icon, so the lines are created once, and emptied for each boot.
+/// Creating them takes the same time with or without the ROMFS
+static uint32_t boot(const char* name, bool (*load_icon)(const mixer::ProgramVolume&, GDisplay*)) {
+  SetVolumeHelper::hooks = { load_icon, drop_command, now_ms, &strip };
+  for (auto& line : lines) {
+    line.reset();
+  }
+  slots.clear();
+  downloads = 0;
+
+  bench::Stopwatch sw;
+  show_volumes(lines, slots, volumes);
+  bench::report(name, sw.us(), "us to first frame");
+  bench::report(name, downloads, "icons downloaded");
+  return downloads;
+}
+
+void test_lines_init() {
+  bench::Stopwatch sw;
+  for (auto& line : lines) {
+    line.init();
+  }
+  bench::report("lines init", sw.us(), "us");
+}
+
+void test_boot() {
+  // master and the usual programs, one of them without a default icon
+  volumes[0] = mixer::ProgramVolume(-1, 40, "");
+  volumes[1] = mixer::ProgramVolume(1204, 70, "chrome.exe");
+  volumes[2] = mixer::ProgramVolume(5120, 55, "Spotify.exe");
+  volumes[3] = mixer::ProgramVolume(3388, 100, "Discord.exe");
+  volumes[4] = mixer::ProgramVolume(7701, 80, "SomeGame.exe");
+
+  TEST_ASSERT_EQUAL_UINT32(MAX_LINES, boot("boot download", download_icon));
+  TEST_ASSERT_EQUAL_UINT32(1, boot("boot romfs", romfs_icon));
+}
+
+extern "C" void uGFXMain() {
+  gwinSetDefaultStyle(&BlackWidgetStyle, false);
+  gwinSetDefaultFont(gdispOpenFont("DejaVuSans12*"));
+  TEST_ASSERT_TRUE(strip.init(GDISP));
+
+  RUN_TEST(test_lines_init);
+  RUN_TEST(test_boot);
+}
+
+void test_task(void*) {
+  gfxInit();
+}
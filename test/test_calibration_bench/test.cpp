@@ -0,0 +1,110 @@
+#include "gfx.h"
+#include "src/ginput/ginput_driver_mouse.h"
+#include "unity.h"
+#include "bench.h"
+#include <cstdlib>
+
+/// @brief The calibration of the board, see gmouse_lld_ADS7843.c
+static constexpr GMouseCalibration board_cal = { .ax = -0.062154454f,
+                                                 .bx = -0.00104754698f,
+                                                 .cx = 246.636615f,
+                                                 .ay = -0.00186230578f,
+                                                 .by = 0.0898562551f,
+                                                 .cy = -15.0520843f };
+
+/// @brief A calibration for a panel mounted rotated and mirrored, with 12 bit readings
+static constexpr GMouseCalibration rotated_cal = { .ax = 0.00312f,
+                                                   .bx = 0.0781f,
+                                                   .cx = -12.25f,
+                                                   .ay = -0.0589f,
+                                                   .by = 0.00471f,
+                                                   .cy = 251.5f };
+
+static constexpr gCoord panel_max = 8191;  ///< the ADS7843 adaptor returns 13 bits
+
+/// @brief Transform like ginput_mouse.c does without GINPUT_TOUCH_FIXEDPOINT_CALIBRATION
+static void transform_float(GMouseReading* pt, const GMouseCalibration* c) {
+  gCoord x = (gCoord)(c->ax * pt->x + c->bx * pt->y + c->cx);
+  gCoord y = (gCoord)(c->ay * pt->x + c->by * pt->y + c->cy);
+  pt->x = x;
+  pt->y = y;
+}
+
+static void clip(GMouseReading& r) {
+  r.x = r.x < 0 ? 0 : (r.x > 319 ? 319 : r.x);
+  r.y = r.y < 0 ? 0 : (r.y > 319 ? 319 : r.y);
+}
+
+/// @brief Compare fixed and float calibration over the whole panel range
+static void check_range(const GMouseCalibration& cal) {
+  GMouseCalibrationFixed q;
+  _gmouseCalibrationToFixed(&q, &cal);
+
+  int max_err = 0;
+  for (gCoord x = 0; x <= panel_max; x += 7) {
+    for (gCoord y = 0; y <= panel_max; y += 7) {
+      GMouseReading f = { x, y, 1, 0 }, i = f;
+      transform_float(&f, &cal);
+      _gmouseCalibrationTransformFixed(&i, &q);
+      // GINPUT clips the readings to the display
+      clip(f);
+      clip(i);
+      const int err = std::abs(f.x - i.x) > std::abs(f.y - i.y) ? std::abs(f.x - i.x) : std::abs(f.y - i.y);
+      max_err = err > max_err ? err : max_err;
+    }
+  }
+  TEST_ASSERT_LESS_OR_EQUAL(1, max_err);
+}
+
+void test_board_calibration_error() {
+  check_range(board_cal);
+}
+
+void test_rotated_calibration_error() {
+  check_range(rotated_cal);
+}
+
+void test_conversion() {
+  GMouseCalibrationFixed q;
+  const GMouseCalibration cal = { .ax = 1.0f, .bx = -0.5f, .cx = 100.0f, .ay = 0.0f, .by = 2.0f, .cy = -1.0f };
+  _gmouseCalibrationToFixed(&q, &cal);
+  TEST_ASSERT_EQUAL_INT32(65536, q.ax);
+  TEST_ASSERT_EQUAL_INT32(-32768, q.bx);
+  TEST_ASSERT_EQUAL_INT32(100 * 65536, q.cx);
+  TEST_ASSERT_EQUAL_INT32(0, q.ay);
+  TEST_ASSERT_EQUAL_INT32(131072, q.by);
+  TEST_ASSERT_EQUAL_INT32(-65536, q.cy);
+}
+
+void test_cycles_per_sample() {
+  constexpr int samples = 1000;
+  static volatile gCoord sink;
+  GMouseCalibrationFixed q;
+  _gmouseCalibrationToFixed(&q, &board_cal);
+
+  bench::Stopwatch sw;
+  for (int n = 0; n < samples; ++n) {
+    GMouseReading r = { gCoord(n * 8), gCoord(panel_max - n * 8), 1, 0 };
+    transform_float(&r, &board_cal);
+    sink = r.x + r.y;
+  }
+  const uint32_t float_cycles = sw.cycles() / samples;
+
+  sw.restart();
+  for (int n = 0; n < samples; ++n) {
+    GMouseReading r = { gCoord(n * 8), gCoord(panel_max - n * 8), 1, 0 };
+    _gmouseCalibrationTransformFixed(&r, &q);
+    sink = r.x + r.y;
+  }
+  const uint32_t fixed_cycles = sw.cycles() / samples;
+
+  bench::report("float calibration", float_cycles, "cycles/sample");
+  bench::report("Q16.16 calibration", fixed_cycles, "cycles/sample");
+}
+
+void test_task(void*) {
+  RUN_TEST(test_conversion);
+  RUN_TEST(test_board_calibration_error);
+  RUN_TEST(test_rotated_calibration_error);
+  RUN_TEST(test_cycles_per_sample);
+}
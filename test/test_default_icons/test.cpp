@@ -0,0 +1,10 @@
+#include "gfx.h"
+#include "default_icons.h"
+
+extern "C" void uGFXMain() {
+  default_icons_tests();
+}
+
+void test_task(void*) {
+  gfxInit();
+}
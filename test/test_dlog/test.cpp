@@ -0,0 +1,5 @@
+#include "dlog.h"
+
+void test_task(void*) {
+  dlog_tests();
+}
@@ -0,0 +1,112 @@
+/**
+ * @file test.cpp
+ * @brief Deferred binary log against formatting on the board: bytes on the link and the cost of logging a line
+ * @details Before: the line is formatted with snprintf and sent with CommAPI::echo(), like the heap and latency
+ * reports did. After: DLOG queues the id of the format and the arguments, and the link task sends the queue with
+ * CommAPI::send_log(), which isn't part of the call. The lines are those of the latency and heap reports, the link is a
+ * sink which counts bytes. Cycles are nanoseconds on the PC.
+ */
+#include "unity.h"
+#include "bench.h"
+#include "comm_api.h"
+#include "comm_class.h"
+#include "dlog.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <cstdio>
+
+static constexpr unsigned N_BATCHES = 200;
+static constexpr unsigned BATCH = 2;  ///< of the latency and the heap line, fit into the tx buffer and the queue
+
+/// @brief Counts the bytes sent to the PC
+class Sink : public IHWMessage {
+public:
+  void init() override {
+  }
+
+  bool status() const override {
+    return true;
+  }
+
+  void deinit() override {
+  }
+
+  size_t transmit(const void*, size_t sz) override {
+    bytes += sz;
+    return sz;
+  }
+
+  uint32_t bytes = 0;
+};
+
+static Sink sink;
+static CommClass uart;
+static CommAPI& api = CommAPI::get_instance();
+static uint32_t record_bytes = 0;  ///< of the DLOG records, without the frames
+
+struct Result {
+  uint32_t cycles;  ///< median per line
+  uint32_t bytes;   ///< per line
+};
+
+/// @brief Log BATCH of both lines N_BATCHES times with @p log, then send them with @p send
+template <typename Log, typename Send>
+static Result measure(Log log, Send send) {
+  static uint32_t samples[N_BATCHES];
+  sink.bytes = 0;
+  for (unsigned b = 0; b < N_BATCHES; ++b) {
+    bench::Stopwatch sw;
+    for (unsigned i = 0; i < BATCH; ++i) {
+      log(b * BATCH + i);
+    }
+    samples[b] = sw.cycles() / (2 * BATCH);
+    send();
+    uart.flush();
+  }
+  return { bench::percentile(samples, N_BATCHES, 50), sink.bytes / (2 * N_BATCHES * BATCH) };
+}
+
+void test_log_line() {
+  // the writes notify nobody, the bench flushes
+  uart.set_hw_msg(&sink);
+  uart.init();
+  uart.set_tx_task(xTaskGetCurrentTaskHandle());
+  api.init(&uart);
+
+  const auto echo = measure(
+      [](unsigned i) {
+        char buff[80];
+        snprintf(buff, sizeof(buff), "LAT:%s:n=%lu,p50=%lu,p90=%lu,p99=%lu,max=%luus\n", "redraw_end",
+                 static_cast<unsigned long>(i), 1023ul, 2047ul, 4095ul, 6210ul);
+        api.echo(buff);
+        snprintf(buff, sizeof(buff), "HEAP:%u\t%u\n", 21344u + i, 18200u);
+        api.echo(buff);
+      },
+      [] {});
+
+  const auto deferred = measure(
+      [](unsigned i) {
+        DLOG("LAT:%s:n=%u,p50=%u,p90=%u,p99=%u,max=%uus", "redraw_end", i, 1023u, 2047u, 4095u, 6210u);
+        DLOG("HEAP:%u\t%u", 21344u + i, 18200u);
+      },
+      [] {
+        static uint8_t records[dlog::QUEUE_SZ];
+        uint32_t dropped;
+        const size_t n = dlog::read(records, sizeof(records), &dropped);
+        TEST_ASSERT_EQUAL(0, dropped);
+        record_bytes += n;
+        api.send_log(records, n, dropped);
+      });
+
+  bench::report("echo line", echo.cycles, "cycles");
+  bench::report("echo line", echo.bytes, "bytes on the link");
+  bench::report("dlog line", deferred.cycles, "cycles");
+  bench::report("dlog line", record_bytes / (2 * N_BATCHES * BATCH), "bytes of the record");
+  bench::report("dlog line", deferred.bytes, "bytes on the link, with the LOG frames");
+  TEST_ASSERT_LESS_THAN(echo.bytes, deferred.bytes);
+  TEST_ASSERT_LESS_THAN(echo.cycles, deferred.cycles);
+}
+
+void test_task(void*) {
+  RUN_TEST(test_log_line);
+}
@@ -0,0 +1,5 @@
+#include "FD_Adaptor.h"
+
+void test_task(void*) {
+  fd_adaptor_tests();
+}
@@ -0,0 +1,5 @@
+#include "gui_events.h"
+
+void test_task(void*) {
+  gui_events_test();
+}
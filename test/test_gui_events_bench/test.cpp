@@ -0,0 +1,281 @@
+/**
+ * @file test.cpp
+ * @brief Simulates the GUI loop with a slow serial link, and reports event-to-handling latency
+ * @details The old loop waits for input and then polls the PC itself, the new one waits on GuiEventQueue, while a
+ * separate task talks to the PC. Between them, the GUI waited on the queue, but still loaded the sessions and the icons
+ * in its DRAW state. Now the link task loads them, the GUI only draws. Every second change brings a session with an
+ * unknown icon. The PC is simulated with delays: a round trip takes 20 ms, every 8th one times out after 500 ms.
+ */
+#include "unity.h"
+#include "bench.h"
+#include "gui_events.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+static constexpr unsigned N_TOUCH = 150;
+static constexpr TickType_t TOUCH_PERIOD = pdMS_TO_TICKS(37);
+static constexpr TickType_t CHANGE_PERIOD = pdMS_TO_TICKS(300);
+static constexpr TickType_t ROUND_TRIP = pdMS_TO_TICKS(20);
+static constexpr TickType_t ROUND_TRIP_TIMEOUT = pdMS_TO_TICKS(500);
+static constexpr TickType_t POLL_PERIOD = pdMS_TO_TICKS(100);  ///< like mixer_link_task
+static constexpr unsigned ICON_ROUND_TRIPS = 6;  ///< IMAGE_INFO, and the chunks of a 1.2 kB icon
+static constexpr size_t MAX_SAMPLES = 64;
+
+struct Latencies {
+  uint32_t touch[N_TOUCH];
+  size_t n_touch;
+  uint32_t serial[MAX_SAMPLES];
+  size_t n_serial;
+  uint32_t icon[MAX_SAMPLES];  ///< from the change to the icon
+  size_t n_icon;
+  unsigned touch_dropped;
+
+  void add_touch(uint32_t ms) {
+    if (n_touch < N_TOUCH) touch[n_touch++] = ms;
+  }
+  void add_serial(uint32_t ms) {
+    if (n_serial < MAX_SAMPLES) serial[n_serial++] = ms;
+  }
+  void add_icon(uint32_t ms) {
+    if (n_icon < MAX_SAMPLES) icon[n_icon++] = ms;
+  }
+};
+
+/// @brief A change of the PC
+struct Change {
+  TickType_t at;  ///< 0 if nothing is pending
+  bool icon;      ///< a new session, its icon must be downloaded
+};
+
+static Latencies old_loop, draw_load_loop, new_loop;
+static Latencies* results;
+static volatile bool running = false;
+static volatile bool producer_done = false;
+static volatile TickType_t change_at = 0;  ///< when the PC changed, 0 if nothing is pending
+static volatile bool change_icon = false;
+static volatile Change reported{};          ///< change, which the link task posted last
+static volatile TickType_t icon_change = 0;  ///< change of the icon, which the link task posted last
+
+static QueueHandle_t old_touch_q;    ///< one slot, like a GListener
+static QueueHandle_t icon_requests;  ///< changes, whose icon the GUI asked the link task for
+static GuiEventQueue events;
+static bool use_new_loop = false;
+static bool link_loads = false;  ///< the link task loads the sessions and the icons
+
+/// @brief Wait for a round trip to the PC
+static void wait_pc() {
+  static unsigned n = 0;
+  vTaskDelay(++n % 8 ? ROUND_TRIP : ROUND_TRIP_TIMEOUT);
+}
+
+/// @brief Simulate QUERY_CHANGES
+/// @return the change, which was pending when the query was sent
+static Change round_trip() {
+  const Change change{ change_at, change_icon };
+  wait_pc();
+  if (change.at) {
+    change_at = 0;
+  }
+  return change;
+}
+
+/// @brief Simulate LOAD_PAGE
+static void load_sessions() {
+  wait_pc();
+}
+
+/// @brief Simulate IMAGE_INFO and READ_IMG
+static void load_icon() {
+  for (unsigned i = 0; i < ICON_ROUND_TRIPS; ++i) {
+    wait_pc();
+  }
+}
+
+static void pc_task(void*) {
+  bool icon = false;
+  while (running) {
+    vTaskDelay(CHANGE_PERIOD);
+    if (not change_at) {
+      icon = not icon;
+      change_icon = icon;
+      change_at = xTaskGetTickCount() | 1;
+    }
+  }
+  vTaskDelete(nullptr);
+}
+
+static void touch_task(void*) {
+  Latencies& res = *results;
+  for (unsigned i = 0; i < N_TOUCH; ++i) {
+    vTaskDelay(TOUCH_PERIOD);
+    bool ok;
+    if (use_new_loop) {
+      GEvent ev{};
+      ev.type = GEVENT_TOUCH;
+      ok = events.post_ui(ev);
+    } else {
+      const TickType_t now = xTaskGetTickCount();
+      ok = pdTRUE == xQueueSend(old_touch_q, &now, 0);
+    }
+    if (not ok) {
+      ++res.touch_dropped;
+    }
+  }
+  producer_done = true;
+  vTaskDelete(nullptr);
+}
+
+static void link_task(void*) {
+  TickType_t last_poll = xTaskGetTickCount() - POLL_PERIOD;
+  while (running) {
+    // icons the GUI asked for go first, but don't starve the polling
+    const TickType_t since_poll = xTaskGetTickCount() - last_poll;
+    TickType_t change;
+    if (pdTRUE == xQueueReceive(icon_requests, &change, since_poll < POLL_PERIOD ? POLL_PERIOD - since_poll : 0)) {
+      load_icon();
+      icon_change = change;
+      events.post_icon(0);
+    }
+    if (xTaskGetTickCount() - last_poll < POLL_PERIOD) {
+      continue;
+    }
+    last_poll = xTaskGetTickCount();
+    const Change c = round_trip();
+    if (c.at) {
+      if (link_loads) {
+        load_sessions();
+      }
+      reported.at = c.at;
+      reported.icon = c.icon;
+      events.post_serial(CHANGE);
+    }
+  }
+  vTaskDelete(nullptr);
+}
+
+static void start(bool new_loop_, Latencies& res) {
+  use_new_loop = new_loop_;
+  results = &res;
+  running = true;
+  producer_done = false;
+  change_at = 0;
+  // the link task of the loop before may have posted after it ended
+  while (events.wait(0).event != NOEVENT) {
+  }
+  xQueueReset(icon_requests);
+  xTaskCreate(pc_task, "pc", 128, nullptr, 11, nullptr);
+  xTaskCreate(touch_task, "touch", 128, nullptr, 11, nullptr);
+  if (use_new_loop) {
+    xTaskCreate(link_task, "link", 128, nullptr, 9, nullptr);
+  }
+}
+
+static void stop() {
+  running = false;
+  vTaskDelay(CHANGE_PERIOD + ICON_ROUND_TRIPS * ROUND_TRIP_TIMEOUT + POLL_PERIOD);
+}
+
+static void report(const char* name, Latencies& res) {
+  char buff[48];
+  for (unsigned pct : { 50, 90, 99 }) {
+    snprintf(buff, sizeof(buff), "%s touch p%u", name, pct);
+    bench::report(buff, bench::percentile(res.touch, res.n_touch, pct), "ms");
+  }
+  for (unsigned pct : { 50, 90, 99 }) {
+    snprintf(buff, sizeof(buff), "%s serial p%u", name, pct);
+    bench::report(buff, bench::percentile(res.serial, res.n_serial, pct), "ms");
+  }
+  for (unsigned pct : { 50, 90, 99 }) {
+    snprintf(buff, sizeof(buff), "%s icon p%u", name, pct);
+    bench::report(buff, bench::percentile(res.icon, res.n_icon, pct), "ms");
+  }
+  snprintf(buff, sizeof(buff), "%s touch dropped", name);
+  bench::report(buff, res.touch_dropped, "events");
+}
+
+/// @brief Input wait with timeout, then a blocking poll, and the loads after a change, like mixer_gui_task did
+void test_old_loop() {
+  old_touch_q = xQueueCreate(1, sizeof(TickType_t));
+  start(false, old_loop);
+  while (not producer_done || uxQueueMessagesWaiting(old_touch_q)) {
+    TickType_t touched;
+    if (pdTRUE == xQueueReceive(old_touch_q, &touched, pdMS_TO_TICKS(1000))) {
+      old_loop.add_touch(xTaskGetTickCount() - touched);
+    }
+    const Change change = round_trip();
+    if (change.at) {
+      load_sessions();
+      old_loop.add_serial(xTaskGetTickCount() - change.at);
+      if (change.icon) {
+        load_icon();
+        old_loop.add_icon(xTaskGetTickCount() - change.at);
+      }
+    }
+  }
+  stop();
+  TEST_ASSERT_GREATER_THAN(0, old_loop.n_touch);
+  TEST_ASSERT_GREATER_THAN(0, old_loop.n_serial);
+  report("old", old_loop);
+}
+
+/// @brief One queue for input and serial events, the link runs in its own task
+/// @param gui_loads the GUI loads the sessions and the icons in its DRAW state, else the link task loads them
+static void queue_loop(Latencies& res, bool gui_loads) {
+  link_loads = not gui_loads;
+  start(true, res);
+  while (1) {
+    const GuiMessage msg = events.wait(pdMS_TO_TICKS(100));
+    const TickType_t now = xTaskGetTickCount();
+    if (msg.event == UI_INPUT) {
+      res.add_touch(now - msg.posted);
+    } else if (msg.event == ICON) {
+      res.add_icon(now - icon_change);
+    } else if (msg.event != CHANGE && producer_done) {
+      break;
+    }
+    if (gui_loads && (msg.event == UI_INPUT || msg.event == CHANGE)) {
+      // the DRAW state
+      load_sessions();
+    }
+    if (msg.event == CHANGE) {
+      const Change change{ reported.at, reported.icon };
+      res.add_serial(xTaskGetTickCount() - change.at);
+      if (change.icon && gui_loads) {
+        load_icon();
+        res.add_icon(xTaskGetTickCount() - change.at);
+      } else if (change.icon) {
+        // the line asks the link task for the icon
+        xQueueSend(icon_requests, &change.at, 0);
+      }
+    }
+  }
+  stop();
+  TEST_ASSERT_GREATER_THAN(0, res.n_touch);
+  TEST_ASSERT_GREATER_THAN(0, res.n_serial);
+  TEST_ASSERT_GREATER_THAN(0, res.n_icon);
+}
+
+/// @brief Like the first GuiEventQueue loop, which loaded in the DRAW state
+void test_draw_load_loop() {
+  queue_loop(draw_load_loop, true);
+  report("draw load", draw_load_loop);
+  // a touch waits behind the loads of the events before
+  TEST_ASSERT_GREATER_OR_EQUAL(ROUND_TRIP, bench::percentile(draw_load_loop.touch, draw_load_loop.n_touch, 99));
+}
+
+void test_new_loop() {
+  queue_loop(new_loop, false);
+  TEST_ASSERT_EQUAL(0, new_loop.touch_dropped);
+  report("new", new_loop);
+  // touch is never stuck behind a round trip, not even behind an icon download
+  TEST_ASSERT_LESS_THAN(ROUND_TRIP, bench::percentile(new_loop.touch, new_loop.n_touch, 99));
+}
+
+void test_task(void*) {
+  events.init();
+  icon_requests = xQueueCreate(4, sizeof(TickType_t));
+  RUN_TEST(test_old_loop);
+  RUN_TEST(test_draw_load_loop);
+  RUN_TEST(test_new_loop);
+}
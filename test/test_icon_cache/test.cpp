@@ -0,0 +1,5 @@
+#include "icon_cache.h"
+
+void test_task(void*) {
+  icon_cache_tests();
+}
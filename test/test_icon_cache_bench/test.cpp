@@ -0,0 +1,216 @@
+#include "gfx.h"
+#include "unity.h"
+#include "bench.h"
+#include "bench_icon_corpus.h"
+#include "comm_api.h"
+#include "icon_loader.h"
+#include "FileFlash.h"
+#include <cstring>
+
+static constexpr size_t SECTORS = 2;
+static constexpr size_t SECTOR_SZ = 128 * 1024;  ///< like sectors 6 and 7 of the board
+static constexpr size_t SESSIONS = 5;
+
+/// @brief master has a default icon, the others are sent by the PC
+static const mixer::ProgramVolume sessions[SESSIONS] = {
+  mixer::ProgramVolume(-1, 40, ""),           mixer::ProgramVolume(101, 70, "SomeGame.exe"),
+  mixer::ProgramVolume(102, 55, "Editor.exe"), mixer::ProgramVolume(103, 100, "Recorder.exe"),
+  mixer::ProgramVolume(104, 80, "Viewer.exe"),
+};
+
+/// @brief Stands in for the PC on the other end of CommClass, answers the image commands
+/// @details The device writes a byte stream, which may be split anywhere, so the messages are collected first
+class FakePC : public IHWMessage {
+public:
+  void init() override {
+  }
+
+  bool status() const override {
+    return true;
+  }
+
+  void deinit() override {
+  }
+
+  size_t transmit(const void* buff, size_t sz) override {
+    const auto* p = static_cast<const uint8_t*>(buff);
+    to_pc += sz;
+    for (size_t i = 0; i < sz; ++i) {
+      msg_[len_++] = p[i];
+      if (len_ == expected()) {
+        handle();
+        len_ = 0;
+      }
+    }
+    return sz;
+  }
+
+  void reset_counters() {
+    to_pc = from_pc = downloads = info_requests = 0;
+  }
+
+  bool has_info = true;     ///< false for a PC, which doesn't know IMAGE_INFO
+  uint32_t to_pc = 0;       ///< bytes sent by the device
+  uint32_t from_pc = 0;     ///< bytes sent by the PC
+  uint32_t downloads = 0;  ///< images requested
+  uint32_t info_requests = 0;
+
+private:
+  enum State { IDLE, WAIT_CHUNK_SIZE, SENDING };
+
+  static const bench::CorpusIcon& icon(int16_t pid) {
+    return bench::icon_corpus[(pid - 101) % std::size(bench::icon_corpus)];
+  }
+
+  /// @brief Length of the message, which starts with msg_[0]
+  size_t expected() const {
+    if (msg_[0] == 0xA0 || msg_[0] == 0xB0) {
+      return 5;  // response, crc
+    }
+    if (state_ == WAIT_CHUNK_SIZE) {
+      return 8;  // chunk size, crc
+    }
+    return 7;  // command, pid, crc
+  }
+
+  void send(const void* data, size_t sz) {
+    uint8_t out[256 + 4];
+    memcpy(out, data, sz);
+    const uint32_t crc = utils::crc32mpeg2(out, sz);
+    memcpy(out + sz, &crc, sizeof(crc));
+    from_pc += sz + sizeof(crc);
+    receive(out, sz + sizeof(crc));
+  }
+
+  void send_chunk() {
+    const uint32_t len = std::min<uint32_t>(chunk_, image_->png_sz - sent_);
+    send(image_->png + sent_, len);
+    sent_ += len;
+  }
+
+  void handle() {
+    if (msg_[0] == 0xB0) {
+      state_ = IDLE;
+      return;
+    }
+    switch (state_) {
+      case IDLE: {
+        const int16_t pid = utils::mem2T<int16_t>(msg_ + 1);
+        if (msg_[0] == 0x07) {
+          ++info_requests;
+        }
+        if (msg_[0] == 0x07 && has_info) {
+          const uint32_t info[2] = { utils::crc32mpeg2(icon(pid).png, icon(pid).png_sz),
+                                     static_cast<uint32_t>(icon(pid).png_sz) };
+          send(info, sizeof(info));
+        } else if (msg_[0] == 0x02) {
+          ++downloads;
+          image_ = &icon(pid);
+          sent_ = 0;
+          const uint32_t size = image_->png_sz;
+          send(&size, sizeof(size));
+          state_ = WAIT_CHUNK_SIZE;
+        }
+        break;
+      }
+      case WAIT_CHUNK_SIZE:
+        chunk_ = utils::mem2T<uint32_t>(msg_);
+        state_ = SENDING;
+        send_chunk();
+        break;
+      case SENDING:
+        if (sent_ < image_->png_sz) {
+          send_chunk();
+        } else {
+          state_ = IDLE;
+        }
+        break;
+    }
+  }
+
+  State state_ = IDLE;
+  uint8_t msg_[8];
+  size_t len_ = 0;
+  const bench::CorpusIcon* image_ = nullptr;
+  uint32_t sent_ = 0;
+  uint32_t chunk_ = 0;
+};
+
+static FakePC pc;
+static CommClass comm;
+static FileFlash flash(nullptr, SECTORS, SECTOR_SZ);
+static GDisplay* icon;
+
+/// @brief Load the icons of all sessions, like the GUI after the link comes up
+/// @return bytes sent by the PC
+static uint32_t connect(const char* name, IconCache* cache) {
+  pc.reset_counters();
+  bench::Stopwatch sw;
+  for (const auto& vol : sessions) {
+    TEST_ASSERT_TRUE_MESSAGE(icon_loader::load(cache, vol, icon), vol.name_);
+  }
+  const uint32_t us = sw.us();
+  bench::report(name, pc.from_pc, "bytes from PC");
+  bench::report(name, pc.to_pc, "bytes to PC");
+  bench::report(name, pc.downloads, "icons downloaded");
+  bench::report(name, us, "us");
+  return pc.from_pc;
+}
+
+void test_without_cache() {
+  connect("no cache", nullptr);
+  TEST_ASSERT_EQUAL_UINT32(SESSIONS - 1, pc.downloads);
+}
+
+void test_reconnect() {
+  uint32_t first = 0;
+  {
+    IconCache cache(flash);
+    cache.mount();
+    cache.prepare();  // like mixer_gui_init, the icons are added without erasing
+    first = connect("cache, first connect", &cache);
+    TEST_ASSERT_EQUAL_UINT32(SESSIONS - 1, pc.downloads);
+  }
+
+  // a reboot, the icons are read from flash
+  IconCache cache(flash);
+  cache.mount();
+  cache.prepare();
+  TEST_ASSERT_EQUAL(SESSIONS - 1, cache.count());
+  const uint32_t again = connect("cache, reconnect", &cache);
+  TEST_ASSERT_EQUAL_UINT32(0, pc.downloads);
+  TEST_ASSERT_LESS_THAN(first / 10, again);
+  bench::report("flash", flash.programmed(), "bytes programmed");
+  bench::report("flash", flash.erases(), "sectors erased");
+}
+
+void test_old_pc() {
+  // without the image info, every icon is downloaded, and nothing is cached. Only the first few wait for the timeout
+  pc.has_info = false;
+  IconCache cache(flash);
+  cache.mount();
+  cache.prepare();
+  connect("cache, PC without image info", &cache);
+  TEST_ASSERT_EQUAL_UINT32(SESSIONS - 1, pc.downloads);
+  TEST_ASSERT_EQUAL_UINT32(icon_loader::INFO_TRIES, pc.info_requests);
+  pc.has_info = true;
+}
+
+extern "C" void uGFXMain() {
+  icon = gdispPixmapCreate(32, 32);
+  TEST_ASSERT_NOT_NULL(icon);
+
+  comm.set_hw_msg(&pc);
+  comm.init();
+  comm.set_tx_task(xTaskGetCurrentTaskHandle());
+  pc.set_receive_cb([](const void* buff, size_t sz) { comm.receive(buff, sz); });
+  CommAPI::get_instance().init(&comm);
+
+  RUN_TEST(test_without_cache);
+  RUN_TEST(test_reconnect);
+  RUN_TEST(test_old_pc);
+}
+
+void test_task(void*) {
+  gfxInit();
+}
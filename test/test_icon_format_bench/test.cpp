@@ -0,0 +1,120 @@
+#include "gfx.h"
+#include "unity.h"
+#include "bench.h"
+#include "bench_icon_corpus.h"
+#include "icon_stream.h"
+#include <algorithm>
+#include <cstring>
+
+static constexpr gCoord ICON_SZ = 32;
+static constexpr size_t CHUNK = 252;  ///< image chunk of CommAPI
+static constexpr size_t REPEATS = 15;
+
+/// @brief Part of the image to draw
+struct Window {
+  gCoord sx, sy, cx, cy;
+};
+static constexpr Window WHOLE = { 0, 0, ICON_SZ, ICON_SZ };
+
+static GDisplay* from_png;
+static GDisplay* from_rle;
+
+/// @brief Decode @p file from memory onto @p dst
+/// @param peak set to the memory the decoder allocated
+/// @return time of open, draw and close in us
+static uint32_t decode(GDisplay* dst, const uint8_t* file, const Window& window, size_t* peak = nullptr) {
+  gdispGClear(dst, GFX_BLACK);
+  gdispImage img;
+  gdispImageInit(&img);
+  bench::Stopwatch sw;
+  TEST_ASSERT_EQUAL(GDISP_IMAGE_ERR_OK, gdispImageOpenMemory(&img, file));
+  TEST_ASSERT_EQUAL(GDISP_IMAGE_ERR_OK,
+                    gdispGImageDraw(dst, &img, 0, 0, window.cx, window.cy, window.sx, window.sy));
+  if (peak) {
+    *peak = img.maxmemused;
+  }
+  gdispImageClose(&img);
+  return sw.us();
+}
+
+static bool same_pixels() {
+  return 0 == memcmp(gdispPixmapGetBits(from_png), gdispPixmapGetBits(from_rle), ICON_SZ * ICON_SZ * sizeof(gPixel));
+}
+
+void test_same_pixels() {
+  static constexpr Window part = { 7, 5, 10, 12 };  // runs cross the edges of the window
+
+  for (const auto& icon : bench::icon_corpus) {
+    if (not icon.lossless) {
+      continue;
+    }
+    for (const Window& window : { WHOLE, part }) {
+      decode(from_png, icon.png, window);
+      decode(from_rle, icon.rle, window);
+      TEST_ASSERT_TRUE_MESSAGE(same_pixels(), icon.name);
+    }
+  }
+}
+
+/// @brief Hand out the file in link sized chunks
+static int next_chunk(void* param, const gU8** data) {
+  auto& [file, left] = *static_cast<std::pair<const uint8_t*, size_t>*>(param);
+  const size_t len = std::min(CHUNK, left);
+  *data = file;
+  file += len;
+  left -= len;
+  return len;
+}
+
+void test_stream() {
+  for (const auto& icon : bench::icon_corpus) {
+    std::pair<const uint8_t*, size_t> link{ icon.rle, icon.rle_sz };
+    TEST_ASSERT_TRUE_MESSAGE(icon_stream::draw(from_rle, GFX_BLACK, next_chunk, &link), icon.name);
+    decode(from_png, icon.rle, WHOLE);
+    TEST_ASSERT_TRUE_MESSAGE(same_pixels(), icon.name);
+  }
+}
+
+void test_decode_and_size() {
+  char label[64];
+  uint32_t png_total = 0, rle_total = 0;
+
+  for (const auto& icon : bench::icon_corpus) {
+    uint32_t png_us[REPEATS], rle_us[REPEATS];
+    size_t png_peak = 0, rle_peak = 0;
+    for (size_t i = 0; i < REPEATS; ++i) {
+      png_us[i] = decode(from_png, icon.png, WHOLE, &png_peak);
+      rle_us[i] = decode(from_rle, icon.rle, WHOLE, &rle_peak);
+    }
+
+    snprintf(label, sizeof(label), "%s png", icon.name);
+    bench::report(label, bench::percentile(png_us, REPEATS, 50), "us");
+    bench::report(label, icon.png_sz, "B on the wire");
+    bench::report(label, png_peak, "B decoder");
+    snprintf(label, sizeof(label), "%s rle", icon.name);
+    bench::report(label, bench::percentile(rle_us, REPEATS, 50), "us");
+    bench::report(label, icon.rle_sz, "B on the wire");
+    bench::report(label, rle_peak, "B decoder");
+
+    png_total += icon.png_sz;
+    rle_total += icon.rle_sz;
+    TEST_ASSERT_LESS_THAN_UINT32(png_peak, rle_peak);
+  }
+  bench::report("corpus png", png_total, "B on the wire");
+  bench::report("corpus rle", rle_total, "B on the wire");
+}
+
+extern "C" void uGFXMain() {
+  from_png = gdispPixmapCreate(ICON_SZ, ICON_SZ);
+  from_rle = gdispPixmapCreate(ICON_SZ, ICON_SZ);
+  TEST_ASSERT_NOT_NULL(from_png);
+  TEST_ASSERT_NOT_NULL(from_rle);
+
+  RUN_TEST(test_same_pixels);
+  RUN_TEST(test_stream);
+  RUN_TEST(test_decode_and_size);
+}
+
+void test_task(void*) {
+  gfxInit();
+}
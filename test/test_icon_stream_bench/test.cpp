@@ -0,0 +1,146 @@
+#include "gfx.h"
+#include "unity.h"
+#include "bench.h"
+#include "bench_icon.h"
+#include "icon_stream.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+static constexpr size_t CHUNK = 252;           ///< image chunk of CommAPI
+static constexpr uint32_t LINK_US = 1000;      ///< from the ack to the next chunk, one USB frame
+static constexpr size_t STAGING_SZ = 5500;     ///< the whole file was received into this before
+static constexpr gCoord ICON_SZ = 32;
+
+static GDisplay* reference;
+static GDisplay* icon;
+static uint8_t staging[STAGING_SZ];
+
+/// @brief Stands in for the link, hands out a file in pieces
+struct FakeLink {
+  const uint8_t* file;
+  size_t size;
+  size_t piece;        ///< bytes per piece
+  uint32_t delay_us;   ///< a piece arrives this long after the previous one was taken
+  size_t sent = 0;
+  bench::Stopwatch since_ack{};
+
+  static int next(void* param, const gU8** data) {
+    FakeLink& link = *static_cast<FakeLink*>(param);
+    while (link.since_ack.us() < link.delay_us) {
+    }
+    const size_t len = std::min(link.piece, link.size - link.sent);
+    *data = link.file + link.sent;
+    link.sent += len;
+    // acked right away, the PC starts sending the next piece
+    link.since_ack.restart();
+    return len;
+  }
+};
+
+static bool same_pixels(GDisplay* a, GDisplay* b) {
+  return 0 == memcmp(gdispPixmapGetBits(a), gdispPixmapGetBits(b), ICON_SZ * ICON_SZ * sizeof(gPixel));
+}
+
+/// @brief Receive the whole file, then decode it from memory, like the mixer did before
+/// @return the decoder's peak memory
+static size_t staged_decode(FakeLink& link) {
+  const uint8_t* piece = nullptr;
+  size_t received = 0;
+  while (const int len = FakeLink::next(&link, &piece)) {
+    memcpy(staging + received, piece, len);
+    received += len;
+  }
+
+  gdispGClear(icon, GFX_BLACK);
+  gdispImage img;
+  gdispImageInit(&img);
+  TEST_ASSERT_EQUAL(GDISP_IMAGE_ERR_OK, gdispImageOpenMemory(&img, staging));
+  TEST_ASSERT_EQUAL(GDISP_IMAGE_ERR_OK, gdispGImageDraw(icon, &img, 0, 0, ICON_SZ, ICON_SZ, 0, 0));
+  const size_t peak = img.maxmemused;
+  gdispImageClose(&img);
+  return peak;
+}
+
+void test_stream_matches_memory() {
+  FakeLink link{ bench::icon_png, sizeof(bench::icon_png), CHUNK, 0 };
+  staged_decode(link);
+  gdispGBlitArea(reference, 0, 0, ICON_SZ, ICON_SZ, 0, 0, ICON_SZ, gdispPixmapGetBits(icon));
+
+  // pieces smaller than a PNG chunk header, and the size of the link
+  for (size_t piece : { size_t(5), CHUNK }) {
+    link = { bench::icon_png, sizeof(bench::icon_png), piece, 0 };
+    TEST_ASSERT_TRUE(icon_stream::draw(icon, GFX_BLACK, FakeLink::next, &link));
+    TEST_ASSERT_TRUE(same_pixels(reference, icon));
+  }
+}
+
+void test_stream_long_chunk() {
+  // a comment chunk longer than the head moves the image data, its header is split between two pieces
+  static uint8_t png[sizeof(bench::icon_png) + 1000];
+  constexpr size_t ihdr_end = 8 + 25;
+  constexpr size_t idat = 4 * CHUNK - 4;
+  constexpr uint32_t text_len = idat - ihdr_end - 12;
+  memcpy(png, bench::icon_png, ihdr_end);
+  const uint8_t text_hdr[8] = { 0, 0, text_len >> 8, text_len & 0xFF, 't', 'E', 'X', 't' };
+  memcpy(png + ihdr_end, text_hdr, sizeof(text_hdr));
+  memset(png + ihdr_end + 8, 0, text_len + 4);
+  memcpy(png + idat, bench::icon_png + ihdr_end, sizeof(bench::icon_png) - ihdr_end);
+
+  static_assert(idat > icon_stream::HEAD_SZ);
+  const size_t size = idat + sizeof(bench::icon_png) - ihdr_end;
+
+  // the draw goes on from the image data, where the open stopped
+  for (size_t piece : { size_t(5), CHUNK, sizeof(png) }) {
+    FakeLink link{ png, size, piece, 0 };
+    TEST_ASSERT_TRUE(icon_stream::draw(icon, GFX_BLACK, FakeLink::next, &link));
+    TEST_ASSERT_TRUE(same_pixels(reference, icon));
+  }
+}
+
+/// @brief Time to icon and peak RAM of both paths, over a link with @p delay_us per chunk
+static void compare(const char* name, uint32_t delay_us) {
+  char label[64];
+  FakeLink link{ bench::icon_png, sizeof(bench::icon_png), CHUNK, delay_us };
+
+  bench::Stopwatch sw;
+  const size_t staged_peak = staged_decode(link);
+  snprintf(label, sizeof(label), "staged %s", name);
+  bench::report(label, sw.us(), "us");
+  bench::report(label, STAGING_SZ + staged_peak, "B");
+
+  link = { bench::icon_png, sizeof(bench::icon_png), CHUNK, delay_us };
+  size_t stream_peak = 0;
+  sw.restart();
+  TEST_ASSERT_TRUE(icon_stream::draw(icon, GFX_BLACK, FakeLink::next, &link, &stream_peak));
+  snprintf(label, sizeof(label), "streamed %s", name);
+  bench::report(label, sw.us(), "us");
+  bench::report(label, icon_stream::HEAD_SZ + stream_peak, "B");
+
+  TEST_ASSERT_TRUE(same_pixels(reference, icon));
+  TEST_ASSERT_LESS_THAN_UINT32(STAGING_SZ + staged_peak, icon_stream::HEAD_SZ + stream_peak);
+}
+
+void test_decode_only() {
+  compare("decode", 0);
+}
+
+void test_over_link() {
+  compare("over link", LINK_US);
+}
+
+extern "C" void uGFXMain() {
+  reference = gdispPixmapCreate(ICON_SZ, ICON_SZ);
+  icon = gdispPixmapCreate(ICON_SZ, ICON_SZ);
+  TEST_ASSERT_NOT_NULL(reference);
+  TEST_ASSERT_NOT_NULL(icon);
+
+  RUN_TEST(test_stream_matches_memory);
+  RUN_TEST(test_stream_long_chunk);
+  RUN_TEST(test_decode_only);
+  RUN_TEST(test_over_link);
+}
+
+void test_task(void*) {
+  gfxInit();
+}
@@ -0,0 +1,5 @@
+#include "ili9341_scroll.h"
+
+void test_task(void*) {
+  ili9341_scroll_tests();
+}
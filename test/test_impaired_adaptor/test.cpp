@@ -0,0 +1,5 @@
+#include "Impaired_Adaptor.h"
+
+void test_task(void*) {
+  impaired_adaptor_tests();
+}
@@ -0,0 +1,5 @@
+#include "latency_trace.h"
+
+void test_task(void*) {
+  latency_trace_tests();
+}
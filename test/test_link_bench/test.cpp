@@ -0,0 +1,102 @@
+/**
+ * @file test.cpp
+ * @brief CommAPI over a real byte stream, a socket pair and a pseudo-terminal, with and without USB sized chunks
+ * @details bench::PCThread stands in for the PC on the other end. It answers at once, so the times are those of the
+ * device side: CommClass polling its buffers, the tasks and the host link. Reports the round trip of a change query,
+ * loading five sessions, and the throughput of icon downloads.
+ */
+#include "unity.h"
+#include "bench.h"
+#include "bench_pc.h"
+#include "comm_api.h"
+#include "comm_class.h"
+#include "PTY_Adaptor.h"
+#include "Socket_Adaptor.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <fcntl.h>
+
+static constexpr unsigned N_QUERIES = 200;
+static constexpr unsigned N_LOADS = 50;
+static constexpr unsigned N_ICONS = 10;
+static constexpr uint32_t ICON_SZ = 8 * 1024;
+
+static CommClass uart;
+static CommAPI& api = CommAPI::get_instance();
+
+static void tx_task(void*) {
+  uart.set_tx_task(xTaskGetCurrentTaskHandle());
+  while (1) {
+    uart.send_task();
+  }
+}
+
+/// @brief Measure over @p link, the PC is on @p pc
+static void measure(const char* name, FD_Adaptor& link, int pc, size_t chunk) {
+  link.set_chunk(chunk);
+  link.set_receive_cb([](const void* buff, size_t sz) { uart.receive(buff, sz); });
+  uart.set_hw_msg(&link);
+  uart.init();
+  bench::PCThread bench_pc(pc, ICON_SZ);
+  char label[64];
+
+  static uint32_t rtt[N_QUERIES];
+  for (auto& t : rtt) {
+    bench::Stopwatch sw;
+    TEST_ASSERT_EQUAL(1, api.changes());
+    t = sw.us();
+  }
+  snprintf(label, sizeof(label), "%s query p50", name);
+  bench::report(label, bench::percentile(rtt, N_QUERIES, 50), "us");
+  snprintf(label, sizeof(label), "%s query p99", name);
+  bench::report(label, bench::percentile(rtt, N_QUERIES, 99), "us");
+
+  static uint32_t loads[N_LOADS];
+  for (auto& t : loads) {
+    bench::Stopwatch sw;
+    TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_volumes());
+    t = sw.us();
+  }
+  snprintf(label, sizeof(label), "%s load 5 sessions p50", name);
+  bench::report(label, bench::percentile(loads, N_LOADS, 50), "us");
+
+  static uint8_t icon[ICON_SZ];
+  static uint32_t downloads[N_ICONS];
+  for (auto& t : downloads) {
+    bench::Stopwatch sw;
+    TEST_ASSERT_EQUAL(CommAPI::ret_t::OK, api.load_image(1, icon, sizeof(icon)));
+    t = sw.us();
+  }
+  const uint32_t us = bench::percentile(downloads, N_ICONS, 50);
+  snprintf(label, sizeof(label), "%s icon download p50", name);
+  bench::report(label, static_cast<uint32_t>(uint64_t(ICON_SZ) * 1000000 / 1024 / (us ? us : 1)), "KB/s");
+
+  link.deinit();
+}
+
+void test_socket_usb_packets() {
+  Socket_Adaptor link;
+  measure("socket 64 B", link, link.peer(), FD_Adaptor::USB_PACKET_SZ);
+}
+
+void test_socket_whole() {
+  Socket_Adaptor link;
+  measure("socket whole", link, link.peer(), 0);
+}
+
+void test_pty_usb_packets() {
+  PTY_Adaptor link;
+  TEST_ASSERT_TRUE(link.open());
+  const int pc = open(link.path(), O_RDWR | O_NOCTTY);
+  measure("pty 64 B", link, pc, FD_Adaptor::USB_PACKET_SZ);
+  close(pc);
+}
+
+void test_task(void*) {
+  api.init(&uart);
+  xTaskCreate(tx_task, "uart", 256, nullptr, 11, nullptr);
+
+  RUN_TEST(test_socket_usb_packets);
+  RUN_TEST(test_socket_whole);
+  RUN_TEST(test_pty_usb_packets);
+}
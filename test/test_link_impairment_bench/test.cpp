@@ -0,0 +1,192 @@
+/**
+ * @file test.cpp
+ * @brief CommAPI over links as bad as a cheap USB hub, a busy PC or a noisy cable
+ * @details A socket pair is wrapped by Impaired_Adaptor, bench::PCThread answers on the other end. Each profile loads
+ * the sessions, downloads icons and sets volumes. A failed command is tried again, like the GUI does on its next
+ * query, up to MAX_ATTEMPTS times. Reports the goodput, the retries and the tail latency of each, the seed keeps the
+ * drops and flips the same in every run.
+ */
+#include "unity.h"
+#include "bench.h"
+#include "bench_pc.h"
+#include "comm_api.h"
+#include "comm_class.h"
+#include "Impaired_Adaptor.h"
+#include "Socket_Adaptor.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <algorithm>
+#include <atomic>
+
+static constexpr unsigned N_LOADS = 20;
+static constexpr unsigned N_ICONS = 5;
+static constexpr unsigned N_VOLUMES = 20;
+static constexpr unsigned MAX_ATTEMPTS = 10;
+static constexpr uint32_t ICON_SZ = 4 * 1024;
+static constexpr uint32_t VOLUME_TIMEOUT_US = 1000000;  ///< then the volume counts as lost
+/// @brief Bytes of five sessions, without the CRCs
+static constexpr uint32_t SESSIONS_SZ = 1 + bench::PCThread::SESSIONS * (5 + sizeof("program.exe") - 1);
+
+static CommClass uart;
+static CommAPI& api = CommAPI::get_instance();
+
+static const bench::Stopwatch clock_us;  ///< never restarted, the PC thread reads it too
+static std::atomic<int> received_volume{ -1 };
+static std::atomic<uint32_t> received_us{ 0 };
+
+static void tx_task(void*) {
+  uart.set_tx_task(xTaskGetCurrentTaskHandle());
+  while (1) {
+    uart.send_task();
+  }
+}
+
+static void on_volume(int16_t, uint8_t volume) {
+  received_us = clock_us.us();
+  received_volume = volume;
+}
+
+/// @brief Latencies and retries of one operation
+struct Result {
+  uint32_t us[std::max(N_LOADS, N_VOLUMES)];
+  unsigned n = 0;
+  unsigned retries = 0;
+  unsigned failed = 0;  ///< not done after MAX_ATTEMPTS
+  uint64_t total_us = 0;
+
+  void report(const char* profile, const char* op, uint32_t bytes_each) {
+    char label[64];
+    const uint64_t done = uint64_t(n - failed) * bytes_each;
+    snprintf(label, sizeof(label), "%s %s goodput", profile, op);
+    bench::report(label, static_cast<uint32_t>(done * 1000000 / (total_us ? total_us : 1)), "B/s");
+    snprintf(label, sizeof(label), "%s %s retries", profile, op);
+    bench::report(label, retries, failed ? "times, some failed" : "times");
+    snprintf(label, sizeof(label), "%s %s p99", profile, op);
+    bench::report(label, bench::percentile(us, n, 99), "us");
+  }
+};
+
+/// @brief Run @p op until it succeeds, record the time over all attempts
+template <typename F>
+static void attempt(Result& r, F&& op) {
+  bench::Stopwatch sw;
+  unsigned attempts = 1;
+  while (not op() && attempts < MAX_ATTEMPTS) {
+    ++attempts;
+  }
+  r.failed += attempts == MAX_ATTEMPTS;
+  r.retries += attempts - 1;
+  r.us[r.n] = sw.us();
+  r.total_us += r.us[r.n++];
+}
+
+/// @brief Wait for the PC to get @p volume
+static bool volume_received(uint8_t volume, uint32_t sent_us) {
+  while (clock_us.us() - sent_us < VOLUME_TIMEOUT_US) {
+    if (received_volume == volume) {
+      return true;
+    }
+    vTaskDelay(1);
+  }
+  return false;
+}
+
+static void measure(const char* name, const Impaired_Adaptor::Impairments& impairments) {
+  Socket_Adaptor socket;
+  Impaired_Adaptor link(socket, impairments);
+  link.set_receive_cb([](const void* buff, size_t sz) { uart.receive(buff, sz); });
+  uart.set_hw_msg(&link);
+  uart.init();
+  bench::PCThread bench_pc(socket.peer(), ICON_SZ, on_volume);
+  received_volume = -1;
+
+  Result loads;
+  for (unsigned i = 0; i < N_LOADS; ++i) {
+    attempt(loads, [] { return api.load_volumes() == CommAPI::ret_t::OK; });
+  }
+  loads.report(name, "load_volumes", SESSIONS_SZ);
+
+  static uint8_t icon[ICON_SZ];
+  Result images;
+  for (unsigned i = 0; i < N_ICONS; ++i) {
+    attempt(images, [] { return api.load_image(1, icon, sizeof(icon)) == CommAPI::ret_t::OK; });
+  }
+  images.report(name, "load_image", ICON_SZ);
+
+  // fire and forget, a lost volume is sent again. The latency is up to the PC receiving it
+  Result volumes;
+  for (unsigned i = 0; i < N_VOLUMES; ++i) {
+    const uint8_t volume = i * 5;
+    attempt(volumes, [volume] {
+      const uint32_t sent_us = clock_us.us();
+      api.set_volume(1, volume);
+      return volume_received(volume, sent_us);
+    });
+  }
+  volumes.report(name, "set_volume", sizeof(int16_t) + sizeof(uint8_t));
+
+  const auto stats = link.stats();
+  char label[64];
+  snprintf(label, sizeof(label), "%s link", name);
+  bench::report(label, stats.dropped + stats.flipped, "bytes dropped or flipped");
+  link.deinit();
+}
+
+void test_clean() {
+  measure("clean", {});
+}
+
+void test_slow_hub() {
+  Impaired_Adaptor::Impairments hub;
+  hub.latency_us = 2000;
+  hub.jitter_us = 3000;
+  hub.fragment = 16;
+  measure("slow hub", hub);
+}
+
+void test_busy_pc() {
+  Impaired_Adaptor::Impairments busy;
+  busy.latency_us = 20000;
+  busy.jitter_us = 30000;
+  measure("busy pc", busy);
+}
+
+void test_narrow() {
+  // full speed USB behind a hub shared with a webcam
+  Impaired_Adaptor::Impairments narrow;
+  narrow.bytes_per_s = 100 * 1024;
+  narrow.fragment = FD_Adaptor::USB_PACKET_SZ;
+  measure("narrow", narrow);
+}
+
+void test_noisy() {
+  Impaired_Adaptor::Impairments noisy;
+  noisy.drop_ppm = 100;
+  noisy.flip_ppm = 100;
+  noisy.seed = 42;
+  measure("noisy", noisy);
+}
+
+void test_everything() {
+  Impaired_Adaptor::Impairments bad;
+  bad.latency_us = 2000;
+  bad.jitter_us = 5000;
+  bad.bytes_per_s = 100 * 1024;
+  bad.fragment = 16;
+  bad.drop_ppm = 100;
+  bad.flip_ppm = 100;
+  bad.seed = 7;
+  measure("everything", bad);
+}
+
+void test_task(void*) {
+  api.init(&uart);
+  xTaskCreate(tx_task, "uart", 256, nullptr, 11, nullptr);
+
+  RUN_TEST(test_clean);
+  RUN_TEST(test_slow_hub);
+  RUN_TEST(test_busy_pc);
+  RUN_TEST(test_narrow);
+  RUN_TEST(test_noisy);
+  RUN_TEST(test_everything);
+}
@@ -4,6 +4,7 @@
 #include "task.h"
 #include "unity.h"
 #include "fakeit.hpp"
+#include <cstdlib>
 
 /**
  * @brief Tests have to implement this task
@@ -23,9 +24,14 @@ extern void pre_test();
 static void test_task_wrap(void* arg) {
   UNITY_BEGIN();
   test_task(arg);
+#ifdef NATIVE
+  // the host runner waits for the process to exit
+  exit(UNITY_END());
+#else
   UNITY_END();
   while (1) {
   }
+#endif
 }
 
 
@@ -57,3 +63,6 @@ __weak void tearDown() {
 }
 __weak void pre_test() {
 }
+/// uGFX refers to it, the GUI tests implement it and call gfxInit() from test_task
+extern "C" __weak void uGFXMain() {
+}
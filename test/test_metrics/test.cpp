@@ -0,0 +1,5 @@
+#include "metrics.h"
+
+void test_task(void*) {
+  metrics_tests();
+}
@@ -0,0 +1,121 @@
+/**
+ * @file test.cpp
+ * @brief Cost of the metrics on the hot paths, and the size of a snapshot on the link
+ * @details Each update is timed over many calls with the scheduler suspended, against an empty loop. The timer reads
+ * the clock twice, the DWT cycle counter on the board and the monotonic clock on the PC. The snapshot holds every
+ * metric of the firmware linked into the test, sent to a sink which counts bytes. Cycles are nanoseconds on the PC.
+ */
+#include "unity.h"
+#include "bench.h"
+#include "comm_api.h"
+#include "comm_class.h"
+#include "metrics.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+static constexpr unsigned N_OPS = 100000;
+static constexpr unsigned RUNS = 5;
+
+#ifdef NATIVE
+static const uint32_t CYCLES_PER_US = 1000;
+
+static uint32_t clock_cycles() {
+  timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return static_cast<uint32_t>(static_cast<uint64_t>(t.tv_sec) * 1000000000u + t.tv_nsec);
+}
+#else
+static const uint32_t CYCLES_PER_US = SystemCoreClock / 1000000;
+
+static uint32_t clock_cycles() {
+  return DWT->CYCCNT;
+}
+#endif
+
+METRICS_COUNTER(bench_counter, "bench.counter");
+METRICS_GAUGE(bench_gauge, "bench.gauge");
+METRICS_HISTOGRAM(bench_histogram, "bench.histogram");
+
+/// @brief Counts the bytes sent to the PC
+class Sink : public IHWMessage {
+public:
+  void init() override {
+  }
+
+  bool status() const override {
+    return true;
+  }
+
+  void deinit() override {
+  }
+
+  size_t transmit(const void*, size_t sz) override {
+    bytes += sz;
+    return sz;
+  }
+
+  uint32_t bytes = 0;
+};
+
+static Sink sink;
+static CommClass uart;
+static CommAPI& api = CommAPI::get_instance();
+
+/// @brief The median of RUNS, in cycles per call of @p op
+template <typename Op>
+static uint32_t cost(Op op) {
+  uint32_t samples[RUNS];
+  for (auto& sample : samples) {
+    vTaskSuspendAll();
+    bench::Stopwatch sw;
+    for (uint32_t i = 0; i < N_OPS; ++i) {
+      op(i);
+    }
+    sample = sw.cycles() / N_OPS;
+    xTaskResumeAll();
+  }
+  return bench::percentile(samples, RUNS, 50);
+}
+
+void test_update_cost() {
+  metrics::set_clock(clock_cycles, CYCLES_PER_US);
+  const uint32_t loop = cost([](uint32_t) { asm volatile(""); });
+  const uint32_t counter = cost([](uint32_t) { bench_counter.add(); });
+  const uint32_t gauge = cost([](uint32_t i) { bench_gauge.set(i); });
+  const uint32_t histogram = cost([](uint32_t i) { bench_histogram.record(i & 0xFFFF); });
+  const uint32_t timer = cost([](uint32_t) { metrics::ScopedTimer t(bench_histogram); });
+  metrics::set_clock(nullptr, 1);
+
+  bench::report("empty loop", loop, "cycles");
+  bench::report("counter add", counter, "cycles");
+  bench::report("gauge set", gauge, "cycles");
+  bench::report("histogram record", histogram, "cycles");
+  bench::report("scoped timer", timer, "cycles");
+  TEST_ASSERT_EQUAL(5 * N_OPS, bench_counter.get());
+  TEST_ASSERT_LESS_THAN(CYCLES_PER_US / 4, counter);
+  TEST_ASSERT_LESS_THAN(CYCLES_PER_US / 4, histogram);
+  TEST_ASSERT_LESS_THAN(CYCLES_PER_US, timer);
+}
+
+void test_snapshot() {
+  uart.set_hw_msg(&sink);
+  uart.init();
+  uart.set_tx_task(xTaskGetCurrentTaskHandle());
+  api.init(&uart);
+
+  for (const bool names : { true, false }) {
+    sink.bytes = 0;
+    bench::Stopwatch sw;
+    api.send_metrics(1000, names);
+    const uint32_t cycles = sw.cycles();
+    uart.flush();
+    bench::report(names ? "snapshot with names" : "snapshot", sink.bytes, "bytes on the link");
+    bench::report(names ? "snapshot with names" : "snapshot", cycles, "cycles");
+  }
+  bench::report("metrics", metrics::count(), "registered");
+}
+
+void test_task(void*) {
+  RUN_TEST(test_update_cost);
+  RUN_TEST(test_snapshot);
+}
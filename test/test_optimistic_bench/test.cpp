@@ -0,0 +1,149 @@
+/**
+ * @file test.cpp
+ * @brief Simulates taps on "+" and "-" against a delayed PC, and reports the input-to-feedback latency
+ * @details The simulation runs in virtual time with 1 ms steps. Commands reach the PC after LINK_DELAY, and it applies
+ * them after APPLY_DELAY. The link polls every POLL_PERIOD, and the GUI loads the volumes after each tap and each
+ * reported change, like mixer_gui does. Three GUIs are compared: one that shows only the values from the PC, one that
+ * shows the target right away but takes every value from the PC, and one with PendingVolume.
+ */
+#include "unity.h"
+#include "bench.h"
+#include "pending_volume.h"
+
+static constexpr uint32_t LINK_DELAY = 10;
+static constexpr uint32_t APPLY_DELAY = 80;
+static constexpr uint32_t ROUND_TRIP = 20;
+static constexpr uint32_t POLL_PERIOD = 250;
+static constexpr uint32_t TAP_PERIOD = 400;
+static constexpr unsigned N_TAPS = 40;
+static constexpr uint32_t DURATION = TAP_PERIOD * (N_TAPS + 2);
+
+enum class Gui {
+  PC_ONLY,
+  OPTIMISTIC,
+  RECONCILED,
+};
+
+struct Result {
+  uint32_t latency[N_TAPS];
+  unsigned n = 0;
+  unsigned jumps = 0;  ///< times the shown value moved away from the target, after it was shown
+};
+
+/// @brief The PC stand-in
+struct Pc {
+  uint8_t volume = 50;
+  bool changed = false;
+  int32_t pending_volume = -1;
+  uint32_t apply_at = 0;
+
+  void step(uint32_t now) {
+    if (pending_volume >= 0 && now == apply_at) {
+      volume = pending_volume;
+      pending_volume = -1;
+      changed = true;
+    }
+  }
+  void set_volume(uint8_t vol, uint32_t now) {
+    pending_volume = vol;
+    apply_at = now + LINK_DELAY + APPLY_DELAY;
+  }
+};
+
+static Result run(Gui gui) {
+  Result res;
+  Pc pc;
+  PendingVolume pending;
+  uint8_t shown = pc.volume;
+  uint8_t target = shown;
+  bool target_shown = true;
+  uint32_t tapped_at = 0;
+  int32_t load_at = -1;  ///< a load of the volumes finishes
+  uint32_t next_poll = 0;
+  int32_t poll_at = -1;  ///< a poll finishes
+  int direction = 10;
+
+  for (uint32_t now = 0; now < DURATION; ++now) {
+    pc.step(now);
+
+    // tap
+    if (now % TAP_PERIOD == TAP_PERIOD / 2 && res.n < N_TAPS && target_shown) {
+      if (shown + direction > 100 || shown + direction < 0) {
+        direction = -direction;
+      }
+      target = shown + direction;
+      tapped_at = now;
+      target_shown = false;
+      pc.set_volume(target, now);
+      if (gui != Gui::PC_ONLY) {
+        shown = target;
+        pending.set_volume(target, now);
+      }
+      load_at = now + ROUND_TRIP;
+    }
+
+    // poll
+    if (now == next_poll) {
+      poll_at = now + ROUND_TRIP;
+      next_poll += POLL_PERIOD;
+    }
+    if (static_cast<int32_t>(now) == poll_at && pc.changed) {
+      pc.changed = false;
+      load_at = now + ROUND_TRIP;
+    }
+
+    // load the volumes
+    if (static_cast<int32_t>(now) == load_at) {
+      mixer::ProgramVolume vol(1, pc.volume);
+      const uint8_t loaded = gui == Gui::RECONCILED ? pending.reconcile(vol, now).volume_ : vol.volume_;
+      if (target_shown && shown == target && loaded != target) {
+        ++res.jumps;
+      }
+      shown = loaded;
+    }
+
+    if (not target_shown && shown == target) {
+      target_shown = true;
+      res.latency[res.n++] = now - tapped_at;
+    }
+  }
+  return res;
+}
+
+static void report(const char* name, Result& res) {
+  char buff[48];
+  for (unsigned pct : { 50, 99 }) {
+    snprintf(buff, sizeof(buff), "%s feedback p%u", name, pct);
+    bench::report(buff, bench::percentile(res.latency, res.n, pct), "ms");
+  }
+  snprintf(buff, sizeof(buff), "%s jumps back", name);
+  bench::report(buff, res.jumps, "times");
+}
+
+void test_pc_only() {
+  auto res = run(Gui::PC_ONLY);
+  TEST_ASSERT_EQUAL(N_TAPS, res.n);
+  report("pc only", res);
+  TEST_ASSERT_GREATER_OR_EQUAL(LINK_DELAY + APPLY_DELAY, bench::percentile(res.latency, res.n, 50));
+}
+
+void test_optimistic() {
+  auto res = run(Gui::OPTIMISTIC);
+  report("optimistic", res);
+  // the load after the tap shows the old value again
+  TEST_ASSERT_GREATER_THAN(0, res.jumps);
+}
+
+void test_reconciled() {
+  auto res = run(Gui::RECONCILED);
+  TEST_ASSERT_EQUAL(N_TAPS, res.n);
+  report("reconciled", res);
+  TEST_ASSERT_EQUAL(0, bench::percentile(res.latency, res.n, 99));
+  TEST_ASSERT_EQUAL(0, res.jumps);
+}
+
+void test_task(void*) {
+  RUN_TEST(test_pc_only);
+  RUN_TEST(test_optimistic);
+  RUN_TEST(test_reconciled);
+}
@@ -0,0 +1,5 @@
+#include "pc_server.h"
+
+void test_task(void*) {
+  pc_server_tests();
+}
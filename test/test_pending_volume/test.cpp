@@ -0,0 +1,5 @@
+#include "pending_volume.h"
+
+void test_task(void*) {
+  pending_volume_tests();
+}
@@ -0,0 +1,163 @@
+#include "gfx.h"
+#include "unity.h"
+#include "bench.h"
+#include "bench_icon.h"
+#include "volume_line.h"
+#include "icon_stream.h"
+#include "gdisp_memory.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+static StripRenderer strip;
+static volume_lines_t lines = { SetVolumeHelper(0), SetVolumeHelper(1), SetVolumeHelper(2), SetVolumeHelper(3),
+                                SetVolumeHelper(4) };
+static session_slots_t slots;
+static std::array<CommAPI::volume_t, CommAPI::MAX_SUPPORTED_PROGRAMS> volumes;
+static uint32_t icons_loaded = 0;
+static uint32_t icon_tries = 0;
+static bool icons_broken = false;  ///< the PC sends icons, which can't be decoded
+
+/// @brief Hand out the icon in link sized chunks
+static int next_chunk(void* param, const gU8** data) {
+  size_t& sent = *static_cast<size_t*>(param);
+  const size_t len = std::min<size_t>(252, sizeof(bench::icon_png) - sent);
+  *data = bench::icon_png + sent;
+  sent += len;
+  return len;
+}
+
+/// @brief Stands in for the PC, every session has the same icon
+static bool load_icon(const mixer::ProgramVolume&, GDisplay* icon) {
+  ++icon_tries;
+  size_t sent = icons_broken ? sizeof(bench::icon_png) / 2 : 0;
+  if (not icon_stream::draw(icon, gwinGetDefaultBgColor(), next_chunk, &sent)) {
+    return false;
+  }
+  ++icons_loaded;
+  return true;
+}
+
+static void drop_command(const LinkCommand&) {
+}
+
+static uint32_t now_ms() {
+  return 0;
+}
+
+/// @brief Write the frame to $RENDER_BENCH_PPM_DIR/<name>.ppm, if the variable is set
+static void dump_frame(const char* name) {
+  const char* dir = getenv("RENDER_BENCH_PPM_DIR");
+  if (not dir) {
+    return;
+  }
+  char path[256];
+  int len = snprintf(path, sizeof(path), "%s/", dir);
+  for (const char* c = name; *c && len < static_cast<int>(sizeof(path)) - 5; ++c, ++len) {
+    path[len] = (*c == ' ') ? '_' : *c;
+  }
+  strcpy(path + len, ".ppm");
+  TEST_ASSERT_TRUE(gdispMemoryDumpPPM(GDISP, path));
+}
+
+/// @brief Run @p draw once, report the time and the pixels it wrote
+/// @return pixels written
+template <typename F>
+static uint32_t measure(const char* name, F&& draw) {
+  gdispResetPixelsWritten();
+  bench::Stopwatch sw;
+  draw();
+  const uint32_t us = sw.us();
+  const uint32_t px = gdispGetPixelsWritten();
+  bench::report(name, us, "us");
+  bench::report(name, px, "px");
+  dump_frame(name);
+  return px;
+}
+
+void test_lines_init() {
+  const uint32_t px = measure("lines init", [] {
+    for (auto& line : lines) {
+      line.init();
+    }
+  });
+  // widgets are created hidden
+  TEST_ASSERT_EQUAL_UINT32(0, px);
+}
+
+void test_full_redraw() {
+  for (int16_t i = 0; i < static_cast<int16_t>(volumes.size()); ++i) {
+    volumes[i] = mixer::ProgramVolume(i == 0 ? -1 : 100 + i, 20 * i, "session");
+  }
+  const uint32_t px = measure("full redraw", [] { show_volumes(lines, slots, volumes); });
+
+  // every line goes through the strip once, and nothing else is drawn
+  TEST_ASSERT_EQUAL_UINT32(MAX_LINES * gdispGetWidth() * StripRenderer::HEIGHT, px);
+  TEST_ASSERT_EQUAL_UINT32(MAX_LINES, icons_loaded);
+}
+
+void test_redraw_unchanged() {
+  const uint32_t px = measure("unchanged redraw", [] { show_volumes(lines, slots, volumes); });
+  TEST_ASSERT_EQUAL_UINT32(0, px);
+}
+
+void test_volume_change() {
+  volumes[2]->volume_ += 10;
+  const uint32_t px = measure("single volume change", [] { show_volumes(lines, slots, volumes); });
+
+  // only the slider of one line is touched
+  TEST_ASSERT_GREATER_THAN_UINT32(0, px);
+  TEST_ASSERT_LESS_THAN_UINT32(gdispGetWidth() * StripRenderer::HEIGHT, px);
+}
+
+void test_icon_load() {
+  const uint32_t loaded = icons_loaded;
+  volumes[3]->pid_ += 100;  // new session on the line
+  const uint32_t px = measure("icon load", [] { show_volumes(lines, slots, volumes); });
+
+  TEST_ASSERT_EQUAL_UINT32(loaded + 1, icons_loaded);
+  TEST_ASSERT_EQUAL_UINT32(gdispGetWidth() * StripRenderer::HEIGHT, px);
+}
+
+void test_icon_failed() {
+  const uint32_t tries = icon_tries;
+  icons_broken = true;
+  volumes[4]->pid_ += 100;
+  measure("icon failed", [] { show_volumes(lines, slots, volumes); });
+
+  // the line is shown without the icon, it isn't downloaded again until the session changes
+  const uint32_t px = measure("after icon failed", [] { show_volumes(lines, slots, volumes); });
+  icons_broken = false;
+  TEST_ASSERT_EQUAL_UINT32(tries + 1, icon_tries);
+  TEST_ASSERT_EQUAL_UINT32(0, px);
+}
+
+void test_text_draw() {
+  gFont font = gdispOpenFont("DejaVuSans12*");
+  TEST_ASSERT_NOT_NULL(font);
+  const uint32_t px = measure("text draw", [font] {
+    gdispFillStringBox(10, 200, 200, 32, "Mute (45%)", font, GFX_WHITE, GFX_BLUE, gJustifyCenter);
+  });
+  // the box is filled, then the glyphs are drawn over it
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(200 * 32, px);
+  gdispCloseFont(font);
+}
+
+extern "C" void uGFXMain() {
+  gwinSetDefaultStyle(&BlackWidgetStyle, false);
+  gwinSetDefaultFont(gdispOpenFont("DejaVuSans12*"));
+  TEST_ASSERT_TRUE(strip.init(GDISP));
+  SetVolumeHelper::hooks = { load_icon, drop_command, now_ms, &strip };
+
+  RUN_TEST(test_lines_init);
+  RUN_TEST(test_full_redraw);
+  RUN_TEST(test_redraw_unchanged);
+  RUN_TEST(test_volume_change);
+  RUN_TEST(test_icon_load);
+  RUN_TEST(test_icon_failed);
+  RUN_TEST(test_text_draw);
+}
+
+void test_task(void*) {
+  gfxInit();
+}
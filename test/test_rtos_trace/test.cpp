@@ -0,0 +1,5 @@
+#include "rtos_trace.h"
+
+void test_task(void*) {
+  rtos_trace_tests();
+}
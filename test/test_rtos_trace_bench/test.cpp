@@ -0,0 +1,97 @@
+/**
+ * @file test.cpp
+ * @brief Cost of the RTOS tracer: one event, and a queue ping-pong between two tasks with and without recording
+ * @details The ping-pong records about 10 events a round trip: sends, receives, blocking, switches and ready tasks.
+ * Cycles are nanoseconds on the PC.
+ */
+#include "unity.h"
+#include "bench.h"
+#include "rtos_trace.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+static constexpr unsigned N_EVENTS = 10000;
+static constexpr unsigned N_ROUNDS = 2000;
+static constexpr unsigned RUNS = 5;
+
+#ifdef NATIVE
+static const uint32_t CYCLES_PER_US = 1000;
+#else
+static const uint32_t CYCLES_PER_US = SystemCoreClock / 1000000;
+#endif
+
+static QueueHandle_t ping, pong;
+
+static void echo_task(void*) {
+  uint32_t v;
+  while (1) {
+    xQueueReceive(ping, &v, portMAX_DELAY);
+    xQueueSend(pong, &v, portMAX_DELAY);
+  }
+}
+
+/// @brief The fastest of RUNS ping-pongs, in ns or cycles per round trip
+static uint32_t ping_pong() {
+  uint32_t best = UINT32_MAX;
+  for (unsigned run = 0; run < RUNS; ++run) {
+    bench::Stopwatch sw;
+    for (uint32_t i = 0; i < N_ROUNDS; ++i) {
+      uint32_t v = i;
+      xQueueSend(ping, &v, portMAX_DELAY);
+      xQueueReceive(pong, &v, portMAX_DELAY);
+    }
+    best = std::min(best, sw.cycles() / N_ROUNDS);
+    rtos_trace_clear();
+  }
+  return best;
+}
+
+void test_event_cost() {
+  // the scheduler would count its own switches in
+  uint32_t samples[RUNS];
+  const uint16_t marker = rtos_trace_marker("bench");
+  for (auto& sample : samples) {
+    vTaskSuspendAll();
+    bench::Stopwatch sw;
+    for (uint32_t i = 0; i < N_EVENTS; ++i) {
+      rtos_trace_mark(marker, i);
+    }
+    sample = sw.cycles() / N_EVENTS;
+    xTaskResumeAll();
+  }
+  rtos_trace_clear();
+  const uint32_t cycles = bench::percentile(samples, RUNS, 50);
+  bench::report("trace event", cycles, "cycles");
+  TEST_ASSERT_LESS_THAN(CYCLES_PER_US, cycles);
+}
+
+void test_ping_pong() {
+  ping = xQueueCreate(1, sizeof(uint32_t));
+  pong = xQueueCreate(1, sizeof(uint32_t));
+  TaskHandle_t echo;
+  xTaskCreate(echo_task, "echo", 256, nullptr, uxTaskPriorityGet(nullptr), &echo);
+
+  rtos_trace_clear();
+  uint32_t lost = 0;
+  static rtos_trace_record_t records[RTOS_TRACE_RECORDS];
+  uint32_t v = 0;
+  xQueueSend(ping, &v, portMAX_DELAY);
+  xQueueReceive(pong, &v, portMAX_DELAY);
+  bench::report("ping-pong", rtos_trace_read(records, RTOS_TRACE_RECORDS, &lost), "events per round trip");
+
+  const uint32_t traced = ping_pong();
+  rtos_trace_enable(0);
+  const uint32_t untraced = ping_pong();
+  rtos_trace_enable(1);
+  vTaskDelete(echo);
+
+  bench::report("ping-pong traced", traced, "cycles per round trip");
+  bench::report("ping-pong untraced", untraced, "cycles per round trip");
+  bench::report("ping-pong overhead", traced > untraced ? traced - untraced : 0, "cycles per round trip");
+}
+
+void test_task(void*) {
+  RUN_TEST(test_event_cost);
+  RUN_TEST(test_ping_pong);
+}
@@ -0,0 +1,163 @@
+#include "gfx.h"
+#include "unity.h"
+#include "bench.h"
+#include "bench_icon.h"
+#include "volume_line.h"
+#include "icon_stream.h"
+#include "gdisp_memory.h"
+#include <algorithm>
+#include <vector>
+
+static constexpr size_t STEPS = 300;
+
+static StripRenderer strip;
+static volume_lines_t lines = { SetVolumeHelper(0), SetVolumeHelper(1), SetVolumeHelper(2), SetVolumeHelper(3),
+                                SetVolumeHelper(4) };
+static session_slots_t slots;
+static uint32_t icons_loaded = 0;
+
+using volumes_t = std::array<CommAPI::volume_t, CommAPI::MAX_SUPPORTED_PROGRAMS>;
+
+/// @brief Hand out the icon in link sized chunks
+static int next_chunk(void* param, const gU8** data) {
+  size_t& sent = *static_cast<size_t*>(param);
+  const size_t len = std::min<size_t>(252, sizeof(bench::icon_png) - sent);
+  *data = bench::icon_png + sent;
+  sent += len;
+  return len;
+}
+
+/// @brief Stands in for the PC, every session has the same icon
+static bool load_icon(const mixer::ProgramVolume&, GDisplay* icon) {
+  size_t sent = 0;
+  ++icons_loaded;
+  return icon_stream::draw(icon, gwinGetDefaultBgColor(), next_chunk, &sent);
+}
+
+static void drop_command(const LinkCommand&) {
+}
+
+static uint32_t now_ms() {
+  return 0;
+}
+
+/// @brief What the PC reports after each change: programs start and stop, change volume, and the PC lists them in a
+/// different order now and then. The master is always first
+static std::vector<volumes_t> churn_trace() {
+  std::vector<volumes_t> trace;
+  std::vector<mixer::ProgramVolume> sessions = { mixer::ProgramVolume(-1, 50, "") };
+  uint32_t rnd = 12345;
+  auto random = [&rnd](uint32_t n) {
+    rnd = rnd * 1103515245 + 12345;
+    return (rnd >> 16) % n;
+  };
+  int16_t next_pid = 1000;
+
+  while (trace.size() < STEPS) {
+    switch (random(4)) {
+      case 0:  // a program stops
+        if (sessions.size() > 1) {
+          sessions.erase(sessions.begin() + 1 + random(sessions.size() - 1));
+        }
+        break;
+      case 1:  // a program starts
+        if (sessions.size() < CommAPI::MAX_SUPPORTED_PROGRAMS) {
+          sessions.emplace_back(next_pid, 50, "program");
+          next_pid += 4;
+        }
+        break;
+      case 2:  // volume of one session
+        sessions[random(sessions.size())].volume_ = random(101);
+        break;
+      case 3:  // listed in another order
+        if (sessions.size() > 2) {
+          std::rotate(sessions.begin() + 1, sessions.begin() + 2, sessions.end());
+        }
+        break;
+    }
+    volumes_t volumes;
+    std::copy(sessions.begin(), sessions.end(), volumes.begin());
+    trace.push_back(volumes);
+  }
+  return trace;
+}
+
+/// @brief Like before the session slots, the n-th session from the PC on the n-th line
+static void show_in_order(const volumes_t& volumes) {
+  size_t line = 0;
+  for (const auto& vol : volumes) {
+    if (vol) {
+      lines[line].set_volume(*vol);
+      lines[line].render();
+      ++line;
+    }
+  }
+  for (; line < lines.size(); ++line) {
+    lines[line].reset();
+  }
+}
+
+static void show_in_slots(const volumes_t& volumes) {
+  show_volumes(lines, slots, volumes);
+}
+
+/// @brief Play the trace on empty lines
+/// @return icons loaded
+static uint32_t play(const char* name, void (*show)(const volumes_t&)) {
+  static const std::vector<volumes_t> trace = churn_trace();
+  for (auto& line : lines) {
+    line.reset();
+  }
+  slots.clear();
+  icons_loaded = 0;
+  gdispResetPixelsWritten();
+
+  std::vector<uint32_t> step_us;
+  for (const auto& volumes : trace) {
+    bench::Stopwatch sw;
+    show(volumes);
+    step_us.push_back(sw.us());
+  }
+  bench::report(name, icons_loaded, "icons loaded");
+  bench::report(name, gdispGetPixelsWritten(), "px written");
+  bench::report(name, bench::percentile(step_us.data(), step_us.size(), 50), "us per change, p50");
+  bench::report(name, bench::percentile(step_us.data(), step_us.size(), 99), "us per change, p99");
+  return icons_loaded;
+}
+
+void test_lines_init() {
+  for (auto& line : lines) {
+    line.init();
+  }
+}
+
+void test_churn() {
+  const uint32_t in_order = play("churn in order", show_in_order);
+  const uint32_t in_slots = play("churn in slots", show_in_slots);
+
+  // only new sessions load an icon
+  uint32_t started = 0;
+  const auto trace = churn_trace();
+  for (size_t i = 0; i < trace.size(); ++i) {
+    for (const auto& vol : trace[i]) {
+      const auto same_pid = [&vol](const CommAPI::volume_t& v) { return v && vol && v->pid_ == vol->pid_; };
+      started += vol && (i == 0 || std::none_of(trace[i - 1].begin(), trace[i - 1].end(), same_pid));
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(started, in_slots);
+  TEST_ASSERT_LESS_THAN_UINT32(in_order, in_slots);
+}
+
+extern "C" void uGFXMain() {
+  gwinSetDefaultStyle(&BlackWidgetStyle, false);
+  gwinSetDefaultFont(gdispOpenFont("DejaVuSans12*"));
+  TEST_ASSERT_TRUE(strip.init(GDISP));
+  SetVolumeHelper::hooks = { load_icon, drop_command, now_ms, &strip };
+
+  RUN_TEST(test_lines_init);
+  RUN_TEST(test_churn);
+}
+
+void test_task(void*) {
+  gfxInit();
+}
@@ -0,0 +1,5 @@
+#include "session_pager.h"
+
+void test_task(void*) {
+  session_pager_tests();
+}
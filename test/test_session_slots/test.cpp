@@ -0,0 +1,5 @@
+#include "session_slots.h"
+
+void test_task(void*) {
+  session_slots_tests();
+}
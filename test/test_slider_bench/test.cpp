@@ -0,0 +1,71 @@
+#include "gfx.h"
+#include "unity.h"
+#include "bench.h"
+
+static GHandle slider;
+static char slider_txt[30];
+
+/// @brief Create a slider the same size as the ones on the mixer GUI
+static void create_slider() {
+  GWidgetInit wi;
+  gwinWidgetClearInit(&wi);
+  wi.g.show = gTrue;
+  wi.g.x = 10 + 3 * 40;
+  wi.g.y = 10;
+  wi.g.height = 32;
+  wi.g.width = gdispGetWidth() - 10 - 3 * 40 - 10 - 40;
+  wi.text = "0%";
+  slider = gwinSliderCreate(0, &wi);
+  gwinRedraw(slider);
+}
+
+/// @brief Move the slider from 0 to 100 in 1% steps, like a drag does
+/// @return number of pixels written
+static uint32_t drag(bool incremental) {
+  gwinSliderSetPositionText(slider, 0, "0%");
+  gwinRedraw(slider);
+  gdispResetPixelsWritten();
+
+  for (int pos = 1; pos <= 100; ++pos) {
+    snprintf(slider_txt, sizeof(slider_txt), "%d%%", pos);
+    if (incremental) {
+      gwinSliderSetPositionText(slider, pos, slider_txt);
+    } else {
+      // like the GUI did, each call has the redraw timer draw the whole slider
+      gwinSliderSetPosition(slider, pos);
+      gwinSetText(slider, slider_txt, gFalse);
+    }
+  }
+  return gdispGetPixelsWritten();
+}
+
+void test_slider_drag_pixels() {
+  gwinSetCustomDraw(slider, gwinSliderDraw_Std, nullptr);
+  const TickType_t std_start = xTaskGetTickCount();
+  const uint32_t std_pixels = drag(false);
+  const TickType_t std_ticks = xTaskGetTickCount() - std_start;
+
+  gwinSetCustomDraw(slider, gwinSliderDraw_Incremental, nullptr);
+  const TickType_t inc_start = xTaskGetTickCount();
+  const uint32_t inc_pixels = drag(true);
+  const TickType_t inc_ticks = xTaskGetTickCount() - inc_start;
+
+  bench::report("full redraw, 0-100 drag", std_pixels, "px");
+  bench::report("full redraw, 0-100 drag", std_ticks, "ms");
+  bench::report("incremental, 0-100 drag", inc_pixels, "px");
+  bench::report("incremental, 0-100 drag", inc_ticks, "ms");
+
+  TEST_ASSERT_LESS_THAN_UINT32(std_pixels, inc_pixels);
+}
+
+extern "C" void uGFXMain() {
+  gwinSetDefaultStyle(&BlackWidgetStyle, false);
+  gwinSetDefaultFont(gdispOpenFont("DejaVuSans12*"));
+  create_slider();
+
+  RUN_TEST(test_slider_drag_pixels);
+}
+
+void test_task(void*) {
+  gfxInit();
+}
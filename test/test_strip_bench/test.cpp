@@ -0,0 +1,82 @@
+#include "gfx.h"
+#include "unity.h"
+#include "bench.h"
+#include "strip_renderer.h"
+#include <array>
+
+static StripRenderer strip;
+static std::array<GHandle, 5> widgets;
+static constexpr gCoord line_y = 10;
+
+/// @brief Create one line of widgets, like the mixer GUI does
+static void create_line() {
+  GWidgetInit wi;
+  gwinWidgetClearInit(&wi);
+  wi.g.show = gTrue;
+  wi.g.x = 10;
+  wi.g.y = line_y;
+  wi.g.height = 32;
+  wi.g.width = 32;
+  widgets[0] = gwinImageCreate(0, &wi.g);
+
+  wi.g.x += 40;
+  wi.text = "M";
+  widgets[1] = gwinButtonCreate(0, &wi);
+
+  wi.g.x += 40;
+  wi.text = "-";
+  widgets[2] = gwinButtonCreate(0, &wi);
+
+  wi.g.x += 40;
+  wi.g.width = gdispGetWidth() - 10 - 3 * 40 - 10 - 40;
+  wi.text = "Mute (45%)";
+  widgets[3] = gwinSliderCreate(0, &wi);
+  gwinSliderSetPosition(widgets[3], 45);
+
+  wi.text = "+";
+  wi.g.width = 32;
+  wi.g.x = gdispGetWidth() - 10 - 32;
+  widgets[4] = gwinButtonCreate(0, &wi);
+
+  for (auto w : widgets) {
+    gwinRedraw(w);
+  }
+}
+
+void test_line_direct() {
+  gdispResetPixelsWritten();
+  bench::Stopwatch sw;
+  for (auto w : widgets) {
+    gwinRedraw(w);
+  }
+  const uint32_t us = sw.us();
+  bench::report("direct line redraw", us, "us");
+  bench::report("direct line redraw", gdispGetPixelsWritten(), "px");
+}
+
+void test_line_strip() {
+  TEST_ASSERT_TRUE(strip.init(GDISP));
+
+  gdispResetPixelsWritten();
+  bench::Stopwatch sw;
+  strip.draw(line_y - (StripRenderer::HEIGHT - 32) / 2, widgets.data(), widgets.size());
+  const uint32_t us = sw.us();
+  bench::report("strip line redraw", us, "us");
+  bench::report("strip line redraw", gdispGetPixelsWritten(), "px");
+
+  // exactly one window of the strip size was written
+  TEST_ASSERT_EQUAL_UINT32(gdispGetWidth() * StripRenderer::HEIGHT, gdispGetPixelsWritten());
+}
+
+extern "C" void uGFXMain() {
+  gwinSetDefaultStyle(&BlackWidgetStyle, false);
+  gwinSetDefaultFont(gdispOpenFont("DejaVuSans12*"));
+  create_line();
+
+  RUN_TEST(test_line_direct);
+  RUN_TEST(test_line_strip);
+}
+
+void test_task(void*) {
+  gfxInit();
+}
@@ -0,0 +1,5 @@
+#include "task_stats.h"
+
+void test_task(void*) {
+  task_stats_tests();
+}
@@ -0,0 +1,137 @@
+#include "gfx.h"
+#include "unity.h"
+#include "bench.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <cstring>
+
+static constexpr const char* label = "Mute (45%)";
+static constexpr int repeats = 20;
+
+struct TextCost {
+  uint32_t us;
+  uint32_t pixels;
+};
+
+/// @brief Draw the label the way a widget does, @p repeats times
+/// @return cost of one draw
+static TextCost draw_label(gFont font, bool fill) {
+  gdispResetPixelsWritten();
+  bench::Stopwatch sw;
+  for (int i = 0; i < repeats; ++i) {
+    if (fill) {
+      gdispFillStringBox(10, 10, 200, 32, label, font, GFX_WHITE, GFX_BLUE, gJustifyCenter);
+    } else {
+      gdispDrawStringBox(10, 10, 200, 32, label, font, GFX_WHITE, gJustifyCenter);
+    }
+  }
+  return { sw.us() / repeats, gdispGetPixelsWritten() / repeats };
+}
+
+static void compare(const char* font_name, bool fill) {
+  gFont font = gdispOpenFont(font_name);
+  TEST_ASSERT_NOT_NULL(font);
+
+  gdispGlyphCacheEnable(gFalse);
+  const auto before = draw_label(font, fill);
+  gdispGlyphCacheEnable(gTrue);
+  draw_label(font, fill);  // fill the cache
+  const auto after = draw_label(font, fill);
+
+  char name[48];
+  snprintf(name, sizeof(name), "%s %s, uncached", font_name, fill ? "fill" : "draw");
+  bench::report(name, before.us, "us");
+  snprintf(name, sizeof(name), "%s %s, cached", font_name, fill ? "fill" : "draw");
+  bench::report(name, after.us, "us");
+
+  // the cache must not change what is drawn
+  TEST_ASSERT_EQUAL_UINT32(before.pixels, after.pixels);
+  gdispCloseFont(font);
+}
+
+void test_text_draw_12() {
+  compare("DejaVuSans12*", false);
+}
+
+void test_text_fill_12() {
+  compare("DejaVuSans12*", true);
+}
+
+void test_text_draw_24() {
+  compare("DejaVuSans24*", false);
+}
+
+void test_text_fill_24() {
+  compare("DejaVuSans24*", true);
+}
+
+static constexpr gCoord LABEL_W = 240;
+static constexpr gCoord LABEL_H = 20;
+static constexpr int THREAD_DRAWS = 3000;
+
+/// @brief A task, which fills its text into its own pixmap, like the GUI into the strip while GWIN redraws the screen
+struct Painter {
+  const char* text;
+  gFont font;
+  gColor color;
+  gColor bgcolor;
+  GDisplay* pixmap;
+  gPixel reference[LABEL_W * LABEL_H];  ///< drawn before, while nothing else draws
+  int mismatches;
+  volatile bool done;
+
+  void draw() {
+    gdispGFillStringBox(pixmap, 0, 0, LABEL_W, LABEL_H, text, font, color, bgcolor, gJustifyCenter);
+  }
+
+  static void task(void* param) {
+    auto& p = *static_cast<Painter*>(param);
+    for (int i = 0; i < THREAD_DRAWS; ++i) {
+      p.draw();
+      p.mismatches += 0 != memcmp(gdispPixmapGetBits(p.pixmap), p.reference, sizeof(p.reference));
+    }
+    p.done = true;
+    vTaskDelete(nullptr);
+  }
+};
+
+static Painter painters[2];
+
+/// @brief Two tasks draw text with different colors, the glyph cache and its blend table are shared
+/// @details Together, the texts have more glyphs than the cache, so it's refilled all the time
+void test_text_threads() {
+  const char* texts[2] = { "abcdefghijklmnopqrstuvwxyz", "ABCDEFGHIJKLMNOPQRSTUVWXYZ" };
+  gFont font = gdispOpenFont("DejaVuSans12*");
+  TEST_ASSERT_NOT_NULL(font);
+  const gColor colors[2][2] = { { GFX_WHITE, GFX_BLUE }, { GFX_YELLOW, GFX_RED } };
+  for (size_t i = 0; i < 2; ++i) {
+    Painter& p = painters[i];
+    p = Painter{ texts[i], font, colors[i][0], colors[i][1], gdispPixmapCreate(LABEL_W, LABEL_H) };
+    TEST_ASSERT_NOT_NULL(p.pixmap);
+    p.draw();
+    memcpy(p.reference, gdispPixmapGetBits(p.pixmap), sizeof(p.reference));
+  }
+  for (auto& p : painters) {
+    xTaskCreate(Painter::task, "painter", 256, &p, uxTaskPriorityGet(nullptr), nullptr);
+  }
+  while (not painters[0].done || not painters[1].done) {
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  for (auto& p : painters) {
+    TEST_ASSERT_EQUAL(0, p.mismatches);
+    gdispPixmapDelete(p.pixmap);
+  }
+  gdispCloseFont(font);
+}
+
+extern "C" void uGFXMain() {
+  RUN_TEST(test_text_draw_12);
+  RUN_TEST(test_text_fill_12);
+  RUN_TEST(test_text_draw_24);
+  RUN_TEST(test_text_fill_24);
+  RUN_TEST(test_text_threads);
+}
+
+void test_task(void*) {
+  gfxInit();
+}
@@ -0,0 +1,5 @@
+#include "touch_filter.h"
+
+void test_task(void*) {
+  touch_filter_tests();
+}
@@ -0,0 +1,136 @@
+/**
+ * @file test.cpp
+ * @brief Runs the ADS7843 touch driver against a simulated panel, and counts how often GINPUT wakes up
+ * @details Needs the ADS7843 driver in place of the Memory one, see env:native_ads7843. The simulated chip pulls
+ * PENIRQ low while the pen is down. The conversions disable PENIRQ and the last command of a reading enables it again,
+ * so every command of a reading can make a falling edge. The worst case, an edge on each of them, is simulated, and each
+ * edge calls ADS7843_PenIRQ() like the EXTI handler. MousePoll() only runs in the GTIMER thread, so its wakeups are
+ * counted in the RTOS trace, as the switches to the task with the priority of GTIMER.
+ */
+#include "gfx.h"
+#include "unity.h"
+#include "bench.h"
+#include "rtos_trace.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+static constexpr TickType_t IDLE = pdMS_TO_TICKS(3000);
+static constexpr TickType_t PRESS = pdMS_TO_TICKS(1000);
+static constexpr uint32_t POLLS = PRESS / pdMS_TO_TICKS(GINPUT_MOUSE_POLL_PERIOD);  ///< readings a press needs
+static constexpr uint32_t POLLS_MAX = POLLS + POLLS / 10 + 2;  ///< the ticks of the host are late sometimes
+
+extern "C" void ADS7843_PenIRQ(void);
+
+static volatile bool pen_down = false;
+static volatile uint32_t readings = 0;  ///< MouseXYZ() asks for the pen once
+static volatile uint32_t edges = 0;     ///< falling edges of PENIRQ
+
+static void penirq_edge() {
+  ++edges;
+  ADS7843_PenIRQ();
+}
+
+extern "C" {
+gBool TOUCH_init_board() {
+  return gTrue;
+}
+
+gBool TOUCH_getpin_pressed() {
+  ++readings;
+  return pen_down;
+}
+
+void TOUCH_aquire_bus() {
+}
+
+void TOUCH_release_bus() {
+}
+
+gU16 TOUCH_read_value(gU16 reg) {
+  if (pen_down) {
+    penirq_edge();
+  }
+  return reg == 0xD1 ? 2000 : 1800;
+}
+}
+
+/// @brief Sleep for @p ticks, and count the switches from another task to the GTIMER thread meanwhile
+/// @details The GTIMER thread yields before it waits, and it's switched in again right away, that isn't a wakeup
+static uint32_t gtimer_wakeups(TickType_t ticks) {
+  static rtos_trace_record_t records[64];
+  uint32_t wakeups = 0;
+  uint32_t lost = 0;
+  bool in_gtimer = false;
+  rtos_trace_clear();
+  const TickType_t start = xTaskGetTickCount();
+  do {
+    vTaskDelay(pdMS_TO_TICKS(20));  // well before the ring is full
+    while (const size_t n = rtos_trace_read(records, 64, &lost)) {
+      TEST_ASSERT_EQUAL(0, lost);
+      for (size_t i = 0; i < n; ++i) {
+        if (records[i].event != RTOS_TRACE_TASK_SWITCHED_IN) {
+          continue;
+        }
+        const bool gtimer = records[i].info == GTIMER_THREAD_PRIORITY;
+        wakeups += gtimer && not in_gtimer;
+        in_gtimer = gtimer;
+      }
+    }
+  } while (xTaskGetTickCount() - start < ticks);
+  return wakeups;
+}
+
+/// @brief Nothing is read, nothing wakes up
+static void check_idle(const char* name) {
+  readings = 0;
+  const uint32_t wakeups = gtimer_wakeups(IDLE);
+  bench::report(name, readings, "readings");
+  bench::report(name, wakeups, "GTIMER wakeups");
+  TEST_ASSERT_EQUAL(0, readings);
+  TEST_ASSERT_EQUAL(0, wakeups);
+}
+
+void test_pen_up() {
+  // the first reading after the start
+  gtimer_wakeups(pdMS_TO_TICKS(200));
+  check_idle("pen up");
+}
+
+void test_press() {
+  readings = 0;
+  edges = 0;
+  pen_down = true;
+  penirq_edge();
+  const uint32_t wakeups = gtimer_wakeups(PRESS);
+  const uint32_t pressed = readings;
+  GEventMouse ev;
+  TEST_ASSERT_TRUE(ginputGetMouseStatus(0, &ev));
+  TEST_ASSERT_TRUE(ev.buttons & GINPUT_MOUSE_BTN_LEFT);
+  pen_down = false;
+  // the readings, which see the release
+  gtimer_wakeups(pdMS_TO_TICKS(100));
+  TEST_ASSERT_TRUE(ginputGetMouseStatus(0, &ev));
+  TEST_ASSERT_FALSE(ev.buttons & GINPUT_MOUSE_BTN_LEFT);
+
+  bench::report("press", pressed, "readings");
+  bench::report("press", wakeups, "GTIMER wakeups");
+  bench::report("press", edges, "PENIRQ edges");
+  // read at the poll period, the edges of the driver's own conversions don't wake it up
+  TEST_ASSERT_GREATER_OR_EQUAL(POLLS / 2, pressed);
+  TEST_ASSERT_LESS_OR_EQUAL(POLLS_MAX, pressed);
+  TEST_ASSERT_LESS_OR_EQUAL(POLLS_MAX, wakeups);
+}
+
+void test_pen_up_after_press() {
+  check_idle("pen up after press");
+}
+
+extern "C" void uGFXMain() {
+  RUN_TEST(test_pen_up);
+  RUN_TEST(test_press);
+  RUN_TEST(test_pen_up_after_press);
+}
+
+void test_task(void*) {
+  gfxInit();
+}
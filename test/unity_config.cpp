@@ -1,12 +1,35 @@
 /**
  * @file unity_config.cpp
  * @brief unity test framework connector with board and with PC via UART2
+ * @details In host builds (env:native) the output goes to stdout
  */
 #include "unity_config.h"
 #include "STHAL.h"
 #include <unity.h>
-#include "comm_class.h"
-#include "CDC_Adaptor.h"
+
+#ifdef NATIVE
+  #include <cstdio>
+
+extern "C" {
+void unityOutputStart() {
+}
+
+void unityOutputChar(char c) {
+  putchar(c);
+}
+
+void unityOutputFlush() {
+  fflush(stdout);
+}
+
+void unityOutputComplete() {
+  fflush(stdout);
+}
+}
+
+#else
+  #include "comm_class.h"
+  #include "CDC_Adaptor.h"
 
 CommClass uart;
 
@@ -54,4 +77,6 @@ void unityOutputComplete() {
 
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
+
+#endif